@@ -1,12 +1,11 @@
 #include "BitcoinTransaction.h"
 
-#include <mbedtls/ecdsa.h>
-#include <mbedtls/md.h>
-#include <esp_random.h>
 #include <string.h>
 
+#include "BitcoinTransactionInternal.h"
 #include "CryptoPrimitives.h"
 #include "WalletAddresses.h"
+#include "WalletTrace.h"
 
 namespace hexwallet {
 namespace {
@@ -14,6 +13,7 @@ namespace {
 constexpr uint64_t kMaximumBitcoinSupply = 21000000ULL * 100000000ULL;
 constexpr uint32_t kSighashAll = 1;
 constexpr uint8_t kPsbtMagic[] = {'p', 's', 'b', 't', 0xff};
+constexpr size_t kBip44AccountDepth = 3;
 
 struct Cursor {
   const uint8_t *data;
@@ -186,32 +186,24 @@ TransactionError parse_unsigned_transaction(const uint8_t *data, size_t size,
   return cursor.position == cursor.size ? TransactionError::Ok : TransactionError::NonCanonical;
 }
 
-bool master_fingerprint(const HdPrivateNode &master, uint8_t out[4]) {
-  uint8_t public_key[kCompressedPublicKeySize];
-  uint8_t hash[kRipemd160Size];
-  const bool ok = public_key_from_private(master.private_key, public_key) == WalletError::Ok &&
-                  crypto_hash160(public_key, sizeof(public_key), hash);
-  if (ok) memcpy(out, hash, 4);
-  secure_zero(public_key, sizeof(public_key));
-  secure_zero(hash, sizeof(hash));
-  return ok;
-}
-
+// Returns the leaf expanded, so callers compare and hash its public key without
+// another scalar multiplication.
 WalletError derive_array_path(const HdPrivateNode &master, const uint32_t *path,
-                              size_t depth, HdPrivateNode *out) {
+                              size_t depth, HdExpandedPrivateNode *out) {
   if (path == nullptr || out == nullptr || depth == 0 || depth > kBitcoinMaxPathDepth) {
     return WalletError::InvalidPath;
   }
-  HdPrivateNode current = master;
-  for (size_t index = 0; index < depth; ++index) {
-    HdPrivateNode next;
-    const WalletError result = hd_private_derive(&current, path[index], &next);
-    secure_zero(&current, sizeof(current));
-    if (result != WalletError::Ok) return result;
+  HdExpandedPrivateNode current;
+  WalletError result = hd_private_expand(&master, &current);
+  for (size_t index = 0; result == WalletError::Ok && index < depth; ++index) {
+    HdExpandedPrivateNode next;
+    result = hd_private_derive_expanded(&current, path[index], &next);
     current = next;
+    secure_zero(&next, sizeof(next));
   }
-  *out = current;
-  return WalletError::Ok;
+  if (result == WalletError::Ok) *out = current;
+  secure_zero(&current, sizeof(current));
+  return result;
 }
 
 bool valid_bitcoin_single_sig_path(const uint32_t *path, size_t depth) {
@@ -229,15 +221,72 @@ bool path_matches_spend_type(const BitcoinInput &input) {
            input.path[0] == (49U | kHardenedOffset)));
 }
 
+// Per-request derivation state. The master is expanded once for its
+// fingerprint, and the last account node is kept so sibling paths under one
+// account only walk their change and index steps.
+struct DerivationContext {
+  HdExpandedPrivateNode master;
+  HdExpandedPrivateNode account;
+  uint32_t account_path[kBip44AccountDepth];
+  bool has_account;
+};
+
+WalletError prepare_derivation(const HdPrivateNode &master, DerivationContext *out) {
+  secure_zero(out, sizeof(*out));
+  return hd_private_expand(&master, &out->master);
+}
+
+// Paths have already passed valid_bitcoin_single_sig_path().
+WalletError derive_context_path(DerivationContext *context, const uint32_t *path,
+                                HdExpandedPrivateNode *out) {
+  WalletError result = WalletError::Ok;
+  if (!context->has_account ||
+      memcmp(context->account_path, path, sizeof(context->account_path)) != 0) {
+    context->has_account = false;
+    HdExpandedPrivateNode current = context->master;
+    for (size_t index = 0; result == WalletError::Ok && index < kBip44AccountDepth; ++index) {
+      HdExpandedPrivateNode next;
+      result = hd_private_derive_expanded(&current, path[index], &next);
+      current = next;
+      secure_zero(&next, sizeof(next));
+    }
+    if (result == WalletError::Ok) {
+      context->account = current;
+      memcpy(context->account_path, path, sizeof(context->account_path));
+      context->has_account = true;
+    }
+    secure_zero(&current, sizeof(current));
+    if (result != WalletError::Ok) return result;
+  }
+  HdExpandedPrivateNode change;
+  result = hd_private_derive_expanded(&context->account, path[kBip44AccountDepth], &change);
+  if (result == WalletError::Ok) {
+    result = hd_private_derive_expanded(&change, path[kBip44AccountDepth + 1], out);
+  }
+  secure_zero(&change, sizeof(change));
+  return result;
+}
+
+const BitcoinInputKey *find_input_key(const BitcoinSigningRequest &request,
+                                      const uint32_t *path, size_t depth) {
+  for (size_t index = 0; index < request.input_key_count && index < kBitcoinMaxInputs; ++index) {
+    const BitcoinInputKey &key = request.input_keys[index];
+    if (key.path_depth == depth && memcmp(key.path, path, depth * sizeof(uint32_t)) == 0) return &key;
+  }
+  return nullptr;
+}
+
 TransactionError parse_derivation(const uint8_t *key, size_t key_size,
                                   const uint8_t *value, size_t value_size,
-                                  const HdPrivateNode &master, BitcoinInput *input,
-                                  BitcoinOutput *output) {
+                                  DerivationContext *context, BitcoinSigningRequest *request,
+                                  BitcoinInput *input, BitcoinOutput *output) {
   if (key_size != 34 || value_size < 8 || (value_size - 4) % 4 != 0) return TransactionError::NonCanonical;
   const size_t depth = (value_size - 4) / 4;
   if (depth > kBitcoinMaxPathDepth) return TransactionError::TooLarge;
   uint8_t expected_fingerprint[4];
-  if (!master_fingerprint(master, expected_fingerprint)) return TransactionError::CryptoFailure;
+  for (size_t index = 0; index < sizeof(expected_fingerprint); ++index) {
+    expected_fingerprint[index] = static_cast<uint8_t>(context->master.fingerprint >> (24 - index * 8));
+  }
   const bool fingerprint_ok = crypto_constant_time_equal(value, expected_fingerprint, 4);
   secure_zero(expected_fingerprint, sizeof(expected_fingerprint));
   if (!fingerprint_ok) return TransactionError::WrongWallet;
@@ -248,15 +297,31 @@ TransactionError parse_derivation(const uint8_t *key, size_t key_size,
                   (static_cast<uint32_t>(part[2]) << 16) | (static_cast<uint32_t>(part[3]) << 24);
   }
   if (!valid_bitcoin_single_sig_path(path, depth)) return TransactionError::Unsupported;
-  HdPrivateNode derived;
   uint8_t public_key[kCompressedPublicKeySize];
-  const WalletError derive_result = derive_array_path(master, path, depth, &derived);
-  const bool public_ok = derive_result == WalletError::Ok &&
-                         public_key_from_private(derived.private_key, public_key) == WalletError::Ok;
-  secure_zero(&derived, sizeof(derived));
-  if (!public_ok) {
-    secure_zero(public_key, sizeof(public_key));
-    return TransactionError::CryptoFailure;
+  const BitcoinInputKey *known = find_input_key(*request, path, depth);
+  if (known != nullptr) {
+    memcpy(public_key, known->public_key, sizeof(public_key));
+  } else {
+    HdExpandedPrivateNode derived;
+    const bool public_ok = derive_context_path(context, path, &derived) == WalletError::Ok;
+    if (public_ok) memcpy(public_key, derived.public_key, sizeof(public_key));
+    if (public_ok && input != nullptr) {
+      if (request->input_key_count >= kBitcoinMaxInputs) {
+        secure_zero(&derived, sizeof(derived));
+        secure_zero(public_key, sizeof(public_key));
+        return TransactionError::TooLarge;
+      }
+      BitcoinInputKey &entry = request->input_keys[request->input_key_count++];
+      memcpy(entry.path, path, sizeof(entry.path));
+      entry.path_depth = static_cast<uint8_t>(depth);
+      memcpy(entry.private_key, derived.node.private_key, sizeof(entry.private_key));
+      memcpy(entry.public_key, derived.public_key, sizeof(entry.public_key));
+    }
+    secure_zero(&derived, sizeof(derived));
+    if (!public_ok) {
+      secure_zero(public_key, sizeof(public_key));
+      return TransactionError::CryptoFailure;
+    }
   }
   const bool key_ok = crypto_constant_time_equal(key + 1, public_key, sizeof(public_key));
   if (input != nullptr) {
@@ -294,7 +359,8 @@ TransactionError parse_derivation(const uint8_t *key, size_t key_size,
   return key_ok ? TransactionError::Ok : TransactionError::WrongWallet;
 }
 
-TransactionError parse_input_map(Cursor *cursor, const HdPrivateNode &master, BitcoinInput *input) {
+TransactionError parse_input_map(Cursor *cursor, DerivationContext *context,
+                                 BitcoinSigningRequest *request, BitcoinInput *input) {
   bool has_utxo = false;
   bool has_derivation = false;
   bool has_sighash = false;
@@ -350,7 +416,7 @@ TransactionError parse_input_map(Cursor *cursor, const HdPrivateNode &master, Bi
       has_utxo = true;
     } else if (key_size == 34 && key[0] == 0x06) {
       if (has_derivation) return TransactionError::DuplicateField;
-      result = parse_derivation(key, key_size, value, value_size, master, input, nullptr);
+      result = parse_derivation(key, key_size, value, value_size, context, request, input, nullptr);
       if (result != TransactionError::Ok) return result;
       has_derivation = true;
     } else if (key_size == 1 && key[0] == 0x03) {
@@ -382,7 +448,8 @@ TransactionError verify_input_script(BitcoinInput *input) {
   return matches ? TransactionError::Ok : TransactionError::WrongWallet;
 }
 
-TransactionError parse_output_map(Cursor *cursor, const HdPrivateNode &master, BitcoinOutput *output) {
+TransactionError parse_output_map(Cursor *cursor, DerivationContext *context,
+                                  BitcoinSigningRequest *request, BitcoinOutput *output) {
   bool has_derivation = false;
   while (true) {
     const uint8_t *key;
@@ -394,7 +461,7 @@ TransactionError parse_output_map(Cursor *cursor, const HdPrivateNode &master, B
     if (result != TransactionError::Ok || end) return result;
     if (key_size == 34 && key[0] == 0x02) {
       if (has_derivation) return TransactionError::DuplicateField;
-      result = parse_derivation(key, key_size, value, value_size, master, nullptr, output);
+      result = parse_derivation(key, key_size, value, value_size, context, request, nullptr, output);
       if (result != TransactionError::Ok) return result;
       has_derivation = true;
     } else {
@@ -414,8 +481,7 @@ bool serialize_outputs(const BitcoinSigningRequest &request, uint8_t *out, size_
   return true;
 }
 
-TransactionError bip143_digest(const BitcoinSigningRequest &request, size_t input_index,
-                               uint8_t out[kSha256Size]) {
+TransactionError bip143_prepare(const BitcoinSigningRequest &request, Bip143Cache *out) {
   uint8_t prevouts[kBitcoinMaxInputs * 36];
   uint8_t sequences[kBitcoinMaxInputs * 4];
   uint8_t outputs[kBitcoinMaxOutputs * (8 + 1 + kBitcoinMaxScriptSize)];
@@ -428,12 +494,19 @@ TransactionError bip143_digest(const BitcoinSigningRequest &request, size_t inpu
   }
   size_t outputs_size;
   if (!serialize_outputs(request, outputs, sizeof(outputs), &outputs_size)) return TransactionError::BufferTooSmall;
-  uint8_t hash_prevouts[kSha256Size];
-  uint8_t hash_sequences[kSha256Size];
-  uint8_t hash_outputs[kSha256Size];
-  if (!crypto_double_sha256(prevouts, prevout_writer.position, hash_prevouts) ||
-      !crypto_double_sha256(sequences, sequence_writer.position, hash_sequences) ||
-      !crypto_double_sha256(outputs, outputs_size, hash_outputs)) return TransactionError::CryptoFailure;
+  const bool hashed = crypto_double_sha256(prevouts, prevout_writer.position, out->hash_prevouts) &&
+                      crypto_double_sha256(sequences, sequence_writer.position, out->hash_sequences) &&
+                      crypto_double_sha256(outputs, outputs_size, out->hash_outputs);
+  secure_zero(prevouts, sizeof(prevouts));
+  secure_zero(sequences, sizeof(sequences));
+  secure_zero(outputs, sizeof(outputs));
+  if (!hashed) secure_zero(out, sizeof(*out));
+  return hashed ? TransactionError::Ok : TransactionError::CryptoFailure;
+}
+
+TransactionError bip143_digest(const BitcoinSigningRequest &request, const Bip143Cache &cache,
+                               size_t input_index, uint8_t out[kSha256Size]) {
+  HEXWALLET_TRACE_SCOPE(Bip143Digest);
   const BitcoinInput &input = request.inputs[input_index];
   uint8_t key_hash[kRipemd160Size];
   if (!crypto_hash160(input.public_key, sizeof(input.public_key), key_hash)) return TransactionError::CryptoFailure;
@@ -442,91 +515,163 @@ TransactionError bip143_digest(const BitcoinSigningRequest &request, size_t inpu
   const uint8_t script_prefix[] = {0x19, 0x76, 0xa9, 0x14};
   const uint8_t script_suffix[] = {0x88, 0xac};
   const bool serialized = write_u32(&writer, request.version) &&
-      write_bytes(&writer, hash_prevouts, sizeof(hash_prevouts)) &&
-      write_bytes(&writer, hash_sequences, sizeof(hash_sequences)) &&
+      write_bytes(&writer, cache.hash_prevouts, sizeof(cache.hash_prevouts)) &&
+      write_bytes(&writer, cache.hash_sequences, sizeof(cache.hash_sequences)) &&
       write_bytes(&writer, input.previous_txid, sizeof(input.previous_txid)) &&
       write_u32(&writer, input.previous_index) && write_bytes(&writer, script_prefix, sizeof(script_prefix)) &&
       write_bytes(&writer, key_hash, sizeof(key_hash)) && write_bytes(&writer, script_suffix, sizeof(script_suffix)) &&
       write_u64(&writer, input.value) && write_u32(&writer, input.sequence) &&
-      write_bytes(&writer, hash_outputs, sizeof(hash_outputs)) && write_u32(&writer, request.lock_time) &&
+      write_bytes(&writer, cache.hash_outputs, sizeof(cache.hash_outputs)) && write_u32(&writer, request.lock_time) &&
       write_u32(&writer, kSighashAll);
   const bool hashed = serialized && crypto_double_sha256(preimage, writer.position, out);
-  secure_zero(prevouts, sizeof(prevouts));
-  secure_zero(sequences, sizeof(sequences));
-  secure_zero(outputs, sizeof(outputs));
-  secure_zero(hash_prevouts, sizeof(hash_prevouts));
-  secure_zero(hash_sequences, sizeof(hash_sequences));
-  secure_zero(hash_outputs, sizeof(hash_outputs));
   secure_zero(key_hash, sizeof(key_hash));
   secure_zero(preimage, sizeof(preimage));
   return hashed ? TransactionError::Ok : TransactionError::CryptoFailure;
 }
 
-int random_callback(void *, unsigned char *output, size_t length) {
-  esp_fill_random(output, length);
-  return 0;
-}
-
-size_t der_integer(const mbedtls_mpi &value, uint8_t *out) {
-  uint8_t raw[32];
-  mbedtls_mpi_write_binary(&value, raw, sizeof(raw));
+size_t der_integer(const uint8_t value[kPrivateKeySize], uint8_t *out) {
   size_t first = 0;
-  while (first + 1 < sizeof(raw) && raw[first] == 0) ++first;
-  const bool prefix_zero = (raw[first] & 0x80) != 0;
-  const size_t length = sizeof(raw) - first + (prefix_zero ? 1 : 0);
+  while (first + 1 < kPrivateKeySize && value[first] == 0) ++first;
+  const bool prefix_zero = (value[first] & 0x80) != 0;
+  const size_t length = kPrivateKeySize - first + (prefix_zero ? 1 : 0);
   out[0] = 0x02;
   out[1] = static_cast<uint8_t>(length);
   size_t position = 2;
   if (prefix_zero) out[position++] = 0;
-  memcpy(out + position, raw + first, sizeof(raw) - first);
-  secure_zero(raw, sizeof(raw));
+  memcpy(out + position, value + first, kPrivateKeySize - first);
   return 2 + length;
 }
 
+// Low-S RFC 6979 signing with the post-sign verification lives in
+// secp256k1_sign_digest_recoverable; this only adds the DER encoding.
 TransactionError sign_digest(const uint8_t private_key[kPrivateKeySize],
                              const uint8_t digest[kSha256Size], uint8_t *der, size_t *der_size) {
-  mbedtls_ecp_group group;
-  mbedtls_mpi d;
-  mbedtls_mpi r;
-  mbedtls_mpi s;
-  mbedtls_mpi half_order;
-  mbedtls_ecp_point public_key;
-  mbedtls_ecp_group_init(&group);
-  mbedtls_mpi_init(&d);
-  mbedtls_mpi_init(&r);
-  mbedtls_mpi_init(&s);
-  mbedtls_mpi_init(&half_order);
-  mbedtls_ecp_point_init(&public_key);
-  int result = mbedtls_ecp_group_load(&group, MBEDTLS_ECP_DP_SECP256K1);
-  if (result == 0) result = mbedtls_mpi_read_binary(&d, private_key, kPrivateKeySize);
-  if (result == 0) result = mbedtls_ecdsa_sign_det_ext(&group, &r, &s, &d, digest, kSha256Size,
-                                                       MBEDTLS_MD_SHA256, random_callback, nullptr);
-  if (result == 0) result = mbedtls_mpi_copy(&half_order, &group.N);
-  if (result == 0) result = mbedtls_mpi_shift_r(&half_order, 1);
-  if (result == 0 && mbedtls_mpi_cmp_mpi(&s, &half_order) > 0) result = mbedtls_mpi_sub_mpi(&s, &group.N, &s);
-  if (result == 0) result = mbedtls_ecp_mul(&group, &public_key, &d, &group.G, random_callback, nullptr);
-  if (result == 0) result = mbedtls_ecdsa_verify(&group, digest, kSha256Size, &public_key, &r, &s);
+  RecoverableSignature signature;
+  bool ok = secp256k1_sign_digest_recoverable(private_key, digest, &signature) == WalletError::Ok;
   uint8_t integers[70];
   size_t integer_size = 0;
-  if (result == 0) {
-    integer_size = der_integer(r, integers);
-    integer_size += der_integer(s, integers + integer_size);
-    if (*der_size < integer_size + 2) result = -1;
+  if (ok) {
+    integer_size = der_integer(signature.r, integers);
+    integer_size += der_integer(signature.s, integers + integer_size);
+    ok = *der_size >= integer_size + 2;
   }
-  if (result == 0) {
+  if (ok) {
     der[0] = 0x30;
     der[1] = static_cast<uint8_t>(integer_size);
     memcpy(der + 2, integers, integer_size);
     *der_size = integer_size + 2;
   }
   secure_zero(integers, sizeof(integers));
-  mbedtls_mpi_free(&half_order);
-  mbedtls_ecp_point_free(&public_key);
-  mbedtls_mpi_free(&s);
-  mbedtls_mpi_free(&r);
-  mbedtls_mpi_free(&d);
-  mbedtls_ecp_group_free(&group);
-  return result == 0 ? TransactionError::Ok : TransactionError::CryptoFailure;
+  secure_zero(&signature, sizeof(signature));
+  return ok ? TransactionError::Ok : TransactionError::CryptoFailure;
+}
+
+// The parse-time keys may only sign for the master they were derived from;
+// after a wallet switch every input key is walked from the new master.
+bool keys_from_master(const BitcoinSigningRequest &request, const HdPrivateNode &master) {
+  if (request.input_key_count == 0) return false;
+  HdExpandedPrivateNode expanded;
+  const bool expanded_ok = hd_private_expand(&master, &expanded) == WalletError::Ok;
+  uint8_t fingerprint[4];
+  uint8_t expected_fingerprint[4];
+  for (size_t index = 0; index < sizeof(fingerprint); ++index) {
+    fingerprint[index] = static_cast<uint8_t>(expanded.fingerprint >> (24 - index * 8));
+    expected_fingerprint[index] = static_cast<uint8_t>(request.key_master_fingerprint >> (24 - index * 8));
+  }
+  const bool matches = expanded_ok &&
+      crypto_constant_time_equal(fingerprint, expected_fingerprint, sizeof(fingerprint)) &&
+      crypto_constant_time_equal(expanded.node.chain_code, request.key_master_chain_code,
+                                 sizeof(request.key_master_chain_code));
+  secure_zero(&expanded, sizeof(expanded));
+  secure_zero(fingerprint, sizeof(fingerprint));
+  secure_zero(expected_fingerprint, sizeof(expected_fingerprint));
+  return matches;
+}
+
+// Resolves the input key from the parse-time table when cached_keys is set,
+// otherwise by a path walk from master, and writes the DER signature followed
+// by the sighash byte.
+TransactionError sign_input(const BitcoinSigningRequest &request, const HdPrivateNode &master,
+                            bool cached_keys, size_t input_index, const uint8_t digest[kSha256Size],
+                            uint8_t *out_signature, size_t *in_out_size) {
+  if (input_index >= request.input_count || out_signature == nullptr || in_out_size == nullptr ||
+      *in_out_size < 2) return TransactionError::InvalidArgument;
+  const BitcoinInput &input = request.inputs[input_index];
+  const BitcoinInputKey *known =
+      cached_keys ? find_input_key(request, input.path, input.path_depth) : nullptr;
+  HdExpandedPrivateNode derived;
+  if (known != nullptr) {
+    memcpy(derived.node.private_key, known->private_key, sizeof(derived.node.private_key));
+    memcpy(derived.public_key, known->public_key, sizeof(derived.public_key));
+  } else if (derive_array_path(master, input.path, input.path_depth, &derived) != WalletError::Ok) {
+    return TransactionError::WrongWallet;
+  }
+  const bool key_matches = crypto_constant_time_equal(derived.public_key, input.public_key,
+                                                      sizeof(derived.public_key));
+  size_t der_size = *in_out_size - 1;
+  const TransactionError result = key_matches
+      ? sign_digest(derived.node.private_key, digest, out_signature, &der_size)
+      : TransactionError::WrongWallet;
+  secure_zero(&derived, sizeof(derived));
+  if (result != TransactionError::Ok) return result;
+  out_signature[der_size] = static_cast<uint8_t>(kSighashAll);
+  *in_out_size = der_size + 1;
+  return TransactionError::Ok;
+}
+
+TransactionError sign_inputs(const BitcoinSigningRequest &request, const HdPrivateNode &master,
+                             const uint8_t digests[][kSha256Size],
+                             uint8_t signatures[][kBitcoinMaxDerSignatureSize],
+                             uint8_t signature_sizes[]) {
+  const bool cached_keys = keys_from_master(request, master);
+  TransactionError result = TransactionError::Ok;
+  for (size_t index = 0; result == TransactionError::Ok && index < request.input_count; ++index) {
+    size_t signature_size = kBitcoinMaxDerSignatureSize;
+    result = sign_input(request, master, cached_keys, index, digests[index], signatures[index],
+                        &signature_size);
+    signature_sizes[index] = static_cast<uint8_t>(signature_size);
+  }
+  return result;
+}
+
+TransactionError write_witness_transaction(
+    const BitcoinSigningRequest &request, const uint8_t signatures[][kBitcoinMaxDerSignatureSize],
+    const uint8_t signature_sizes[], uint8_t *out_transaction, size_t *in_out_size) {
+  if (out_transaction == nullptr || in_out_size == nullptr) return TransactionError::InvalidArgument;
+  Writer writer = {out_transaction, *in_out_size, 0};
+  const uint8_t marker_flag[] = {0, 1};
+  bool ok = write_u32(&writer, request.version) && write_bytes(&writer, marker_flag, sizeof(marker_flag)) &&
+            write_compact_size(&writer, request.input_count);
+  for (size_t index = 0; ok && index < request.input_count; ++index) {
+    const BitcoinInput &input = request.inputs[index];
+    uint8_t redeem_script[22] = {0, 20};
+    const uint8_t push_redeem = sizeof(redeem_script);
+    memcpy(redeem_script + 2, input.witness_key_hash, sizeof(input.witness_key_hash));
+    const bool nested = input.spend_type == BitcoinSpendType::NestedP2shP2wpkh;
+    ok = write_bytes(&writer, input.previous_txid, sizeof(input.previous_txid)) &&
+         write_u32(&writer, input.previous_index) &&
+         write_compact_size(&writer, nested ? sizeof(redeem_script) + 1 : 0) &&
+         (!nested || (write_bytes(&writer, &push_redeem, sizeof(push_redeem)) &&
+                      write_bytes(&writer, redeem_script, sizeof(redeem_script)))) &&
+         write_u32(&writer, input.sequence);
+    secure_zero(redeem_script, sizeof(redeem_script));
+  }
+  ok = ok && write_compact_size(&writer, request.output_count);
+  for (size_t index = 0; ok && index < request.output_count; ++index) {
+    const BitcoinOutput &output = request.outputs[index];
+    ok = write_u64(&writer, output.value) && write_compact_size(&writer, output.script_size) &&
+         write_bytes(&writer, output.script, output.script_size);
+  }
+  for (size_t index = 0; ok && index < request.input_count; ++index) {
+    ok = write_compact_size(&writer, 2) && write_compact_size(&writer, signature_sizes[index]) &&
+         write_bytes(&writer, signatures[index], signature_sizes[index]) &&
+         write_compact_size(&writer, sizeof(request.inputs[index].public_key)) &&
+         write_bytes(&writer, request.inputs[index].public_key, sizeof(request.inputs[index].public_key));
+  }
+  ok = ok && write_u32(&writer, request.lock_time);
+  if (!ok) return TransactionError::BufferTooSmall;
+  *in_out_size = writer.position;
+  return TransactionError::Ok;
 }
 
 uint32_t stripped_size(const BitcoinSigningRequest &request) {
@@ -541,14 +686,8 @@ uint32_t stripped_size(const BitcoinSigningRequest &request) {
   return size;
 }
 
-}
-
-TransactionError bitcoin_parse_psbt(const uint8_t *psbt, size_t psbt_size,
-                                    const HdPrivateNode &master, BitcoinSigningRequest *out) {
-  if (psbt == nullptr || out == nullptr || psbt_size < sizeof(kPsbtMagic) ||
-      psbt_size > HEXWALLET_MAX_PSBT_BYTES) return TransactionError::InvalidArgument;
-  BitcoinSigningRequest parsed;
-  clear_bitcoin_request(&parsed);
+TransactionError parse_psbt(const uint8_t *psbt, size_t psbt_size, DerivationContext *context,
+                            BitcoinSigningRequest &parsed) {
   Cursor cursor = {psbt, psbt_size, 0};
   const uint8_t *magic;
   if (!read_bytes(&cursor, sizeof(kPsbtMagic), &magic) || memcmp(magic, kPsbtMagic, sizeof(kPsbtMagic)) != 0) {
@@ -572,14 +711,14 @@ TransactionError bitcoin_parse_psbt(const uint8_t *psbt, size_t psbt_size,
   }
   if (!has_unsigned_tx) return TransactionError::MissingField;
   for (size_t index = 0; index < parsed.input_count; ++index) {
-    TransactionError result = parse_input_map(&cursor, master, &parsed.inputs[index]);
+    TransactionError result = parse_input_map(&cursor, context, &parsed, &parsed.inputs[index]);
     if (result != TransactionError::Ok) return result;
     result = verify_input_script(&parsed.inputs[index]);
     if (result != TransactionError::Ok) return result;
     if (!add_u64(parsed.input_total, parsed.inputs[index].value, &parsed.input_total)) return TransactionError::InvalidAmount;
   }
   for (size_t index = 0; index < parsed.output_count; ++index) {
-    const TransactionError result = parse_output_map(&cursor, master, &parsed.outputs[index]);
+    const TransactionError result = parse_output_map(&cursor, context, &parsed, &parsed.outputs[index]);
     if (result != TransactionError::Ok) return result;
   }
   if (cursor.position != cursor.size) return TransactionError::NonCanonical;
@@ -592,9 +731,32 @@ TransactionError bitcoin_parse_psbt(const uint8_t *psbt, size_t psbt_size,
       parsed.fee > HEXWALLET_MAX_BITCOIN_FEE_RATE * static_cast<uint64_t>(parsed.estimated_vbytes)) {
     return TransactionError::FeePolicy;
   }
-  if (!crypto_sha256(psbt, psbt_size, parsed.psbt_hash)) return TransactionError::CryptoFailure;
-  *out = parsed;
-  return TransactionError::Ok;
+  return crypto_sha256(psbt, psbt_size, parsed.psbt_hash) ? TransactionError::Ok
+                                                          : TransactionError::CryptoFailure;
+}
+
+}
+
+// Parses straight into out, which then holds the input signing keys; a failed
+// parse clears it so no partial table outlives the call.
+TransactionError bitcoin_parse_psbt(const uint8_t *psbt, size_t psbt_size,
+                                    const HdPrivateNode &master, BitcoinSigningRequest *out) {
+  if (psbt == nullptr || out == nullptr || psbt_size < sizeof(kPsbtMagic) ||
+      psbt_size > HEXWALLET_MAX_PSBT_BYTES) return TransactionError::InvalidArgument;
+  HEXWALLET_TRACE_SCOPE(BitcoinParsePsbt);
+  clear_bitcoin_request(out);
+  DerivationContext context;
+  TransactionError result = prepare_derivation(master, &context) == WalletError::Ok
+                                ? TransactionError::Ok : TransactionError::CryptoFailure;
+  if (result == TransactionError::Ok) result = parse_psbt(psbt, psbt_size, &context, *out);
+  if (result == TransactionError::Ok) {
+    out->key_master_fingerprint = context.master.fingerprint;
+    memcpy(out->key_master_chain_code, context.master.node.chain_code,
+           sizeof(out->key_master_chain_code));
+  }
+  secure_zero(&context, sizeof(context));
+  if (result != TransactionError::Ok) clear_bitcoin_request(out);
+  return result;
 }
 
 TransactionError bitcoin_sign_request(const BitcoinSigningRequest &request,
@@ -645,73 +807,56 @@ TransactionError bitcoin_sign_request(const BitcoinSigningRequest &request,
       request.fee > HEXWALLET_MAX_BITCOIN_FEE_RATE * static_cast<uint64_t>(request.estimated_vbytes)) {
     return TransactionError::FeePolicy;
   }
+  Bip143Cache sighash_cache;
+  TransactionError result = bip143_prepare(request, &sighash_cache);
+  uint8_t digests[kBitcoinMaxInputs][kSha256Size];
+  for (size_t index = 0; result == TransactionError::Ok && index < request.input_count; ++index) {
+    result = bip143_digest(request, sighash_cache, index, digests[index]);
+  }
+  secure_zero(&sighash_cache, sizeof(sighash_cache));
   uint8_t signatures[kBitcoinMaxInputs][kBitcoinMaxDerSignatureSize];
   uint8_t signature_sizes[kBitcoinMaxInputs] = {};
-  for (size_t index = 0; index < request.input_count; ++index) {
-    HdPrivateNode derived;
-    if (derive_array_path(master, request.inputs[index].path, request.inputs[index].path_depth, &derived) != WalletError::Ok) {
-      secure_zero(signatures, sizeof(signatures));
-      return TransactionError::WrongWallet;
-    }
-    uint8_t public_key[kCompressedPublicKeySize];
-    const bool key_matches = public_key_from_private(derived.private_key, public_key) == WalletError::Ok &&
-        crypto_constant_time_equal(public_key, request.inputs[index].public_key, sizeof(public_key));
-    secure_zero(public_key, sizeof(public_key));
-    if (!key_matches) {
-      secure_zero(&derived, sizeof(derived));
-      secure_zero(signatures, sizeof(signatures));
-      return TransactionError::WrongWallet;
-    }
-    uint8_t digest[kSha256Size];
-    TransactionError result = bip143_digest(request, index, digest);
-    size_t der_size = sizeof(signatures[index]) - 1;
-    if (result == TransactionError::Ok) result = sign_digest(derived.private_key, digest, signatures[index], &der_size);
-    secure_zero(&derived, sizeof(derived));
-    secure_zero(digest, sizeof(digest));
-    if (result != TransactionError::Ok || der_size + 1 > sizeof(signatures[index])) {
-      secure_zero(signatures, sizeof(signatures));
-      return result == TransactionError::Ok ? TransactionError::BufferTooSmall : result;
-    }
-    signatures[index][der_size] = static_cast<uint8_t>(kSighashAll);
-    signature_sizes[index] = static_cast<uint8_t>(der_size + 1);
-  }
-  Writer writer = {out_transaction, *in_out_size, 0};
-  const uint8_t marker_flag[] = {0, 1};
-  bool ok = write_u32(&writer, request.version) && write_bytes(&writer, marker_flag, sizeof(marker_flag)) &&
-            write_compact_size(&writer, request.input_count);
-  for (size_t index = 0; ok && index < request.input_count; ++index) {
-    const BitcoinInput &input = request.inputs[index];
-    uint8_t redeem_script[22] = {0, 20};
-    const uint8_t push_redeem = sizeof(redeem_script);
-    memcpy(redeem_script + 2, input.witness_key_hash, sizeof(input.witness_key_hash));
-    const bool nested = input.spend_type == BitcoinSpendType::NestedP2shP2wpkh;
-    ok = write_bytes(&writer, input.previous_txid, sizeof(input.previous_txid)) &&
-         write_u32(&writer, input.previous_index) &&
-         write_compact_size(&writer, nested ? sizeof(redeem_script) + 1 : 0) &&
-         (!nested || (write_bytes(&writer, &push_redeem, sizeof(push_redeem)) &&
-                      write_bytes(&writer, redeem_script, sizeof(redeem_script)))) &&
-         write_u32(&writer, input.sequence);
-    secure_zero(redeem_script, sizeof(redeem_script));
+  if (result == TransactionError::Ok) {
+    result = sign_inputs(request, master, digests, signatures, signature_sizes);
   }
-  ok = ok && write_compact_size(&writer, request.output_count);
-  for (size_t index = 0; ok && index < request.output_count; ++index) {
-    const BitcoinOutput &output = request.outputs[index];
-    ok = write_u64(&writer, output.value) && write_compact_size(&writer, output.script_size) &&
-         write_bytes(&writer, output.script, output.script_size);
+  secure_zero(digests, sizeof(digests));
+  if (result == TransactionError::Ok) {
+    result = write_witness_transaction(request, signatures, signature_sizes, out_transaction,
+                                       in_out_size);
   }
-  for (size_t index = 0; ok && index < request.input_count; ++index) {
-    ok = write_compact_size(&writer, 2) && write_compact_size(&writer, signature_sizes[index]) &&
-         write_bytes(&writer, signatures[index], signature_sizes[index]) &&
-         write_compact_size(&writer, sizeof(request.inputs[index].public_key)) &&
-         write_bytes(&writer, request.inputs[index].public_key, sizeof(request.inputs[index].public_key));
-  }
-  ok = ok && write_u32(&writer, request.lock_time);
   secure_zero(signatures, sizeof(signatures));
-  if (!ok) return TransactionError::BufferTooSmall;
-  *in_out_size = writer.position;
-  return TransactionError::Ok;
+  return result;
+}
+
+#if HEXWALLET_BENCH_STAGES
+namespace bitcoin_stages {
+
+TransactionError bip143_prepare(const BitcoinSigningRequest &request, Bip143Cache *out) {
+  return hexwallet::bip143_prepare(request, out);
+}
+
+TransactionError bip143_digest(const BitcoinSigningRequest &request, const Bip143Cache &cache,
+                               size_t input_index, uint8_t out[kSha256Size]) {
+  return hexwallet::bip143_digest(request, cache, input_index, out);
+}
+
+TransactionError sign_inputs(const BitcoinSigningRequest &request, const HdPrivateNode &master,
+                             const uint8_t digests[][kSha256Size],
+                             uint8_t signatures[][kBitcoinMaxDerSignatureSize],
+                             uint8_t signature_sizes[]) {
+  return hexwallet::sign_inputs(request, master, digests, signatures, signature_sizes);
+}
+
+TransactionError write_witness_transaction(
+    const BitcoinSigningRequest &request, const uint8_t signatures[][kBitcoinMaxDerSignatureSize],
+    const uint8_t signature_sizes[], uint8_t *out_transaction, size_t *in_out_size) {
+  return hexwallet::write_witness_transaction(request, signatures, signature_sizes,
+                                              out_transaction, in_out_size);
 }
 
+}  // namespace bitcoin_stages
+#endif
+
 const char *transaction_error_text(TransactionError error) {
   switch (error) {
     case TransactionError::Ok: return "ok";
@@ -762,14 +907,17 @@ bool run_bitcoin_transaction_self_test() {
   const uint8_t expected[32] = {0xc3,0x7a,0xf3,0x11,0x16,0xd1,0xb2,0x7c,0xaf,0x68,0xaa,0xe9,0xe3,0xac,0x82,0xf1,0x47,0x79,0x29,0x01,0x4d,0x5b,0x91,0x76,0x57,0xd0,0xeb,0x49,0x47,0x8c,0xb6,0x70};
   const uint8_t private_key[32] = {0x61,0x9c,0x33,0x50,0x25,0xc7,0xf4,0x01,0x2e,0x55,0x6c,0x2a,0x58,0xb2,0x50,0x6e,0x30,0xb8,0x51,0x1b,0x53,0xad,0xe9,0x5e,0xa3,0x16,0xfd,0x8c,0x32,0x86,0xfe,0xb9};
   const uint8_t expected_signature[70] = {0x30,0x44,0x02,0x20,0x36,0x09,0xe1,0x7b,0x84,0xf6,0xa7,0xd3,0x0c,0x80,0xbf,0xa6,0x10,0xb5,0xb4,0x54,0x2f,0x32,0xa8,0xa0,0xd5,0x44,0x7a,0x12,0xfb,0x13,0x66,0xd7,0xf0,0x1c,0xc4,0x4a,0x02,0x20,0x57,0x3a,0x95,0x4c,0x45,0x18,0x33,0x15,0x61,0x40,0x6f,0x90,0x30,0x0e,0x8f,0x33,0x58,0xf5,0x19,0x28,0xd4,0x3c,0x21,0x2a,0x8c,0xae,0xd0,0x2d,0xe6,0x7e,0xeb,0xee};
+  Bip143Cache sighash_cache;
   uint8_t digest[kSha256Size];
   uint8_t signature[kBitcoinMaxDerSignatureSize];
   size_t signature_size = sizeof(signature);
-  bool passed = bip143_digest(request, 1, digest) == TransactionError::Ok &&
+  bool passed = bip143_prepare(request, &sighash_cache) == TransactionError::Ok &&
+                bip143_digest(request, sighash_cache, 1, digest) == TransactionError::Ok &&
                 crypto_constant_time_equal(digest, expected, sizeof(expected)) &&
                 sign_digest(private_key, digest, signature, &signature_size) == TransactionError::Ok &&
                 signature_size == sizeof(expected_signature) &&
                 crypto_constant_time_equal(signature, expected_signature, sizeof(expected_signature));
+  secure_zero(&sighash_cache, sizeof(sighash_cache));
   secure_zero(digest, sizeof(digest));
   secure_zero(signature, sizeof(signature));
   clear_bitcoin_request(&request);
@@ -780,8 +928,8 @@ bool run_bitcoin_transaction_self_test() {
   const uint32_t output_path[5] = {49U | kHardenedOffset, kHardenedOffset,
                                    kHardenedOffset, 1, 0};
   HdPrivateNode master;
-  HdPrivateNode input_node;
-  HdPrivateNode output_node;
+  HdExpandedPrivateNode input_node;
+  HdExpandedPrivateNode output_node;
   uint8_t input_public[kCompressedPublicKeySize];
   uint8_t output_public[kCompressedPublicKeySize];
   uint8_t input_redeem[22] = {0, 20};
@@ -789,16 +937,23 @@ bool run_bitcoin_transaction_self_test() {
   uint8_t input_script[23] = {0xa9, 0x14};
   uint8_t output_script[23] = {0xa9, 0x14};
   uint8_t fingerprint[4];
+  HdExpandedPrivateNode expanded_master;
   passed = passed && hd_private_from_seed(seed, sizeof(seed), &master) == WalletError::Ok &&
            derive_array_path(master, input_path, 5, &input_node) == WalletError::Ok &&
            derive_array_path(master, output_path, 5, &output_node) == WalletError::Ok &&
-           public_key_from_private(input_node.private_key, input_public) == WalletError::Ok &&
-           public_key_from_private(output_node.private_key, output_public) == WalletError::Ok &&
+           public_key_from_private(input_node.node.private_key, input_public) == WalletError::Ok &&
+           public_key_from_private(output_node.node.private_key, output_public) == WalletError::Ok &&
+           crypto_constant_time_equal(input_public, input_node.public_key, sizeof(input_public)) &&
+           crypto_constant_time_equal(output_public, output_node.public_key, sizeof(output_public)) &&
            crypto_hash160(input_public, sizeof(input_public), input_redeem + 2) &&
            crypto_hash160(output_public, sizeof(output_public), output_redeem + 2) &&
            crypto_hash160(input_redeem, sizeof(input_redeem), input_script + 2) &&
            crypto_hash160(output_redeem, sizeof(output_redeem), output_script + 2) &&
-           master_fingerprint(master, fingerprint);
+           hd_private_expand(&master, &expanded_master) == WalletError::Ok;
+  for (size_t index = 0; index < sizeof(fingerprint); ++index) {
+    fingerprint[index] = static_cast<uint8_t>(expanded_master.fingerprint >> (24 - index * 8));
+  }
+  secure_zero(&expanded_master, sizeof(expanded_master));
   input_script[22] = 0x87;
   output_script[22] = 0x87;
 
@@ -821,6 +976,7 @@ bool run_bitcoin_transaction_self_test() {
   const uint8_t output_derivation_type = 0x02;
   serialized = passed && serialized && write_bytes(&psbt_writer, kPsbtMagic, sizeof(kPsbtMagic)) &&
       write_compact_size(&psbt_writer, 1) && write_bytes(&psbt_writer, &global_key, 1) &&
+      unsigned_writer.position <= sizeof(unsigned_transaction) &&
       write_compact_size(&psbt_writer, unsigned_writer.position) &&
       write_bytes(&psbt_writer, unsigned_transaction, unsigned_writer.position) &&
       write_compact_size(&psbt_writer, 0) && write_compact_size(&psbt_writer, 1) &&
@@ -843,13 +999,36 @@ bool run_bitcoin_transaction_self_test() {
 
   BitcoinSigningRequest parsed;
   uint8_t signed_transaction[384];
+  uint8_t rederived_transaction[384];
   size_t signed_size = sizeof(signed_transaction);
+  size_t rederived_size = sizeof(rederived_transaction);
   passed = serialized && bitcoin_parse_psbt(psbt, psbt_writer.position, master, &parsed) == TransactionError::Ok &&
            parsed.input_count == 1 && parsed.output_count == 1 && parsed.fee == 10000 &&
-           parsed.outputs[0].wallet_owned && parsed.outputs[0].change &&
+           parsed.outputs[0].wallet_owned && parsed.outputs[0].change && parsed.input_key_count == 1 &&
            bitcoin_sign_request(parsed, master, signed_transaction, &signed_size) == TransactionError::Ok &&
            signed_size > 44 && signed_transaction[4] == 0 && signed_transaction[5] == 1 &&
            signed_transaction[43] == 23 && signed_transaction[44] == 22;
+  // The cached keys belong to the parse-time master; a different wallet must
+  // not sign with them.
+  HdPrivateNode other_master;
+  uint8_t other_transaction[384];
+  size_t other_size = sizeof(other_transaction);
+  uint8_t other_seed[sizeof(seed)];
+  memcpy(other_seed, seed, sizeof(other_seed));
+  other_seed[0] ^= 0x01;
+  passed = passed && hd_private_from_seed(other_seed, sizeof(other_seed), &other_master) == WalletError::Ok &&
+           bitcoin_sign_request(parsed, other_master, other_transaction, &other_size) ==
+               TransactionError::WrongWallet;
+  secure_zero(&other_master, sizeof(other_master));
+  secure_zero(other_seed, sizeof(other_seed));
+  secure_zero(other_transaction, sizeof(other_transaction));
+  // Without the parse-time key table, signing derives from the master and
+  // must produce the same deterministic transaction.
+  secure_zero(parsed.input_keys, sizeof(parsed.input_keys));
+  parsed.input_key_count = 0;
+  passed = passed && bitcoin_sign_request(parsed, master, rederived_transaction, &rederived_size) == TransactionError::Ok &&
+           rederived_size == signed_size &&
+           memcmp(rederived_transaction, signed_transaction, signed_size) == 0;
   clear_bitcoin_request(&parsed);
   secure_zero(&master, sizeof(master));
   secure_zero(&input_node, sizeof(input_node));
@@ -864,6 +1043,7 @@ bool run_bitcoin_transaction_self_test() {
   secure_zero(unsigned_transaction, sizeof(unsigned_transaction));
   secure_zero(psbt, sizeof(psbt));
   secure_zero(signed_transaction, sizeof(signed_transaction));
+  secure_zero(rederived_transaction, sizeof(rederived_transaction));
   return passed;
 }
 
@@ -59,6 +59,15 @@ struct BitcoinOutput {
   bool change;
 };
 
+// Signing key derived for an input while the PSBT was parsed. Signing looks
+// keys up by path so each input path is walked once per request.
+struct BitcoinInputKey {
+  uint32_t path[kBitcoinMaxPathDepth];
+  uint8_t path_depth;
+  uint8_t private_key[kPrivateKeySize];
+  uint8_t public_key[kCompressedPublicKeySize];
+};
+
 struct BitcoinSigningRequest {
   uint32_t version;
   uint32_t lock_time;
@@ -71,6 +80,13 @@ struct BitcoinSigningRequest {
   uint64_t fee;
   uint32_t estimated_vbytes;
   uint8_t psbt_hash[kSha256Size];
+  // Private key material; clear_bitcoin_request() wipes it with the request.
+  BitcoinInputKey input_keys[kBitcoinMaxInputs];
+  uint8_t input_key_count;
+  // The master the input keys came from. Signing uses them only when its
+  // master has the same fingerprint and chain code.
+  uint32_t key_master_fingerprint;
+  uint8_t key_master_chain_code[kChainCodeSize];
 };
 
 TransactionError bitcoin_parse_psbt(const uint8_t *psbt, size_t psbt_size,
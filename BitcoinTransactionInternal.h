@@ -0,0 +1,42 @@
+#ifndef HEXWALLET_BITCOIN_TRANSACTION_INTERNAL_H
+#define HEXWALLET_BITCOIN_TRANSACTION_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "BitcoinTransaction.h"
+#include "WalletConfig.h"
+
+namespace hexwallet {
+
+// hashPrevouts, hashSequence and hashOutputs are shared by every input, so a
+// signing pass hashes them once and each input only hashes its preimage.
+struct Bip143Cache {
+  uint8_t hash_prevouts[kSha256Size];
+  uint8_t hash_sequences[kSha256Size];
+  uint8_t hash_outputs[kSha256Size];
+};
+
+#if HEXWALLET_BENCH_STAGES
+// The stages bitcoin_sign_request runs after validating the request, so the
+// host benchmarks can time them one by one. sign_inputs signs whatever
+// digests it is given, so firmware builds never export these.
+namespace bitcoin_stages {
+
+TransactionError bip143_prepare(const BitcoinSigningRequest &request, Bip143Cache *out);
+TransactionError bip143_digest(const BitcoinSigningRequest &request, const Bip143Cache &cache,
+                               size_t input_index, uint8_t out[kSha256Size]);
+TransactionError sign_inputs(const BitcoinSigningRequest &request, const HdPrivateNode &master,
+                             const uint8_t digests[][kSha256Size],
+                             uint8_t signatures[][kBitcoinMaxDerSignatureSize],
+                             uint8_t signature_sizes[]);
+TransactionError write_witness_transaction(
+    const BitcoinSigningRequest &request, const uint8_t signatures[][kBitcoinMaxDerSignatureSize],
+    const uint8_t signature_sizes[], uint8_t *out_transaction, size_t *in_out_size);
+
+}  // namespace bitcoin_stages
+#endif
+
+}  // namespace hexwallet
+
+#endif
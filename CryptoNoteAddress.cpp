@@ -1,9 +1,10 @@
 #include "CryptoNoteAddress.h"
 
-#include <mbedtls/bignum.h>
 #include <string.h>
 
 #include "CryptoPrimitives.h"
+#include "WalletTrace.h"
+#include "local_ed25519.h"
 
 namespace hexwallet {
 namespace {
@@ -17,162 +18,20 @@ constexpr size_t kMaximumPrefixSize = 10;
 constexpr size_t kAddressPayloadSize =
     kMaximumPrefixSize + 2 * kCryptoNotePublicKeySize + kChecksumSize;
 constexpr uint8_t kEncodedBlockSizes[kFullBlockSize + 1] = {0, 2, 3, 5, 6, 7, 9, 10, 11};
+// "SubAddr" with its terminator, then the view key and both indices.
+constexpr char kSubaddressDomain[] = "SubAddr";
+constexpr size_t kSubaddressHashInputSize = sizeof(kSubaddressDomain) + kCryptoNoteScalarSize + 8;
 
-struct EdwardsPoint {
-  mbedtls_mpi x;
-  mbedtls_mpi y;
-  mbedtls_mpi z;
-  mbedtls_mpi t;
-};
-
-void point_init(EdwardsPoint *point) {
-  mbedtls_mpi_init(&point->x);
-  mbedtls_mpi_init(&point->y);
-  mbedtls_mpi_init(&point->z);
-  mbedtls_mpi_init(&point->t);
-}
-
-void point_free(EdwardsPoint *point) {
-  mbedtls_mpi_free(&point->t);
-  mbedtls_mpi_free(&point->z);
-  mbedtls_mpi_free(&point->y);
-  mbedtls_mpi_free(&point->x);
-}
-
-bool read_decimal(mbedtls_mpi *value, const char *text) {
-  return mbedtls_mpi_read_string(value, 10, text) == 0;
-}
-
-bool field_normalize(mbedtls_mpi *value, const mbedtls_mpi *prime) {
-  return mbedtls_mpi_mod_mpi(value, value, prime) == 0;
-}
-
-bool field_add(mbedtls_mpi *out, const mbedtls_mpi *left,
-               const mbedtls_mpi *right, const mbedtls_mpi *prime) {
-  return mbedtls_mpi_add_mpi(out, left, right) == 0 && field_normalize(out, prime);
-}
-
-bool field_sub(mbedtls_mpi *out, const mbedtls_mpi *left,
-               const mbedtls_mpi *right, const mbedtls_mpi *prime) {
-  return mbedtls_mpi_sub_mpi(out, left, right) == 0 && field_normalize(out, prime);
-}
-
-bool field_mul(mbedtls_mpi *out, const mbedtls_mpi *left,
-               const mbedtls_mpi *right, const mbedtls_mpi *prime) {
-  return mbedtls_mpi_mul_mpi(out, left, right) == 0 && field_normalize(out, prime);
-}
-
-bool point_copy(EdwardsPoint *out, const EdwardsPoint &source) {
-  return mbedtls_mpi_copy(&out->x, &source.x) == 0 &&
-         mbedtls_mpi_copy(&out->y, &source.y) == 0 &&
-         mbedtls_mpi_copy(&out->z, &source.z) == 0 &&
-         mbedtls_mpi_copy(&out->t, &source.t) == 0;
-}
-
-bool point_identity(EdwardsPoint *point) {
-  return mbedtls_mpi_lset(&point->x, 0) == 0 &&
-         mbedtls_mpi_lset(&point->y, 1) == 0 &&
-         mbedtls_mpi_lset(&point->z, 1) == 0 &&
-         mbedtls_mpi_lset(&point->t, 0) == 0;
-}
-
-bool point_base(EdwardsPoint *point, const mbedtls_mpi *prime) {
-  if (!read_decimal(&point->x,
-      "15112221349535400772501151409588531511454012693041857206046113283949847762202") ||
-      !read_decimal(&point->y,
-      "46316835694926478169428394003475163141307993866256225615783033603165251855960") ||
-      mbedtls_mpi_lset(&point->z, 1) != 0) {
-    return false;
-  }
-  return field_mul(&point->t, &point->x, &point->y, prime);
-}
-
-bool point_add(EdwardsPoint *out, const EdwardsPoint &left,
-               const EdwardsPoint &right, const mbedtls_mpi *prime,
-               const mbedtls_mpi *edwards_d) {
-  mbedtls_mpi a, b, c, d, e, f, g, h, first, second;
-  mbedtls_mpi_init(&a); mbedtls_mpi_init(&b); mbedtls_mpi_init(&c);
-  mbedtls_mpi_init(&d); mbedtls_mpi_init(&e); mbedtls_mpi_init(&f);
-  mbedtls_mpi_init(&g); mbedtls_mpi_init(&h); mbedtls_mpi_init(&first);
-  mbedtls_mpi_init(&second);
-  const bool ok = field_sub(&first, &left.y, &left.x, prime) &&
-      field_sub(&second, &right.y, &right.x, prime) &&
-      field_mul(&a, &first, &second, prime) &&
-      field_add(&first, &left.y, &left.x, prime) &&
-      field_add(&second, &right.y, &right.x, prime) &&
-      field_mul(&b, &first, &second, prime) &&
-      field_mul(&first, &left.t, &right.t, prime) &&
-      field_mul(&second, &first, edwards_d, prime) &&
-      field_add(&c, &second, &second, prime) &&
-      field_mul(&first, &left.z, &right.z, prime) &&
-      field_add(&d, &first, &first, prime) &&
-      field_sub(&e, &b, &a, prime) && field_sub(&f, &d, &c, prime) &&
-      field_add(&g, &d, &c, prime) && field_add(&h, &b, &a, prime) &&
-      field_mul(&out->x, &e, &f, prime) && field_mul(&out->y, &g, &h, prime) &&
-      field_mul(&out->t, &e, &h, prime) && field_mul(&out->z, &f, &g, prime);
-  mbedtls_mpi_free(&second); mbedtls_mpi_free(&first); mbedtls_mpi_free(&h);
-  mbedtls_mpi_free(&g); mbedtls_mpi_free(&f); mbedtls_mpi_free(&e);
-  mbedtls_mpi_free(&d); mbedtls_mpi_free(&c); mbedtls_mpi_free(&b);
-  mbedtls_mpi_free(&a);
-  return ok;
-}
-
-bool point_double(EdwardsPoint *out, const EdwardsPoint &point,
-                  const mbedtls_mpi *prime) {
-  mbedtls_mpi a, b, c, d, e, f, g, h, temporary;
-  mbedtls_mpi_init(&a); mbedtls_mpi_init(&b); mbedtls_mpi_init(&c);
-  mbedtls_mpi_init(&d); mbedtls_mpi_init(&e); mbedtls_mpi_init(&f);
-  mbedtls_mpi_init(&g); mbedtls_mpi_init(&h); mbedtls_mpi_init(&temporary);
-  const bool ok = field_mul(&a, &point.x, &point.x, prime) &&
-      field_mul(&b, &point.y, &point.y, prime) &&
-      field_mul(&temporary, &point.z, &point.z, prime) &&
-      field_add(&c, &temporary, &temporary, prime) &&
-      mbedtls_mpi_sub_mpi(&d, prime, &a) == 0 &&
-      field_add(&temporary, &point.x, &point.y, prime) &&
-      field_mul(&e, &temporary, &temporary, prime) &&
-      field_sub(&e, &e, &a, prime) && field_sub(&e, &e, &b, prime) &&
-      field_add(&g, &d, &b, prime) && field_sub(&f, &g, &c, prime) &&
-      field_sub(&h, &d, &b, prime) &&
-      field_mul(&out->x, &e, &f, prime) && field_mul(&out->y, &g, &h, prime) &&
-      field_mul(&out->t, &e, &h, prime) && field_mul(&out->z, &f, &g, prime);
-  mbedtls_mpi_free(&temporary); mbedtls_mpi_free(&h); mbedtls_mpi_free(&g);
-  mbedtls_mpi_free(&f); mbedtls_mpi_free(&e); mbedtls_mpi_free(&d);
-  mbedtls_mpi_free(&c); mbedtls_mpi_free(&b); mbedtls_mpi_free(&a);
-  return ok;
-}
-
-bool read_little_endian(mbedtls_mpi *out, const uint8_t *input, size_t size) {
-  uint8_t reversed[kCryptoNoteScalarSize];
-  if (input == nullptr || size > sizeof(reversed)) return false;
-  for (size_t index = 0; index < size; ++index) reversed[index] = input[size - 1 - index];
-  const bool ok = mbedtls_mpi_read_binary(out, reversed, size) == 0;
-  secure_zero(reversed, sizeof(reversed));
-  return ok;
-}
-
-bool write_little_endian(const mbedtls_mpi *value, uint8_t *out, size_t size) {
-  uint8_t big_endian[kCryptoNoteScalarSize];
-  if (out == nullptr || size > sizeof(big_endian) ||
-      mbedtls_mpi_write_binary(value, big_endian, size) != 0) return false;
-  for (size_t index = 0; index < size; ++index) out[index] = big_endian[size - 1 - index];
-  secure_zero(big_endian, sizeof(big_endian));
-  return true;
-}
+static_assert(kCryptoNoteSubaddressBatchSize <= kLocalEd25519MaxBatch,
+              "subaddress batches must fit one Ed25519 batch");
+static_assert(kCryptoNoteScanBatchSize <= kLocalEd25519MaxBatch,
+              "scan batches must fit one Ed25519 batch");
 
+// Keccak digests are taken mod l and must not land on zero.
 bool scalar_reduce(const uint8_t input[kCryptoNoteScalarSize],
                    uint8_t out[kCryptoNoteScalarSize]) {
-  mbedtls_mpi scalar, order;
-  mbedtls_mpi_init(&scalar);
-  mbedtls_mpi_init(&order);
-  const bool ok = read_little_endian(&scalar, input, kCryptoNoteScalarSize) &&
-      read_decimal(&order,
-      "7237005577332262213973186563042994240857116359379907606001950938285454250989") &&
-      mbedtls_mpi_mod_mpi(&scalar, &scalar, &order) == 0 &&
-      mbedtls_mpi_cmp_int(&scalar, 0) != 0 &&
-      write_little_endian(&scalar, out, kCryptoNoteScalarSize);
-  mbedtls_mpi_free(&order);
-  mbedtls_mpi_free(&scalar);
-  return ok;
+  local_ed25519_scalar_reduce(input, out);
+  return local_ed25519_scalar_is_valid(out);
 }
 
 size_t write_varint(uint64_t value, uint8_t out[kMaximumPrefixSize]) {
@@ -220,8 +79,70 @@ bool cryptonote_base58(const uint8_t *input, size_t input_size, char *out, size_
   return true;
 }
 
+// Hs("SubAddr" || a || major || minor), the indices as little-endian uint32.
+bool subaddress_tweak(const uint8_t view_key[kCryptoNoteScalarSize], uint32_t major,
+                      uint32_t minor, uint8_t out[kCryptoNoteScalarSize]) {
+  uint8_t input[kSubaddressHashInputSize];
+  memcpy(input, kSubaddressDomain, sizeof(kSubaddressDomain));
+  memcpy(input + sizeof(kSubaddressDomain), view_key, kCryptoNoteScalarSize);
+  for (size_t byte = 0; byte < 4; ++byte) {
+    input[sizeof(kSubaddressDomain) + kCryptoNoteScalarSize + byte] =
+        static_cast<uint8_t>(major >> (8 * byte));
+    input[sizeof(kSubaddressDomain) + kCryptoNoteScalarSize + 4 + byte] =
+        static_cast<uint8_t>(minor >> (8 * byte));
+  }
+  uint8_t digest[kKeccak256Size];
+  const bool ok = crypto_keccak256(input, sizeof(input), digest);
+  if (ok) local_ed25519_scalar_reduce(digest, out);
+  secure_zero(input, sizeof(input));
+  secure_zero(digest, sizeof(digest));
+  return ok;
+}
+
+// Hs(derivation || varint(index)), CryptoNote's derivation_to_scalar().
+bool derivation_scalar(const uint8_t derivation[kCryptoNotePublicKeySize], uint64_t index,
+                       uint8_t out[kCryptoNoteScalarSize]) {
+  uint8_t input[kCryptoNotePublicKeySize + kMaximumPrefixSize];
+  memcpy(input, derivation, kCryptoNotePublicKeySize);
+  const size_t index_size = write_varint(index, input + kCryptoNotePublicKeySize);
+  uint8_t digest[kKeccak256Size];
+  const bool ok = index_size != 0 &&
+                  crypto_keccak256(input, kCryptoNotePublicKeySize + index_size, digest);
+  if (ok) local_ed25519_scalar_reduce(digest, out);
+  secure_zero(input, sizeof(input));
+  secure_zero(digest, sizeof(digest));
+  return ok;
+}
+
+WalletError encode_address(uint64_t prefix, const uint8_t public_spend_key[kCryptoNotePublicKeySize],
+                           const uint8_t public_view_key[kCryptoNotePublicKeySize],
+                           char *out, size_t out_size) {
+  uint8_t payload[kAddressPayloadSize];
+  const size_t prefix_size = write_varint(prefix, payload);
+  if (prefix_size == 0) return WalletError::InvalidArgument;
+  memcpy(payload + prefix_size, public_spend_key, kCryptoNotePublicKeySize);
+  memcpy(payload + prefix_size + kCryptoNotePublicKeySize,
+         public_view_key, kCryptoNotePublicKeySize);
+  const size_t data_size = prefix_size + 2 * kCryptoNotePublicKeySize;
+  uint8_t digest[kKeccak256Size];
+  const bool hashed = crypto_keccak256(payload, data_size, digest);
+  if (hashed) memcpy(payload + data_size, digest, kChecksumSize);
+  const bool encoded = hashed && cryptonote_base58(payload, data_size + kChecksumSize, out, out_size);
+  secure_zero(digest, sizeof(digest));
+  secure_zero(payload, sizeof(payload));
+  return encoded ? WalletError::Ok : (out_size < kCryptoNoteStandardAddressSize
+                                           ? WalletError::BufferTooSmall
+                                           : WalletError::CryptoFailure);
+}
+
 }  // namespace
 
+const CryptoNoteAddressProfile *cryptonote_find_profile(uint64_t standard_address_prefix) {
+  if (standard_address_prefix == kMoneroMainnet.standard_address_prefix) return &kMoneroMainnet;
+  if (standard_address_prefix == kMasariMainnet.standard_address_prefix) return &kMasariMainnet;
+  return nullptr;
+}
+
 WalletError cryptonote_private_keys_from_seed(
     const uint8_t seed[kCryptoNoteScalarSize],
     uint8_t out_spend_key[kCryptoNoteScalarSize],
@@ -246,38 +167,13 @@ WalletError cryptonote_public_key_from_scalar(
     const uint8_t scalar_bytes[kCryptoNoteScalarSize],
     uint8_t out_public_key[kCryptoNotePublicKeySize]) {
   if (scalar_bytes == nullptr || out_public_key == nullptr) return WalletError::InvalidArgument;
-  mbedtls_mpi prime, order, scalar, edwards_d, inverse, affine_x, affine_y;
-  mbedtls_mpi_init(&prime); mbedtls_mpi_init(&order); mbedtls_mpi_init(&scalar);
-  mbedtls_mpi_init(&edwards_d); mbedtls_mpi_init(&inverse);
-  mbedtls_mpi_init(&affine_x); mbedtls_mpi_init(&affine_y);
-  EdwardsPoint result, addend, added, doubled;
-  point_init(&result); point_init(&addend); point_init(&added); point_init(&doubled);
-  bool ok = read_decimal(&prime,
-      "57896044618658097711785492504343953926634992332820282019728792003956564819949") &&
-      read_decimal(&order,
-      "7237005577332262213973186563042994240857116359379907606001950938285454250989") &&
-      read_decimal(&edwards_d,
-      "37095705934669439343138083508754565189542113879843219016388785533085940283555") &&
-      read_little_endian(&scalar, scalar_bytes, kCryptoNoteScalarSize) &&
-      mbedtls_mpi_cmp_int(&scalar, 0) > 0 && mbedtls_mpi_cmp_mpi(&scalar, &order) < 0 &&
-      point_identity(&result) && point_base(&addend, &prime);
-  for (size_t bit = 0; ok && bit < 253; ++bit) {
-    ok = point_add(&added, result, addend, &prime, &edwards_d) &&
-         point_double(&doubled, addend, &prime);
-    if (ok && mbedtls_mpi_get_bit(&scalar, bit) != 0) ok = point_copy(&result, added);
-    if (ok) ok = point_copy(&addend, doubled);
+  HEXWALLET_TRACE_COUNT(EcMultiply, 1);
+  if (!local_ed25519_scalar_is_valid(scalar_bytes) ||
+      !local_ed25519_public_key(scalar_bytes, out_public_key)) {
+    secure_zero(out_public_key, kCryptoNotePublicKeySize);
+    return WalletError::InvalidKey;
   }
-  ok = ok && mbedtls_mpi_inv_mod(&inverse, &result.z, &prime) == 0 &&
-       field_mul(&affine_x, &result.x, &inverse, &prime) &&
-       field_mul(&affine_y, &result.y, &inverse, &prime) &&
-       write_little_endian(&affine_y, out_public_key, kCryptoNotePublicKeySize);
-  if (ok && mbedtls_mpi_get_bit(&affine_x, 0) != 0) out_public_key[31] |= 0x80;
-  point_free(&doubled); point_free(&added); point_free(&addend); point_free(&result);
-  mbedtls_mpi_free(&affine_y); mbedtls_mpi_free(&affine_x); mbedtls_mpi_free(&inverse);
-  mbedtls_mpi_free(&edwards_d); mbedtls_mpi_free(&scalar);
-  mbedtls_mpi_free(&order); mbedtls_mpi_free(&prime);
-  if (!ok) secure_zero(out_public_key, kCryptoNotePublicKeySize);
-  return ok ? WalletError::Ok : WalletError::InvalidKey;
+  return WalletError::Ok;
 }
 
 WalletError cryptonote_standard_address(
@@ -287,22 +183,8 @@ WalletError cryptonote_standard_address(
     char *out, size_t out_size) {
   if (profile.standard_address_prefix == 0 || public_spend_key == nullptr ||
       public_view_key == nullptr || out == nullptr) return WalletError::InvalidArgument;
-  uint8_t payload[kAddressPayloadSize];
-  const size_t prefix_size = write_varint(profile.standard_address_prefix, payload);
-  if (prefix_size == 0) return WalletError::InvalidArgument;
-  memcpy(payload + prefix_size, public_spend_key, kCryptoNotePublicKeySize);
-  memcpy(payload + prefix_size + kCryptoNotePublicKeySize,
-         public_view_key, kCryptoNotePublicKeySize);
-  const size_t data_size = prefix_size + 2 * kCryptoNotePublicKeySize;
-  uint8_t digest[kKeccak256Size];
-  const bool hashed = crypto_keccak256(payload, data_size, digest);
-  if (hashed) memcpy(payload + data_size, digest, kChecksumSize);
-  const bool encoded = hashed && cryptonote_base58(payload, data_size + kChecksumSize, out, out_size);
-  secure_zero(digest, sizeof(digest));
-  secure_zero(payload, sizeof(payload));
-  return encoded ? WalletError::Ok : (out_size < kCryptoNoteStandardAddressSize
-                                           ? WalletError::BufferTooSmall
-                                           : WalletError::CryptoFailure);
+  return encode_address(profile.standard_address_prefix, public_spend_key, public_view_key,
+                        out, out_size);
 }
 
 WalletError cryptonote_address_from_seed(
@@ -327,6 +209,247 @@ WalletError cryptonote_address_from_seed(
   return result;
 }
 
+WalletError cryptonote_subaddress_range(
+    const CryptoNoteAddressProfile &profile,
+    const uint8_t view_key[kCryptoNoteScalarSize],
+    const uint8_t public_spend_key[kCryptoNotePublicKeySize],
+    uint32_t major, uint32_t first_minor, uint32_t count,
+    CryptoNoteSubaddressVisitor visit, void *context) {
+  if (profile.subaddress_prefix == 0 || view_key == nullptr || public_spend_key == nullptr ||
+      visit == nullptr || count == 0 || count - 1 > UINT32_MAX - first_minor) {
+    return WalletError::InvalidArgument;
+  }
+  CryptoNoteSubaddress subaddress;
+  WalletError first_error = WalletError::Ok;
+  const auto report = [&](WalletError result) {
+    if (result != WalletError::Ok) {
+      memset(subaddress.address, 0, sizeof(subaddress.address));
+      if (first_error == WalletError::Ok) first_error = result;
+    }
+    visit(result, subaddress, context);
+    secure_zero(&subaddress, sizeof(subaddress));
+  };
+  LocalEd25519TweakBase base;
+  HEXWALLET_TRACE_COUNT(EcMultiply, 1);
+  WalletError result = local_ed25519_tweak_base_init(&base, public_spend_key, view_key)
+                           ? WalletError::Ok : WalletError::InvalidKey;
+  uint8_t tweaks[kCryptoNoteSubaddressBatchSize * kCryptoNoteScalarSize];
+  uint8_t spend_keys[kCryptoNoteSubaddressBatchSize * kCryptoNotePublicKeySize];
+  uint8_t view_keys[kCryptoNoteSubaddressBatchSize * kCryptoNotePublicKeySize];
+  for (uint32_t done = 0; done < count;) {
+    const size_t batch = count - done < kCryptoNoteSubaddressBatchSize
+                             ? count - done : kCryptoNoteSubaddressBatchSize;
+    const uint32_t batch_minor = first_minor + done;
+    WalletError batch_result = result;
+    for (size_t offset = 0; batch_result == WalletError::Ok && offset < batch; ++offset) {
+      if (!subaddress_tweak(view_key, major, batch_minor + static_cast<uint32_t>(offset),
+                            tweaks + offset * kCryptoNoteScalarSize)) {
+        batch_result = WalletError::CryptoFailure;
+      }
+    }
+    if (batch_result == WalletError::Ok &&
+        !local_ed25519_tweak_add_scale_batch(base, tweaks, batch, spend_keys, view_keys)) {
+      batch_result = WalletError::CryptoFailure;
+    }
+    HEXWALLET_TRACE_COUNT(EcMultiply, batch_result == WalletError::Ok ? 2 * batch : 0);
+    for (size_t offset = 0; offset < batch; ++offset) {
+      subaddress.major = major;
+      subaddress.minor = batch_minor + static_cast<uint32_t>(offset);
+      WalletError entry_result = batch_result;
+      if (entry_result == WalletError::Ok && major == 0 && subaddress.minor == 0) {
+        // Index 0/0 is the wallet's own standard address.
+        uint8_t public_view_key[kCryptoNotePublicKeySize];
+        entry_result = cryptonote_public_key_from_scalar(view_key, public_view_key);
+        if (entry_result == WalletError::Ok) {
+          entry_result = cryptonote_standard_address(profile, public_spend_key, public_view_key,
+                                                     subaddress.address, sizeof(subaddress.address));
+        }
+        secure_zero(public_view_key, sizeof(public_view_key));
+      } else if (entry_result == WalletError::Ok) {
+        entry_result = encode_address(profile.subaddress_prefix,
+                                      spend_keys + offset * kCryptoNotePublicKeySize,
+                                      view_keys + offset * kCryptoNotePublicKeySize,
+                                      subaddress.address, sizeof(subaddress.address));
+      }
+      report(entry_result);
+    }
+    done += static_cast<uint32_t>(batch);
+  }
+  secure_zero(&base, sizeof(base));
+  secure_zero(tweaks, sizeof(tweaks));
+  secure_zero(spend_keys, sizeof(spend_keys));
+  secure_zero(view_keys, sizeof(view_keys));
+  return first_error;
+}
+
+WalletError cryptonote_scanner_init(CryptoNoteScanner *out,
+                                    const uint8_t view_key[kCryptoNoteScalarSize],
+                                    const uint8_t public_spend_key[kCryptoNotePublicKeySize]) {
+  if (out == nullptr || view_key == nullptr || public_spend_key == nullptr) {
+    return WalletError::InvalidArgument;
+  }
+  // The base keeps a as its scale and B as its first addend; the a * B it
+  // also computes is not needed for scanning.
+  HEXWALLET_TRACE_COUNT(EcMultiply, 1);
+  if (!local_ed25519_tweak_base_init(&out->base, public_spend_key, view_key)) {
+    secure_zero(out, sizeof(*out));
+    return WalletError::InvalidKey;
+  }
+  return WalletError::Ok;
+}
+
+WalletError cryptonote_scan_outputs(const CryptoNoteScanner &scanner,
+                                    const CryptoNoteOutput *outputs, size_t count,
+                                    bool *out_owned) {
+  if (outputs == nullptr || out_owned == nullptr) return WalletError::InvalidArgument;
+  uint8_t tx_keys[kCryptoNoteScanBatchSize * kCryptoNotePublicKeySize];
+  uint8_t derivations[kCryptoNoteScanBatchSize * kCryptoNotePublicKeySize];
+  uint8_t scalars[kCryptoNoteScanBatchSize * kCryptoNoteScalarSize];
+  uint8_t expected[kCryptoNoteScanBatchSize * kCryptoNotePublicKeySize];
+  bool valid[kCryptoNoteScanBatchSize];
+  size_t slots[kCryptoNoteScanBatchSize];
+  WalletError result = WalletError::Ok;
+  size_t batch = 0;
+  for (size_t done = 0; result == WalletError::Ok && done < count; done += batch) {
+    batch = count - done < kCryptoNoteScanBatchSize ? count - done : kCryptoNoteScanBatchSize;
+    const CryptoNoteOutput *batch_outputs = outputs + done;
+    // Outputs of one transaction sit together and need one derivation.
+    size_t distinct = 0;
+    for (size_t offset = 0; offset < batch; ++offset) {
+      size_t slot = 0;
+      while (slot < distinct && memcmp(tx_keys + slot * kCryptoNotePublicKeySize,
+                                       batch_outputs[offset].tx_public_key,
+                                       kCryptoNotePublicKeySize) != 0) {
+        ++slot;
+      }
+      if (slot == distinct) {
+        memcpy(tx_keys + distinct++ * kCryptoNotePublicKeySize,
+               batch_outputs[offset].tx_public_key, kCryptoNotePublicKeySize);
+      }
+      slots[offset] = slot;
+    }
+    if (!local_ed25519_derivation_batch(scanner.base.scale, tx_keys, distinct, derivations, valid)) {
+      result = WalletError::CryptoFailure;
+    }
+    HEXWALLET_TRACE_COUNT(EcMultiply, result == WalletError::Ok ? distinct : 0);
+    for (size_t offset = 0; result == WalletError::Ok && offset < batch; ++offset) {
+      if (!derivation_scalar(derivations + slots[offset] * kCryptoNotePublicKeySize,
+                             batch_outputs[offset].output_index,
+                             scalars + offset * kCryptoNoteScalarSize)) {
+        result = WalletError::CryptoFailure;
+      }
+    }
+    if (result == WalletError::Ok &&
+        !local_ed25519_tweak_add_scale_batch(scanner.base, scalars, batch, expected, nullptr)) {
+      result = WalletError::CryptoFailure;
+    }
+    HEXWALLET_TRACE_COUNT(EcMultiply, result == WalletError::Ok ? batch : 0);
+    for (size_t offset = 0; result == WalletError::Ok && offset < batch; ++offset) {
+      out_owned[done + offset] =
+          valid[slots[offset]] &&
+          crypto_constant_time_equal(expected + offset * kCryptoNotePublicKeySize,
+                                     batch_outputs[offset].output_key, kCryptoNotePublicKeySize);
+    }
+  }
+  if (result != WalletError::Ok) memset(out_owned, 0, count * sizeof(out_owned[0]));
+  secure_zero(derivations, sizeof(derivations));
+  secure_zero(scalars, sizeof(scalars));
+  secure_zero(expected, sizeof(expected));
+  return result;
+}
+
+namespace {
+
+struct SubaddressCheck {
+  const char *const *expected;
+  size_t seen;
+  bool passed;
+};
+
+void check_subaddress(WalletError result, const CryptoNoteSubaddress &subaddress, void *context) {
+  SubaddressCheck *check = static_cast<SubaddressCheck *>(context);
+  check->passed = check->passed && result == WalletError::Ok &&
+                  strcmp(subaddress.address, check->expected[check->seen]) == 0;
+  ++check->seen;
+}
+
+// Outputs to the zero-seed wallet from R = r * B with r = Hs("HexWallet scan
+// test"), built on the sender's side as Hs(8 * r * A || varint(i)) * G + B.
+// The torsion key is R plus a point of order 8, which the derivation's
+// cofactor removes. Ten outputs cross a batch boundary.
+bool scan_outputs_match(const uint8_t view_key[kCryptoNoteScalarSize],
+                        const uint8_t public_spend_key[kCryptoNotePublicKeySize]) {
+  static const uint8_t kScanTxKey[kCryptoNotePublicKeySize] = {
+      0x9d,0x63,0x43,0x91,0x5d,0xdd,0x3e,0x08,0xee,0x7d,0xb0,0x7a,0xe2,0xf7,0xc0,0xa8,
+      0xfd,0xed,0x76,0x41,0xe8,0xd2,0x35,0x97,0xd7,0xef,0xcb,0x56,0x5b,0x32,0x39,0x23,
+  };
+  static const uint8_t kScanTorsionTxKey[kCryptoNotePublicKeySize] = {
+      0xfb,0x84,0xaf,0x7c,0x5d,0x12,0xe8,0x21,0xf2,0x62,0x65,0x4d,0x0f,0xf9,0x85,0xad,
+      0xd9,0x91,0xef,0x95,0x45,0x7a,0x2c,0x26,0x70,0x38,0x97,0xb0,0x15,0x88,0xac,0x47,
+  };
+  // r' * B for r' = Hs("HexWallet scan other"), paying another spend key.
+  static const uint8_t kScanOtherTxKey[kCryptoNotePublicKeySize] = {
+      0xc5,0xed,0x2b,0x12,0x9f,0x9f,0xaf,0xd6,0xbf,0x33,0x77,0x98,0x02,0x51,0xd4,0xef,
+      0xad,0x80,0xda,0x7b,0x23,0x3a,0x30,0x3c,0x9a,0x0a,0xf3,0xad,0x33,0x4a,0xc6,0xe3,
+  };
+  static const uint8_t kScanOtherOutputKey[kCryptoNotePublicKeySize] = {
+      0x2d,0x8f,0x51,0x36,0x0b,0x45,0x33,0xdb,0xe9,0xeb,0xca,0x93,0x68,0x42,0x0c,0x8b,
+      0x09,0xdc,0xcf,0x14,0xa6,0xac,0xd3,0x8e,0x1f,0x62,0xed,0x98,0xa0,0x94,0x1f,0xd1,
+  };
+  static const uint8_t kScanOutputKey0[kCryptoNotePublicKeySize] = {
+      0x3b,0xed,0xcc,0x27,0x4d,0x7f,0xe7,0x65,0xf5,0x2e,0xe3,0xa8,0x47,0xde,0x5a,0xf2,
+      0xbe,0x87,0xbf,0x84,0xdc,0x68,0x50,0x38,0x0e,0x80,0x3e,0x17,0x50,0x02,0xb8,0x82,
+  };
+  static const uint8_t kScanOutputKey1[kCryptoNotePublicKeySize] = {
+      0x91,0x67,0x14,0xc7,0x37,0x04,0xce,0x94,0x44,0x95,0x0f,0x28,0xda,0x0d,0xb1,0xe8,
+      0x47,0x6f,0xa9,0x55,0xdf,0x3d,0x03,0x4a,0xcb,0x9a,0xf5,0x17,0x7b,0x1f,0xc1,0x42,
+  };
+  static const uint8_t kScanOutputKey300[kCryptoNotePublicKeySize] = {
+      0x03,0xe2,0x1c,0x55,0xb8,0xd4,0x40,0xd5,0x5c,0xf7,0xf1,0x13,0x61,0x0d,0x88,0x51,
+      0x90,0x93,0x3e,0x51,0x62,0xbd,0x16,0x7d,0x18,0x6b,0x97,0x1a,0x67,0x84,0x2b,0xff,
+  };
+  // y = 2 is not on the curve.
+  static const uint8_t kInvalidTxKey[kCryptoNotePublicKeySize] = {2};
+  struct Case {
+    const uint8_t *tx_public_key;
+    uint64_t output_index;
+    const uint8_t *output_key;
+    bool owned;
+  };
+  static const Case kCases[] = {
+      {kScanTxKey, 0, kScanOutputKey0, true},
+      {kScanTxKey, 1, kScanOutputKey1, true},
+      {kScanOtherTxKey, 0, kScanOtherOutputKey, false},
+      {kScanTorsionTxKey, 300, kScanOutputKey300, true},
+      {kScanTxKey, 1, kScanOutputKey0, false},
+      {kInvalidTxKey, 0, kScanOutputKey0, false},
+      {kScanTxKey, 300, kScanOutputKey300, true},
+      {kScanOtherTxKey, 0, kScanOutputKey0, false},
+      {kScanTxKey, 0, kScanOutputKey0, true},
+      {kScanTorsionTxKey, 1, kScanOutputKey1, true},
+  };
+  constexpr size_t kCaseCount = sizeof(kCases) / sizeof(kCases[0]);
+  CryptoNoteOutput outputs[kCaseCount];
+  for (size_t index = 0; index < kCaseCount; ++index) {
+    memcpy(outputs[index].tx_public_key, kCases[index].tx_public_key, kCryptoNotePublicKeySize);
+    outputs[index].output_index = kCases[index].output_index;
+    memcpy(outputs[index].output_key, kCases[index].output_key, kCryptoNotePublicKeySize);
+  }
+  CryptoNoteScanner scanner;
+  bool owned[kCaseCount];
+  bool passed = cryptonote_scanner_init(&scanner, view_key, public_spend_key) == WalletError::Ok &&
+                cryptonote_scan_outputs(scanner, outputs, kCaseCount, owned) == WalletError::Ok;
+  for (size_t index = 0; passed && index < kCaseCount; ++index) {
+    passed = owned[index] == kCases[index].owned;
+  }
+  passed = passed && cryptonote_scanner_init(&scanner, view_key, kInvalidTxKey) ==
+                         WalletError::InvalidKey;
+  secure_zero(&scanner, sizeof(scanner));
+  return passed;
+}
+
+}  // namespace
+
 bool run_cryptonote_self_tests() {
   uint8_t seed[kCryptoNoteScalarSize] = {};
   uint8_t spend_key[kCryptoNoteScalarSize];
@@ -349,6 +472,14 @@ bool run_cryptonote_self_tests() {
       0xd4,0xb4,0xf5,0x78,0x48,0x68,0xc3,0x02,0x04,0x03,0x24,0x67,0x17,0xec,0x16,0x9f,
       0xf7,0x9e,0x26,0x60,0x8e,0xa1,0x26,0xa1,0xab,0x69,0xee,0x77,0xd1,0xb1,0x67,0x12,
   };
+  // (l - 1) * B is -B, which takes the top digit and flips the sign of x.
+  static const uint8_t kOrderMinusOne[kCryptoNoteScalarSize] = {
+      0xec,0xd3,0xf5,0x5c,0x1a,0x63,0x12,0x58,0xd6,0x9c,0xf7,0xa2,0xde,0xf9,0xde,0x14,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,
+  };
+  uint8_t negated_base[kCryptoNotePublicKeySize];
+  memcpy(negated_base, kBasePoint, sizeof(negated_base));
+  negated_base[kCryptoNotePublicKeySize - 1] |= 0x80;
   char address[kCryptoNoteStandardAddressSize];
   static const char kExpectedAddress[] =
       "44yQXfkWZNmJ8QgRfFWTzmJ8QgRfFWTzmJ8QgRfFWTzmJ7suhUXwdrD"
@@ -361,12 +492,47 @@ bool run_cryptonote_self_tests() {
       crypto_constant_time_equal(view_key, kExpectedViewKey, sizeof(view_key)) &&
       cryptonote_public_key_from_scalar(scalar, public_key) == WalletError::Ok &&
       crypto_constant_time_equal(public_key, kExpectedThreeTimesBasePoint, sizeof(public_key)) &&
+      cryptonote_public_key_from_scalar(kOrderMinusOne, public_key) == WalletError::Ok &&
+      crypto_constant_time_equal(public_key, negated_base, sizeof(public_key)) &&
+      cryptonote_public_key_from_scalar(seed, public_key) == WalletError::InvalidKey &&
       cryptonote_standard_address(kMoneroMainnet, kBasePoint, kBasePoint,
                                   address, sizeof(address)) == WalletError::Ok &&
       strcmp(address, kExpectedAddress) == 0;
   passed = passed && cryptonote_standard_address(kMasariMainnet, kBasePoint, kBasePoint,
                                                   address, sizeof(address)) == WalletError::Ok &&
            strcmp(address, kExpectedMasariAddress) == 0;
+  // Subaddresses of the zero-seed wallet. 0/0 is its standard address, and the
+  // 2/5 to 2/14 range crosses a batch boundary.
+  static const char *const kExpectedSubaddresses[] = {
+      "42z7XSCSbPzfRbbKcALdcZev4QXGGuoLh2x36LhaxLSxJ8BhY7tm4LPc4ZvLo1tmZvA1BtagEN9HkhLzmddcK2PxNj5aDL5",
+      "8AGiXjGVUbB7VkUZkmuThePWy9qnC7srpAomAafzkZN4Wka9v2f1b1XDFd1w5fpmkQKrweHLrBa3F3rSdDYbVCgkHkGGn8z",
+  };
+  static const char *const kExpectedRange[] = {
+      "8AiLHcu8vvi4TPp5Wug2XaPxy7sHMxkLWX9BzByPRcLBSLfHGRdiWfEDYPqkt6seSYRUQuY8LJ6iHL3LFf2aqT3k43YnVHf",
+      "87r54VbeTmCELpbFHS9h7zNVo5bdaHmmmPezFkSNWVbaFt9L6QG1KenWfp3zHCyCKEdt4tgui1GALKd3qAx5mPhc9CHgdM8",
+      "8AEocRF8KzNGgfvxCyHtie23pXfmpyWbC6E6dbHS1GjTYMK3VZBsHVdQnMxLxTqi2Y17uXcVMYMDFavoFdrFvihkQ4hU64o",
+      "86qpxSPBDo2Dn2CdnQdWBd95zFrxK7YgsJvoDqXJBmfnHHsEmxZec999nDB8m1rEpsfuo5wJZphRiT6rQg4687b7Mu3mgA2",
+      "86K2qe6Ru5Rb4YaqGFxZ8YhDNbhxRM9y45KiLGStwKteWndQHRjDTFXeYeRNFAqskQc7eDbSLqcvSbPKSQ329kraRceWGKu",
+      "85ypyQ8ZfHa8xHzMDaTimTVjfVNz7w5avDQfDovGfAWeNzowpb4kM77ZrgsqgwnBsVZeBbBNFLakYNczc24fS37M8maP1ri",
+      "8BVwNxrxJTKjkqccsjKZRqHyNhU7kAGy47r7ripYZFgk2F5sXhUNr6VN8wSAsKPbQuZdhw7eZCsENDeDQmu6H89RUo6n5KG",
+      "87ykatyBiSt4QTUFKRayKVKPWWSf7U33AAAxv3jjLDatEf56Sp6VzpP8wDxgtdeHuy4U1dMaTZYN6G4zAiWZitsG9jU1eMM",
+      "865bA9DmYoDNxAgzc4pkwCfXaokuUxWzqPhDaavpeSzu8fNKn3FEpoTYU2otrNnp3zTWb9HW9CF7LZbh3P8TNZfv3Ax6KM5",
+      "84KqCbpGwvCbM9EbGpNoKgerzJhzYieLWhzgLxJXfB3aZ349NgS8udGU4vDYAKaZax7ykA3THj5ocWEy8oD2QJK5NJgEi4J",
+  };
+  SubaddressCheck check = {kExpectedSubaddresses, 0, true};
+  passed = passed && cryptonote_public_key_from_scalar(spend_key, public_key) == WalletError::Ok &&
+           cryptonote_subaddress_range(kMoneroMainnet, view_key, public_key, 0, 0, 2,
+                                       check_subaddress, &check) == WalletError::Ok &&
+           check.passed && check.seen == 2;
+  check = {kExpectedRange, 0, true};
+  passed = passed && cryptonote_subaddress_range(kMoneroMainnet, view_key, public_key, 2, 5, 10,
+                                                 check_subaddress, &check) == WalletError::Ok &&
+           check.passed && check.seen == 10 &&
+           cryptonote_subaddress_range(kMasariMainnet, view_key, public_key, 0, 0, 1,
+                                       check_subaddress, &check) == WalletError::InvalidArgument &&
+           cryptonote_subaddress_range(kMoneroMainnet, view_key, public_key, 0, UINT32_MAX, 2,
+                                       check_subaddress, &check) == WalletError::InvalidArgument;
+  passed = passed && scan_outputs_match(view_key, public_key);
   secure_zero(address, sizeof(address));
   secure_zero(public_key, sizeof(public_key));
   secure_zero(scalar, sizeof(scalar));
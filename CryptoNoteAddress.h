@@ -5,6 +5,7 @@
 #include <stdint.h>
 
 #include "WalletSecurity.h"
+#include "local_ed25519.h"
 
 namespace hexwallet {
 
@@ -12,12 +13,18 @@ constexpr size_t kCryptoNoteScalarSize = 32;
 constexpr size_t kCryptoNotePublicKeySize = 32;
 constexpr size_t kCryptoNoteStandardAddressSize = 96;
 
+// subaddress_prefix is zero for networks whose subaddress prefix is not
+// configured here.
 struct CryptoNoteAddressProfile {
   uint64_t standard_address_prefix;
+  uint64_t subaddress_prefix;
 };
 
-constexpr CryptoNoteAddressProfile kMoneroMainnet = {18};
-constexpr CryptoNoteAddressProfile kMasariMainnet = {28};
+constexpr CryptoNoteAddressProfile kMoneroMainnet = {18, 42};
+constexpr CryptoNoteAddressProfile kMasariMainnet = {28, 0};
+
+// The profile with this standard address prefix, or nullptr.
+const CryptoNoteAddressProfile *cryptonote_find_profile(uint64_t standard_address_prefix);
 
 WalletError cryptonote_private_keys_from_seed(
     const uint8_t seed[kCryptoNoteScalarSize],
@@ -37,6 +44,62 @@ WalletError cryptonote_address_from_seed(
     char *out, size_t out_size,
     uint8_t out_spend_key[kCryptoNoteScalarSize]);
 
+// Subaddress major/minor of the wallet with private view key view_key and
+// public spend key public_spend_key. Index 0/0 is the standard address itself.
+struct CryptoNoteSubaddress {
+  uint32_t major;
+  uint32_t minor;
+  char address[kCryptoNoteStandardAddressSize];
+};
+
+// Receives each subaddress in minor order. address is cleared when result is
+// not Ok, and is wiped again once the visitor returns.
+using CryptoNoteSubaddressVisitor = void (*)(WalletError result,
+                                             const CryptoNoteSubaddress &subaddress,
+                                             void *context);
+// Derives count subaddresses major/first_minor onwards. The public spend key is
+// decoded and multiplied by the view key once for the whole range; each
+// subaddress then costs two fixed-base multiplies, and every
+// kCryptoNoteSubaddressBatchSize of them share one field inversion. Fails
+// with InvalidArgument when the profile has no subaddress prefix or the minor
+// index would wrap. Returns the first error, after visiting all.
+constexpr size_t kCryptoNoteSubaddressBatchSize = 8;
+WalletError cryptonote_subaddress_range(
+    const CryptoNoteAddressProfile &profile,
+    const uint8_t view_key[kCryptoNoteScalarSize],
+    const uint8_t public_spend_key[kCryptoNotePublicKeySize],
+    uint32_t major, uint32_t first_minor, uint32_t count,
+    CryptoNoteSubaddressVisitor visit, void *context);
+
+// One transaction output to check: the transaction public key R, the
+// output's position in the transaction, and its one-time key.
+struct CryptoNoteOutput {
+  uint8_t tx_public_key[kCryptoNotePublicKeySize];
+  uint64_t output_index;
+  uint8_t output_key[kCryptoNotePublicKeySize];
+};
+
+// Scanning state for one wallet: its private view key a and decoded public
+// spend key B, set up once per session. Holds the view key, so callers wipe
+// it with secure_zero().
+struct CryptoNoteScanner {
+  LocalEd25519TweakBase base;
+};
+
+WalletError cryptonote_scanner_init(CryptoNoteScanner *out,
+                                    const uint8_t view_key[kCryptoNoteScalarSize],
+                                    const uint8_t public_spend_key[kCryptoNotePublicKeySize]);
+// Sets out_owned[i] when output i pays the wallet's standard address, that is
+// when Hs(8 * a * R || varint(index)) * G + B is its output key. Outputs are
+// taken kCryptoNoteScanBatchSize at a time: outputs of one batch that share R
+// share its derivation, and the batch's derivations and its output keys each
+// share one field inversion. An R that is not a valid point marks its outputs
+// as not owned. Outputs paying subaddresses are not matched.
+constexpr size_t kCryptoNoteScanBatchSize = 8;
+WalletError cryptonote_scan_outputs(const CryptoNoteScanner &scanner,
+                                    const CryptoNoteOutput *outputs, size_t count,
+                                    bool *out_owned);
+
 bool run_cryptonote_self_tests();
 
 }  // namespace hexwallet
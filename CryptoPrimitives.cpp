@@ -1,12 +1,15 @@
 #include "CryptoPrimitives.h"
 
 #include <mbedtls/md.h>
-#include <mbedtls/pkcs5.h>
 #include <mbedtls/platform_util.h>
+#include <mbedtls/sha256.h>
+#include <mbedtls/sha512.h>
 #include <string.h>
 
 #include "keccak256.h"
 #include "local_ripemd160.h"
+#include "local_sha512.h"
+#include "WalletTrace.h"
 
 namespace hexwallet {
 namespace {
@@ -17,16 +20,69 @@ bool digest(mbedtls_md_type_t type, const uint8_t *data, size_t size, uint8_t *o
   return info != nullptr && mbedtls_md(info, data, size, out) == 0;
 }
 
-bool hmac(mbedtls_md_type_t type, const uint8_t *key, size_t key_size,
-          const uint8_t *data, size_t data_size, uint8_t *out) {
+struct Sha256Hash {
+  using Context = mbedtls_sha256_context;
+  static constexpr size_t kBlockSize = 64;
+  static constexpr size_t kDigestSize = kSha256Size;
+  static void init(Context *context) { mbedtls_sha256_init(context); }
+  static void free(Context *context) { mbedtls_sha256_free(context); }
+  static bool starts(Context *context) { return mbedtls_sha256_starts(context, 0) == 0; }
+  static bool update(Context *context, const uint8_t *data, size_t size) {
+    return mbedtls_sha256_update(context, data, size) == 0;
+  }
+  static bool finish(Context *context, uint8_t *out) { return mbedtls_sha256_finish(context, out) == 0; }
+};
+
+struct Sha512Hash {
+  using Context = mbedtls_sha512_context;
+  static constexpr size_t kBlockSize = 128;
+  static constexpr size_t kDigestSize = kSha512Size;
+  static void init(Context *context) { mbedtls_sha512_init(context); }
+  static void free(Context *context) { mbedtls_sha512_free(context); }
+  static bool starts(Context *context) { return mbedtls_sha512_starts(context, 0) == 0; }
+  static bool update(Context *context, const uint8_t *data, size_t size) {
+    return mbedtls_sha512_update(context, data, size) == 0;
+  }
+  static bool finish(Context *context, uint8_t *out) { return mbedtls_sha512_finish(context, out) == 0; }
+};
+
+// RFC 2104 HMAC on a stack hash context. mbedtls_md_hmac allocates its
+// context and key pads on the heap on every call, and BIP32 steps and
+// RFC 6979 nonces run HMAC several times per key.
+template <typename Hash>
+bool hmac(const uint8_t *key, size_t key_size, const uint8_t *data, size_t data_size,
+          uint8_t *out) {
   if (key == nullptr || out == nullptr || (data == nullptr && data_size != 0)) return false;
-  const mbedtls_md_info_t *info = mbedtls_md_info_from_type(type);
-  return info != nullptr && mbedtls_md_hmac(info, key, key_size, data, data_size, out) == 0;
+  HEXWALLET_TRACE_COUNT(Hmac, 1);
+  HEXWALLET_TRACE_COUNT(HashBytes, 2 * Hash::kBlockSize + data_size + Hash::kDigestSize);
+  typename Hash::Context context;
+  uint8_t pad[Hash::kBlockSize] = {};
+  uint8_t inner[Hash::kDigestSize];
+  Hash::init(&context);
+  bool ok = true;
+  if (key_size > sizeof(pad)) {
+    ok = Hash::starts(&context) && Hash::update(&context, key, key_size) &&
+         Hash::finish(&context, pad);
+  } else {
+    memcpy(pad, key, key_size);
+  }
+  for (size_t index = 0; index < sizeof(pad); ++index) pad[index] ^= 0x36;
+  ok = ok && Hash::starts(&context) && Hash::update(&context, pad, sizeof(pad)) &&
+       Hash::update(&context, data, data_size) && Hash::finish(&context, inner);
+  for (size_t index = 0; index < sizeof(pad); ++index) pad[index] ^= 0x36 ^ 0x5c;
+  ok = ok && Hash::starts(&context) && Hash::update(&context, pad, sizeof(pad)) &&
+       Hash::update(&context, inner, sizeof(inner)) && Hash::finish(&context, out);
+  Hash::free(&context);
+  mbedtls_platform_zeroize(&context, sizeof(context));
+  mbedtls_platform_zeroize(pad, sizeof(pad));
+  mbedtls_platform_zeroize(inner, sizeof(inner));
+  return ok;
 }
 
 }  // namespace
 
 bool crypto_sha256(const uint8_t *data, size_t size, uint8_t out[kSha256Size]) {
+  HEXWALLET_TRACE_COUNT(HashBytes, size);
   return digest(MBEDTLS_MD_SHA256, data, size, out);
 }
 
@@ -39,12 +95,12 @@ bool crypto_double_sha256(const uint8_t *data, size_t size, uint8_t out[kSha256S
 
 bool crypto_hmac_sha256(const uint8_t *key, size_t key_size, const uint8_t *data,
                         size_t data_size, uint8_t out[kSha256Size]) {
-  return hmac(MBEDTLS_MD_SHA256, key, key_size, data, data_size, out);
+  return hmac<Sha256Hash>(key, key_size, data, data_size, out);
 }
 
 bool crypto_hmac_sha512(const uint8_t *key, size_t key_size, const uint8_t *data,
                         size_t data_size, uint8_t out[kSha512Size]) {
-  return hmac(MBEDTLS_MD_SHA512, key, key_size, data, data_size, out);
+  return hmac<Sha512Hash>(key, key_size, data, data_size, out);
 }
 
 bool crypto_pbkdf2_sha256(const uint8_t *password, size_t password_size,
@@ -54,21 +110,53 @@ bool crypto_pbkdf2_sha256(const uint8_t *password, size_t password_size,
       out_size == 0 || out_size > UINT32_MAX) {
     return false;
   }
-  const int result = mbedtls_pkcs5_pbkdf2_hmac_ext(
-      MBEDTLS_MD_SHA256, password, password_size, salt, salt_size,
-      iterations, static_cast<uint32_t>(out_size), out);
-  return result == 0;
+  return local_pbkdf2_hmac_sha256(password, password_size, salt, salt_size, iterations,
+                                  out, out_size);
+}
+
+bool crypto_pbkdf2_sha256_begin(Pbkdf2Sha256Job *job, const uint8_t *password,
+                                size_t password_size, const uint8_t *salt, size_t salt_size,
+                                uint32_t iterations) {
+  if (job == nullptr || password == nullptr || salt == nullptr || iterations == 0) return false;
+  return local_pbkdf2_sha256_begin(job, password, password_size, salt, salt_size, iterations, 1);
+}
+
+bool crypto_pbkdf2_sha256_step(Pbkdf2Sha256Job *job, uint32_t max_iterations) {
+  return local_pbkdf2_sha256_step(job, max_iterations);
+}
+
+bool crypto_pbkdf2_sha256_finish(Pbkdf2Sha256Job *job, uint8_t out[kSha256Size]) {
+  return local_pbkdf2_sha256_finish(job, out);
+}
+
+void crypto_pbkdf2_sha256_clear(Pbkdf2Sha256Job *job) {
+  local_pbkdf2_sha256_clear(job);
+}
+
+// BIP39 seed derivation runs 2048 iterations on every import and unlock, so it
+// uses the in-tree midstate PBKDF2 instead of the per-iteration mbedtls HMAC.
+bool crypto_pbkdf2_sha512(const uint8_t *password, size_t password_size,
+                          const uint8_t *salt, size_t salt_size, uint32_t iterations,
+                          uint8_t *out, size_t out_size) {
+  if (password == nullptr || salt == nullptr || out == nullptr || iterations == 0 ||
+      out_size == 0 || out_size > UINT32_MAX) {
+    return false;
+  }
+  return local_pbkdf2_hmac_sha512(password, password_size, salt, salt_size, iterations,
+                                  out, out_size);
 }
 
 bool crypto_hash160(const uint8_t *data, size_t size, uint8_t out[kRipemd160Size]) {
   uint8_t sha[kSha256Size];
   if (!crypto_sha256(data, size, sha)) return false;
+  HEXWALLET_TRACE_COUNT(HashBytes, sizeof(sha));
   local_ripemd160(sha, sizeof(sha), out);
   mbedtls_platform_zeroize(sha, sizeof(sha));
   return true;
 }
 
 bool crypto_keccak256(const uint8_t *data, size_t size, uint8_t out[kKeccak256Size]) {
+  HEXWALLET_TRACE_COUNT(HashBytes, size);
   SHA3_CTX context;
   keccak_init(&context);
   const bool ok = keccak_update(&context, data, size) && keccak_final(&context, out);
@@ -96,17 +184,53 @@ bool run_crypto_self_tests() {
       0x9c,0x11,0x85,0xa5,0xc5,0xe9,0xfc,0x54,0x61,0x28,0x08,0x97,0x7e,0xe8,0xf5,0x48,
       0xb2,0x25,0x8d,0x31,
   };
+  // RFC 4231 test case 2.
+  static const uint8_t kHmacKey[] = {'J','e','f','e'};
+  static const uint8_t kHmacData[] = "what do ya want for nothing?";
+  static const uint8_t kHmacSha256[kSha256Size] = {
+      0x5b,0xdc,0xc1,0x46,0xbf,0x60,0x75,0x4e,0x6a,0x04,0x24,0x26,0x08,0x95,0x75,0xc7,
+      0x5a,0x00,0x3f,0x08,0x9d,0x27,0x39,0x83,0x9d,0xec,0x58,0xb9,0x64,0xec,0x38,0x43,
+  };
+  static const uint8_t kHmacSha512[kSha512Size] = {
+      0x16,0x4b,0x7a,0x7b,0xfc,0xf8,0x19,0xe2,0xe3,0x95,0xfb,0xe7,0x3b,0x56,0xe0,0xa3,
+      0x87,0xbd,0x64,0x22,0x2e,0x83,0x1f,0xd6,0x10,0x27,0x0c,0xd7,0xea,0x25,0x05,0x54,
+      0x97,0x58,0xbf,0x75,0xc0,0x5a,0x99,0x4a,0x6d,0x03,0x4f,0x65,0xf8,0xf0,0xe6,0xfd,
+      0xca,0xea,0xb1,0xa3,0x4d,0x4a,0x6b,0x4b,0x63,0x6e,0x07,0x0a,0x38,0xbc,0xe7,0x37,
+  };
+  // PBKDF2-HMAC-SHA256("password", "salt", c = 4096), run in five slices.
+  static const uint8_t kPassword[] = {'p','a','s','s','w','o','r','d'};
+  static const uint8_t kSalt[] = {'s','a','l','t'};
+  static const uint8_t kPbkdf2Sha256[kSha256Size] = {
+      0xc5,0xe4,0x78,0xd5,0x92,0x88,0xc8,0x41,0xaa,0x53,0x0d,0xb6,0x84,0x5c,0x4c,0x8d,
+      0x96,0x28,0x93,0xa0,0x01,0xce,0x4e,0x11,0xa4,0x96,0x38,0x73,0xaa,0x98,0x13,0x4a,
+  };
   static const uint8_t kAbc[] = {'a','b','c'};
   uint8_t actual[kSha256Size];
+  uint8_t long_actual[kSha512Size];
   bool passed = crypto_sha256(kAbc, sizeof(kAbc), actual) &&
                 crypto_constant_time_equal(actual, kAbcSha, sizeof(actual));
+  passed = passed &&
+           crypto_hmac_sha256(kHmacKey, sizeof(kHmacKey), kHmacData, sizeof(kHmacData) - 1, actual) &&
+           crypto_constant_time_equal(actual, kHmacSha256, sizeof(actual)) &&
+           crypto_hmac_sha512(kHmacKey, sizeof(kHmacKey), kHmacData, sizeof(kHmacData) - 1,
+                              long_actual) &&
+           crypto_constant_time_equal(long_actual, kHmacSha512, sizeof(long_actual));
   passed = passed && crypto_keccak256(nullptr, 0, actual) &&
            crypto_constant_time_equal(actual, kEmptyKeccak, sizeof(actual));
+  Pbkdf2Sha256Job job;
+  const bool started = crypto_pbkdf2_sha256_begin(&job, kPassword, sizeof(kPassword), kSalt,
+                                                  sizeof(kSalt), 4096);
+  size_t slices = 1;
+  while (started && !crypto_pbkdf2_sha256_step(&job, 1000)) ++slices;
+  passed = passed && started && slices == 5 && crypto_pbkdf2_sha256_finish(&job, actual) &&
+           crypto_constant_time_equal(actual, kPbkdf2Sha256, sizeof(actual));
+  crypto_pbkdf2_sha256_clear(&job);
   uint8_t short_actual[kRipemd160Size];
   local_ripemd160(nullptr, 0, short_actual);
   passed = passed && crypto_constant_time_equal(short_actual, kEmptyRipemd, sizeof(short_actual));
   mbedtls_platform_zeroize(actual, sizeof(actual));
   mbedtls_platform_zeroize(short_actual, sizeof(short_actual));
+  mbedtls_platform_zeroize(long_actual, sizeof(long_actual));
   return passed;
 }
 
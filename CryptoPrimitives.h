@@ -4,6 +4,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "local_sha256.h"
+
 namespace hexwallet {
 
 constexpr size_t kSha256Size = 32;
@@ -20,6 +22,19 @@ bool crypto_hmac_sha512(const uint8_t *key, size_t key_size, const uint8_t *data
 bool crypto_pbkdf2_sha256(const uint8_t *password, size_t password_size,
                           const uint8_t *salt, size_t salt_size, uint32_t iterations,
                           uint8_t *out, size_t out_size);
+// One 32-byte PBKDF2-HMAC-SHA256 block advanced in bounded slices, so a long
+// derivation does not hold the main loop. step() returns true once every
+// iteration has run; finish() and clear() wipe the password midstates.
+using Pbkdf2Sha256Job = LocalPbkdf2Sha256;
+bool crypto_pbkdf2_sha256_begin(Pbkdf2Sha256Job *job, const uint8_t *password,
+                                size_t password_size, const uint8_t *salt, size_t salt_size,
+                                uint32_t iterations);
+bool crypto_pbkdf2_sha256_step(Pbkdf2Sha256Job *job, uint32_t max_iterations);
+bool crypto_pbkdf2_sha256_finish(Pbkdf2Sha256Job *job, uint8_t out[kSha256Size]);
+void crypto_pbkdf2_sha256_clear(Pbkdf2Sha256Job *job);
+bool crypto_pbkdf2_sha512(const uint8_t *password, size_t password_size,
+                          const uint8_t *salt, size_t salt_size, uint32_t iterations,
+                          uint8_t *out, size_t out_size);
 bool crypto_hash160(const uint8_t *data, size_t size, uint8_t out[kRipemd160Size]);
 bool crypto_keccak256(const uint8_t *data, size_t size, uint8_t out[kKeccak256Size]);
 bool crypto_constant_time_equal(const uint8_t *left, const uint8_t *right, size_t size);
@@ -5,6 +5,7 @@
 
 #include "WalletConfig.h"
 #include "WalletSecurity.h"
+#include "WalletTrace.h"
 
 namespace hexwallet {
 namespace {
@@ -343,6 +344,7 @@ EvmTransactionError evm_parse_transaction(const uint8_t *transaction,
       transaction_size > kEvmMaxUnsignedTransactionSize ||
       network.encoding != AddressEncoding::Evm || network.evm_chain_id == 0 ||
       address_index >= kHardenedOffset) return EvmTransactionError::InvalidArgument;
+  HEXWALLET_TRACE_SCOPE(EvmParseTransaction);
   EvmSigningRequest parsed = {};
   parsed.network = &network;
   parsed.address_index = address_index;
@@ -1,11 +1,10 @@
 #include "WalletAddresses.h"
 
 #include <string.h>
-#include <string>
-#include <vector>
 
 #include "base58.h"
 #include "CryptoPrimitives.h"
+#include "local_bech32.h"
 #include "local_segwit.h"
 
 namespace hexwallet {
@@ -17,9 +16,13 @@ constexpr size_t kMaximumBase58PayloadSize = 78;
 constexpr size_t kMaximumBase58CheckedSize = kMaximumBase58PayloadSize + kBase58ChecksumSize;
 constexpr size_t kVersionedHash160Size = kVersionSize + kRipemd160Size;
 constexpr uint8_t kWitnessVersionZeroOpcode = 0x00;
+// Witness version plus a 20-byte program in 5-bit groups.
+constexpr size_t kP2wpkhValueCount = 1 + kRipemd160Size * 8 / 5;
 
-WalletError base58check(const uint8_t *payload, size_t payload_size, bool ripple_alphabet,
-                        char *out, size_t *in_out_size) {
+}  // namespace
+
+WalletError address_base58check(const uint8_t *payload, size_t payload_size, bool ripple_alphabet,
+                                char *out, size_t *in_out_size) {
   if (payload == nullptr || out == nullptr || in_out_size == nullptr ||
       payload_size > kMaximumBase58PayloadSize) {
     return WalletError::InvalidArgument;
@@ -41,7 +44,31 @@ WalletError base58check(const uint8_t *payload, size_t payload_size, bool ripple
   return ok ? WalletError::Ok : WalletError::BufferTooSmall;
 }
 
-}  // namespace
+WalletError address_p2wpkh_text(const char *hrp, const uint8_t program[kRipemd160Size],
+                                char *out, size_t out_size) {
+  if (hrp == nullptr || program == nullptr || out == nullptr) return WalletError::InvalidArgument;
+  const size_t required = strlen(hrp) + 1 + kP2wpkhValueCount + bech32::kChecksumLength + 1;
+  if (required > out_size) return WalletError::BufferTooSmall;
+  return segwit_address::encode(out, out_size, hrp, 0, program, kRipemd160Size) == 0
+             ? WalletError::CryptoFailure
+             : WalletError::Ok;
+}
+
+WalletError address_evm_text(const uint8_t account[kEvmAccountSize], char *out, size_t out_size) {
+  constexpr size_t kTextSize = 2 + kEvmAccountSize * 2 + 1;
+  if (account == nullptr || out == nullptr || out_size < kTextSize) {
+    return out_size < kTextSize ? WalletError::BufferTooSmall : WalletError::InvalidArgument;
+  }
+  static constexpr char kHex[] = "0123456789abcdef";
+  out[0] = '0';
+  out[1] = 'x';
+  for (size_t index = 0; index < kEvmAccountSize; ++index) {
+    out[2 + index * 2] = kHex[account[index] >> 4];
+    out[3 + index * 2] = kHex[account[index] & 0x0f];
+  }
+  out[kTextSize - 1] = '\0';
+  return WalletError::Ok;
+}
 
 WalletError address_p2pkh(const UtxoAddressProfile &profile,
                           const uint8_t public_key[kCompressedPublicKeySize],
@@ -55,8 +82,8 @@ WalletError address_p2pkh(const UtxoAddressProfile &profile,
     secure_zero(payload, sizeof(payload));
     return WalletError::CryptoFailure;
   }
-  const WalletError result = base58check(payload, sizeof(payload), profile.ripple_alphabet,
-                                         out, in_out_size);
+  const WalletError result = address_base58check(payload, sizeof(payload), profile.ripple_alphabet,
+                                                 out, in_out_size);
   secure_zero(payload, sizeof(payload));
   return result;
 }
@@ -84,8 +111,8 @@ WalletError address_p2sh_p2wpkh(const UtxoAddressProfile &profile,
     secure_zero(payload, sizeof(payload));
     return WalletError::CryptoFailure;
   }
-  const WalletError result = base58check(payload, sizeof(payload), profile.ripple_alphabet,
-                                         out, in_out_size);
+  const WalletError result = address_base58check(payload, sizeof(payload), profile.ripple_alphabet,
+                                                 out, in_out_size);
   secure_zero(payload, sizeof(payload));
   return result;
 }
@@ -100,20 +127,14 @@ WalletError address_p2wpkh(const UtxoAddressProfile &profile,
   if (!crypto_hash160(public_key, kCompressedPublicKeySize, witness_key_hash)) {
     return WalletError::CryptoFailure;
   }
-  const std::vector<uint8_t> program(witness_key_hash, witness_key_hash + sizeof(witness_key_hash));
-  const std::string address = segwit_address::encode(profile.bech32_hrp, 0, program);
+  const WalletError result = address_p2wpkh_text(profile.bech32_hrp, witness_key_hash, out, out_size);
   secure_zero(witness_key_hash, sizeof(witness_key_hash));
-  if (address.empty() || address.size() + 1 > out_size) {
-    return address.empty() ? WalletError::CryptoFailure : WalletError::BufferTooSmall;
-  }
-  memcpy(out, address.c_str(), address.size() + 1);
-  return WalletError::Ok;
+  return result;
 }
 
 WalletError address_evm(const uint8_t public_key[kUncompressedPublicKeySize],
                         char *out, size_t out_size) {
-  constexpr size_t kAddressBytes = 20;
-  constexpr size_t kTextSize = 2 + kAddressBytes * 2 + 1;
+  constexpr size_t kTextSize = 2 + kEvmAccountSize * 2 + 1;
   if (public_key == nullptr || out == nullptr || out_size < kTextSize || public_key[0] != 0x04) {
     return out_size < kTextSize ? WalletError::BufferTooSmall : WalletError::InvalidArgument;
   }
@@ -121,17 +142,9 @@ WalletError address_evm(const uint8_t public_key[kUncompressedPublicKeySize],
   if (!crypto_keccak256(public_key + 1, kUncompressedPublicKeySize - 1, digest)) {
     return WalletError::CryptoFailure;
   }
-  static constexpr char kHex[] = "0123456789abcdef";
-  out[0] = '0';
-  out[1] = 'x';
-  const uint8_t *address = digest + kKeccak256Size - kAddressBytes;
-  for (size_t index = 0; index < kAddressBytes; ++index) {
-    out[2 + index * 2] = kHex[address[index] >> 4];
-    out[3 + index * 2] = kHex[address[index] & 0x0f];
-  }
-  out[kTextSize - 1] = '\0';
+  const WalletError result = address_evm_text(digest + kKeccak256Size - kEvmAccountSize, out, out_size);
   secure_zero(digest, sizeof(digest));
-  return WalletError::Ok;
+  return result;
 }
 
 WalletError address_keccak_base58(uint8_t version,
@@ -141,14 +154,24 @@ WalletError address_keccak_base58(uint8_t version,
     return WalletError::InvalidArgument;
   }
   uint8_t digest[kKeccak256Size];
-  uint8_t payload[1 + kRipemd160Size];
   if (!crypto_keccak256(public_key + 1, kUncompressedPublicKeySize - 1, digest)) {
     return WalletError::CryptoFailure;
   }
-  payload[0] = version;
-  memcpy(payload + 1, digest + kKeccak256Size - kRipemd160Size, kRipemd160Size);
-  const WalletError result = base58check(payload, sizeof(payload), false, out, in_out_size);
+  const WalletError result = address_keccak_base58_text(version, digest + kKeccak256Size - kEvmAccountSize,
+                                                        out, in_out_size);
   secure_zero(digest, sizeof(digest));
+  return result;
+}
+
+WalletError address_keccak_base58_text(uint8_t version, const uint8_t account[kEvmAccountSize],
+                                       char *out, size_t *in_out_size) {
+  if (account == nullptr || out == nullptr || in_out_size == nullptr) {
+    return WalletError::InvalidArgument;
+  }
+  uint8_t payload[1 + kEvmAccountSize];
+  payload[0] = version;
+  memcpy(payload + 1, account, kEvmAccountSize);
+  const WalletError result = address_base58check(payload, sizeof(payload), false, out, in_out_size);
   secure_zero(payload, sizeof(payload));
   return result;
 }
@@ -158,12 +181,7 @@ WalletError address_from_script(const UtxoAddressProfile &profile,
                                 char *out, size_t out_size) {
   if (script == nullptr || out == nullptr || out_size == 0) return WalletError::InvalidArgument;
   if (script_size == 22 && script[0] == 0x00 && script[1] == 0x14 && profile.bech32_hrp != nullptr) {
-    const std::vector<uint8_t> program(script + 2, script + 22);
-    const std::string address = segwit_address::encode(profile.bech32_hrp, 0, program);
-    if (address.empty()) return WalletError::CryptoFailure;
-    if (address.size() + 1 > out_size) return WalletError::BufferTooSmall;
-    memcpy(out, address.c_str(), address.size() + 1);
-    return WalletError::Ok;
+    return address_p2wpkh_text(profile.bech32_hrp, script + 2, out, out_size);
   }
   uint8_t payload[kVersionedHash160Size];
   if (script_size == 25 && script[0] == 0x76 && script[1] == 0xa9 && script[2] == 0x14 &&
@@ -177,8 +195,8 @@ WalletError address_from_script(const UtxoAddressProfile &profile,
     return WalletError::InvalidArgument;
   }
   size_t encoded_size = out_size;
-  const WalletError result = base58check(payload, sizeof(payload), profile.ripple_alphabet,
-                                         out, &encoded_size);
+  const WalletError result = address_base58check(payload, sizeof(payload), profile.ripple_alphabet,
+                                                 out, &encoded_size);
   secure_zero(payload, sizeof(payload));
   return result;
 }
@@ -4,6 +4,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "CryptoPrimitives.h"
 #include "WalletSecurity.h"
 
 namespace hexwallet {
@@ -19,6 +20,7 @@ struct UtxoAddressProfile {
 
 constexpr UtxoAddressProfile kBitcoinMainnet = {0x00, 0x05, "bc", false};
 constexpr UtxoAddressProfile kBitcoinTestnet = {0x6f, 0xc4, "tb", false};
+constexpr size_t kEvmAccountSize = 20;
 
 WalletError address_p2pkh(const UtxoAddressProfile &profile,
                           const uint8_t public_key[kCompressedPublicKeySize],
@@ -34,6 +36,14 @@ WalletError address_evm(const uint8_t public_key[kUncompressedPublicKeySize],
 WalletError address_keccak_base58(uint8_t version,
                                   const uint8_t public_key[kUncompressedPublicKeySize],
                                   char *out, size_t *in_out_size);
+// The text step of the encoders above, from a hash the caller already holds.
+WalletError address_base58check(const uint8_t *payload, size_t payload_size, bool ripple_alphabet,
+                                char *out, size_t *in_out_size);
+WalletError address_p2wpkh_text(const char *hrp, const uint8_t program[kRipemd160Size],
+                                char *out, size_t out_size);
+WalletError address_evm_text(const uint8_t account[kEvmAccountSize], char *out, size_t out_size);
+WalletError address_keccak_base58_text(uint8_t version, const uint8_t account[kEvmAccountSize],
+                                       char *out, size_t *in_out_size);
 WalletError address_from_script(const UtxoAddressProfile &profile,
                                 const uint8_t *script, size_t script_size,
                                 char *out, size_t out_size);
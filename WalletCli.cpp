@@ -15,6 +15,7 @@
 #include "WalletSecurity.h"
 #include "WalletSession.h"
 #include "WalletTokens.h"
+#include "WalletTrace.h"
 #include "WalletTransportPolicy.h"
 #include "WalletUi.h"
 
@@ -27,6 +28,7 @@ constexpr char kProvisionedKey[] = "provisioned";
 constexpr char kSaltKey[] = "auth_salt";
 constexpr char kVerifierKey[] = "auth_verifier";
 constexpr char kFailuresKey[] = "auth_failures";
+constexpr char kIterationsKey[] = "auth_iters";
 constexpr size_t kSaltSize = 16;
 constexpr size_t kVerifierSize = kSha256Size;
 constexpr size_t kChallengeSize = kSha256Size;
@@ -35,6 +37,7 @@ constexpr size_t kMinimumPinSize = 8;
 constexpr size_t kMaximumPinSize = 64;
 constexpr uint32_t kMaximumBackoffMs = 10UL * 60UL * 1000UL;
 constexpr uint32_t kTransactionApprovalMs = 2UL * 60UL * 1000UL;
+constexpr uint32_t kMaximumAddressRange = 1000;
 
 Preferences preferences;
 bool preferences_open = false;
@@ -46,6 +49,9 @@ uint32_t authenticated_at = 0;
 uint32_t retry_after = 0;
 uint8_t salt[kSaltSize];
 uint8_t verifier[kVerifierSize];
+uint32_t verifier_iterations = HEXWALLET_CLI_PBKDF2_ITERATIONS;
+bool provisioning_active = false;
+Pbkdf2Sha256Job provisioning_job;
 uint8_t challenge[kChallengeSize];
 char line_buffer[kLineSize];
 size_t line_used = 0;
@@ -56,6 +62,27 @@ PendingTransactionKind pending_transaction_kind = PendingTransactionKind::None;
 bool transaction_pending = false;
 uint32_t transaction_approval = 0;
 uint32_t transaction_expires_at = 0;
+// The scanner for the network last scanned, kept for the unlocked session so
+// later wallet scan lines skip the path walk and the view-key multiply.
+CryptoNoteScanner session_scanner;
+const NetworkProfile *session_scanner_network = nullptr;
+#if HEXWALLET_TRACE_MEMORY
+// Lines are filed under the command they start with, and anything else under
+// "other", so arguments such as PINs and mnemonics never reach the table.
+constexpr const char *kMeasuredCommands[] = {
+  "help", "status", "perf", "coin list", "coin search", "coin show", "token list", "token show",
+  "auth begin", "auth unlock", "auth provision", "lock", "selftest", "wallet generate",
+  "wallet import", "wallet address", "wallet token", "wallet xpub", "wallet addresses",
+  "wallet subaddresses", "wallet scan", "wallet secret", "tx inspect", "tx sign", "tx reject",
+  "evm inspect", "evm sign", "other",
+};
+constexpr size_t kMeasuredCommandCount = sizeof(kMeasuredCommands) / sizeof(kMeasuredCommands[0]);
+struct CommandMemory {
+  uint32_t runs;
+  TraceMemoryStats worst;
+};
+CommandMemory command_memory[kMeasuredCommandCount];
+#endif
 
 bool deadline_reached(uint32_t now, uint32_t deadline) {
   return static_cast<int32_t>(now - deadline) >= 0;
@@ -129,8 +156,14 @@ void clear_pending_transaction() {
   transaction_expires_at = 0;
 }
 
+void clear_session_scanner() {
+  secure_zero(&session_scanner, sizeof(session_scanner));
+  session_scanner_network = nullptr;
+}
+
 void clear_wallet() {
   clear_pending_transaction();
+  clear_session_scanner();
   wallet_session_clear();
 }
 
@@ -192,8 +225,15 @@ uint32_t parse_index(const char *text, bool *ok) {
 
 void show_help() {
   Serial.println("OK public: help | status | coin list | coin search <text> | coin show <id> | token list [network] | token show <id>");
+#if HEXWALLET_TRACE && HEXWALLET_TRACE_MEMORY
+  Serial.println("OK trace: perf | perf memory | perf reset");
+#elif HEXWALLET_TRACE
+  Serial.println("OK trace: perf | perf reset");
+#elif HEXWALLET_TRACE_MEMORY
+  Serial.println("OK trace: perf memory | perf reset");
+#endif
   Serial.println("OK auth: auth provision <pin> <pin> | auth begin | auth unlock <proof-hex> | lock");
-  Serial.println("OK wallet: wallet generate | wallet import <mnemonic> | wallet address <id> [index] | wallet token <id> [index] | wallet addresses [index]");
+  Serial.println("OK wallet: wallet generate | wallet import <mnemonic> | wallet address <id> [index] | wallet token <id> [index] | wallet xpub <id> [account] | wallet addresses [index] | wallet addresses <id> <start> <count> | wallet subaddresses <id> <major> <minor> <count> | wallet scan <id> <tx-key> <index> <output-key> [...]");
   Serial.println("OK signing: tx inspect <psbt-v0-hex> | tx sign <code> | evm inspect <network> <index> <unsigned-rlp-hex> | evm sign <code> | tx reject");
 #if HEXWALLET_ENABLE_SECRET_EXPORT
   Serial.println("OK sensitive: wallet secret [index] | selftest");
@@ -203,18 +243,81 @@ void show_help() {
 }
 
 void show_status() {
-  Serial.print("OK provisioned="); Serial.print(provisioned ? "yes" : "no");
+  Serial.print("OK provisioned=");
+  Serial.print(provisioned ? "yes" : (provisioning_active ? "pending" : "no"));
   Serial.print(" authenticated="); Serial.print(authenticated ? "yes" : "no");
   Serial.print(" display="); Serial.print(display_is_available ? "available" : "absent");
   Serial.print(" wallet="); Serial.print(wallet_session_is_loaded() ? "loaded" : "empty");
   Serial.print(" pending-tx="); Serial.println(transaction_pending ? "yes" : "no");
 }
 
+// Counters and timers accumulate from boot or the last perf reset. They show
+// which signing and unlock commands have run, so they need an unlocked session.
+void show_perf() {
+  if (!require_authentication()) return;
+#if HEXWALLET_TRACE
+  Serial.print("OK perf");
+  for (size_t index = 0; index < kTraceCounterCount; ++index) {
+    const TraceCounter counter = static_cast<TraceCounter>(index);
+    Serial.print(' '); Serial.print(trace_counter_name(counter));
+    Serial.print('='); Serial.print(static_cast<unsigned long long>(trace_counter_value(counter)));
+  }
+  Serial.println();
+  for (size_t index = 0; index < kTraceTimerCount; ++index) {
+    const TraceTimer timer = static_cast<TraceTimer>(index);
+    const TraceTimerStats stats = trace_timer_stats(timer);
+    Serial.print("OK perf "); Serial.print(trace_timer_name(timer));
+    Serial.print(" calls="); Serial.print(static_cast<unsigned long>(stats.calls));
+    Serial.print(" total-us="); Serial.print(static_cast<unsigned long long>(stats.total_us));
+    Serial.print(" max-us="); Serial.println(static_cast<unsigned long>(stats.max_us));
+  }
+#else
+  Serial.println("ERR trace-disabled; build with HEXWALLET_TRACE=1");
+#endif
+}
+
+void show_perf_memory() {
+  if (!require_authentication()) return;
+#if HEXWALLET_TRACE_MEMORY
+  Serial.print("OK memory stack-free-min="); Serial.print(static_cast<unsigned long>(trace_stack_free_minimum()));
+  Serial.print(" painted="); Serial.println(static_cast<unsigned long>(HEXWALLET_TRACE_STACK_BYTES));
+  for (size_t index = 0; index < kMeasuredCommandCount; ++index) {
+    const CommandMemory &entry = command_memory[index];
+    if (entry.runs == 0) continue;
+    Serial.print("OK memory "); Serial.print(kMeasuredCommands[index]);
+    Serial.print(" runs="); Serial.print(static_cast<unsigned long>(entry.runs));
+    Serial.print(" stack="); Serial.print(entry.worst.stack_saturated ? ">=" : "");
+    Serial.print(static_cast<unsigned long>(entry.worst.stack_bytes));
+    Serial.print(" heap-peak="); Serial.print(static_cast<unsigned long>(entry.worst.heap_peak_bytes));
+    Serial.print(" allocs="); Serial.println(static_cast<unsigned long>(entry.worst.allocations));
+  }
+#else
+  Serial.println("ERR memory-trace-disabled; build with HEXWALLET_TRACE_MEMORY=1");
+#endif
+}
+
+void reset_perf() {
+  if (!require_authentication()) return;
+#if HEXWALLET_TRACE || HEXWALLET_TRACE_MEMORY
+  trace_reset();
+#if HEXWALLET_TRACE_MEMORY
+  memset(command_memory, 0, sizeof(command_memory));
+#endif
+  Serial.println("OK perf reset");
+#else
+  Serial.println("ERR trace-disabled; build with HEXWALLET_TRACE=1");
+#endif
+}
+
 void provision_pin(char *arguments) {
   if (provisioned) {
     Serial.println("ERR already-provisioned");
     return;
   }
+  if (provisioning_active) {
+    Serial.println("ERR provisioning-in-progress");
+    return;
+  }
   char *separator = strchr(arguments, ' ');
   if (separator == nullptr) {
     Serial.println("ERR confirmation-required");
@@ -230,14 +333,33 @@ void provision_pin(char *arguments) {
     return;
   }
   esp_fill_random(salt, sizeof(salt));
-  uint8_t new_verifier[kVerifierSize];
-  const bool derived = crypto_pbkdf2_sha256(reinterpret_cast<const uint8_t *>(arguments), pin_size,
-                                             salt, sizeof(salt), HEXWALLET_CLI_PBKDF2_ITERATIONS,
-                                             new_verifier, sizeof(new_verifier));
+  const bool started = crypto_pbkdf2_sha256_begin(&provisioning_job,
+                                                  reinterpret_cast<const uint8_t *>(arguments),
+                                                  pin_size, salt, sizeof(salt),
+                                                  HEXWALLET_CLI_PBKDF2_ITERATIONS);
   secure_zero(arguments, pin_size);
   secure_zero(separator, pin_size);
-  if (!derived || preferences.putBytes(kSaltKey, salt, sizeof(salt)) != sizeof(salt) ||
+  if (!started) {
+    crypto_pbkdf2_sha256_clear(&provisioning_job);
+    Serial.println("ERR provisioning-failed");
+    return;
+  }
+  provisioning_active = true;
+  Serial.print("OK provisioning iterations="); Serial.print(HEXWALLET_CLI_PBKDF2_ITERATIONS);
+  Serial.println("; wait for OK provisioned");
+}
+
+// Advances a started provisioning by one slice and stores the verifier once
+// the derivation is complete. The job holds PIN-equivalent midstates until then.
+void continue_provisioning() {
+  if (!crypto_pbkdf2_sha256_step(&provisioning_job, HEXWALLET_CLI_PBKDF2_SLICE_ITERATIONS)) return;
+  provisioning_active = false;
+  uint8_t new_verifier[kVerifierSize];
+  const uint32_t iterations = HEXWALLET_CLI_PBKDF2_ITERATIONS;
+  if (!crypto_pbkdf2_sha256_finish(&provisioning_job, new_verifier) ||
+      preferences.putBytes(kSaltKey, salt, sizeof(salt)) != sizeof(salt) ||
       preferences.putBytes(kVerifierKey, new_verifier, sizeof(new_verifier)) != sizeof(new_verifier) ||
+      preferences.putUInt(kIterationsKey, iterations) != sizeof(iterations) ||
       preferences.putBool(kProvisionedKey, true) == 0) {
     secure_zero(new_verifier, sizeof(new_verifier));
     Serial.println("ERR provisioning-failed");
@@ -245,6 +367,7 @@ void provision_pin(char *arguments) {
   }
   memcpy(verifier, new_verifier, sizeof(verifier));
   secure_zero(new_verifier, sizeof(new_verifier));
+  verifier_iterations = iterations;
   preferences.putUInt(kFailuresKey, 0);
   provisioned = true;
   Serial.println("OK provisioned; run auth begin and auth unlock <proof-hex>");
@@ -264,7 +387,7 @@ void begin_challenge() {
   esp_fill_random(challenge, sizeof(challenge));
   challenge_active = true;
   Serial.print("OK challenge salt="); print_hex(salt, sizeof(salt));
-  Serial.print(" iterations="); Serial.print(HEXWALLET_CLI_PBKDF2_ITERATIONS);
+  Serial.print(" iterations="); Serial.print(verifier_iterations);
   Serial.print(" nonce="); print_hex(challenge, sizeof(challenge));
   Serial.println();
 }
@@ -385,10 +508,11 @@ void handle_token(char *command) {
   else Serial.println("ERR invalid-token-command");
 }
 
-void print_derived(const NetworkProfile &network, const HdPrivateNode &master,
-                   uint32_t address_index, bool include_private) {
-  DerivedAddress derived;
-  const WalletError result = derive_address(master, network, 0, 0, address_index, &derived);
+// DerivedAddressVisitor for show_addresses() and address ranges; context
+// points to the include-private flag.
+void print_derived(const NetworkProfile &network, WalletError result,
+                   const DerivedAddress &derived, void *context) {
+  const bool include_private = *static_cast<const bool *>(context);
   if (result != WalletError::Ok) {
     Serial.print("ERR network="); Serial.print(network.id);
     Serial.print(" error="); Serial.println(error_text(result));
@@ -402,7 +526,6 @@ void print_derived(const NetworkProfile &network, const HdPrivateNode &master,
     Serial.print(" private="); print_hex(derived.private_key, sizeof(derived.private_key));
   }
   Serial.println();
-  clear_derived_address(&derived);
 }
 
 void show_addresses(uint32_t address_index, const NetworkProfile *only_network, bool include_secrets) {
@@ -427,13 +550,10 @@ void show_addresses(uint32_t address_index, const NetworkProfile *only_network,
     }
     secure_zero(extended, sizeof(extended));
   }
-  if (only_network != nullptr) {
-    print_derived(*only_network, master, address_index, include_secrets);
-  } else {
-    for (size_t index = 0; index < kNetworkProfileCount; ++index) {
-      print_derived(kNetworkProfiles[index], master, address_index, include_secrets);
-    }
-  }
+  const NetworkProfile *networks = only_network != nullptr ? only_network : kNetworkProfiles;
+  const size_t network_count = only_network != nullptr ? 1 : kNetworkProfileCount;
+  derive_network_addresses(master, networks, network_count, 0, 0, address_index, print_derived,
+                           &include_secrets);
   if (include_secrets) Serial.println("END SENSITIVE");
   secure_zero(seed, sizeof(seed));
   secure_zero(&master, sizeof(master));
@@ -464,6 +584,230 @@ void handle_wallet_address(char *arguments) {
   show_addresses(index, entry.network, false);
 }
 
+// wallet addresses <coin> <start> <count>, streamed as they are derived.
+void handle_wallet_address_range(char *arguments) {
+  char *start_text = strchr(arguments, ' ');
+  char *count_text = start_text == nullptr ? nullptr : strchr(start_text + 1, ' ');
+  if (count_text == nullptr) {
+    Serial.println("ERR usage: wallet addresses <coin> <start> <count>");
+    return;
+  }
+  *start_text++ = '\0';
+  *count_text++ = '\0';
+  WalletCatalogEntry entry;
+  if (!wallet_catalog_find(arguments, &entry)) {
+    Serial.println("ERR unknown-coin");
+    return;
+  }
+  if (!wallet_catalog_has(entry, WalletCapabilityAddress) || entry.network == nullptr) {
+    Serial.print("ERR address-unsupported status=\""); Serial.print(entry.status); Serial.println("\"");
+    return;
+  }
+  bool valid_start;
+  bool valid_count;
+  const uint32_t start = parse_index(start_text, &valid_start);
+  const uint32_t count = parse_index(count_text, &valid_count);
+  if (!valid_start || !valid_count || *start_text == '\0' || *count_text == '\0' || count == 0 ||
+      count > kMaximumAddressRange || count - 1 > kHardenedOffset - 1 - start) {
+    Serial.println("ERR invalid-range");
+    return;
+  }
+  HdPrivateNode master;
+  if (!load_master(&master)) return;
+  bool include_private = false;
+  derive_address_range(master, *entry.network, 0, 0, start, count, print_derived, &include_private);
+  secure_zero(&master, sizeof(master));
+}
+
+// CryptoNoteSubaddressVisitor for subaddress ranges; context points to the
+// network profile pointer.
+void print_subaddress(WalletError result, const CryptoNoteSubaddress &subaddress, void *context) {
+  const NetworkProfile *network = *static_cast<const NetworkProfile **>(context);
+  Serial.print(result == WalletError::Ok ? "network=" : "ERR network="); Serial.print(network->id);
+  Serial.print(" major="); Serial.print(subaddress.major);
+  Serial.print(" minor="); Serial.print(subaddress.minor);
+  if (result != WalletError::Ok) {
+    Serial.print(" error="); Serial.println(error_text(result));
+    return;
+  }
+  Serial.print(" address="); Serial.println(subaddress.address);
+}
+
+// wallet subaddresses <coin> <major> <minor> <count>: CryptoNote subaddresses
+// of the wallet at index 0, streamed as they are derived.
+void handle_wallet_subaddresses(char *arguments) {
+  char *major_text = strchr(arguments, ' ');
+  char *minor_text = major_text == nullptr ? nullptr : strchr(major_text + 1, ' ');
+  char *count_text = minor_text == nullptr ? nullptr : strchr(minor_text + 1, ' ');
+  if (count_text == nullptr) {
+    Serial.println("ERR usage: wallet subaddresses <coin> <major> <minor> <count>");
+    return;
+  }
+  *major_text++ = '\0';
+  *minor_text++ = '\0';
+  *count_text++ = '\0';
+  WalletCatalogEntry entry;
+  if (!wallet_catalog_find(arguments, &entry)) {
+    Serial.println("ERR unknown-coin");
+    return;
+  }
+  const CryptoNoteAddressProfile *profile =
+      entry.network == nullptr ? nullptr : cryptonote_find_profile(entry.network->account_version);
+  if (!wallet_catalog_has(entry, WalletCapabilityAddress) ||
+      entry.network->encoding != AddressEncoding::CryptoNote || profile == nullptr ||
+      profile->subaddress_prefix == 0) {
+    Serial.println("ERR subaddresses-unsupported");
+    return;
+  }
+  bool valid_major;
+  bool valid_minor;
+  bool valid_count;
+  const uint32_t major = parse_index(major_text, &valid_major);
+  const uint32_t minor = parse_index(minor_text, &valid_minor);
+  const uint32_t count = parse_index(count_text, &valid_count);
+  if (!valid_major || !valid_minor || !valid_count || *major_text == '\0' || *minor_text == '\0' ||
+      *count_text == '\0' || count == 0 || count > kMaximumAddressRange ||
+      count - 1 > kHardenedOffset - 1 - minor) {
+    Serial.println("ERR invalid-range");
+    return;
+  }
+  HdPrivateNode master;
+  if (!load_master(&master)) return;
+  const NetworkProfile *network = entry.network;
+  derive_subaddress_range(master, *network, 0, major, minor, count, print_subaddress, &network);
+  secure_zero(&master, sizeof(master));
+}
+
+// Splits the next space-separated token off *cursor, or returns nullptr.
+char *next_token(char **cursor) {
+  while (**cursor == ' ') ++*cursor;
+  if (**cursor == '\0') return nullptr;
+  char *token = *cursor;
+  char *end = strchr(token, ' ');
+  if (end == nullptr) {
+    *cursor = token + strlen(token);
+  } else {
+    *end = '\0';
+    *cursor = end + 1;
+  }
+  return token;
+}
+
+bool parse_output(char **cursor, CryptoNoteOutput *out) {
+  const char *tx_key_text = next_token(cursor);
+  const char *index_text = next_token(cursor);
+  const char *output_key_text = next_token(cursor);
+  bool valid_index = false;
+  if (output_key_text != nullptr) out->output_index = parse_index(index_text, &valid_index);
+  return valid_index && *index_text != '\0' &&
+         decode_hex_exact(tx_key_text, out->tx_public_key, sizeof(out->tx_public_key)) &&
+         decode_hex_exact(output_key_text, out->output_key, sizeof(out->output_key));
+}
+
+// wallet scan <coin> <tx-key> <index> <output-key> [...]: whether each output
+// pays the wallet at index 0, checked on the device so the view key never
+// leaves it. Outputs are parsed and scanned kCryptoNoteScanBatchSize at a time,
+// so one line carries as many as the command buffer holds. The scanner is
+// derived on the first line for a network and reused until the session ends.
+void handle_wallet_scan(char *arguments) {
+  char *cursor = strchr(arguments, ' ');
+  if (cursor == nullptr) {
+    Serial.println("ERR usage: wallet scan <coin> <tx-key> <index> <output-key> [...]");
+    return;
+  }
+  *cursor++ = '\0';
+  WalletCatalogEntry entry;
+  if (!wallet_catalog_find(arguments, &entry)) {
+    Serial.println("ERR unknown-coin");
+    return;
+  }
+  if (!wallet_catalog_has(entry, WalletCapabilityAddress) || entry.network == nullptr ||
+      entry.network->encoding != AddressEncoding::CryptoNote) {
+    Serial.println("ERR scan-unsupported");
+    return;
+  }
+  WalletError result = WalletError::Ok;
+  if (session_scanner_network != entry.network) {
+    clear_session_scanner();
+    HdPrivateNode master;
+    if (!load_master(&master)) return;
+    result = derive_output_scanner(master, *entry.network, 0, &session_scanner);
+    secure_zero(&master, sizeof(master));
+    if (result == WalletError::Ok) session_scanner_network = entry.network;
+  }
+  CryptoNoteOutput outputs[kCryptoNoteScanBatchSize];
+  bool owned[kCryptoNoteScanBatchSize];
+  size_t position = 0;
+  bool malformed = false;
+  while (result == WalletError::Ok && !malformed) {
+    size_t batch = 0;
+    while (batch < kCryptoNoteScanBatchSize && !malformed) {
+      while (*cursor == ' ') ++cursor;
+      if (*cursor == '\0') break;
+      malformed = !parse_output(&cursor, &outputs[batch]);
+      if (!malformed) ++batch;
+    }
+    if (batch == 0) break;
+    result = cryptonote_scan_outputs(session_scanner, outputs, batch, owned);
+    for (size_t offset = 0; result == WalletError::Ok && offset < batch; ++offset) {
+      Serial.print("network="); Serial.print(entry.network->id);
+      Serial.print(" output="); Serial.print(static_cast<unsigned long>(position++));
+      Serial.print(" index="); Serial.print(static_cast<unsigned long>(outputs[offset].output_index));
+      Serial.println(owned[offset] ? " owned=yes" : " owned=no");
+    }
+  }
+  if (result != WalletError::Ok) {
+    Serial.print("ERR scan "); Serial.println(error_text(result));
+  } else if (malformed || position == 0) {
+    Serial.print("ERR invalid-output position="); Serial.println(static_cast<unsigned long>(position));
+  }
+}
+
+// wallet xpub <coin> [account]: the account key and its receive and change
+// descriptors, for watch-only address derivation on the host.
+void handle_wallet_xpub(char *arguments) {
+  char *separator = strchr(arguments, ' ');
+  const char *account_text = "";
+  if (separator != nullptr) {
+    *separator++ = '\0';
+    account_text = separator;
+  }
+  WalletCatalogEntry entry;
+  if (!wallet_catalog_find(arguments, &entry)) {
+    Serial.println("ERR unknown-coin");
+    return;
+  }
+  if (!wallet_catalog_has(entry, WalletCapabilityAddress) || entry.network == nullptr ||
+      entry.network->encoding == AddressEncoding::CryptoNote) {
+    Serial.println("ERR xpub-unsupported");
+    return;
+  }
+  bool valid_account;
+  const uint32_t account = parse_index(account_text, &valid_account);
+  if (!valid_account) {
+    Serial.println("ERR invalid-account");
+    return;
+  }
+  HdPrivateNode master;
+  if (!load_master(&master)) return;
+  AccountExport exported;
+  const WalletError result = export_account(master, *entry.network, account, &exported);
+  secure_zero(&master, sizeof(master));
+  if (result != WalletError::Ok) {
+    Serial.print("ERR xpub "); Serial.println(error_text(result));
+    return;
+  }
+  Serial.print("OK network="); Serial.print(entry.network->id);
+  Serial.print(" path="); Serial.print(exported.path);
+  Serial.print(" account-key="); Serial.println(exported.extended_key);
+  if (exported.receive_descriptor[0] == '\0') {
+    Serial.println("INFO descriptor-unavailable");
+  } else {
+    Serial.print("descriptor-receive="); Serial.println(exported.receive_descriptor);
+    Serial.print("descriptor-change="); Serial.println(exported.change_descriptor);
+  }
+}
+
 void handle_wallet_token(char *arguments) {
   char *separator = strchr(arguments, ' ');
   const char *index_text = "";
@@ -516,12 +860,16 @@ void handle_wallet_token(char *arguments) {
 void handle_wallet(char *command) {
   if (!require_authentication()) return;
   if (strcmp(command, "wallet generate") == 0) {
+    clear_pending_transaction();
+    clear_session_scanner();
     const WalletError result = wallet_session_generate();
     Serial.println(result == WalletError::Ok ? "OK wallet-generated-in-volatile-memory" : "ERR wallet-generation-failed");
     return;
   }
   constexpr char kImportPrefix[] = "wallet import ";
   if (strncmp(command, kImportPrefix, sizeof(kImportPrefix) - 1) == 0) {
+    clear_pending_transaction();
+    clear_session_scanner();
     const WalletError result = wallet_session_import(command + sizeof(kImportPrefix) - 1);
     Serial.print(result == WalletError::Ok ? "OK wallet-imported-in-volatile-memory" : "ERR import ");
     if (result != WalletError::Ok) Serial.print(error_text(result));
@@ -533,6 +881,21 @@ void handle_wallet(char *command) {
     handle_wallet_address(command + sizeof(kAddressPrefix) - 1);
     return;
   }
+  constexpr char kXpubPrefix[] = "wallet xpub ";
+  if (strncmp(command, kXpubPrefix, sizeof(kXpubPrefix) - 1) == 0) {
+    handle_wallet_xpub(command + sizeof(kXpubPrefix) - 1);
+    return;
+  }
+  constexpr char kSubaddressesPrefix[] = "wallet subaddresses ";
+  if (strncmp(command, kSubaddressesPrefix, sizeof(kSubaddressesPrefix) - 1) == 0) {
+    handle_wallet_subaddresses(command + sizeof(kSubaddressesPrefix) - 1);
+    return;
+  }
+  constexpr char kScanPrefix[] = "wallet scan ";
+  if (strncmp(command, kScanPrefix, sizeof(kScanPrefix) - 1) == 0) {
+    handle_wallet_scan(command + sizeof(kScanPrefix) - 1);
+    return;
+  }
   constexpr char kTokenPrefix[] = "wallet token ";
   if (strncmp(command, kTokenPrefix, sizeof(kTokenPrefix) - 1) == 0) {
     handle_wallet_token(command + sizeof(kTokenPrefix) - 1);
@@ -548,12 +911,16 @@ void handle_wallet(char *command) {
     }
 #endif
     const size_t prefix_size = secret ? 13 : 16;
-    const char *argument = command + prefix_size;
+    char *argument = command + prefix_size;
     if (*argument == ' ') ++argument;
     else if (*argument != '\0') {
       Serial.println("ERR invalid-command");
       return;
     }
+    if (addresses && *argument != '\0' && (*argument < '0' || *argument > '9')) {
+      handle_wallet_address_range(argument);
+      return;
+    }
     bool valid_index;
     const uint32_t index = parse_index(argument, &valid_index);
     if (!valid_index) {
@@ -623,7 +990,7 @@ void inspect_transaction(const char *psbt_hex) {
   pending_transaction_kind = PendingTransactionKind::Bitcoin;
   print_transaction_review();
   char approval[7];
-  snprintf(approval, sizeof(approval), "%06lu", static_cast<unsigned long>(transaction_approval));
+  snprintf(approval, sizeof(approval), "%06lu", static_cast<unsigned long>(transaction_approval % 1000000UL));
   if (display_is_available) {
     Serial.println("OK confirmation-shown-on-trusted-display expires-ms=120000");
   } else {
@@ -779,7 +1146,7 @@ void inspect_evm_transaction(char *arguments) {
   Serial.print("review-id="); print_hex(pending_evm_transaction.request_hash, 8); Serial.println();
   Serial.println("END TRANSACTION REVIEW");
   char approval[7];
-  snprintf(approval, sizeof(approval), "%06lu", static_cast<unsigned long>(transaction_approval));
+  snprintf(approval, sizeof(approval), "%06lu", static_cast<unsigned long>(transaction_approval % 1000000UL));
   if (display_is_available) {
     Serial.println("OK confirmation-shown-on-trusted-display expires-ms=120000");
   } else {
@@ -916,6 +1283,9 @@ void handle_line(char *command) {
   if (*command == '\0') return;
   if (strcmp(command, "help") == 0) show_help();
   else if (strcmp(command, "status") == 0) show_status();
+  else if (strcmp(command, "perf") == 0) show_perf();
+  else if (strcmp(command, "perf memory") == 0) show_perf_memory();
+  else if (strcmp(command, "perf reset") == 0) reset_perf();
   else if (strncmp(command, "coin ", 5) == 0) handle_coin(command);
   else if (strncmp(command, "token ", 6) == 0) handle_token(command);
   else if (strcmp(command, "auth begin") == 0) begin_challenge();
@@ -931,6 +1301,45 @@ void handle_line(char *command) {
   else Serial.println("ERR unknown-command; use help");
 }
 
+#if HEXWALLET_TRACE_MEMORY
+// Compares the first words of line, up to the end of the line or a space,
+// with command.
+bool line_starts_with_command(const char *line, const char *command) {
+  const size_t length = strlen(command);
+  return strncmp(line, command, length) == 0 && (line[length] == '\0' || line[length] == ' ');
+}
+
+CommandMemory *command_memory_slot(const char *line) {
+  while (*line == ' ') ++line;
+  if (*line == '\0') return nullptr;
+  size_t match = kMeasuredCommandCount - 1;
+  size_t match_length = 0;
+  for (size_t index = 0; index + 1 < kMeasuredCommandCount; ++index) {
+    const size_t length = strlen(kMeasuredCommands[index]);
+    if (length > match_length && line_starts_with_command(line, kMeasuredCommands[index])) {
+      match = index;
+      match_length = length;
+    }
+  }
+  return &command_memory[match];
+}
+
+// The slot is chosen before the command runs, as commands wipe their own
+// arguments from the line.
+void measure_line(char *line) {
+  CommandMemory *slot = command_memory_slot(line);
+  const TraceMemoryStats stats = trace_memory_measure(handle_line, line);
+  if (slot == nullptr) return;
+  ++slot->runs;
+  if (stats.stack_bytes > slot->worst.stack_bytes) {
+    slot->worst.stack_bytes = stats.stack_bytes;
+    slot->worst.stack_saturated = stats.stack_saturated;
+  }
+  if (stats.heap_peak_bytes > slot->worst.heap_peak_bytes) slot->worst.heap_peak_bytes = stats.heap_peak_bytes;
+  if (stats.allocations > slot->worst.allocations) slot->worst.allocations = stats.allocations;
+}
+#endif
+
 }
 #endif
 
@@ -950,6 +1359,13 @@ bool wallet_cli_init(bool display_available) {
                 preferences.getBytesLength(kVerifierKey) == sizeof(verifier) &&
                 preferences.getBytes(kSaltKey, salt, sizeof(salt)) == sizeof(salt) &&
                 preferences.getBytes(kVerifierKey, verifier, sizeof(verifier)) == sizeof(verifier);
+  // Verifiers stored before the iteration count was persisted were derived
+  // with the compiled count; record it so a later rebuild cannot change it.
+  verifier_iterations = preferences.getUInt(kIterationsKey, 0);
+  if (verifier_iterations == 0) {
+    verifier_iterations = HEXWALLET_CLI_PBKDF2_ITERATIONS;
+    if (provisioned) preferences.putUInt(kIterationsKey, verifier_iterations);
+  }
   const uint32_t failures = preferences.getUInt(kFailuresKey, 0);
   if (failures != 0) {
     const uint32_t exponent = failures > 10 ? 10 : failures;
@@ -974,6 +1390,7 @@ void wallet_cli_service() {
     wallet_cli_lock();
     Serial.println("INFO session-expired-and-wallet-cleared");
   }
+  if (provisioning_active) continue_provisioning();
   if (transaction_pending && deadline_reached(millis(), transaction_expires_at)) {
     clear_pending_transaction();
     Serial.println("INFO transaction-review-expired");
@@ -983,7 +1400,11 @@ void wallet_cli_service() {
     if (value == '\r') continue;
     if (value == '\n') {
       line_buffer[line_used] = '\0';
+#if HEXWALLET_TRACE_MEMORY
+      measure_line(line_buffer);
+#else
       handle_line(line_buffer);
+#endif
       secure_zero(line_buffer, sizeof(line_buffer));
       line_used = 0;
     } else if ((value == '\b' || value == 0x7f) && line_used != 0) {
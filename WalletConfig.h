@@ -30,6 +30,12 @@
 #define HEXWALLET_CLI_PBKDF2_ITERATIONS 120000UL
 #endif
 
+// PIN provisioning runs this many PBKDF2 iterations per wallet_cli_service()
+// call, so serial input and the UI keep running while the verifier derives.
+#ifndef HEXWALLET_CLI_PBKDF2_SLICE_ITERATIONS
+#define HEXWALLET_CLI_PBKDF2_SLICE_ITERATIONS 1000UL
+#endif
+
 #ifndef HEXWALLET_MAX_PSBT_BYTES
 #define HEXWALLET_MAX_PSBT_BYTES 4096U
 #endif
@@ -50,6 +56,29 @@
 #define HEXWALLET_ENABLE_SECRET_EXPORT 0
 #endif
 
+// Counts EC multiplications, HMAC calls and hashed bytes, and times the hot
+// wallet paths, for the perf command. Off, the trace hooks compile to nothing.
+#ifndef HEXWALLET_TRACE
+#define HEXWALLET_TRACE 0
+#endif
+
+// Records the stack depth, peak heap bytes and allocation count of each CLI
+// command for perf memory. Stack use is found by painting up to
+// HEXWALLET_TRACE_STACK_BYTES below the dispatcher before every command.
+#ifndef HEXWALLET_TRACE_MEMORY
+#define HEXWALLET_TRACE_MEMORY 0
+#endif
+
+#ifndef HEXWALLET_TRACE_STACK_BYTES
+#define HEXWALLET_TRACE_STACK_BYTES (12U * 1024U)
+#endif
+
+// Exports the Bitcoin signing stages for the host benchmarks. Firmware must
+// leave this off: the signing stage signs any digest it is handed.
+#ifndef HEXWALLET_BENCH_STAGES
+#define HEXWALLET_BENCH_STAGES 0
+#endif
+
 #ifndef HEXWALLET_ALLOW_HOST_ONLY_CONFIRMATION
 #define HEXWALLET_ALLOW_HOST_ONLY_CONFIRMATION 0
 #endif
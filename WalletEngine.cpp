@@ -6,20 +6,205 @@
 #include "CryptoPrimitives.h"
 #include "CryptoNoteAddress.h"
 #include "WalletAddresses.h"
+#include "WalletTrace.h"
+#include "local_descriptor.h"
 
 namespace hexwallet {
 
 static_assert(kAddressTextSize >= kCryptoNoteStandardAddressSize,
               "DerivedAddress must hold a CryptoNote standard address");
 
-WalletError derive_address(const HdPrivateNode &master, const NetworkProfile &network,
-                           uint32_t account, uint32_t change, uint32_t address_index,
-                           DerivedAddress *out) {
-  if (out == nullptr || account >= kHardenedOffset || change >= kHardenedOffset ||
-      address_index >= kHardenedOffset || network.bip_purpose >= kHardenedOffset ||
-      network.derivation_coin_type >= kHardenedOffset) {
-    return WalletError::InvalidArgument;
+namespace {
+
+constexpr size_t kAccountCacheSize = 16;
+constexpr size_t kCachedChangeBranches = 2;
+
+// Hardened m/purpose'/coin'/account' nodes and their external/internal change
+// children, so an address lookup only walks the final non-hardened step. Nodes
+// are kept expanded so that step does not recompute the parent public key.
+struct AccountCacheEntry {
+  bool used;
+  uint32_t purpose;
+  uint32_t coin_type;
+  uint32_t account;
+  HdExpandedPrivateNode account_node;
+  HdExpandedPrivateNode change_nodes[kCachedChangeBranches];
+  bool change_ready[kCachedChangeBranches];
+};
+
+HdExpandedPrivateNode cache_master;
+bool cache_master_ready = false;
+AccountCacheEntry account_cache[kAccountCacheSize];
+size_t next_cache_slot = 0;
+
+bool cache_matches_master(const HdPrivateNode &master) {
+  return cache_master_ready && cache_master.node.depth == master.depth &&
+         crypto_constant_time_equal(cache_master.node.private_key, master.private_key,
+                                    kPrivateKeySize) &&
+         crypto_constant_time_equal(cache_master.node.chain_code, master.chain_code, kChainCodeSize);
+}
+
+WalletError derive_account_node(const HdExpandedPrivateNode &master, uint32_t purpose,
+                                uint32_t coin_type, uint32_t account, HdExpandedPrivateNode *out) {
+  const uint32_t path[] = {purpose | kHardenedOffset, coin_type | kHardenedOffset,
+                           account | kHardenedOffset};
+  HdExpandedPrivateNode current = master;
+  for (const uint32_t index : path) {
+    HdExpandedPrivateNode next;
+    const WalletError result = hd_private_derive_expanded(&current, index, &next);
+    secure_zero(&current, sizeof(current));
+    if (result != WalletError::Ok) return result;
+    current = next;
+    secure_zero(&next, sizeof(next));
   }
+  *out = current;
+  secure_zero(&current, sizeof(current));
+  return WalletError::Ok;
+}
+
+WalletError find_account(const HdPrivateNode &master, uint32_t purpose, uint32_t coin_type,
+                         uint32_t account, AccountCacheEntry **out) {
+  if (!cache_matches_master(master)) {
+    clear_derivation_cache();
+    const WalletError result = hd_private_expand(&master, &cache_master);
+    if (result != WalletError::Ok) {
+      secure_zero(&cache_master, sizeof(cache_master));
+      return result;
+    }
+    cache_master_ready = true;
+  }
+  for (AccountCacheEntry &entry : account_cache) {
+    if (entry.used && entry.purpose == purpose && entry.coin_type == coin_type &&
+        entry.account == account) {
+      *out = &entry;
+      return WalletError::Ok;
+    }
+  }
+  AccountCacheEntry &entry = account_cache[next_cache_slot];
+  next_cache_slot = (next_cache_slot + 1) % kAccountCacheSize;
+  secure_zero(&entry, sizeof(entry));
+  const WalletError result = derive_account_node(cache_master, purpose, coin_type, account,
+                                                 &entry.account_node);
+  if (result != WalletError::Ok) {
+    secure_zero(&entry, sizeof(entry));
+    return result;
+  }
+  entry.used = true;
+  entry.purpose = purpose;
+  entry.coin_type = coin_type;
+  entry.account = account;
+  *out = &entry;
+  return WalletError::Ok;
+}
+
+WalletError derive_change_node(const HdPrivateNode &master, uint32_t purpose, uint32_t coin_type,
+                               uint32_t account, uint32_t change, HdExpandedPrivateNode *out) {
+  AccountCacheEntry *entry = nullptr;
+  const WalletError result = find_account(master, purpose, coin_type, account, &entry);
+  if (result != WalletError::Ok) return result;
+  if (change >= kCachedChangeBranches) {
+    return hd_private_derive_expanded(&entry->account_node, change, out);
+  }
+  if (!entry->change_ready[change]) {
+    const WalletError change_result = hd_private_derive_expanded(&entry->account_node, change,
+                                                                 &entry->change_nodes[change]);
+    if (change_result != WalletError::Ok) {
+      secure_zero(&entry->change_nodes[change], sizeof(entry->change_nodes[change]));
+      return change_result;
+    }
+    entry->change_ready[change] = true;
+  }
+  *out = entry->change_nodes[change];
+  return WalletError::Ok;
+}
+
+// The key material an encoding consumes from the leaf. UTXO encodings use the
+// compressed key, account-model encodings the uncompressed point, and
+// CryptoNote only the private key, which seeds its own key derivation.
+enum class LeafKey : uint8_t {
+  Compressed,
+  Uncompressed,
+  PrivateOnly,
+};
+
+struct DerivedLeaf {
+  uint8_t private_key[kPrivateKeySize];
+  uint8_t public_key[kUncompressedPublicKeySize];
+  // Keccak account of an uncompressed leaf, hashed once for every EVM and
+  // Tron network that shares the leaf.
+  uint8_t account[kEvmAccountSize];
+};
+
+// Networks that share a leaf group have the same key at every path.
+struct LeafGroup {
+  uint32_t purpose;
+  uint32_t coin_type;
+  LeafKey key;
+};
+
+LeafKey leaf_key(const NetworkProfile &network) {
+  if (network.encoding == AddressEncoding::CryptoNote) return LeafKey::PrivateOnly;
+  if (network.encoding == AddressEncoding::Evm || network.encoding == AddressEncoding::Tron) {
+    return LeafKey::Uncompressed;
+  }
+  return LeafKey::Compressed;
+}
+
+LeafGroup leaf_group(const NetworkProfile &network) {
+  return {network.bip_purpose, network.derivation_coin_type, leaf_key(network)};
+}
+
+bool same_leaf_group(const LeafGroup &left, const LeafGroup &right) {
+  return left.purpose == right.purpose && left.coin_type == right.coin_type &&
+         left.key == right.key;
+}
+
+bool valid_address_path(const NetworkProfile &network, uint32_t account, uint32_t change,
+                        uint32_t address_index) {
+  return account < kHardenedOffset && change < kHardenedOffset && address_index < kHardenedOffset &&
+         network.bip_purpose < kHardenedOffset && network.derivation_coin_type < kHardenedOffset;
+}
+
+WalletError hash_leaf_account(DerivedLeaf *leaf) {
+  uint8_t digest[kKeccak256Size];
+  if (!crypto_keccak256(leaf->public_key + 1, kUncompressedPublicKeySize - 1, digest)) {
+    return WalletError::CryptoFailure;
+  }
+  memcpy(leaf->account, digest + kKeccak256Size - kEvmAccountSize, kEvmAccountSize);
+  secure_zero(digest, sizeof(digest));
+  return WalletError::Ok;
+}
+
+WalletError derive_leaf(const HdPrivateNode &master, const LeafGroup &group, uint32_t account,
+                        uint32_t change, uint32_t address_index, DerivedLeaf *out) {
+  HdExpandedPrivateNode change_node;
+  HdExpandedPrivateNode expanded_child;
+  HdPrivateNode &child = expanded_child.node;
+  WalletError result = derive_change_node(master, group.purpose, group.coin_type, account, change,
+                                          &change_node);
+  if (result == WalletError::Ok && group.key == LeafKey::Compressed) {
+    result = hd_private_derive_expanded(&change_node, address_index, &expanded_child);
+  } else if (result == WalletError::Ok) {
+    result = hd_private_derive_from_expanded(&change_node, address_index, &child);
+  }
+  secure_zero(&change_node, sizeof(change_node));
+  if (result == WalletError::Ok) {
+    memcpy(out->private_key, child.private_key, kPrivateKeySize);
+    if (group.key == LeafKey::Compressed) {
+      memcpy(out->public_key, expanded_child.public_key, kCompressedPublicKeySize);
+    } else if (group.key == LeafKey::Uncompressed) {
+      result = uncompressed_public_key_from_private(child.private_key, out->public_key);
+      if (result == WalletError::Ok) result = hash_leaf_account(out);
+    }
+  }
+  secure_zero(&expanded_child, sizeof(expanded_child));
+  if (result != WalletError::Ok) secure_zero(out, sizeof(*out));
+  return result;
+}
+
+// The per-network step: the path text and the address encoding of the leaf.
+WalletError encode_leaf(const NetworkProfile &network, const DerivedLeaf &leaf, uint32_t account,
+                        uint32_t change, uint32_t address_index, DerivedAddress *out) {
   memset(out, 0, sizeof(*out));
   out->network = &network;
   const int written = snprintf(out->path, sizeof(out->path), "m/%lu'/%lu'/%lu'/%lu/%lu",
@@ -32,52 +217,549 @@ WalletError derive_address(const HdPrivateNode &master, const NetworkProfile &ne
     clear_derived_address(out);
     return WalletError::BufferTooSmall;
   }
-  HdPrivateNode child;
-  WalletError result = hd_private_derive_path(&master, out->path, &child);
-  if (result != WalletError::Ok) {
+  memcpy(out->private_key, leaf.private_key, kPrivateKeySize);
+  WalletError result;
+  if (network.encoding == AddressEncoding::CryptoNote) {
+    const CryptoNoteAddressProfile *profile = cryptonote_find_profile(network.account_version);
+    result = profile == nullptr ? WalletError::InvalidArgument :
+        cryptonote_address_from_seed(*profile, leaf.private_key, out->address,
+                                     sizeof(out->address), out->private_key);
+  } else if (network.encoding == AddressEncoding::Evm) {
+    result = address_evm_text(leaf.account, out->address, sizeof(out->address));
+  } else if (network.encoding == AddressEncoding::Tron) {
+    size_t output_size = sizeof(out->address);
+    result = address_keccak_base58_text(network.account_version, leaf.account,
+                                        out->address, &output_size);
+  } else if (network.encoding == AddressEncoding::P2wpkh) {
+    result = address_p2wpkh(network.utxo, leaf.public_key, out->address, sizeof(out->address));
+  } else if (network.encoding == AddressEncoding::P2shP2wpkh) {
+    size_t output_size = sizeof(out->address);
+    result = address_p2sh_p2wpkh(network.utxo, leaf.public_key, out->address, &output_size);
+  } else {
+    size_t output_size = sizeof(out->address);
+    result = address_p2pkh(network.utxo, leaf.public_key, out->address, &output_size);
+  }
+  if (result != WalletError::Ok) clear_derived_address(out);
+  return result;
+}
+
+// The private view key and public spend key of the CryptoNote wallet at
+// m/purpose'/coin'/0'/0/address_index.
+WalletError derive_cryptonote_keys(const HdPrivateNode &master, const NetworkProfile &network,
+                                   uint32_t address_index,
+                                   uint8_t out_view_key[kCryptoNoteScalarSize],
+                                   uint8_t out_public_spend_key[kCryptoNotePublicKeySize]) {
+  if (!valid_address_path(network, 0, 0, address_index)) return WalletError::InvalidArgument;
+  DerivedLeaf leaf;
+  uint8_t spend_key[kCryptoNoteScalarSize];
+  WalletError result = derive_leaf(master, leaf_group(network), 0, 0, address_index, &leaf);
+  if (result == WalletError::Ok) {
+    result = cryptonote_private_keys_from_seed(leaf.private_key, spend_key, out_view_key);
+  }
+  secure_zero(&leaf, sizeof(leaf));
+  if (result == WalletError::Ok) {
+    result = cryptonote_public_key_from_scalar(spend_key, out_public_spend_key);
+  }
+  secure_zero(spend_key, sizeof(spend_key));
+  if (result != WalletError::Ok) secure_zero(out_view_key, kCryptoNoteScalarSize);
+  return result;
+}
+
+}  // namespace
+
+WalletError derive_address(const HdPrivateNode &master, const NetworkProfile &network,
+                           uint32_t account, uint32_t change, uint32_t address_index,
+                           DerivedAddress *out) {
+  if (out == nullptr || !valid_address_path(network, account, change, address_index)) {
+    return WalletError::InvalidArgument;
+  }
+  HEXWALLET_TRACE_SCOPE(DeriveAddress);
+  DerivedLeaf leaf;
+  WalletError result = derive_leaf(master, leaf_group(network), account, change, address_index,
+                                   &leaf);
+  if (result == WalletError::Ok) {
+    result = encode_leaf(network, leaf, account, change, address_index, out);
+  } else {
     clear_derived_address(out);
-    return result;
   }
-  memcpy(out->private_key, child.private_key, kPrivateKeySize);
+  secure_zero(&leaf, sizeof(leaf));
+  return result;
+}
 
-  if (network.encoding == AddressEncoding::CryptoNote) {
-    const CryptoNoteAddressProfile profile = {network.account_version};
-    result = cryptonote_address_from_seed(profile, child.private_key, out->address,
-                                          sizeof(out->address), out->private_key);
-  } else if (network.encoding == AddressEncoding::Evm || network.encoding == AddressEncoding::Tron) {
-    uint8_t public_key[kUncompressedPublicKeySize];
-    result = uncompressed_public_key_from_private(child.private_key, public_key);
-    if (result == WalletError::Ok && network.encoding == AddressEncoding::Evm) {
-      result = address_evm(public_key, out->address, sizeof(out->address));
-    } else if (result == WalletError::Ok) {
-      size_t output_size = sizeof(out->address);
-      result = address_keccak_base58(network.account_version, public_key,
-                                     out->address, &output_size);
+WalletError derive_network_addresses(const HdPrivateNode &master, const NetworkProfile *networks,
+                                     size_t count, uint32_t account, uint32_t change,
+                                     uint32_t address_index, DerivedAddressVisitor visit,
+                                     void *context) {
+  if (networks == nullptr || visit == nullptr) return WalletError::InvalidArgument;
+  HEXWALLET_TRACE_SCOPE(DeriveAddress);
+  DerivedLeaf leaf;
+  LeafGroup leaf_owner = {};
+  bool leaf_ready = false;
+  DerivedAddress derived;
+  WalletError first_error = WalletError::Ok;
+  // The listing keeps its order, so leaf holds the last group a later network
+  // still shares, and groups used once derive into scratch without evicting it.
+  DerivedLeaf scratch;
+  for (size_t index = 0; index < count; ++index) {
+    const NetworkProfile &network = networks[index];
+    const LeafGroup group = leaf_group(network);
+    WalletError result = WalletError::InvalidArgument;
+    if (valid_address_path(network, account, change, address_index)) {
+      bool shared_later = false;
+      for (size_t later = index + 1; later < count && !shared_later; ++later) {
+        shared_later = same_leaf_group(group, leaf_group(networks[later]));
+      }
+      const DerivedLeaf *source = &leaf;
+      if (leaf_ready && same_leaf_group(group, leaf_owner)) {
+        result = WalletError::Ok;
+      } else if (shared_later) {
+        result = derive_leaf(master, group, account, change, address_index, &leaf);
+        leaf_owner = group;
+        leaf_ready = result == WalletError::Ok;
+      } else {
+        result = derive_leaf(master, group, account, change, address_index, &scratch);
+        source = &scratch;
+      }
+      if (result == WalletError::Ok) {
+        result = encode_leaf(network, *source, account, change, address_index, &derived);
+      }
+      secure_zero(&scratch, sizeof(scratch));
     }
-    secure_zero(public_key, sizeof(public_key));
-  } else {
-    uint8_t public_key[kCompressedPublicKeySize];
-    result = public_key_from_private(child.private_key, public_key);
-    if (result == WalletError::Ok && network.encoding == AddressEncoding::P2wpkh) {
-      result = address_p2wpkh(network.utxo, public_key, out->address, sizeof(out->address));
-    } else if (result == WalletError::Ok && network.encoding == AddressEncoding::P2shP2wpkh) {
-      size_t output_size = sizeof(out->address);
-      result = address_p2sh_p2wpkh(network.utxo, public_key, out->address, &output_size);
-    } else if (result == WalletError::Ok) {
-      size_t output_size = sizeof(out->address);
-      result = address_p2pkh(network.utxo, public_key, out->address, &output_size);
+    if (result != WalletError::Ok) {
+      clear_derived_address(&derived);
+      if (first_error == WalletError::Ok) first_error = result;
     }
-    secure_zero(public_key, sizeof(public_key));
+    visit(network, result, derived, context);
+    clear_derived_address(&derived);
   }
-  secure_zero(&child, sizeof(child));
-  if (result != WalletError::Ok) clear_derived_address(out);
+  secure_zero(&leaf, sizeof(leaf));
+  return first_error;
+}
+
+WalletError derive_address_range(const HdPrivateNode &master, const NetworkProfile &network,
+                                 uint32_t account, uint32_t change, uint32_t first_index,
+                                 uint32_t count, DerivedAddressVisitor visit, void *context) {
+  if (visit == nullptr || count == 0 ||
+      !valid_address_path(network, account, change, first_index) ||
+      count - 1 > kHardenedOffset - 1 - first_index) {
+    return WalletError::InvalidArgument;
+  }
+  const LeafGroup group = leaf_group(network);
+  DerivedAddress derived;
+  WalletError first_error = WalletError::Ok;
+  const auto report = [&](WalletError result) {
+    if (result != WalletError::Ok) {
+      clear_derived_address(&derived);
+      if (first_error == WalletError::Ok) first_error = result;
+    }
+    secure_zero(derived.private_key, sizeof(derived.private_key));
+    visit(network, result, derived, context);
+    clear_derived_address(&derived);
+  };
+  if (group.key == LeafKey::PrivateOnly) {
+    for (uint32_t offset = 0; offset < count; ++offset) {
+      report(derive_address(master, network, account, change, first_index + offset, &derived));
+    }
+    return first_error;
+  }
+
+  HdExpandedPrivateNode change_node;
+  HdPublicNode branch;
+  WalletError result = derive_change_node(master, group.purpose, group.coin_type, account, change,
+                                          &change_node);
+  if (result == WalletError::Ok) result = hd_public_neuter(&change_node.node, &branch);
+  secure_zero(&change_node, sizeof(change_node));
+  if (result != WalletError::Ok) {
+    for (uint32_t offset = 0; offset < count; ++offset) report(result);
+    return first_error;
+  }
+  const bool compressed = group.key == LeafKey::Compressed;
+  const size_t key_size = compressed ? kCompressedPublicKeySize : kUncompressedPublicKeySize;
+  uint8_t keys[kHdPublicKeyBatchSize * kUncompressedPublicKeySize];
+  DerivedLeaf leaf = {};
+  for (uint32_t done = 0; done < count;) {
+    const uint32_t batch_index = first_index + done;
+    const size_t batch = count - done < kHdPublicKeyBatchSize ? count - done : kHdPublicKeyBatchSize;
+    const WalletError batch_result = hd_public_derive_keys(&branch, batch_index, batch,
+                                                           compressed, keys);
+    for (size_t offset = 0; offset < batch; ++offset) {
+      const uint32_t index = batch_index + static_cast<uint32_t>(offset);
+      if (batch_result == WalletError::InvalidChild) {
+        // A batch holding an index BIP32 skips is rare enough to redo one by
+        // one, which reports the same per-index errors as derive_address().
+        result = derive_address(master, network, account, change, index, &derived);
+      } else if (batch_result != WalletError::Ok) {
+        result = batch_result;
+      } else {
+        memcpy(leaf.public_key, keys + offset * key_size, key_size);
+        result = compressed ? WalletError::Ok : hash_leaf_account(&leaf);
+        if (result == WalletError::Ok) {
+          result = encode_leaf(network, leaf, account, change, index, &derived);
+        }
+      }
+      report(result);
+    }
+    done += static_cast<uint32_t>(batch);
+  }
+  secure_zero(&branch, sizeof(branch));
+  return first_error;
+}
+
+WalletError derive_subaddress_range(const HdPrivateNode &master, const NetworkProfile &network,
+                                    uint32_t address_index, uint32_t major, uint32_t first_minor,
+                                    uint32_t count, CryptoNoteSubaddressVisitor visit,
+                                    void *context) {
+  const CryptoNoteAddressProfile *profile = cryptonote_find_profile(network.account_version);
+  if (network.encoding != AddressEncoding::CryptoNote || profile == nullptr ||
+      profile->subaddress_prefix == 0) {
+    return WalletError::InvalidArgument;
+  }
+  uint8_t view_key[kCryptoNoteScalarSize];
+  uint8_t public_spend_key[kCryptoNotePublicKeySize];
+  WalletError result = derive_cryptonote_keys(master, network, address_index, view_key,
+                                              public_spend_key);
+  if (result == WalletError::Ok) {
+    result = cryptonote_subaddress_range(*profile, view_key, public_spend_key, major, first_minor,
+                                         count, visit, context);
+  }
+  secure_zero(view_key, sizeof(view_key));
+  secure_zero(public_spend_key, sizeof(public_spend_key));
   return result;
 }
 
+WalletError derive_output_scanner(const HdPrivateNode &master, const NetworkProfile &network,
+                                  uint32_t address_index, CryptoNoteScanner *out) {
+  if (out == nullptr || network.encoding != AddressEncoding::CryptoNote) {
+    return WalletError::InvalidArgument;
+  }
+  uint8_t view_key[kCryptoNoteScalarSize];
+  uint8_t public_spend_key[kCryptoNotePublicKeySize];
+  WalletError result = derive_cryptonote_keys(master, network, address_index, view_key,
+                                              public_spend_key);
+  if (result == WalletError::Ok) result = cryptonote_scanner_init(out, view_key, public_spend_key);
+  secure_zero(view_key, sizeof(view_key));
+  secure_zero(public_spend_key, sizeof(public_spend_key));
+  return result;
+}
+
+namespace {
+
+// The BIP380 script expression around the account key, or false for networks
+// without Bitcoin output scripts.
+bool descriptor_script(const NetworkProfile &network, const char **open, const char **close) {
+  if (network.utxo.ripple_alphabet) return false;
+  if (network.encoding == AddressEncoding::P2pkh) {
+    *open = "pkh(";
+    *close = ")";
+  } else if (network.encoding == AddressEncoding::P2wpkh) {
+    *open = "wpkh(";
+    *close = ")";
+  } else if (network.encoding == AddressEncoding::P2shP2wpkh) {
+    *open = "sh(wpkh(";
+    *close = "))";
+  } else {
+    return false;
+  }
+  return true;
+}
+
+WalletError write_descriptor(const NetworkProfile &network, uint32_t master_fingerprint,
+                             uint32_t account, const char *key, uint32_t change, char *out) {
+  const char *open;
+  const char *close;
+  if (!descriptor_script(network, &open, &close)) return WalletError::Ok;
+  const int written = snprintf(out, kDescriptorTextSize, "%s[%08lx/%luh/%luh/%luh]%s/%lu/*%s", open,
+                               static_cast<unsigned long>(master_fingerprint),
+                               static_cast<unsigned long>(network.bip_purpose),
+                               static_cast<unsigned long>(network.derivation_coin_type),
+                               static_cast<unsigned long>(account), key,
+                               static_cast<unsigned long>(change), close);
+  if (written <= 0 || static_cast<size_t>(written) >= kDescriptorTextSize ||
+      !local_descriptor_append_checksum(out, kDescriptorTextSize)) {
+    return WalletError::BufferTooSmall;
+  }
+  return WalletError::Ok;
+}
+
+}  // namespace
+
+WalletError export_account(const HdPrivateNode &master, const NetworkProfile &network,
+                           uint32_t account, AccountExport *out) {
+  if (out == nullptr) return WalletError::InvalidArgument;
+  memset(out, 0, sizeof(*out));
+  if (network.encoding == AddressEncoding::CryptoNote ||
+      !valid_address_path(network, account, 0, 0)) {
+    return WalletError::InvalidArgument;
+  }
+  AccountCacheEntry *entry = nullptr;
+  WalletError result = find_account(master, network.bip_purpose, network.derivation_coin_type,
+                                    account, &entry);
+  if (result != WalletError::Ok) return result;
+  // The cached account node already carries its public key, so the export
+  // needs no EC multiplication once the account has been used.
+  HdPublicNode account_node;
+  memcpy(account_node.public_key, entry->account_node.public_key, kCompressedPublicKeySize);
+  memcpy(account_node.chain_code, entry->account_node.node.chain_code, kChainCodeSize);
+  account_node.depth = entry->account_node.node.depth;
+  account_node.parent_fingerprint = entry->account_node.node.parent_fingerprint;
+  account_node.child_number = entry->account_node.node.child_number;
+
+  const bool testnet = network.derivation_coin_type == 1;
+  const ExtendedKeyFormat descriptor_format = testnet ? ExtendedKeyFormat::Tpub : ExtendedKeyFormat::Xpub;
+  const ExtendedKeyFormat display_format = network.encoding != AddressEncoding::P2wpkh ?
+      descriptor_format : testnet ? ExtendedKeyFormat::Vpub : ExtendedKeyFormat::Zpub;
+  char descriptor_key[kExtendedKeyTextSize];
+  size_t key_size = sizeof(out->extended_key);
+  result = hd_serialize_public(&account_node, display_format, out->extended_key, &key_size);
+  if (result == WalletError::Ok) {
+    key_size = sizeof(descriptor_key);
+    result = hd_serialize_public(&account_node, descriptor_format, descriptor_key, &key_size);
+  }
+  if (result == WalletError::Ok) {
+    const int written = snprintf(out->path, sizeof(out->path), "m/%lu'/%lu'/%lu'",
+                                 static_cast<unsigned long>(network.bip_purpose),
+                                 static_cast<unsigned long>(network.derivation_coin_type),
+                                 static_cast<unsigned long>(account));
+    if (written <= 0 || static_cast<size_t>(written) >= sizeof(out->path)) {
+      result = WalletError::BufferTooSmall;
+    }
+  }
+  if (result == WalletError::Ok) {
+    result = write_descriptor(network, cache_master.fingerprint, account, descriptor_key, 0,
+                              out->receive_descriptor);
+  }
+  if (result == WalletError::Ok) {
+    result = write_descriptor(network, cache_master.fingerprint, account, descriptor_key, 1,
+                              out->change_descriptor);
+  }
+  secure_zero(&account_node, sizeof(account_node));
+  secure_zero(descriptor_key, sizeof(descriptor_key));
+  if (result != WalletError::Ok) {
+    secure_zero(out, sizeof(*out));
+    return result;
+  }
+  out->network = &network;
+  return WalletError::Ok;
+}
+
 void clear_derived_address(DerivedAddress *address) {
   if (address != nullptr) secure_zero(address, sizeof(*address));
 }
 
+void clear_derivation_cache() {
+  secure_zero(account_cache, sizeof(account_cache));
+  secure_zero(&cache_master, sizeof(cache_master));
+  cache_master_ready = false;
+  next_cache_slot = 0;
+}
+
+namespace {
+
+struct ListingCheck {
+  const HdPrivateNode *master;
+  size_t visited;
+  bool matched;
+};
+
+void check_listed_address(const NetworkProfile &network, WalletError result,
+                          const DerivedAddress &address, void *context) {
+  ListingCheck *check = static_cast<ListingCheck *>(context);
+  DerivedAddress single;
+  check->matched = check->matched && result == WalletError::Ok &&
+                   derive_address(*check->master, network, 0, 0, 3, &single) == WalletError::Ok &&
+                   address.network == &network && strcmp(address.path, single.path) == 0 &&
+                   strcmp(address.address, single.address) == 0 &&
+                   crypto_constant_time_equal(address.private_key, single.private_key,
+                                              kPrivateKeySize);
+  // The cached leaf account must encode like the point encoders.
+  uint8_t uncompressed[kUncompressedPublicKeySize];
+  char encoded[kAddressTextSize];
+  size_t encoded_size = sizeof(encoded);
+  if (check->matched && network.encoding == AddressEncoding::Evm) {
+    check->matched = uncompressed_public_key_from_private(address.private_key, uncompressed) ==
+                         WalletError::Ok &&
+                     address_evm(uncompressed, encoded, sizeof(encoded)) == WalletError::Ok &&
+                     strcmp(address.address, encoded) == 0;
+  } else if (check->matched && network.encoding == AddressEncoding::Tron) {
+    check->matched = uncompressed_public_key_from_private(address.private_key, uncompressed) ==
+                         WalletError::Ok &&
+                     address_keccak_base58(network.account_version, uncompressed, encoded,
+                                           &encoded_size) == WalletError::Ok &&
+                     strcmp(address.address, encoded) == 0;
+  }
+  secure_zero(uncompressed, sizeof(uncompressed));
+  ++check->visited;
+  clear_derived_address(&single);
+}
+
+// The grouped listing must match derive_address() network by network. Three
+// coin-type-60 EVM networks are interleaved with other groups, so the shared
+// leaf has to survive networks that derive their own.
+bool grouped_listing_matches_single() {
+  static const uint8_t kSeed[16] = {
+      0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,
+  };
+  static const char *const kIds[] = {"eth", "btc", "cro", "trx", "bsc"};
+  NetworkProfile networks[sizeof(kIds) / sizeof(kIds[0])];
+  const size_t count = sizeof(networks) / sizeof(networks[0]);
+  for (size_t index = 0; index < count; ++index) {
+    const NetworkProfile *network = find_network_profile(kIds[index]);
+    if (network == nullptr) return false;
+    networks[index] = *network;
+  }
+  HdPrivateNode master;
+  ListingCheck check = {&master, 0, true};
+  const bool passed = hd_private_from_seed(kSeed, sizeof(kSeed), &master) == WalletError::Ok &&
+                      derive_network_addresses(master, networks, count, 0, 0, 3,
+                                               check_listed_address, &check) == WalletError::Ok &&
+                      check.matched && check.visited == count;
+  secure_zero(&master, sizeof(master));
+  clear_derivation_cache();
+  return passed;
+}
+
+struct RangeCheck {
+  const HdPrivateNode *master;
+  uint32_t next_index;
+  bool matched;
+};
+
+void check_range_address(const NetworkProfile &network, WalletError result,
+                         const DerivedAddress &address, void *context) {
+  RangeCheck *check = static_cast<RangeCheck *>(context);
+  DerivedAddress single;
+  check->matched = check->matched && result == WalletError::Ok &&
+                   derive_address(*check->master, network, 0, 0, check->next_index, &single) ==
+                       WalletError::Ok &&
+                   strcmp(address.path, single.path) == 0 &&
+                   strcmp(address.address, single.address) == 0;
+  ++check->next_index;
+  clear_derived_address(&single);
+}
+
+// Public derivation from the neutered change node must reproduce the private
+// path for a compressed (btc) and an uncompressed (eth) leaf key.
+bool range_matches_single() {
+  static const uint8_t kSeed[16] = {
+      0x0f,0x0e,0x0d,0x0c,0x0b,0x0a,0x09,0x08,0x07,0x06,0x05,0x04,0x03,0x02,0x01,0x00,
+  };
+  static const char *const kIds[] = {"btc", "eth"};
+  HdPrivateNode master;
+  bool passed = hd_private_from_seed(kSeed, sizeof(kSeed), &master) == WalletError::Ok;
+  for (const char *id : kIds) {
+    const NetworkProfile *network = find_network_profile(id);
+    RangeCheck check = {&master, 5, true};
+    passed = passed && network != nullptr &&
+             derive_address_range(master, *network, 0, 0, 5, 3, check_range_address, &check) ==
+                 WalletError::Ok &&
+             check.matched && check.next_index == 8;
+  }
+  secure_zero(&master, sizeof(master));
+  clear_derivation_cache();
+  return passed;
+}
+
+// BIP84 account 0 of "abandon ... about": the zpub is the BIP84 vector and
+// the descriptor matches Bitcoin Core's for the same seed.
+bool account_export_matches_bip84() {
+  static const uint8_t kSeed[64] = {
+      0x5e,0xb0,0x0b,0xbd,0xdc,0xf0,0x69,0x08,0x48,0x89,0xa8,0xab,0x91,0x55,0x56,0x81,
+      0x65,0xf5,0xc4,0x53,0xcc,0xb8,0x5e,0x70,0x81,0x1a,0xae,0xd6,0xf6,0xda,0x5f,0xc1,
+      0x9a,0x5a,0xc4,0x0b,0x38,0x9c,0xd3,0x70,0xd0,0x86,0x20,0x6d,0xec,0x8a,0xa6,0xc4,
+      0x3d,0xae,0xa6,0x69,0x0f,0x20,0xad,0x3d,0x8d,0x48,0xb2,0xd2,0xce,0x9e,0x38,0xe4,
+  };
+  static const char kZpub[] =
+      "zpub6rFR7y4Q2AijBEqTUquhVz398htDFrtymD9xYYfG1m4wAcvPhXNfE3EfH1r1ADqtfSdVCToUG868RvUUkgDKf31mGDtKsAYz2oz2AGutZYs";
+  static const char kReceive[] =
+      "wpkh([73c5da0a/84h/0h/0h]xpub6CatWdiZiodmUeTDp8LT5or8nmbKNcuyvz7WyksVFkKB4RHwCD3XyuvPEbvqAQY3"
+      "rAPshWcMLoP2fMFMKHPJ4ZeZXYVUhLv1VMrjPC7PW6V/0/*)#afwvtk2s";
+  static const char kChange[] =
+      "wpkh([73c5da0a/84h/0h/0h]xpub6CatWdiZiodmUeTDp8LT5or8nmbKNcuyvz7WyksVFkKB4RHwCD3XyuvPEbvqAQY3"
+      "rAPshWcMLoP2fMFMKHPJ4ZeZXYVUhLv1VMrjPC7PW6V/1/*)#vatdkr6g";
+  const NetworkProfile *network = find_network_profile("btc");
+  const NetworkProfile *evm = find_network_profile("eth");
+  const NetworkProfile *monero = find_network_profile("xmr");
+  HdPrivateNode master;
+  AccountExport exported;
+  bool passed = network != nullptr && evm != nullptr && monero != nullptr &&
+                hd_private_from_seed(kSeed, sizeof(kSeed), &master) == WalletError::Ok &&
+                export_account(master, *network, 0, &exported) == WalletError::Ok &&
+                strcmp(exported.path, "m/84'/0'/0'") == 0 &&
+                strcmp(exported.extended_key, kZpub) == 0 &&
+                strcmp(exported.receive_descriptor, kReceive) == 0 &&
+                strcmp(exported.change_descriptor, kChange) == 0;
+  passed = passed && export_account(master, *evm, 0, &exported) == WalletError::Ok &&
+           strncmp(exported.extended_key, "xpub", 4) == 0 && exported.receive_descriptor[0] == '\0' &&
+           export_account(master, *monero, 0, &exported) == WalletError::InvalidArgument;
+  secure_zero(&master, sizeof(master));
+  clear_derivation_cache();
+  return passed;
+}
+
+struct SubaddressZeroCheck {
+  const char *standard;
+  bool matched;
+};
+
+void check_subaddress_zero(WalletError result, const CryptoNoteSubaddress &subaddress,
+                           void *context) {
+  SubaddressZeroCheck *check = static_cast<SubaddressZeroCheck *>(context);
+  check->matched = result == WalletError::Ok && subaddress.major == 0 && subaddress.minor == 0 &&
+                   strcmp(subaddress.address, check->standard) == 0;
+}
+
+// Subaddress 0/0 is the standard address derive_address() shows for the same
+// leaf, so both paths must agree on the wallet keys.
+bool subaddress_zero_matches_standard() {
+  static const uint8_t kSeed[16] = {
+      0x10,0x32,0x54,0x76,0x98,0xba,0xdc,0xfe,0x01,0x23,0x45,0x67,0x89,0xab,0xcd,0xef,
+  };
+  const NetworkProfile *monero = find_network_profile("xmr");
+  const NetworkProfile *masari = find_network_profile("msr");
+  HdPrivateNode master;
+  DerivedAddress standard;
+  bool passed = monero != nullptr && masari != nullptr &&
+                hd_private_from_seed(kSeed, sizeof(kSeed), &master) == WalletError::Ok &&
+                derive_address(master, *monero, 0, 0, 2, &standard) == WalletError::Ok;
+  SubaddressZeroCheck check = {standard.address, false};
+  passed = passed && derive_subaddress_range(master, *monero, 2, 0, 0, 1, check_subaddress_zero,
+                                             &check) == WalletError::Ok &&
+           check.matched &&
+           derive_subaddress_range(master, *masari, 2, 0, 0, 1, check_subaddress_zero, &check) ==
+               WalletError::InvalidArgument;
+  clear_derived_address(&standard);
+  secure_zero(&master, sizeof(master));
+  clear_derivation_cache();
+  return passed;
+}
+
+// Scanning needs no subaddress prefix, so Masari scanners work as well, and
+// other networks have no view key to scan with.
+bool output_scanner_follows_network() {
+  static const uint8_t kSeed[16] = {
+      0x10,0x32,0x54,0x76,0x98,0xba,0xdc,0xfe,0x01,0x23,0x45,0x67,0x89,0xab,0xcd,0xef,
+  };
+  const NetworkProfile *monero = find_network_profile("xmr");
+  const NetworkProfile *masari = find_network_profile("msr");
+  const NetworkProfile *bitcoin = find_network_profile("btc");
+  HdPrivateNode master;
+  CryptoNoteScanner scanner;
+  const bool passed =
+      monero != nullptr && masari != nullptr && bitcoin != nullptr &&
+      hd_private_from_seed(kSeed, sizeof(kSeed), &master) == WalletError::Ok &&
+      derive_output_scanner(master, *monero, 2, &scanner) == WalletError::Ok &&
+      derive_output_scanner(master, *masari, 2, &scanner) == WalletError::Ok &&
+      derive_output_scanner(master, *bitcoin, 2, &scanner) == WalletError::InvalidArgument &&
+      derive_output_scanner(master, *monero, kHardenedOffset, &scanner) ==
+          WalletError::InvalidArgument;
+  secure_zero(&scanner, sizeof(scanner));
+  secure_zero(&master, sizeof(master));
+  clear_derivation_cache();
+  return passed;
+}
+
+}  // namespace
+
 bool run_address_self_tests() {
   static const uint8_t kPrivateOne[kPrivateKeySize] = {
       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
@@ -100,6 +782,11 @@ bool run_address_self_tests() {
   secure_zero(compressed, sizeof(compressed));
   secure_zero(uncompressed, sizeof(uncompressed));
   secure_zero(address, sizeof(address));
+  passed = passed && grouped_listing_matches_single();
+  passed = passed && range_matches_single();
+  passed = passed && account_export_matches_bip84();
+  passed = passed && subaddress_zero_matches_standard();
+  passed = passed && output_scanner_follows_network();
   return passed;
 }
 
@@ -4,6 +4,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "CryptoNoteAddress.h"
 #include "WalletNetworks.h"
 #include "WalletSecurity.h"
 
@@ -22,7 +23,62 @@ struct DerivedAddress {
 WalletError derive_address(const HdPrivateNode &master, const NetworkProfile &network,
                            uint32_t account, uint32_t change, uint32_t address_index,
                            DerivedAddress *out);
+// Receives each network's address in listing order. address is cleared when
+// result is not Ok, and is wiped again once the visitor returns.
+using DerivedAddressVisitor = void (*)(const NetworkProfile &network, WalletError result,
+                                       const DerivedAddress &address, void *context);
+// Derives account/change/address_index for each of count networks. Networks
+// with the same purpose, coin type and key form share one leaf key and public
+// key, so only the per-network encoding repeats and all coin-type-60 EVM
+// networks cost one derivation. Returns the first error, after visiting all.
+WalletError derive_network_addresses(const HdPrivateNode &master, const NetworkProfile *networks,
+                                     size_t count, uint32_t account, uint32_t change,
+                                     uint32_t address_index, DerivedAddressVisitor visit,
+                                     void *context);
+// Derives count consecutive addresses from first_index on the account/change
+// branch and passes each to visit in index order. The change node is neutered
+// once and the leaves are public children, derived kHdPublicKeyBatchSize at a
+// time, so no private path walk runs per index. CryptoNote keys need the
+// private leaf and are derived one by one. private_key is zero in every
+// result. Returns the first error, after visiting all.
+WalletError derive_address_range(const HdPrivateNode &master, const NetworkProfile &network,
+                                 uint32_t account, uint32_t change, uint32_t first_index,
+                                 uint32_t count, DerivedAddressVisitor visit, void *context);
+// Subaddresses major/first_minor onwards of the CryptoNote wallet that
+// derive_address() shows at m/purpose'/coin'/0'/0/address_index, through
+// cryptonote_subaddress_range(). Fails with InvalidArgument for other
+// networks and for CryptoNote networks without a subaddress prefix.
+WalletError derive_subaddress_range(const HdPrivateNode &master, const NetworkProfile &network,
+                                    uint32_t address_index, uint32_t major, uint32_t first_minor,
+                                    uint32_t count, CryptoNoteSubaddressVisitor visit,
+                                    void *context);
+// Output scanner for the same CryptoNote wallet, for
+// cryptonote_scan_outputs(); the view key stays on the device. Fails with
+// InvalidArgument for other networks. Callers wipe out when done.
+WalletError derive_output_scanner(const HdPrivateNode &master, const NetworkProfile &network,
+                                  uint32_t address_index, CryptoNoteScanner *out);
+// Watch-only export of m/purpose'/coin'/account'. extended_key uses the
+// SLIP-132 zpub/vpub versions for native SegWit and xpub/tpub otherwise. The
+// descriptors are BIP380 text with the master fingerprint as key origin and
+// the xpub/tpub key, for the receive (/0/*) and change (/1/*) branches. They
+// are empty for networks without Bitcoin output scripts.
+constexpr size_t kDescriptorTextSize = 192;
+
+struct AccountExport {
+  const NetworkProfile *network;
+  char path[kDerivationPathTextSize];
+  char extended_key[kExtendedKeyTextSize];
+  char receive_descriptor[kDescriptorTextSize];
+  char change_descriptor[kDescriptorTextSize];
+};
+
+// Fails with InvalidArgument for CryptoNote networks, whose keys have no
+// BIP32 public derivation.
+WalletError export_account(const HdPrivateNode &master, const NetworkProfile &network,
+                           uint32_t account, AccountExport *out);
 void clear_derived_address(DerivedAddress *address);
+// Wipes the per-session account and change node cache used by derive_address().
+void clear_derivation_cache();
 bool run_address_self_tests();
 
 }  // namespace hexwallet
@@ -3,13 +3,13 @@
 #include <Arduino.h>
 #include <esp_system.h>
 #include <mbedtls/ecp.h>
-#include <mbedtls/ecdsa.h>
 #include <mbedtls/platform_util.h>
-#include <mbedtls/pkcs5.h>
 #include <string.h>
 
 #include "base58.h"
 #include "CryptoPrimitives.h"
+#include "local_secp256k1.h"
+#include "WalletTrace.h"
 #include "word_list.h"
 
 namespace hexwallet {
@@ -19,6 +19,7 @@ constexpr size_t kMnemonicTextSize = 256;
 constexpr size_t kMaxPassphraseSize = 128;
 constexpr size_t kExtendedKeyPayloadSize = 78;
 constexpr size_t kExtendedKeyCheckedSize = 82;
+constexpr size_t kMaxNonceAttempts = 8;
 
 int random_callback(void *, unsigned char *output, size_t length) {
   esp_fill_random(output, length);
@@ -26,17 +27,79 @@ int random_callback(void *, unsigned char *output, size_t length) {
 }
 
 bool valid_private_key(const uint8_t key[kPrivateKeySize]) {
+  return local_secp256k1_scalar_is_valid(key);
+}
+
+// mbedtls stays linked as an independent oracle for the in-tree curve code.
+bool public_key_matches_mbedtls(const uint8_t private_key[kPrivateKeySize]) {
   mbedtls_ecp_group group;
+  mbedtls_ecp_point point;
   mbedtls_mpi scalar;
   mbedtls_ecp_group_init(&group);
+  mbedtls_ecp_point_init(&point);
   mbedtls_mpi_init(&scalar);
+  uint8_t expected[kUncompressedPublicKeySize];
+  uint8_t actual[kUncompressedPublicKeySize];
+  size_t length = sizeof(expected);
   const int result = mbedtls_ecp_group_load(&group, MBEDTLS_ECP_DP_SECP256K1) ||
-                     mbedtls_mpi_read_binary(&scalar, key, kPrivateKeySize);
-  const bool valid = result == 0 && mbedtls_mpi_cmp_int(&scalar, 0) > 0 &&
-                     mbedtls_mpi_cmp_mpi(&scalar, &group.N) < 0;
+                     mbedtls_mpi_read_binary(&scalar, private_key, kPrivateKeySize) ||
+                     mbedtls_ecp_mul(&group, &point, &scalar, &group.G, random_callback, nullptr) ||
+                     mbedtls_ecp_point_write_binary(&group, &point, MBEDTLS_ECP_PF_UNCOMPRESSED,
+                                                    &length, expected, sizeof(expected));
+  const bool matches = result == 0 && length == sizeof(expected) &&
+                       uncompressed_public_key_from_private(private_key, actual) == WalletError::Ok &&
+                       crypto_constant_time_equal(expected, actual, sizeof(actual));
   mbedtls_mpi_free(&scalar);
+  mbedtls_ecp_point_free(&point);
   mbedtls_ecp_group_free(&group);
-  return valid;
+  secure_zero(expected, sizeof(expected));
+  secure_zero(actual, sizeof(actual));
+  return matches;
+}
+
+// RFC 6979 deterministic nonces with HMAC-SHA256. The output matches the
+// mbedtls_ecdsa_sign_det_ext signatures this wallet produced before.
+bool sign_deterministic(const uint8_t private_key[kPrivateKeySize],
+                        const uint8_t digest[kSha256Size], RecoverableSignature *out_signature,
+                        uint8_t *out_recovery_id) {
+  uint8_t v[kSha256Size];
+  uint8_t k[kSha256Size];
+  uint8_t next[kSha256Size];
+  uint8_t buffer[kSha256Size + 1 + 2 * kPrivateKeySize];
+  memset(v, 0x01, sizeof(v));
+  memset(k, 0x00, sizeof(k));
+  memcpy(buffer + kSha256Size + 1, private_key, kPrivateKeySize);
+  local_secp256k1_scalar_reduce(digest, buffer + kSha256Size + 1 + kPrivateKeySize);
+  bool ok = true;
+  for (uint8_t separator = 0; ok && separator < 2; ++separator) {
+    memcpy(buffer, v, sizeof(v));
+    buffer[kSha256Size] = separator;
+    ok = crypto_hmac_sha256(k, sizeof(k), buffer, sizeof(buffer), next);
+    if (ok) memcpy(k, next, sizeof(k));
+    ok = ok && crypto_hmac_sha256(k, sizeof(k), v, sizeof(v), next);
+    if (ok) memcpy(v, next, sizeof(v));
+  }
+  bool signed_digest = false;
+  for (size_t attempt = 0; ok && !signed_digest && attempt < kMaxNonceAttempts; ++attempt) {
+    ok = crypto_hmac_sha256(k, sizeof(k), v, sizeof(v), next);
+    if (ok) memcpy(v, next, sizeof(v));
+    HEXWALLET_TRACE_COUNT(EcMultiply, 1);
+    signed_digest = ok && local_secp256k1_sign(private_key, digest, v, out_signature->r,
+                                               out_signature->s, out_recovery_id);
+    if (ok && !signed_digest) {
+      buffer[kSha256Size] = 0;
+      memcpy(buffer, v, sizeof(v));
+      ok = crypto_hmac_sha256(k, sizeof(k), buffer, kSha256Size + 1, next);
+      if (ok) memcpy(k, next, sizeof(k));
+      ok = ok && crypto_hmac_sha256(k, sizeof(k), v, sizeof(v), next);
+      if (ok) memcpy(v, next, sizeof(v));
+    }
+  }
+  secure_zero(v, sizeof(v));
+  secure_zero(k, sizeof(k));
+  secure_zero(next, sizeof(next));
+  secure_zero(buffer, sizeof(buffer));
+  return signed_digest;
 }
 
 bool hash160(const uint8_t *data, size_t length, uint8_t out[20]) {
@@ -125,6 +188,62 @@ WalletError serialize_payload(const uint8_t *key, const uint8_t chain_code[kChai
   return WalletError::Ok;
 }
 
+bool parse_path_index(const char **cursor, uint32_t *out_index) {
+  const char *position = *cursor;
+  if (*position < '0' || *position > '9') {
+    return false;
+  }
+  uint32_t index = 0;
+  while (*position >= '0' && *position <= '9') {
+    if (index > 214748364U || (index == 214748364U && *position > '7')) {
+      return false;
+    }
+    index = index * 10 + static_cast<uint32_t>(*position - '0');
+    ++position;
+  }
+  if (*position == '\'' || *position == 'h' || *position == 'H') {
+    index |= kHardenedOffset;
+    ++position;
+  }
+  if (*position != '\0' && *position != '/') {
+    return false;
+  }
+  *cursor = position;
+  *out_index = index;
+  return true;
+}
+
+// Intermediate nodes stay expanded so each public key on the path is computed
+// once; the leaf is returned without its own public key.
+WalletError derive_path_walk(const HdExpandedPrivateNode &start, const char *path,
+                             HdPrivateNode *out_leaf) {
+  if (path[0] != 'm' || (path[1] != '\0' && path[1] != '/')) {
+    return WalletError::InvalidPath;
+  }
+  HdExpandedPrivateNode current = start;
+  HdPrivateNode leaf = start.node;
+  WalletError result = WalletError::Ok;
+  const char *cursor = path + 1;
+  while (result == WalletError::Ok && *cursor != '\0') {
+    ++cursor;
+    uint32_t index;
+    if (!parse_path_index(&cursor, &index)) {
+      result = WalletError::InvalidPath;
+    } else if (*cursor == '\0') {
+      result = hd_private_derive_from_expanded(&current, index, &leaf);
+    } else {
+      HdExpandedPrivateNode next;
+      result = hd_private_derive_expanded(&current, index, &next);
+      current = next;
+      secure_zero(&next, sizeof(next));
+    }
+  }
+  if (result == WalletError::Ok) *out_leaf = leaf;
+  secure_zero(&current, sizeof(current));
+  secure_zero(&leaf, sizeof(leaf));
+  return result;
+}
+
 bool word_index(const char *word, size_t length, uint16_t *out_index) {
   for (uint16_t index = 0; index < 2048; ++index) {
     const char *candidate = english_word_list[index];
@@ -280,12 +399,12 @@ WalletError bip39_seed_from_english(const char *mnemonic, const char *passphrase
   char salt[sizeof("mnemonic") + kMaxPassphraseSize];
   memcpy(salt, "mnemonic", 8);
   memcpy(salt + 8, passphrase, passphrase_length);
-  const int result = mbedtls_pkcs5_pbkdf2_hmac_ext(
-      MBEDTLS_MD_SHA512, reinterpret_cast<const unsigned char *>(mnemonic), strlen(mnemonic),
-      reinterpret_cast<const unsigned char *>(salt), 8 + passphrase_length,
-      2048, kSeedSize, out_seed);
+  const bool derived = crypto_pbkdf2_sha512(
+      reinterpret_cast<const uint8_t *>(mnemonic), strlen(mnemonic),
+      reinterpret_cast<const uint8_t *>(salt), 8 + passphrase_length,
+      2048, out_seed, kSeedSize);
   secure_zero(salt, sizeof(salt));
-  return result == 0 ? WalletError::Ok : WalletError::CryptoFailure;
+  return derived ? WalletError::Ok : WalletError::CryptoFailure;
 }
 
 bool run_bip39_self_test() {
@@ -310,22 +429,9 @@ WalletError public_key_from_private(const uint8_t private_key[kPrivateKeySize],
   if (private_key == nullptr || out_public_key == nullptr || !valid_private_key(private_key)) {
     return WalletError::InvalidKey;
   }
-  mbedtls_ecp_group group;
-  mbedtls_ecp_point point;
-  mbedtls_mpi scalar;
-  mbedtls_ecp_group_init(&group);
-  mbedtls_ecp_point_init(&point);
-  mbedtls_mpi_init(&scalar);
-  size_t length = kCompressedPublicKeySize;
-  const int result = mbedtls_ecp_group_load(&group, MBEDTLS_ECP_DP_SECP256K1) ||
-                     mbedtls_mpi_read_binary(&scalar, private_key, kPrivateKeySize) ||
-                     mbedtls_ecp_mul(&group, &point, &scalar, &group.G, random_callback, nullptr) ||
-                     mbedtls_ecp_point_write_binary(&group, &point, MBEDTLS_ECP_PF_COMPRESSED,
-                                                    &length, out_public_key, kCompressedPublicKeySize);
-  mbedtls_mpi_free(&scalar);
-  mbedtls_ecp_point_free(&point);
-  mbedtls_ecp_group_free(&group);
-  return result == 0 && length == kCompressedPublicKeySize ? WalletError::Ok : WalletError::CryptoFailure;
+  HEXWALLET_TRACE_COUNT(EcMultiply, 1);
+  return local_secp256k1_public_key(private_key, true, out_public_key) ? WalletError::Ok
+                                                                      : WalletError::CryptoFailure;
 }
 
 WalletError uncompressed_public_key_from_private(
@@ -334,23 +440,9 @@ WalletError uncompressed_public_key_from_private(
   if (private_key == nullptr || out_public_key == nullptr || !valid_private_key(private_key)) {
     return WalletError::InvalidKey;
   }
-  mbedtls_ecp_group group;
-  mbedtls_ecp_point point;
-  mbedtls_mpi scalar;
-  mbedtls_ecp_group_init(&group);
-  mbedtls_ecp_point_init(&point);
-  mbedtls_mpi_init(&scalar);
-  size_t length = kUncompressedPublicKeySize;
-  const int result = mbedtls_ecp_group_load(&group, MBEDTLS_ECP_DP_SECP256K1) ||
-                     mbedtls_mpi_read_binary(&scalar, private_key, kPrivateKeySize) ||
-                     mbedtls_ecp_mul(&group, &point, &scalar, &group.G, random_callback, nullptr) ||
-                     mbedtls_ecp_point_write_binary(&group, &point, MBEDTLS_ECP_PF_UNCOMPRESSED,
-                                                    &length, out_public_key, kUncompressedPublicKeySize);
-  mbedtls_mpi_free(&scalar);
-  mbedtls_ecp_point_free(&point);
-  mbedtls_ecp_group_free(&group);
-  return result == 0 && length == kUncompressedPublicKeySize ? WalletError::Ok
-                                                             : WalletError::CryptoFailure;
+  HEXWALLET_TRACE_COUNT(EcMultiply, 1);
+  return local_secp256k1_public_key(private_key, false, out_public_key) ? WalletError::Ok
+                                                                       : WalletError::CryptoFailure;
 }
 
 WalletError secp256k1_sign_digest_recoverable(
@@ -361,70 +453,23 @@ WalletError secp256k1_sign_digest_recoverable(
     return WalletError::InvalidArgument;
   }
   memset(out_signature, 0, sizeof(*out_signature));
-  mbedtls_ecp_group group;
-  mbedtls_ecp_point public_key;
-  mbedtls_ecp_point recovery_point;
-  mbedtls_mpi private_scalar, r, s, half_order, z, inverse_s, u1, u2, reduced_x;
-  mbedtls_ecp_group_init(&group);
-  mbedtls_ecp_point_init(&public_key);
-  mbedtls_ecp_point_init(&recovery_point);
-  mbedtls_mpi_init(&private_scalar); mbedtls_mpi_init(&r); mbedtls_mpi_init(&s);
-  mbedtls_mpi_init(&half_order); mbedtls_mpi_init(&z); mbedtls_mpi_init(&inverse_s);
-  mbedtls_mpi_init(&u1); mbedtls_mpi_init(&u2); mbedtls_mpi_init(&reduced_x);
-  int result = mbedtls_ecp_group_load(&group, MBEDTLS_ECP_DP_SECP256K1);
-  if (result == 0) result = mbedtls_mpi_read_binary(&private_scalar, private_key, kPrivateKeySize);
-  if (result == 0) {
-    result = mbedtls_ecdsa_sign_det_ext(&group, &r, &s, &private_scalar,
-                                        digest, kSha256Size, MBEDTLS_MD_SHA256,
-                                        random_callback, nullptr);
-  }
-  if (result == 0) result = mbedtls_mpi_copy(&half_order, &group.N);
-  if (result == 0) result = mbedtls_mpi_shift_r(&half_order, 1);
-  if (result == 0 && mbedtls_mpi_cmp_mpi(&s, &half_order) > 0) {
-    result = mbedtls_mpi_sub_mpi(&s, &group.N, &s);
-  }
-  if (result == 0) {
-    result = mbedtls_ecp_mul(&group, &public_key, &private_scalar, &group.G,
-                             random_callback, nullptr);
-  }
-  if (result == 0) {
-    result = mbedtls_ecdsa_verify(&group, digest, kSha256Size, &public_key, &r, &s);
-  }
-
-  // The verification point equals the ECDSA nonce point for the normalized
-  // low-S signature. Its Y parity is the recovery bit used by Ethereum.
-  if (result == 0) result = mbedtls_mpi_read_binary(&z, digest, kSha256Size);
-  if (result == 0) result = mbedtls_mpi_mod_mpi(&z, &z, &group.N);
-  if (result == 0) result = mbedtls_mpi_inv_mod(&inverse_s, &s, &group.N);
-  if (result == 0) result = mbedtls_mpi_mul_mpi(&u1, &z, &inverse_s);
-  if (result == 0) result = mbedtls_mpi_mod_mpi(&u1, &u1, &group.N);
-  if (result == 0) result = mbedtls_mpi_mul_mpi(&u2, &r, &inverse_s);
-  if (result == 0) result = mbedtls_mpi_mod_mpi(&u2, &u2, &group.N);
-  if (result == 0) {
-    result = mbedtls_ecp_muladd(&group, &recovery_point, &u1, &group.G, &u2, &public_key);
-  }
-  if (result == 0) {
-    result = mbedtls_mpi_copy(&reduced_x, &recovery_point.MBEDTLS_PRIVATE(X));
-  }
-  if (result == 0) result = mbedtls_mpi_mod_mpi(&reduced_x, &reduced_x, &group.N);
-  if (result == 0 && (mbedtls_mpi_cmp_mpi(&reduced_x, &r) != 0 ||
-                      mbedtls_mpi_cmp_mpi(&recovery_point.MBEDTLS_PRIVATE(X), &group.N) >= 0)) {
-    result = MBEDTLS_ERR_ECP_VERIFY_FAILED;
-  }
-  if (result == 0) result = mbedtls_mpi_write_binary(&r, out_signature->r, kPrivateKeySize);
-  if (result == 0) result = mbedtls_mpi_write_binary(&s, out_signature->s, kPrivateKeySize);
-  if (result == 0) {
-    out_signature->y_parity = static_cast<uint8_t>(
-        mbedtls_mpi_get_bit(&recovery_point.MBEDTLS_PRIVATE(Y), 0));
-  }
-
-  mbedtls_mpi_free(&reduced_x); mbedtls_mpi_free(&u2); mbedtls_mpi_free(&u1);
-  mbedtls_mpi_free(&inverse_s); mbedtls_mpi_free(&z); mbedtls_mpi_free(&half_order);
-  mbedtls_mpi_free(&s); mbedtls_mpi_free(&r); mbedtls_mpi_free(&private_scalar);
-  mbedtls_ecp_point_free(&recovery_point); mbedtls_ecp_point_free(&public_key);
-  mbedtls_ecp_group_free(&group);
-  if (result != 0) secure_zero(out_signature, sizeof(*out_signature));
-  return result == 0 ? WalletError::Ok : WalletError::CryptoFailure;
+  uint8_t recovery_id = 0;
+  uint8_t verified_recovery_id = 0;
+  uint8_t public_key[kCompressedPublicKeySize];
+  bool ok = sign_deterministic(private_key, digest, out_signature, &recovery_id) &&
+            public_key_from_private(private_key, public_key) == WalletError::Ok;
+
+  // Verifying against the signer's own key rejects a faulted signature, and
+  // the reconstructed nonce point must agree on the recovery id. Its Y parity
+  // is the recovery bit used by Ethereum; an X overflow cannot be expressed.
+  HEXWALLET_TRACE_COUNT(EcMultiply, ok ? 2 : 0);
+  ok = ok && local_secp256k1_verify(public_key, sizeof(public_key), digest, out_signature->r,
+                                    out_signature->s, &verified_recovery_id) &&
+       verified_recovery_id == recovery_id && recovery_id <= 1;
+  if (ok) out_signature->y_parity = recovery_id;
+  secure_zero(public_key, sizeof(public_key));
+  if (!ok) secure_zero(out_signature, sizeof(*out_signature));
+  return ok ? WalletError::Ok : WalletError::CryptoFailure;
 }
 
 WalletError hd_private_from_seed(const uint8_t *seed, size_t seed_size, HdPrivateNode *out_node) {
@@ -453,62 +498,78 @@ WalletError hd_private_derive(const HdPrivateNode *parent, uint32_t index, HdPri
   if (parent == nullptr || out_node == nullptr || !valid_private_key(parent->private_key) || parent->depth == 255) {
     return WalletError::InvalidArgument;
   }
-  uint8_t data[37];
-  uint8_t material[64];
-  uint8_t parent_public[kCompressedPublicKeySize];
-  const WalletError public_error = public_key_from_private(parent->private_key, parent_public);
-  if (public_error != WalletError::Ok) {
-    return public_error;
+  HdExpandedPrivateNode expanded;
+  WalletError result = hd_private_expand(parent, &expanded);
+  if (result == WalletError::Ok) result = hd_private_derive_from_expanded(&expanded, index, out_node);
+  secure_zero(&expanded, sizeof(expanded));
+  return result;
+}
+
+WalletError hd_private_expand(const HdPrivateNode *node, HdExpandedPrivateNode *out_node) {
+  if (node == nullptr || out_node == nullptr) {
+    return WalletError::InvalidArgument;
   }
-  uint32_t parent_fingerprint;
-  if (!fingerprint(parent_public, &parent_fingerprint)) {
-    secure_zero(parent_public, sizeof(parent_public));
+  const WalletError result = public_key_from_private(node->private_key, out_node->public_key);
+  if (result != WalletError::Ok) {
+    secure_zero(out_node, sizeof(*out_node));
+    return result;
+  }
+  if (!fingerprint(out_node->public_key, &out_node->fingerprint)) {
+    secure_zero(out_node, sizeof(*out_node));
     return WalletError::CryptoFailure;
   }
+  out_node->node = *node;
+  return WalletError::Ok;
+}
+
+WalletError hd_private_derive_from_expanded(const HdExpandedPrivateNode *parent, uint32_t index,
+                                            HdPrivateNode *out_node) {
+  if (parent == nullptr || out_node == nullptr || !valid_private_key(parent->node.private_key) ||
+      parent->node.depth == 255) {
+    return WalletError::InvalidArgument;
+  }
+  HEXWALLET_TRACE_SCOPE(HdPrivateDerive);
+  uint8_t data[37];
+  uint8_t material[64];
   if (index >= kHardenedOffset) {
     data[0] = 0;
-    memcpy(data + 1, parent->private_key, kPrivateKeySize);
+    memcpy(data + 1, parent->node.private_key, kPrivateKeySize);
   } else {
-    memcpy(data, parent_public, sizeof(parent_public));
+    memcpy(data, parent->public_key, kCompressedPublicKeySize);
   }
   write_u32_be(data + 33, index);
-  if (!crypto_hmac_sha512(parent->chain_code, kChainCodeSize, data, sizeof(data), material)) {
+  if (!crypto_hmac_sha512(parent->node.chain_code, kChainCodeSize, data, sizeof(data), material)) {
     secure_zero(data, sizeof(data));
-    secure_zero(parent_public, sizeof(parent_public));
     return WalletError::CryptoFailure;
   }
-  mbedtls_ecp_group group;
-  mbedtls_mpi left;
-  mbedtls_mpi parent_key;
-  mbedtls_mpi child_key;
-  mbedtls_ecp_group_init(&group);
-  mbedtls_mpi_init(&left);
-  mbedtls_mpi_init(&parent_key);
-  mbedtls_mpi_init(&child_key);
-  const int result = mbedtls_ecp_group_load(&group, MBEDTLS_ECP_DP_SECP256K1) ||
-                     mbedtls_mpi_read_binary(&left, material, kPrivateKeySize) ||
-                     mbedtls_mpi_read_binary(&parent_key, parent->private_key, kPrivateKeySize) ||
-                     mbedtls_mpi_add_mpi(&child_key, &left, &parent_key) ||
-                     mbedtls_mpi_mod_mpi(&child_key, &child_key, &group.N);
-  const bool valid = result == 0 && mbedtls_mpi_cmp_int(&left, 0) > 0 &&
-                     mbedtls_mpi_cmp_mpi(&left, &group.N) < 0 && mbedtls_mpi_cmp_int(&child_key, 0) != 0;
+  uint8_t child_key[kPrivateKeySize];
+  const bool valid = valid_private_key(material) &&
+                     local_secp256k1_scalar_add(material, parent->node.private_key, child_key);
   if (valid) {
-    mbedtls_mpi_write_binary(&child_key, out_node->private_key, kPrivateKeySize);
+    memcpy(out_node->private_key, child_key, kPrivateKeySize);
     memcpy(out_node->chain_code, material + kPrivateKeySize, kChainCodeSize);
-    out_node->depth = parent->depth + 1;
-    out_node->parent_fingerprint = parent_fingerprint;
+    out_node->depth = parent->node.depth + 1;
+    out_node->parent_fingerprint = parent->fingerprint;
     out_node->child_number = index;
   }
-  mbedtls_mpi_free(&child_key);
-  mbedtls_mpi_free(&parent_key);
-  mbedtls_mpi_free(&left);
-  mbedtls_ecp_group_free(&group);
+  secure_zero(child_key, sizeof(child_key));
   secure_zero(data, sizeof(data));
   secure_zero(material, sizeof(material));
-  secure_zero(parent_public, sizeof(parent_public));
   return valid ? WalletError::Ok : WalletError::InvalidChild;
 }
 
+WalletError hd_private_derive_expanded(const HdExpandedPrivateNode *parent, uint32_t index,
+                                       HdExpandedPrivateNode *out_node) {
+  if (out_node == nullptr) {
+    return WalletError::InvalidArgument;
+  }
+  HdPrivateNode child;
+  WalletError result = hd_private_derive_from_expanded(parent, index, &child);
+  if (result == WalletError::Ok) result = hd_private_expand(&child, out_node);
+  secure_zero(&child, sizeof(child));
+  return result;
+}
+
 WalletError hd_public_neuter(const HdPrivateNode *private_node, HdPublicNode *out_node) {
   if (private_node == nullptr || out_node == nullptr) {
     return WalletError::InvalidArgument;
@@ -539,98 +600,74 @@ WalletError hd_public_derive(const HdPublicNode *parent, uint32_t index, HdPubli
   if (!crypto_hmac_sha512(parent->chain_code, kChainCodeSize, data, sizeof(data), material)) {
     return WalletError::CryptoFailure;
   }
-  mbedtls_ecp_group group;
-  mbedtls_ecp_point parent_point;
-  mbedtls_ecp_point child_point;
-  mbedtls_mpi left;
-  mbedtls_mpi one;
-  mbedtls_ecp_group_init(&group);
-  mbedtls_ecp_point_init(&parent_point);
-  mbedtls_ecp_point_init(&child_point);
-  mbedtls_mpi_init(&left);
-  mbedtls_mpi_init(&one);
-  size_t public_size = kCompressedPublicKeySize;
-  int result = mbedtls_ecp_group_load(&group, MBEDTLS_ECP_DP_SECP256K1) ||
-               mbedtls_ecp_point_read_binary(&group, &parent_point, parent->public_key,
-                                             kCompressedPublicKeySize);
-  if (result == 0) result = mbedtls_ecp_check_pubkey(&group, &parent_point);
-  if (result == 0) result = mbedtls_mpi_read_binary(&left, material, kPrivateKeySize);
-  const bool valid_offset = result == 0 && mbedtls_mpi_cmp_int(&left, 0) > 0 &&
-                            mbedtls_mpi_cmp_mpi(&left, &group.N) < 0;
-  if (result == 0 && !valid_offset) result = MBEDTLS_ERR_ECP_INVALID_KEY;
-  if (result == 0) result = mbedtls_mpi_lset(&one, 1);
-  if (result == 0) {
-    // mbedTLS exposes point addition through muladd: R = left * G + 1 * parent.
-    result = mbedtls_ecp_muladd(&group, &child_point, &left, &group.G,
-                                &one, &parent_point);
-  }
-  if (result == 0) {
-    result = mbedtls_ecp_check_pubkey(&group, &child_point);
-  }
-  if (result == 0) {
-    result = mbedtls_ecp_point_write_binary(&group, &child_point, MBEDTLS_ECP_PF_COMPRESSED,
-                                            &public_size, out_node->public_key,
-                                            kCompressedPublicKeySize);
-  }
-  const bool valid = result == 0 && valid_offset && !mbedtls_ecp_is_zero(&child_point) &&
-                     public_size == kCompressedPublicKeySize;
+  HEXWALLET_TRACE_COUNT(EcMultiply, 1);
+  const bool valid = local_secp256k1_public_key_tweak_add(parent->public_key, material,
+                                                          out_node->public_key);
   if (valid) {
     memcpy(out_node->chain_code, material + kPrivateKeySize, kChainCodeSize);
     out_node->depth = parent->depth + 1;
     out_node->parent_fingerprint = parent_fingerprint;
     out_node->child_number = index;
   }
-  mbedtls_mpi_free(&left);
-  mbedtls_mpi_free(&one);
-  mbedtls_ecp_point_free(&child_point);
-  mbedtls_ecp_point_free(&parent_point);
-  mbedtls_ecp_group_free(&group);
   secure_zero(data, sizeof(data));
   secure_zero(material, sizeof(material));
   return valid ? WalletError::Ok : WalletError::InvalidChild;
 }
 
+WalletError hd_public_derive_keys(const HdPublicNode *parent, uint32_t first_index, size_t count,
+                                  bool compressed, uint8_t *out_keys) {
+  static_assert(kHdPublicKeyBatchSize <= kLocalSecp256k1MaxBatch, "batch exceeds secp256k1 limit");
+  if (parent == nullptr || out_keys == nullptr || count == 0 || count > kHdPublicKeyBatchSize ||
+      first_index >= kHardenedOffset || count - 1 > kHardenedOffset - 1 - first_index ||
+      parent->depth == 255) {
+    return WalletError::InvalidArgument;
+  }
+  uint8_t data[37];
+  uint8_t material[64];
+  uint8_t tweaks[kHdPublicKeyBatchSize * kPrivateKeySize];
+  memcpy(data, parent->public_key, kCompressedPublicKeySize);
+  bool ok = true;
+  for (size_t offset = 0; ok && offset < count; ++offset) {
+    write_u32_be(data + 33, first_index + static_cast<uint32_t>(offset));
+    ok = crypto_hmac_sha512(parent->chain_code, kChainCodeSize, data, sizeof(data), material);
+    if (ok) memcpy(tweaks + offset * kPrivateKeySize, material, kPrivateKeySize);
+  }
+  HEXWALLET_TRACE_COUNT(EcMultiply, ok ? count : 0);
+  const bool valid = ok && local_secp256k1_public_key_tweak_add_batch(
+                               parent->public_key, tweaks, count, compressed, out_keys);
+  secure_zero(material, sizeof(material));
+  secure_zero(tweaks, sizeof(tweaks));
+  if (!ok) return WalletError::CryptoFailure;
+  return valid ? WalletError::Ok : WalletError::InvalidChild;
+}
+
 WalletError hd_private_derive_path(const HdPrivateNode *master, const char *path,
                                    HdPrivateNode *out_node) {
-  if (master == nullptr || path == nullptr || out_node == nullptr || path[0] != 'm' ||
-      (path[1] != '\0' && path[1] != '/')) {
+  if (master == nullptr || path == nullptr || out_node == nullptr) {
     return WalletError::InvalidPath;
   }
-  HdPrivateNode current = *master;
-  const char *cursor = path + 1;
-  while (*cursor != '\0') {
-    ++cursor;
-    if (*cursor < '0' || *cursor > '9') {
-      secure_zero(&current, sizeof(current));
-      return WalletError::InvalidPath;
-    }
-    uint32_t index = 0;
-    while (*cursor >= '0' && *cursor <= '9') {
-      if (index > 214748364U || (index == 214748364U && *cursor > '7')) {
-        secure_zero(&current, sizeof(current));
-        return WalletError::InvalidPath;
-      }
-      index = index * 10 + static_cast<uint32_t>(*cursor - '0');
-      ++cursor;
-    }
-    if (*cursor == '\'' || *cursor == 'h' || *cursor == 'H') {
-      index |= kHardenedOffset;
-      ++cursor;
-    }
-    if (*cursor != '\0' && *cursor != '/') {
-      secure_zero(&current, sizeof(current));
-      return WalletError::InvalidPath;
-    }
-    HdPrivateNode next;
-    const WalletError result = hd_private_derive(&current, index, &next);
-    secure_zero(&current, sizeof(current));
-    if (result != WalletError::Ok) {
-      return result;
-    }
-    current = next;
+  HdExpandedPrivateNode start;
+  WalletError result = hd_private_expand(master, &start);
+  if (result == WalletError::Ok) result = derive_path_walk(start, path, out_node);
+  secure_zero(&start, sizeof(start));
+  return result;
+}
+
+WalletError hd_private_derive_path_expanded(const HdExpandedPrivateNode *master, const char *path,
+                                            HdExpandedPrivateNode *out_node) {
+  if (master == nullptr || path == nullptr || out_node == nullptr) {
+    return WalletError::InvalidPath;
   }
-  *out_node = current;
-  return WalletError::Ok;
+  HdPrivateNode leaf;
+  WalletError result = derive_path_walk(*master, path, &leaf);
+  // A bare "m" path leaves the walk at its start, which is already expanded.
+  if (result == WalletError::Ok && leaf.depth == master->node.depth) {
+    *out_node = *master;
+  } else if (result == WalletError::Ok) {
+    result = hd_private_expand(&leaf, out_node);
+  }
+  secure_zero(&leaf, sizeof(leaf));
+  return result;
 }
 
 WalletError hd_serialize_private(const HdPrivateNode *node, ExtendedKeyFormat format,
@@ -677,6 +714,17 @@ bool run_bip32_self_test() {
                                      : WalletError::InvalidChild;
   const bool path_metadata = path_error == WalletError::Ok && derived.depth == 3 &&
                              derived.child_number == (2 | kHardenedOffset);
+  HdExpandedPrivateNode expanded_master{};
+  HdExpandedPrivateNode expanded_derived{};
+  uint8_t derived_point[kCompressedPublicKeySize] = {};
+  const bool expanded_match = path_error == WalletError::Ok &&
+      hd_private_expand(&master, &expanded_master) == WalletError::Ok &&
+      hd_private_derive_path_expanded(&expanded_master, "m/0'/1/2'", &expanded_derived) == WalletError::Ok &&
+      public_key_from_private(derived.private_key, derived_point) == WalletError::Ok &&
+      memcmp(expanded_derived.node.private_key, derived.private_key, kPrivateKeySize) == 0 &&
+      memcmp(expanded_derived.node.chain_code, derived.chain_code, kChainCodeSize) == 0 &&
+      expanded_derived.node.parent_fingerprint == derived.parent_fingerprint &&
+      memcmp(expanded_derived.public_key, derived_point, kCompressedPublicKeySize) == 0;
   const WalletError master_public_error = master_error == WalletError::Ok
                                               ? hd_public_neuter(&master, &master_public)
                                               : WalletError::InvalidKey;
@@ -698,11 +746,13 @@ bool run_bip32_self_test() {
                                            kCompressedPublicKeySize) == 0 &&
                                     memcmp(private_child_public.chain_code, derived_public.chain_code,
                                            kChainCodeSize) == 0;
-  const bool passed = master_vector && path_metadata && public_metadata && public_private_match;
+  const bool passed = master_vector && path_metadata && expanded_match && public_metadata &&
+                      public_private_match;
   if (!passed) {
     // Report only stage status and error codes; never print key material.
     Serial.print("BIP32_DETAIL master="); Serial.print(master_vector ? "pass" : "FAIL");
     Serial.print(" path="); Serial.print(path_metadata ? "pass" : "FAIL");
+    Serial.print(" expanded="); Serial.print(expanded_match ? "pass" : "FAIL");
     Serial.print(" neuter="); Serial.print(master_public_error == WalletError::Ok ? "pass" : "FAIL");
     Serial.print(" private-child="); Serial.print(private_child_error == WalletError::Ok ? "pass" : "FAIL");
     Serial.print(" public-child="); Serial.print(public_child_error == WalletError::Ok ? "pass" : "FAIL");
@@ -710,6 +760,9 @@ bool run_bip32_self_test() {
   }
   secure_zero(&master, sizeof(master));
   secure_zero(&derived, sizeof(derived));
+  secure_zero(&expanded_master, sizeof(expanded_master));
+  secure_zero(&expanded_derived, sizeof(expanded_derived));
+  secure_zero(derived_point, sizeof(derived_point));
   secure_zero(&master_public, sizeof(master_public));
   secure_zero(&derived_public, sizeof(derived_public));
   secure_zero(&private_child, sizeof(private_child));
@@ -734,12 +787,26 @@ bool run_secp256k1_self_test() {
       0x57,0x3a,0x95,0x4c,0x45,0x18,0x33,0x15,0x61,0x40,0x6f,0x90,0x30,0x0e,0x8f,0x33,
       0x58,0xf5,0x19,0x28,0xd4,0x3c,0x21,0x2a,0x8c,0xae,0xd0,0x2d,0xe6,0x7e,0xeb,0xee,
   };
+  // Both ends of the scalar range and a top-bit scalar cover the digit
+  // recoding and the negated path of the fixed-base multiply.
+  static const uint8_t kOne[kPrivateKeySize] = {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+  };
+  static const uint8_t kOrderMinusOne[kPrivateKeySize] = {
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,
+      0xba,0xae,0xdc,0xe6,0xaf,0x48,0xa0,0x3b,0xbf,0xd2,0x5e,0x8c,0xd0,0x36,0x41,0x40,
+  };
+  static const uint8_t kTopBit[kPrivateKeySize] = {
+      0x80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  };
   RecoverableSignature signature;
   const bool passed = secp256k1_sign_digest_recoverable(kPrivateKey, kDigest, &signature) ==
                           WalletError::Ok &&
       crypto_constant_time_equal(signature.r, kExpectedR, sizeof(signature.r)) &&
       crypto_constant_time_equal(signature.s, kExpectedS, sizeof(signature.s)) &&
-      signature.y_parity <= 1;
+      signature.y_parity <= 1 && public_key_matches_mbedtls(kOne) &&
+      public_key_matches_mbedtls(kOrderMinusOne) && public_key_matches_mbedtls(kTopBit) &&
+      public_key_matches_mbedtls(kPrivateKey);
   secure_zero(&signature, sizeof(signature));
   return passed;
 }
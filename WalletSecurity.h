@@ -37,6 +37,15 @@ struct HdPrivateNode {
   uint32_t child_number;
 };
 
+// A private node together with its compressed public key and the hash160
+// fingerprint of that key. Path walks carry these forward so every public key
+// on the path is computed once instead of again by the next derivation step.
+struct HdExpandedPrivateNode {
+  HdPrivateNode node;
+  uint8_t public_key[kCompressedPublicKeySize];
+  uint32_t fingerprint;
+};
+
 struct HdPublicNode {
   uint8_t public_key[kCompressedPublicKeySize];
   uint8_t chain_code[kChainCodeSize];
@@ -85,11 +94,28 @@ WalletError hd_private_from_seed(const uint8_t *seed, size_t seed_size,
                                  HdPrivateNode *out_node);
 WalletError hd_private_derive(const HdPrivateNode *parent, uint32_t index,
                               HdPrivateNode *out_node);
+WalletError hd_private_expand(const HdPrivateNode *node, HdExpandedPrivateNode *out_node);
+WalletError hd_private_derive_expanded(const HdExpandedPrivateNode *parent, uint32_t index,
+                                       HdExpandedPrivateNode *out_node);
+// Derives a child whose own public key is not needed, such as an address leaf
+// that is encoded from an uncompressed key or used only as a signing key.
+WalletError hd_private_derive_from_expanded(const HdExpandedPrivateNode *parent, uint32_t index,
+                                            HdPrivateNode *out_node);
 WalletError hd_public_neuter(const HdPrivateNode *private_node, HdPublicNode *out_node);
 WalletError hd_public_derive(const HdPublicNode *parent, uint32_t index,
                              HdPublicNode *out_node);
+// Writes the public keys of children first_index .. first_index + count - 1,
+// compressed or uncompressed and back to back, for count up to
+// kHdPublicKeyBatchSize. Only keys are produced, so the children are leaves.
+// The batch shares one parent decompression and one field inversion. Fails
+// with InvalidChild if any index in it is one that BIP32 skips.
+constexpr size_t kHdPublicKeyBatchSize = 16;
+WalletError hd_public_derive_keys(const HdPublicNode *parent, uint32_t first_index, size_t count,
+                                  bool compressed, uint8_t *out_keys);
 WalletError hd_private_derive_path(const HdPrivateNode *master, const char *path,
                                    HdPrivateNode *out_node);
+WalletError hd_private_derive_path_expanded(const HdExpandedPrivateNode *master, const char *path,
+                                            HdExpandedPrivateNode *out_node);
 WalletError hd_serialize_private(const HdPrivateNode *node, ExtendedKeyFormat format,
                                  char *out, size_t *in_out_size);
 WalletError hd_serialize_public(const HdPublicNode *node, ExtendedKeyFormat format,
@@ -2,13 +2,26 @@
 
 #include <string.h>
 
+#include "WalletEngine.h"
+
 namespace hexwallet {
 namespace {
 
 constexpr size_t kMnemonicSize = 256;
 char mnemonic[kMnemonicSize];
+HdPrivateNode master;
 bool loaded = false;
 
+// BIP39 PBKDF2 dominates every wallet command, so the master node is derived
+// once when the mnemonic enters the session and cleared together with it.
+WalletError derive_master() {
+  uint8_t seed[kSeedSize];
+  WalletError result = bip39_seed_from_english(mnemonic, "", seed);
+  if (result == WalletError::Ok) result = hd_private_from_seed(seed, sizeof(seed), &master);
+  secure_zero(seed, sizeof(seed));
+  return result;
+}
+
 }
 
 bool wallet_session_is_loaded() {
@@ -17,28 +30,35 @@ bool wallet_session_is_loaded() {
 
 WalletError wallet_session_generate() {
   wallet_session_clear();
-  const WalletError result = bip39_generate_english_24(mnemonic, sizeof(mnemonic));
-  loaded = result == WalletError::Ok;
-  return result;
+  WalletError result = bip39_generate_english_24(mnemonic, sizeof(mnemonic));
+  if (result == WalletError::Ok) result = derive_master();
+  if (result != WalletError::Ok) {
+    wallet_session_clear();
+    return result;
+  }
+  loaded = true;
+  return WalletError::Ok;
 }
 
 WalletError wallet_session_import(const char *words) {
   if (words == nullptr || strlen(words) >= sizeof(mnemonic)) return WalletError::InvalidArgument;
-  const WalletError result = bip39_validate_english(words);
+  WalletError result = bip39_validate_english(words);
   if (result != WalletError::Ok) return result;
   wallet_session_clear();
   memcpy(mnemonic, words, strlen(words) + 1);
+  result = derive_master();
+  if (result != WalletError::Ok) {
+    wallet_session_clear();
+    return result;
+  }
   loaded = true;
   return WalletError::Ok;
 }
 
-WalletError wallet_session_load_master(HdPrivateNode *master) {
-  if (!loaded || master == nullptr) return WalletError::InvalidArgument;
-  uint8_t seed[kSeedSize];
-  WalletError result = bip39_seed_from_english(mnemonic, "", seed);
-  if (result == WalletError::Ok) result = hd_private_from_seed(seed, sizeof(seed), master);
-  secure_zero(seed, sizeof(seed));
-  return result;
+WalletError wallet_session_load_master(HdPrivateNode *out) {
+  if (!loaded || out == nullptr) return WalletError::InvalidArgument;
+  *out = master;
+  return WalletError::Ok;
 }
 
 const char *wallet_session_mnemonic_for_export() {
@@ -47,6 +67,8 @@ const char *wallet_session_mnemonic_for_export() {
 
 void wallet_session_clear() {
   secure_zero(mnemonic, sizeof(mnemonic));
+  secure_zero(&master, sizeof(master));
+  clear_derivation_cache();
   loaded = false;
 }
 
@@ -10,6 +10,7 @@ namespace hexwallet {
 bool wallet_session_is_loaded();
 WalletError wallet_session_generate();
 WalletError wallet_session_import(const char *mnemonic);
+// Copies the master node cached at generate/import time; no KDF runs here.
 WalletError wallet_session_load_master(HdPrivateNode *master);
 const char *wallet_session_mnemonic_for_export();
 void wallet_session_clear();
@@ -0,0 +1,196 @@
+#include "WalletTrace.h"
+
+#include <Arduino.h>
+
+#if HEXWALLET_TRACE_MEMORY && defined(ESP_PLATFORM)
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <mbedtls/build_info.h>
+#include <mbedtls/platform.h>
+#include <stdlib.h>
+#endif
+
+namespace hexwallet {
+namespace {
+
+constexpr const char *kCounterNames[kTraceCounterCount] = {
+  "ec-mult",
+  "hmac",
+  "hash-bytes",
+};
+
+constexpr const char *kTimerNames[kTraceTimerCount] = {
+  "hd-private-derive",
+  "derive-address",
+  "bitcoin-parse-psbt",
+  "bip143-digest",
+  "evm-parse-transaction",
+};
+
+#if HEXWALLET_TRACE
+uint64_t counters[kTraceCounterCount];
+TraceTimerStats timers[kTraceTimerCount];
+#endif
+
+}
+
+const char *trace_counter_name(TraceCounter counter) {
+  const size_t index = static_cast<size_t>(counter);
+  return index < kTraceCounterCount ? kCounterNames[index] : "unknown";
+}
+
+const char *trace_timer_name(TraceTimer timer) {
+  const size_t index = static_cast<size_t>(timer);
+  return index < kTraceTimerCount ? kTimerNames[index] : "unknown";
+}
+
+#if HEXWALLET_TRACE
+uint64_t trace_counter_value(TraceCounter counter) {
+  const size_t index = static_cast<size_t>(counter);
+  return index < kTraceCounterCount ? counters[index] : 0;
+}
+
+TraceTimerStats trace_timer_stats(TraceTimer timer) {
+  const size_t index = static_cast<size_t>(timer);
+  return index < kTraceTimerCount ? timers[index] : TraceTimerStats{};
+}
+
+void trace_reset() {
+  for (uint64_t &counter : counters) counter = 0;
+  for (TraceTimerStats &timer : timers) timer = TraceTimerStats{};
+}
+
+void trace_count(TraceCounter counter, uint64_t amount) {
+  const size_t index = static_cast<size_t>(counter);
+  if (index < kTraceCounterCount) counters[index] += amount;
+}
+
+TraceScope::TraceScope(TraceTimer timer) : timer_(timer), started_us_(micros()) {}
+
+// micros() wraps after about 71 minutes; unsigned subtraction still yields
+// the elapsed time of any scope shorter than that.
+TraceScope::~TraceScope() {
+  const size_t index = static_cast<size_t>(timer_);
+  if (index >= kTraceTimerCount) return;
+  const uint32_t elapsed = micros() - started_us_;
+  TraceTimerStats &stats = timers[index];
+  ++stats.calls;
+  stats.total_us += elapsed;
+  if (elapsed > stats.max_us) stats.max_us = elapsed;
+}
+#else
+uint64_t trace_counter_value(TraceCounter) { return 0; }
+TraceTimerStats trace_timer_stats(TraceTimer) { return TraceTimerStats{}; }
+void trace_reset() {}
+#endif
+
+#if HEXWALLET_TRACE_MEMORY
+namespace {
+
+constexpr uint32_t kStackPattern = 0xa5c3a5c3UL;
+// Left untouched above the end of the task stack on the device.
+constexpr uint32_t kStackGuardBytes = 1024;
+
+bool heap_active = false;
+size_t heap_current = 0;
+size_t heap_peak = 0;
+uint32_t heap_allocations = 0;
+
+#if defined(ESP_PLATFORM) && defined(MBEDTLS_PLATFORM_MEMORY)
+// Sizes come from the heap itself, so blocks allocated before the hooks were
+// installed can still be freed through them.
+void *traced_calloc(size_t count, size_t size) {
+  void *block = calloc(count, size);
+  if (block != nullptr) trace_heap_allocated(heap_caps_get_allocated_size(block));
+  return block;
+}
+
+void traced_free(void *block) {
+  if (block != nullptr) trace_heap_freed(heap_caps_get_allocated_size(block));
+  free(block);
+}
+#endif
+
+void install_heap_hooks() {
+#if defined(ESP_PLATFORM) && defined(MBEDTLS_PLATFORM_MEMORY)
+  static bool installed = false;
+  if (!installed) installed = mbedtls_platform_set_calloc_free(traced_calloc, traced_free) == 0;
+#endif
+}
+
+size_t stack_paint_budget() {
+  size_t budget = HEXWALLET_TRACE_STACK_BYTES;
+#if defined(ESP_PLATFORM)
+  const size_t free_minimum = uxTaskGetStackHighWaterMark(nullptr);
+  const size_t usable = free_minimum > kStackGuardBytes ? free_minimum - kStackGuardBytes : 0;
+  if (budget > usable) budget = usable;
+#endif
+  return budget & ~static_cast<size_t>(3);
+}
+
+// Paints or scans the words just below its own frame. Both calls come from the
+// same frame in trace_memory_measure(), so they cover the same addresses, and
+// the measured body runs on top of them in between. The mode is passed
+// through a volatile so the compiler cannot split it into two clones with
+// different frames. Returns how many bytes
+// from the top of the region have been overwritten.
+__attribute__((noinline)) size_t stack_probe(size_t bytes, bool paint) {
+  volatile uint32_t *words = static_cast<volatile uint32_t *>(__builtin_alloca(bytes));
+  const size_t count = bytes / sizeof(uint32_t);
+  if (paint) {
+    for (size_t index = 0; index < count; ++index) words[index] = kStackPattern;
+    return 0;
+  }
+  size_t untouched = 0;
+  while (untouched < count && words[untouched] == kStackPattern) ++untouched;
+  return (count - untouched) * sizeof(uint32_t);
+}
+
+}
+
+TraceMemoryStats trace_memory_measure(void (*body)(char *), char *argument) {
+  install_heap_hooks();
+  const size_t budget = stack_paint_budget();
+  volatile bool paint = true;
+  stack_probe(budget, paint);
+  heap_current = 0;
+  heap_peak = 0;
+  heap_allocations = 0;
+  heap_active = true;
+  body(argument);
+  heap_active = false;
+  paint = false;
+  const size_t used = stack_probe(budget, paint);
+  TraceMemoryStats stats = {};
+  stats.stack_bytes = static_cast<uint32_t>(used);
+  stats.stack_saturated = used >= budget;
+  stats.heap_peak_bytes = static_cast<uint32_t>(heap_peak);
+  stats.allocations = heap_allocations;
+  return stats;
+}
+
+uint32_t trace_stack_free_minimum() {
+#if defined(ESP_PLATFORM)
+  return static_cast<uint32_t>(uxTaskGetStackHighWaterMark(nullptr));
+#else
+  return 0;
+#endif
+}
+
+// Blocks freed during a command but allocated before it only lower the
+// running total, which is clamped at zero.
+void trace_heap_allocated(size_t size) {
+  if (!heap_active) return;
+  ++heap_allocations;
+  heap_current += size;
+  if (heap_current > heap_peak) heap_peak = heap_current;
+}
+
+void trace_heap_freed(size_t size) {
+  if (!heap_active) return;
+  heap_current = heap_current > size ? heap_current - size : 0;
+}
+#endif
+
+}
@@ -0,0 +1,95 @@
+#ifndef HEXWALLET_TRACE_H
+#define HEXWALLET_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "WalletConfig.h"
+
+namespace hexwallet {
+
+enum class TraceCounter : uint8_t {
+  EcMultiply,
+  Hmac,
+  HashBytes,
+  Count,
+};
+
+enum class TraceTimer : uint8_t {
+  HdPrivateDerive,
+  DeriveAddress,
+  BitcoinParsePsbt,
+  Bip143Digest,
+  EvmParseTransaction,
+  Count,
+};
+
+// Times are inclusive, so a derive_address() that walks a path also counts
+// toward hd_private_derive.
+struct TraceTimerStats {
+  uint32_t calls;
+  uint64_t total_us;
+  uint32_t max_us;
+};
+
+constexpr size_t kTraceCounterCount = static_cast<size_t>(TraceCounter::Count);
+constexpr size_t kTraceTimerCount = static_cast<size_t>(TraceTimer::Count);
+
+const char *trace_counter_name(TraceCounter counter);
+const char *trace_timer_name(TraceTimer timer);
+// Both read zero when the build has HEXWALLET_TRACE off.
+uint64_t trace_counter_value(TraceCounter counter);
+TraceTimerStats trace_timer_stats(TraceTimer timer);
+void trace_reset();
+
+// One call measured by trace_memory_measure(). stack_bytes stops at the
+// painted depth, and stack_saturated says the call reached it. Heap figures
+// cover the allocations the platform hook sees: mbedTLS on the device and
+// malloc in the host build.
+struct TraceMemoryStats {
+  uint32_t stack_bytes;
+  bool stack_saturated;
+  uint32_t heap_peak_bytes;
+  uint32_t allocations;
+};
+
+#if HEXWALLET_TRACE_MEMORY
+// Runs body(argument) between painting the stack below this frame and
+// scanning it again, and tracks the heap while it runs.
+TraceMemoryStats trace_memory_measure(void (*body)(char *), char *argument);
+// Smallest free stack the current task has had, or 0 where unknown.
+uint32_t trace_stack_free_minimum();
+// Called by the allocation hooks.
+void trace_heap_allocated(size_t size);
+void trace_heap_freed(size_t size);
+#endif
+
+#if HEXWALLET_TRACE
+void trace_count(TraceCounter counter, uint64_t amount);
+
+class TraceScope {
+ public:
+  explicit TraceScope(TraceTimer timer);
+  ~TraceScope();
+  TraceScope(const TraceScope &) = delete;
+  TraceScope &operator=(const TraceScope &) = delete;
+
+ private:
+  TraceTimer timer_;
+  uint32_t started_us_;
+};
+
+#define HEXWALLET_TRACE_JOIN_(left, right) left##right
+#define HEXWALLET_TRACE_JOIN(left, right) HEXWALLET_TRACE_JOIN_(left, right)
+#define HEXWALLET_TRACE_COUNT(counter, amount) \
+  ::hexwallet::trace_count(::hexwallet::TraceCounter::counter, (amount))
+#define HEXWALLET_TRACE_SCOPE(timer) \
+  ::hexwallet::TraceScope HEXWALLET_TRACE_JOIN(trace_scope_, __LINE__)(::hexwallet::TraceTimer::timer)
+#else
+#define HEXWALLET_TRACE_COUNT(counter, amount) ((void)0)
+#define HEXWALLET_TRACE_SCOPE(timer) ((void)0)
+#endif
+
+}
+
+#endif
@@ -1,5 +1,3 @@
-#include <Arduino.h>
-#include <mbedtls/platform_util.h>
 #include <string.h>
 
 #include "base58.h"
@@ -11,26 +9,120 @@ constexpr char kBitcoinAlphabet[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghij
 constexpr char kRippleAlphabet[] = "rpshnaf39wBUDNEGHJKLM4PQRST7VWXYZ2bcdeCg65jkm8oFqi1tuvAxyz";
 constexpr size_t kChecksumSize = 4;
 constexpr size_t kMaximumEncodedSize = 120;
-constexpr size_t kDecodeBufferSize = 128;
 
-struct ScopedZero {
-  ScopedZero(void *data_value, size_t size_value) : data(data_value), size(size_value) {}
-  ~ScopedZero() { mbedtls_platform_zeroize(data, size); }
-  void *data;
-  size_t size;
+// Values are carried in limbs of five base-58 digits, which fit 32 bits, and
+// in 16-bit binary digits, so every limb product fits 46 bits and a whole
+// column sum still fits a uint64_t without intermediate reduction.
+constexpr uint32_t kLimbRadix = 58UL * 58UL * 58UL * 58UL * 58UL;
+constexpr size_t kDigitsPerLimb = 5;
+constexpr size_t kAddressSize = 25;
+constexpr size_t kExtendedKeySize = 82;
+constexpr size_t kEncodeHalves = (kExtendedKeySize + 1) / 2;
+constexpr size_t kEncodeLimbs = 23;
+constexpr size_t kShortEncodedSize = 35;
+constexpr size_t kDecodeLimbs = kMaximumEncodedSize / kDigitsPerLimb;
+constexpr size_t kDecodeHalves = 44;
+constexpr uint32_t kDigitWeights[kDigitsPerLimb] = {1, 58, 58 * 58, 58 * 58 * 58, 58UL * 58 * 58 * 58};
+
+// Limbs needed for a size-byte value: 5 * log2(58) is just above 29.2899 bits.
+constexpr size_t limb_count(size_t size) { return size * 8 * 10000 / 292899 + 1; }
+
+// kEncodeTable.entry[k][m] is limb m of 2^(16k); kDecodeTable.entry[m][k] is
+// 16-bit digit k of 58^(5m). Both are computed by the compiler into flash.
+struct EncodeTable {
+  uint32_t entry[kEncodeHalves][kEncodeLimbs];
 };
 
-void clear_and_free(uint8_t *buffer, size_t size) {
-  if (buffer != nullptr) {
-    mbedtls_platform_zeroize(buffer, size);
-    free(buffer);
+struct DecodeTable {
+  uint16_t entry[kDecodeLimbs][kDecodeHalves];
+};
+
+constexpr EncodeTable make_encode_table() {
+  EncodeTable table = {};
+  uint32_t power[kEncodeLimbs] = {1};
+  for (size_t half = 0; half < kEncodeHalves; ++half) {
+    uint64_t carry = 0;
+    for (size_t limb = 0; limb < kEncodeLimbs; ++limb) {
+      table.entry[half][limb] = power[limb];
+      const uint64_t value = static_cast<uint64_t>(power[limb]) * 65536U + carry;
+      power[limb] = static_cast<uint32_t>(value % kLimbRadix);
+      carry = value / kLimbRadix;
+    }
+  }
+  return table;
+}
+
+constexpr DecodeTable make_decode_table() {
+  DecodeTable table = {};
+  uint16_t power[kDecodeHalves] = {1};
+  for (size_t limb = 0; limb < kDecodeLimbs; ++limb) {
+    uint64_t carry = 0;
+    for (size_t half = 0; half < kDecodeHalves; ++half) {
+      table.entry[limb][half] = power[half];
+      const uint64_t value = static_cast<uint64_t>(power[half]) * kLimbRadix + carry;
+      power[half] = static_cast<uint16_t>(value & 0xffffU);
+      carry = value >> 16;
+    }
+  }
+  return table;
+}
+
+constexpr EncodeTable kEncodeTable = make_encode_table();
+constexpr DecodeTable kDecodeTable = make_decode_table();
+
+void wipe(void *data, size_t size) {
+  volatile uint8_t *bytes = static_cast<volatile uint8_t *>(data);
+  while (size-- != 0) *bytes++ = 0;
+}
+
+// Converts a big-endian kInputSize-byte value into little-endian base-58^5
+// limbs and returns how many it wrote. Instantiated for the 25-byte address
+// and 82-byte extended key payloads so the loops have fixed trip counts.
+template <size_t kInputSize>
+size_t encode_limbs(const uint8_t *bytes, uint32_t limbs[kEncodeLimbs]) {
+  constexpr size_t kHalves = (kInputSize + 1) / 2;
+  constexpr size_t kLimbs = limb_count(kInputSize);
+  static_assert(kHalves <= kEncodeHalves && kLimbs <= kEncodeLimbs, "base58 table too small");
+  uint16_t halves[kHalves];
+  for (size_t half = 0; half < kHalves; ++half) {
+    const size_t low = kInputSize - 1 - half * 2;
+    halves[half] = static_cast<uint16_t>(bytes[low] | (low == 0 ? 0 : bytes[low - 1] << 8));
+  }
+  uint64_t carry = 0;
+  for (size_t limb = 0; limb < kLimbs; ++limb) {
+    uint64_t sum = carry;
+    for (size_t half = 0; half < kHalves; ++half) {
+      sum += static_cast<uint64_t>(halves[half]) * kEncodeTable.entry[half][limb];
+    }
+    limbs[limb] = static_cast<uint32_t>(sum % kLimbRadix);
+    carry = sum / kLimbRadix;
+  }
+  wipe(halves, sizeof(halves));
+  return kLimbs;
+}
+
+// Converts little-endian base-58^5 limbs into big-endian bytes.
+template <size_t kLimbs>
+void decode_limbs(const uint32_t limbs[kDecodeLimbs], uint8_t out[kDecodeHalves * 2]) {
+  constexpr size_t kHalves = kLimbs * 2932 / 1600 + 1;
+  static_assert(kLimbs <= kDecodeLimbs && kHalves <= kDecodeHalves, "base58 table too small");
+  uint64_t carry = 0;
+  memset(out, 0, kDecodeHalves * 2);
+  for (size_t half = 0; half < kHalves; ++half) {
+    uint64_t sum = carry;
+    for (size_t limb = 0; limb < kLimbs; ++limb) {
+      sum += static_cast<uint64_t>(limbs[limb]) * kDecodeTable.entry[limb][half];
+    }
+    out[kDecodeHalves * 2 - 1 - half * 2] = static_cast<uint8_t>(sum);
+    out[kDecodeHalves * 2 - 2 - half * 2] = static_cast<uint8_t>(sum >> 8);
+    carry = sum >> 16;
   }
 }
 
 bool encode_base58(const char *alphabet, char *out, size_t *in_out_size,
                    const void *input, size_t input_size) {
   if (alphabet == nullptr || out == nullptr || in_out_size == nullptr ||
-      (input == nullptr && input_size != 0)) {
+      (input == nullptr && input_size != 0) || input_size > kExtendedKeySize) {
     return false;
   }
   const uint8_t *bytes = static_cast<const uint8_t *>(input);
@@ -38,48 +130,53 @@ bool encode_base58(const char *alphabet, char *out, size_t *in_out_size,
   while (zeroes < input_size && bytes[zeroes] == 0) {
     ++zeroes;
   }
-  const size_t work_size = (input_size - zeroes) * 138 / 100 + 1;
-  uint8_t *work = static_cast<uint8_t *>(calloc(work_size, sizeof(uint8_t)));
-  if (work == nullptr) {
-    return false;
-  }
-  size_t high = work_size - 1;
-  for (size_t i = zeroes; i < input_size; ++i) {
-    int carry = bytes[i];
-    size_t j = work_size - 1;
-    for (; j > high || carry != 0; --j) {
-      carry += 256 * work[j];
-      work[j] = carry % 58;
-      carry /= 58;
-      if (j == 0) {
-        break;
-      }
+  // Other sizes are left-padded with zero bytes, which leaves the value as is.
+  uint8_t padded[kExtendedKeySize] = {};
+  uint32_t limbs[kEncodeLimbs];
+  size_t limb_total;
+  if (input_size == kAddressSize) {
+    limb_total = encode_limbs<kAddressSize>(bytes, limbs);
+  } else if (input_size == kExtendedKeySize) {
+    limb_total = encode_limbs<kExtendedKeySize>(bytes, limbs);
+  } else if (input_size < kAddressSize) {
+    memcpy(padded + kAddressSize - input_size, bytes, input_size);
+    limb_total = encode_limbs<kAddressSize>(padded, limbs);
+  } else {
+    memcpy(padded + kExtendedKeySize - input_size, bytes, input_size);
+    limb_total = encode_limbs<kExtendedKeySize>(padded, limbs);
+  }
+  // Digits are right-aligned in the buffer, most significant first.
+  char digits[kEncodeLimbs * kDigitsPerLimb];
+  for (size_t limb = 0; limb < limb_total; ++limb) {
+    uint32_t value = limbs[limb];
+    for (size_t digit = 0; digit < kDigitsPerLimb; ++digit) {
+      digits[sizeof(digits) - 1 - limb * kDigitsPerLimb - digit] = static_cast<char>(value % 58);
+      value /= 58;
     }
-    high = j;
   }
-  size_t first = 0;
-  while (first < work_size && work[first] == 0) {
+  size_t first = sizeof(digits) - limb_total * kDigitsPerLimb;
+  while (first < sizeof(digits) && digits[first] == 0) {
     ++first;
   }
-  const size_t required = zeroes + work_size - first + 1;
-  if (*in_out_size < required) {
-    *in_out_size = required;
-    clear_and_free(work, work_size);
-    return false;
-  }
-  memset(out, alphabet[0], zeroes);
-  size_t output_index = zeroes;
-  while (first < work_size) {
-    out[output_index++] = alphabet[work[first++]];
+  const size_t required = zeroes + sizeof(digits) - first + 1;
+  const bool fits = *in_out_size >= required;
+  if (fits) {
+    memset(out, alphabet[0], zeroes);
+    size_t output_index = zeroes;
+    while (first < sizeof(digits)) {
+      out[output_index++] = alphabet[static_cast<uint8_t>(digits[first++])];
+    }
+    out[output_index] = '\0';
   }
-  out[output_index] = '\0';
   *in_out_size = required;
-  clear_and_free(work, work_size);
-  return true;
+  wipe(padded, sizeof(padded));
+  wipe(limbs, sizeof(limbs));
+  wipe(digits, sizeof(digits));
+  return fits;
 }
 
 int bitcoin_digit(unsigned char value) {
-  const char *position = strchr(kBitcoinAlphabet, value);
+  const char *position = value == '\0' ? nullptr : strchr(kBitcoinAlphabet, value);
   return position == nullptr ? -1 : static_cast<int>(position - kBitcoinAlphabet);
 }
 
@@ -101,48 +198,47 @@ bool b58check_dec(uint8_t *bin, size_t *binsz, const char *b58) {
   if (encoded_size == 0 || encoded_size > kMaximumEncodedSize) {
     return false;
   }
-  uint8_t little_endian[kDecodeBufferSize] = {0};
-  ScopedZero little_endian_guard(little_endian, sizeof(little_endian));
-  size_t decoded_size = 0;
   size_t zeroes = 0;
   while (zeroes < encoded_size && b58[zeroes] == '1') {
     ++zeroes;
   }
+  uint32_t limbs[kDecodeLimbs] = {};
   for (size_t i = 0; i < encoded_size; ++i) {
     const int digit = bitcoin_digit(static_cast<unsigned char>(b58[i]));
     if (digit < 0) {
+      wipe(limbs, sizeof(limbs));
       return false;
     }
-    int carry = digit;
-    for (size_t j = 0; j < decoded_size; ++j) {
-      carry += 58 * little_endian[j];
-      little_endian[j] = carry & 0xff;
-      carry >>= 8;
-    }
-    while (carry != 0) {
-      if (decoded_size == sizeof(little_endian)) {
-        return false;
-      }
-      little_endian[decoded_size++] = carry & 0xff;
-      carry >>= 8;
-    }
+    const size_t position = encoded_size - 1 - i;
+    limbs[position / kDigitsPerLimb] += static_cast<uint32_t>(digit) * kDigitWeights[position % kDigitsPerLimb];
+  }
+  uint8_t big_endian[kDecodeHalves * 2];
+  if (encoded_size <= kShortEncodedSize) {
+    decode_limbs<kShortEncodedSize / kDigitsPerLimb>(limbs, big_endian);
+  } else {
+    decode_limbs<kDecodeLimbs>(limbs, big_endian);
   }
+  wipe(limbs, sizeof(limbs));
+  size_t first = 0;
+  while (first < sizeof(big_endian) && big_endian[first] == 0) {
+    ++first;
+  }
+  const size_t decoded_size = sizeof(big_endian) - first;
   const size_t total_size = zeroes + decoded_size;
   if (total_size < kChecksumSize) {
+    wipe(big_endian, sizeof(big_endian));
     return false;
   }
   const size_t payload_size = total_size - kChecksumSize;
   if (*binsz < payload_size) {
     *binsz = payload_size;
+    wipe(big_endian, sizeof(big_endian));
     return false;
   }
-  uint8_t decoded[kDecodeBufferSize] = {0};
-  ScopedZero decoded_guard(decoded, sizeof(decoded));
-  for (size_t i = 0; i < decoded_size; ++i) {
-    decoded[zeroes + i] = little_endian[decoded_size - i - 1];
-  }
+  uint8_t decoded[kMaximumEncodedSize] = {0};
+  memcpy(decoded + zeroes, big_endian + first, decoded_size);
+  wipe(big_endian, sizeof(big_endian));
   uint8_t checksum[hexwallet::kSha256Size];
-  ScopedZero checksum_guard(checksum, sizeof(checksum));
   const bool valid = hexwallet::crypto_double_sha256(decoded, payload_size, checksum) &&
                      hexwallet::crypto_constant_time_equal(
                          checksum, decoded + payload_size, kChecksumSize);
@@ -150,5 +246,7 @@ bool b58check_dec(uint8_t *bin, size_t *binsz, const char *b58) {
     memcpy(bin, decoded, payload_size);
     *binsz = payload_size;
   }
+  wipe(decoded, sizeof(decoded));
+  wipe(checksum, sizeof(checksum));
   return valid;
 }
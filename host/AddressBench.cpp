@@ -0,0 +1,320 @@
+// derive_address() latency for every network profile, split into the phases
+// it runs: the non-hardened leaf step of the path walk, the public key, the
+// address hash and the text encoding. cold is a first address with an empty
+// account cache; warm is a gap-limit scan of indices 0-19 with the cache hot.
+//
+// The phases are timed by calling the primitives derive_address() uses on
+// the same keys. encode runs the text step alone on the digest the hash
+// phase left behind. The CryptoNote hash phase is the scalar derivation, and
+// its encode is the standard address from the two public keys.
+//
+// CryptoNote networks with subaddresses also time cryptonote_subaddress_range()
+// for one subaddress and for a run of 64, whose precomputation and batched
+// inversions are shared. Every CryptoNote network times
+// cryptonote_scan_outputs() for one output and for 64 outputs of 32
+// transactions, two per transaction key.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../CryptoNoteAddress.h"
+#include "../CryptoPrimitives.h"
+#include "../WalletAddresses.h"
+#include "../WalletEngine.h"
+#include "../WalletNetworks.h"
+#include "../WalletSecurity.h"
+#include "BenchSuites.h"
+
+using namespace hexwallet;
+
+namespace {
+
+constexpr char kMnemonic[] =
+    "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about";
+constexpr uint32_t kGapLimit = 20;
+constexpr size_t kPhaseCount = 6;
+constexpr const char *kPhaseNames[kPhaseCount] = {"cold", "warm", "path", "pubkey", "hash", "encode"};
+
+enum Phase : size_t { Cold, Warm, Path, Pubkey, Hash, Encode };
+
+const char *encoding_name(AddressEncoding encoding) {
+  switch (encoding) {
+    case AddressEncoding::P2pkh: return "p2pkh";
+    case AddressEncoding::P2shP2wpkh: return "p2sh-p2wpkh";
+    case AddressEncoding::P2wpkh: return "p2wpkh";
+    case AddressEncoding::Evm: return "evm";
+    case AddressEncoding::Tron: return "tron";
+    case AddressEncoding::CryptoNote: return "cryptonote";
+  }
+  return "unknown";
+}
+
+constexpr AddressEncoding kEncodings[] = {
+    AddressEncoding::P2wpkh, AddressEncoding::P2shP2wpkh, AddressEncoding::P2pkh,
+    AddressEncoding::Evm,    AddressEncoding::Tron,       AddressEncoding::CryptoNote,
+};
+
+struct EncodingTotals {
+  size_t networks;
+  double median_ns[kPhaseCount];
+};
+
+// Keys for one network's leaf at m/purpose'/coin'/0'/0/0.
+struct LeafKeys {
+  HdExpandedPrivateNode change;
+  HdPrivateNode leaf;
+  uint8_t compressed[kCompressedPublicKeySize];
+  uint8_t uncompressed[kUncompressedPublicKeySize];
+  uint8_t spend_key[kCryptoNoteScalarSize];
+  uint8_t view_key[kCryptoNoteScalarSize];
+  uint8_t spend_public[kCryptoNotePublicKeySize];
+  uint8_t view_public[kCryptoNotePublicKeySize];
+  uint8_t digest[kKeccak256Size];
+};
+
+bool prepare_leaf(const HdExpandedPrivateNode &master, const NetworkProfile &network,
+                  LeafKeys *keys) {
+  char path[kDerivationPathTextSize];
+  snprintf(path, sizeof(path), "m/%lu'/%lu'/0'/0", static_cast<unsigned long>(network.bip_purpose),
+           static_cast<unsigned long>(network.derivation_coin_type));
+  return hd_private_derive_path_expanded(&master, path, &keys->change) == WalletError::Ok &&
+         hd_private_derive_from_expanded(&keys->change, 0, &keys->leaf) == WalletError::Ok &&
+         public_key_from_private(keys->leaf.private_key, keys->compressed) == WalletError::Ok &&
+         uncompressed_public_key_from_private(keys->leaf.private_key, keys->uncompressed) ==
+             WalletError::Ok &&
+         cryptonote_private_keys_from_seed(keys->leaf.private_key, keys->spend_key,
+                                           keys->view_key) == WalletError::Ok &&
+         cryptonote_public_key_from_scalar(keys->spend_key, keys->spend_public) == WalletError::Ok &&
+         cryptonote_public_key_from_scalar(keys->view_key, keys->view_public) == WalletError::Ok;
+}
+
+BenchResult bench_pubkey(const char *name, const NetworkProfile &network, LeafKeys *keys,
+                         size_t samples) {
+  switch (network.encoding) {
+    case AddressEncoding::Evm:
+    case AddressEncoding::Tron:
+      return bench_run(name, 0, [&] {
+        return uncompressed_public_key_from_private(keys->leaf.private_key, keys->uncompressed) ==
+               WalletError::Ok;
+      }, samples);
+    case AddressEncoding::CryptoNote:
+      return bench_run(name, 0, [&] {
+        return cryptonote_public_key_from_scalar(keys->spend_key, keys->spend_public) ==
+                   WalletError::Ok &&
+               cryptonote_public_key_from_scalar(keys->view_key, keys->view_public) ==
+                   WalletError::Ok;
+      }, samples);
+    default:
+      return bench_run(name, 0, [&] {
+        return public_key_from_private(keys->leaf.private_key, keys->compressed) == WalletError::Ok;
+      }, samples);
+  }
+}
+
+BenchResult bench_hash(const char *name, const NetworkProfile &network, LeafKeys *keys,
+                       size_t samples) {
+  uint8_t *digest = keys->digest;
+  switch (network.encoding) {
+    case AddressEncoding::Evm:
+    case AddressEncoding::Tron:
+      return bench_run(name, 0, [&] {
+        return crypto_keccak256(keys->uncompressed + 1, kUncompressedPublicKeySize - 1, digest);
+      }, samples);
+    case AddressEncoding::CryptoNote:
+      // Keccak of the leaf seed reduced to the spend and view scalars.
+      return bench_run(name, 0, [&] {
+        return cryptonote_private_keys_from_seed(keys->leaf.private_key, keys->spend_key,
+                                                 keys->view_key) == WalletError::Ok;
+      }, samples);
+    case AddressEncoding::P2shP2wpkh:
+      // The key hash, then the hash of the redeem script wrapping it.
+      return bench_run(name, 0, [&] {
+        uint8_t script[2 + kRipemd160Size] = {0x00, kRipemd160Size};
+        return crypto_hash160(keys->compressed, kCompressedPublicKeySize, script + 2) &&
+               crypto_hash160(script, sizeof(script), digest);
+      }, samples);
+    default:
+      return bench_run(name, 0, [&] {
+        return crypto_hash160(keys->compressed, kCompressedPublicKeySize, digest);
+      }, samples);
+  }
+}
+
+BenchResult bench_encoder(const char *name, const NetworkProfile &network, LeafKeys *keys,
+                          size_t samples) {
+  char text[kAddressTextSize];
+  uint8_t payload[1 + kRipemd160Size];
+  switch (network.encoding) {
+    case AddressEncoding::P2pkh:
+    case AddressEncoding::P2shP2wpkh:
+      payload[0] = network.encoding == AddressEncoding::P2pkh ? network.utxo.p2pkh_version
+                                                              : network.utxo.p2sh_version;
+      memcpy(payload + 1, keys->digest, kRipemd160Size);
+      break;
+    case AddressEncoding::Tron:
+      payload[0] = network.account_version;
+      memcpy(payload + 1, keys->digest + kKeccak256Size - kRipemd160Size, kRipemd160Size);
+      break;
+    default:
+      break;
+  }
+  return bench_run(name, 0, [&] {
+    size_t text_size = sizeof(text);
+    switch (network.encoding) {
+      case AddressEncoding::P2wpkh:
+        return address_p2wpkh_text(network.utxo.bech32_hrp, keys->digest, text, sizeof(text)) ==
+               WalletError::Ok;
+      case AddressEncoding::P2shP2wpkh:
+      case AddressEncoding::P2pkh:
+        return address_base58check(payload, sizeof(payload), network.utxo.ripple_alphabet, text,
+                                   &text_size) == WalletError::Ok;
+      case AddressEncoding::Evm:
+        return address_evm_text(keys->digest + kKeccak256Size - kEvmAccountSize, text,
+                                sizeof(text)) == WalletError::Ok;
+      case AddressEncoding::Tron:
+        return address_base58check(payload, sizeof(payload), false, text, &text_size) ==
+               WalletError::Ok;
+      case AddressEncoding::CryptoNote:
+        return cryptonote_standard_address({network.account_version, 0}, keys->spend_public,
+                                           keys->view_public, text, sizeof(text)) == WalletError::Ok;
+    }
+    return false;
+  }, samples);
+}
+
+constexpr uint32_t kSubaddressRun = 64;
+
+void discard_subaddress(WalletError, const CryptoNoteSubaddress &, void *) {}
+
+void bench_subaddresses(BenchReport *report, const NetworkProfile &network, const LeafKeys &keys,
+                        bool *ok) {
+  const CryptoNoteAddressProfile *profile = cryptonote_find_profile(network.account_version);
+  if (profile == nullptr || profile->subaddress_prefix == 0) return;
+  for (const uint32_t count : {uint32_t{1}, kSubaddressRun}) {
+    char name[64];
+    snprintf(name, sizeof(name), "subaddress/%s/%lu", network.id, static_cast<unsigned long>(count));
+    const BenchResult result = bench_run(name, 0, [&] {
+      return cryptonote_subaddress_range(*profile, keys.view_key, keys.spend_public, 0, 1, count,
+                                         discard_subaddress, nullptr) == WalletError::Ok;
+    }, 21);
+    report->add(result);
+    *ok = *ok && result.ok;
+  }
+}
+
+constexpr size_t kScanRun = 64;
+
+void bench_scan(BenchReport *report, const NetworkProfile &network, const LeafKeys &keys,
+                bool *ok) {
+  CryptoNoteScanner scanner;
+  CryptoNoteOutput outputs[kScanRun];
+  bool owned[kScanRun];
+  bool ready = cryptonote_scanner_init(&scanner, keys.view_key, keys.spend_public) == WalletError::Ok;
+  for (size_t index = 0; ready && index < kScanRun; ++index) {
+    uint8_t scalar[kCryptoNoteScalarSize] = {static_cast<uint8_t>(index / 2 + 1)};
+    ready = cryptonote_public_key_from_scalar(scalar, outputs[index].tx_public_key) == WalletError::Ok;
+    outputs[index].output_index = index % 2;
+    memcpy(outputs[index].output_key, keys.spend_public, kCryptoNotePublicKeySize);
+  }
+  for (const size_t count : {size_t{1}, kScanRun}) {
+    char name[64];
+    snprintf(name, sizeof(name), "scan/%s/%lu", network.id, static_cast<unsigned long>(count));
+    const BenchResult result = bench_run(name, 0, [&] {
+      return ready && cryptonote_scan_outputs(scanner, outputs, count, owned) == WalletError::Ok;
+    }, 21);
+    report->add(result);
+    *ok = *ok && result.ok;
+  }
+  secure_zero(&scanner, sizeof(scanner));
+}
+
+void print_table(const EncodingTotals totals[], size_t count) {
+  printf("\nderive_address median per address by encoding (us)\n");
+  printf("%-12s %8s", "encoding", "networks");
+  for (const char *phase : kPhaseNames) printf(" %10s", phase);
+  printf("\n");
+  for (size_t index = 0; index < count; ++index) {
+    if (totals[index].networks == 0) continue;
+    printf("%-12s %8zu", encoding_name(kEncodings[index]), totals[index].networks);
+    for (const double median : totals[index].median_ns) {
+      printf(" %10.1f", median / totals[index].networks / 1000.0);
+    }
+    printf("\n");
+  }
+  printf("\n");
+}
+
+}  // namespace
+
+bool bench_addresses(BenchReport *report) {
+  uint8_t seed[kSeedSize];
+  HdPrivateNode master;
+  HdExpandedPrivateNode expanded_master;
+  const bool ready = bip39_seed_from_english(kMnemonic, "", seed) == WalletError::Ok &&
+                     hd_private_from_seed(seed, sizeof(seed), &master) == WalletError::Ok &&
+                     hd_private_expand(&master, &expanded_master) == WalletError::Ok;
+  secure_zero(seed, sizeof(seed));
+  if (!ready) {
+    secure_zero(&master, sizeof(master));
+    secure_zero(&expanded_master, sizeof(expanded_master));
+    return false;
+  }
+
+  EncodingTotals totals[sizeof(kEncodings) / sizeof(kEncodings[0])] = {};
+  bool ok = true;
+  DerivedAddress address;
+  LeafKeys keys;
+  for (size_t index = 0; ok && index < kNetworkProfileCount; ++index) {
+    const NetworkProfile &network = kNetworkProfiles[index];
+    const size_t samples = network.encoding == AddressEncoding::CryptoNote ? 21 : kBenchDefaultSamples;
+    char names[kPhaseCount][64];
+    for (size_t phase = 0; phase < kPhaseCount; ++phase) {
+      snprintf(names[phase], sizeof(names[phase]), "address/%s/%s/%s",
+               encoding_name(network.encoding), network.id, kPhaseNames[phase]);
+    }
+    if (!prepare_leaf(expanded_master, network, &keys)) {
+      ok = false;
+      break;
+    }
+    BenchResult results[kPhaseCount];
+    results[Cold] = bench_run(names[Cold], 0, [&] {
+      clear_derivation_cache();
+      return derive_address(master, network, 0, 0, 0, &address) == WalletError::Ok;
+    }, samples);
+    uint32_t address_index = 0;
+    results[Warm] = bench_run(names[Warm], 0, [&] {
+      address_index = (address_index + 1) % kGapLimit;
+      return derive_address(master, network, 0, 0, address_index, &address) == WalletError::Ok;
+    }, samples);
+    HdPrivateNode leaf;
+    results[Path] = bench_run(names[Path], 0, [&] {
+      return hd_private_derive_from_expanded(&keys.change, 0, &leaf) == WalletError::Ok;
+    }, samples);
+    secure_zero(&leaf, sizeof(leaf));
+    results[Pubkey] = bench_pubkey(names[Pubkey], network, &keys, samples);
+    results[Hash] = bench_hash(names[Hash], network, &keys, samples);
+    results[Encode] = bench_encoder(names[Encode], network, &keys, samples);
+    if (network.encoding == AddressEncoding::CryptoNote) {
+      bench_subaddresses(report, network, keys, &ok);
+      bench_scan(report, network, keys, &ok);
+    }
+
+    EncodingTotals *total = nullptr;
+    for (size_t encoding = 0; encoding < sizeof(kEncodings) / sizeof(kEncodings[0]); ++encoding) {
+      if (kEncodings[encoding] == network.encoding) total = &totals[encoding];
+    }
+    ++total->networks;
+    for (size_t phase = 0; phase < kPhaseCount; ++phase) {
+      report->add(results[phase]);
+      total->median_ns[phase] += results[phase].median_ns;
+      ok = ok && results[phase].ok;
+    }
+  }
+  clear_derived_address(&address);
+  clear_derivation_cache();
+  secure_zero(&keys, sizeof(keys));
+  secure_zero(&master, sizeof(master));
+  secure_zero(&expanded_master, sizeof(expanded_master));
+  if (ok && !report->json()) print_table(totals, sizeof(kEncodings) / sizeof(kEncodings[0]));
+  return ok;
+}
@@ -0,0 +1,45 @@
+#ifndef HEXWALLET_HOST_ARDUINO_H
+#define HEXWALLET_HOST_ARDUINO_H
+
+// Host stand-in for the parts of the Arduino core the wallet modules use.
+// Serial writes to stdout and reads from text queued with host_serial_input().
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+class HostSerial {
+ public:
+  void begin(unsigned long baud) { (void)baud; }
+  size_t write(uint8_t value);
+  size_t print(const char *text);
+  size_t print(char value) { return write(static_cast<uint8_t>(value)); }
+  size_t print(unsigned char value) { return print(static_cast<unsigned long long>(value)); }
+  size_t print(int value) { return print(static_cast<long long>(value)); }
+  size_t print(unsigned int value) { return print(static_cast<unsigned long long>(value)); }
+  size_t print(long value) { return print(static_cast<long long>(value)); }
+  size_t print(unsigned long value) { return print(static_cast<unsigned long long>(value)); }
+  size_t print(long long value);
+  size_t print(unsigned long long value);
+  size_t println() { return print("\r\n"); }
+  template <typename T>
+  size_t println(T value) {
+    const size_t written = print(value);
+    return written + println();
+  }
+  int available();
+  int read();
+};
+
+extern HostSerial Serial;
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+
+// Queues text for Serial.read(), as if it had been typed on the console.
+void host_serial_input(const char *text);
+// Suppresses Serial output while muted is true, e.g. inside timing loops.
+void host_serial_mute(bool muted);
+
+#endif
@@ -0,0 +1,65 @@
+#include <stdio.h>
+
+#include "BenchHarness.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+bool bench_has_cycle_counter() {
+#if defined(__x86_64__) || defined(__i386__)
+  return true;
+#else
+  return false;
+#endif
+}
+
+uint64_t bench_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+namespace {
+
+double per_unit(const BenchResult &result) {
+  if (result.median_cycles < 0) return -1.0;
+  return result.size == 0 ? result.median_cycles : result.median_cycles / result.size;
+}
+
+}  // namespace
+
+void BenchReport::add(const BenchResult &result) {
+  results_.push_back(result);
+  if (json_) return;
+  const double cycles = per_unit(result);
+  char size[16];
+  if (result.size == 0) snprintf(size, sizeof(size), "op");
+  else snprintf(size, sizeof(size), "%zu B", result.size);
+  printf("bench %-40s %7s %12.1f ns %12.1f ns p99", result.name, size, result.median_ns,
+         result.p99_ns);
+  if (cycles >= 0) printf(" %10.1f cyc/%s", cycles, result.size == 0 ? "op" : "B");
+  printf("%s\n", result.ok ? "" : " FAILED");
+}
+
+bool BenchReport::finish() {
+  bool ok = true;
+  for (const BenchResult &result : results_) ok = ok && result.ok;
+  if (!json_) return ok;
+  printf("{\"cycle_counter\":%s,\"results\":[", bench_has_cycle_counter() ? "\"tsc\"" : "null");
+  for (size_t index = 0; index < results_.size(); ++index) {
+    const BenchResult &result = results_[index];
+    printf("%s\n{\"name\":\"%s\",\"size\":%zu,\"unit\":\"%s\",\"samples\":%zu,\"batch\":%zu,"
+           "\"median_ns\":%.1f,\"p99_ns\":%.1f,",
+           index == 0 ? "" : ",", result.name, result.size, result.size == 0 ? "op" : "byte",
+           result.samples, result.batch, result.median_ns, result.p99_ns);
+    const double cycles = per_unit(result);
+    if (cycles < 0) printf("\"cycles_per_unit\":null,");
+    else printf("\"cycles_per_unit\":%.2f,", cycles);
+    printf("\"ok\":%s}", result.ok ? "true" : "false");
+  }
+  printf("\n]}\n");
+  return ok;
+}
@@ -0,0 +1,88 @@
+#ifndef HEXWALLET_HOST_BENCH_HARNESS_H
+#define HEXWALLET_HOST_BENCH_HARNESS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+// Statistics for one benchmark case. Times are per call. size is the input
+// size in bytes for throughput cases and 0 for per-operation cases, which
+// selects whether cycles are reported per byte or per op.
+struct BenchResult {
+  char name[64];
+  size_t size;
+  size_t samples;
+  size_t batch;
+  double median_ns;
+  double p99_ns;
+  double median_cycles;
+  bool ok;
+};
+
+// Reference cycles from the time-stamp counter where the host has one.
+bool bench_has_cycle_counter();
+uint64_t bench_cycles();
+
+// Samples and batch size used when a case does not ask for its own.
+constexpr size_t kBenchDefaultSamples = 101;
+constexpr double kBenchTargetSampleNs = 20000.0;
+
+// Times body(), which returns false on failure, over samples batches. The
+// batch size is calibrated first so that one sample lasts about
+// kBenchTargetSampleNs, keeping clock resolution out of fast primitives.
+template <typename Body>
+BenchResult bench_run(const char *name, size_t size, Body body,
+                      size_t samples = kBenchDefaultSamples) {
+  using Clock = std::chrono::steady_clock;
+  BenchResult result = {};
+  snprintf(result.name, sizeof(result.name), "%s", name);
+  result.size = size;
+  result.samples = samples;
+  result.ok = true;
+  size_t batch = 1;
+  for (;;) {
+    const auto start = Clock::now();
+    for (size_t call = 0; call < batch; ++call) result.ok = body() && result.ok;
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    if (!result.ok || elapsed >= kBenchTargetSampleNs || batch >= (1U << 16)) break;
+    batch *= 2;
+  }
+  result.batch = batch;
+  std::vector<double> times(samples);
+  std::vector<double> cycles(samples);
+  for (size_t sample = 0; result.ok && sample < samples; ++sample) {
+    const uint64_t first_cycle = bench_cycles();
+    const auto start = Clock::now();
+    for (size_t call = 0; call < batch; ++call) result.ok = body() && result.ok;
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    times[sample] = elapsed / batch;
+    cycles[sample] = static_cast<double>(bench_cycles() - first_cycle) / batch;
+  }
+  std::sort(times.begin(), times.end());
+  std::sort(cycles.begin(), cycles.end());
+  result.median_ns = times[samples / 2];
+  result.p99_ns = times[(samples * 99 + 99) / 100 - 1];
+  result.median_cycles = bench_has_cycle_counter() ? cycles[samples / 2] : -1.0;
+  return result;
+}
+
+// Collects results for one run and prints them as aligned text as they
+// arrive, or as a single JSON document from finish().
+class BenchReport {
+ public:
+  explicit BenchReport(bool json) : json_(json) {}
+  bool json() const { return json_; }
+  void add(const BenchResult &result);
+  // Prints the JSON document and returns false if any case failed.
+  bool finish();
+
+ private:
+  bool json_;
+  std::vector<BenchResult> results_;
+};
+
+#endif
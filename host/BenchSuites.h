@@ -0,0 +1,12 @@
+#ifndef HEXWALLET_HOST_BENCH_SUITES_H
+#define HEXWALLET_HOST_BENCH_SUITES_H
+
+#include "BenchHarness.h"
+
+// Each suite adds its cases to report and returns false if setup failed.
+bool bench_primitives(BenchReport *report);
+bool bench_addresses(BenchReport *report);
+bool bench_wallet(BenchReport *report);
+bool bench_psbt(BenchReport *report);
+
+#endif
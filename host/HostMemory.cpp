@@ -0,0 +1,45 @@
+// Host allocation hooks for HEXWALLET_TRACE_MEMORY. The definitions below
+// take the place of the C library's malloc family, forward to glibc's own
+// entry points and report block sizes to WalletTrace, so the heap figures
+// include mbedTLS, the C++ runtime and everything else in the process.
+
+#include "../WalletTrace.h"
+
+#if HEXWALLET_TRACE_MEMORY
+#include <malloc.h>
+#include <stddef.h>
+
+extern "C" {
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *block, size_t size);
+void __libc_free(void *block);
+
+void *malloc(size_t size) {
+  void *block = __libc_malloc(size);
+  if (block != nullptr) hexwallet::trace_heap_allocated(malloc_usable_size(block));
+  return block;
+}
+
+void *calloc(size_t count, size_t size) {
+  void *block = __libc_calloc(count, size);
+  if (block != nullptr) hexwallet::trace_heap_allocated(malloc_usable_size(block));
+  return block;
+}
+
+void *realloc(void *block, size_t size) {
+  const size_t previous = block != nullptr ? malloc_usable_size(block) : 0;
+  void *moved = __libc_realloc(block, size);
+  if (moved != nullptr || size == 0) hexwallet::trace_heap_freed(previous);
+  if (moved != nullptr) hexwallet::trace_heap_allocated(malloc_usable_size(moved));
+  return moved;
+}
+
+void free(void *block) {
+  if (block != nullptr) hexwallet::trace_heap_freed(malloc_usable_size(block));
+  __libc_free(block);
+}
+
+}
+#endif
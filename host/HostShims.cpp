@@ -0,0 +1,188 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "Preferences.h"
+#include "esp_system.h"
+
+HostSerial Serial;
+
+namespace {
+
+std::string serial_input;
+size_t serial_read_offset = 0;
+bool serial_muted = false;
+
+const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+std::map<std::string, std::vector<uint8_t>> &preference_store() {
+  static std::map<std::string, std::vector<uint8_t>> store;
+  return store;
+}
+
+std::string preference_key(const char *name, const char *key) {
+  return std::string(name) + '/' + key;
+}
+
+}  // namespace
+
+size_t HostSerial::write(uint8_t value) {
+  if (serial_muted) return 1;
+  return fputc(value, stdout) == EOF ? 0 : 1;
+}
+
+size_t HostSerial::print(const char *text) {
+  if (text == nullptr) return 0;
+  const size_t size = strlen(text);
+  if (serial_muted) return size;
+  return fwrite(text, 1, size, stdout);
+}
+
+size_t HostSerial::print(long long value) {
+  char text[24];
+  snprintf(text, sizeof(text), "%lld", value);
+  return print(text);
+}
+
+size_t HostSerial::print(unsigned long long value) {
+  char text[24];
+  snprintf(text, sizeof(text), "%llu", value);
+  return print(text);
+}
+
+int HostSerial::available() {
+  return static_cast<int>(serial_input.size() - serial_read_offset);
+}
+
+int HostSerial::read() {
+  if (serial_read_offset == serial_input.size()) return -1;
+  return static_cast<unsigned char>(serial_input[serial_read_offset++]);
+}
+
+void host_serial_input(const char *text) {
+  serial_input.erase(0, serial_read_offset);
+  serial_read_offset = 0;
+  serial_input += text;
+}
+
+void host_serial_mute(bool muted) {
+  fflush(stdout);
+  serial_muted = muted;
+}
+
+uint32_t millis() {
+  const auto elapsed = std::chrono::steady_clock::now() - start_time;
+  return static_cast<uint32_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+}
+
+uint32_t micros() {
+  const auto elapsed = std::chrono::steady_clock::now() - start_time;
+  return static_cast<uint32_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void esp_fill_random(void *buf, size_t len) {
+  FILE *source = fopen("/dev/urandom", "rb");
+  if (source == nullptr || fread(buf, 1, len, source) != len) {
+    fprintf(stderr, "FATAL host random source unavailable\n");
+    abort();
+  }
+  fclose(source);
+}
+
+bool Preferences::begin(const char *name, bool read_only) {
+  if (name == nullptr || strlen(name) >= sizeof(name_)) return false;
+  strcpy(name_, name);
+  read_only_ = read_only;
+  open_ = true;
+  return true;
+}
+
+void Preferences::end() {
+  open_ = false;
+}
+
+bool Preferences::clear() {
+  if (!open_ || read_only_) return false;
+  const std::string prefix = preference_key(name_, "");
+  auto &store = preference_store();
+  for (auto entry = store.begin(); entry != store.end();) {
+    entry = entry->first.compare(0, prefix.size(), prefix) == 0 ? store.erase(entry) : ++entry;
+  }
+  return true;
+}
+
+bool Preferences::remove(const char *key) {
+  if (!open_ || read_only_ || key == nullptr) return false;
+  return preference_store().erase(preference_key(name_, key)) != 0;
+}
+
+bool Preferences::find(const char *key, const uint8_t **data, size_t *size) const {
+  if (!open_ || key == nullptr) return false;
+  const auto &store = preference_store();
+  const auto entry = store.find(preference_key(name_, key));
+  if (entry == store.end()) return false;
+  *data = entry->second.data();
+  *size = entry->second.size();
+  return true;
+}
+
+size_t Preferences::put(const char *key, const void *value, size_t len) {
+  if (!open_ || read_only_ || key == nullptr || (value == nullptr && len != 0)) return 0;
+  const uint8_t *bytes = static_cast<const uint8_t *>(value);
+  preference_store()[preference_key(name_, key)].assign(bytes, bytes + len);
+  return len;
+}
+
+bool Preferences::getBool(const char *key, bool default_value) {
+  const uint8_t *data = nullptr;
+  size_t size = 0;
+  return find(key, &data, &size) && size == 1 ? data[0] != 0 : default_value;
+}
+
+size_t Preferences::putBool(const char *key, bool value) {
+  const uint8_t stored = value ? 1 : 0;
+  return put(key, &stored, sizeof(stored));
+}
+
+uint32_t Preferences::getUInt(const char *key, uint32_t default_value) {
+  const uint8_t *data = nullptr;
+  size_t size = 0;
+  uint32_t value = default_value;
+  if (find(key, &data, &size) && size == sizeof(value)) memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+size_t Preferences::putUInt(const char *key, uint32_t value) {
+  return put(key, &value, sizeof(value));
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+  const uint8_t *data = nullptr;
+  size_t size = 0;
+  return find(key, &data, &size) ? size : 0;
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t max_len) {
+  const uint8_t *data = nullptr;
+  size_t size = 0;
+  if (buf == nullptr || !find(key, &data, &size) || size > max_len) return 0;
+  memcpy(buf, data, size);
+  return size;
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len) {
+  return put(key, value, len);
+}
@@ -0,0 +1,32 @@
+#ifndef HEXWALLET_HOST_PREFERENCES_H
+#define HEXWALLET_HOST_PREFERENCES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// In-memory stand-in for the ESP32 NVS Preferences API. Values live for the
+// life of the process and are shared by every instance opened on a namespace.
+class Preferences {
+ public:
+  bool begin(const char *name, bool read_only = false);
+  void end();
+  bool clear();
+  bool remove(const char *key);
+  bool getBool(const char *key, bool default_value = false);
+  size_t putBool(const char *key, bool value);
+  uint32_t getUInt(const char *key, uint32_t default_value = 0);
+  size_t putUInt(const char *key, uint32_t value);
+  size_t getBytesLength(const char *key);
+  size_t getBytes(const char *key, void *buf, size_t max_len);
+  size_t putBytes(const char *key, const void *value, size_t len);
+
+ private:
+  bool find(const char *key, const uint8_t **data, size_t *size) const;
+  size_t put(const char *key, const void *value, size_t len);
+
+  char name_[16] = {};
+  bool open_ = false;
+  bool read_only_ = false;
+};
+
+#endif
@@ -0,0 +1,135 @@
+// Throughput of the hash and encoding primitives across input sizes, and
+// per-operation cost of the secp256k1, Ed25519 and BIP32 operations built on
+// them.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../CryptoNoteAddress.h"
+#include "../CryptoPrimitives.h"
+#include "../WalletSecurity.h"
+#include "../base58.h"
+#include "../local_ripemd160.h"
+#include "../local_segwit.h"
+#include "BenchSuites.h"
+
+using namespace hexwallet;
+
+namespace {
+
+constexpr size_t kHashSizes[] = {32, 64, 256, 1024, 4096};
+constexpr size_t kMaximumInput = 4096;
+
+uint8_t input[kMaximumInput];
+uint8_t output[kSha512Size];
+
+struct HashCase {
+  const char *name;
+  bool (*hash)(const uint8_t *data, size_t size);
+};
+
+bool sha256_case(const uint8_t *data, size_t size) { return crypto_sha256(data, size, output); }
+bool double_sha256_case(const uint8_t *data, size_t size) {
+  return crypto_double_sha256(data, size, output);
+}
+bool hmac_sha512_case(const uint8_t *data, size_t size) {
+  return crypto_hmac_sha512(input, 32, data, size, output);
+}
+bool hash160_case(const uint8_t *data, size_t size) { return crypto_hash160(data, size, output); }
+bool keccak256_case(const uint8_t *data, size_t size) {
+  return crypto_keccak256(data, size, output);
+}
+bool ripemd160_case(const uint8_t *data, size_t size) {
+  local_ripemd160(data, size, output);
+  return true;
+}
+
+constexpr HashCase kHashCases[] = {
+    {"crypto_sha256", sha256_case},
+    {"crypto_double_sha256", double_sha256_case},
+    {"crypto_hmac_sha512", hmac_sha512_case},
+    {"crypto_hash160", hash160_case},
+    {"crypto_keccak256", keccak256_case},
+    {"local_ripemd160", ripemd160_case},
+};
+
+template <typename Body>
+void add_sized(BenchReport *report, const char *name, size_t size, Body body) {
+  char label[64];
+  snprintf(label, sizeof(label), "%s/%zu", name, size);
+  report->add(bench_run(label, size, body));
+}
+
+}  // namespace
+
+bool bench_primitives(BenchReport *report) {
+  for (size_t index = 0; index < sizeof(input); ++index) {
+    input[index] = static_cast<uint8_t>(index * 131 + 7);
+  }
+  for (const HashCase &hash_case : kHashCases) {
+    for (const size_t size : kHashSizes) {
+      add_sized(report, hash_case.name, size, [&] { return hash_case.hash(input, size); });
+    }
+  }
+
+  // An address payload and an extended key, each with its checksum.
+  for (const size_t size : {size_t{25}, size_t{82}}) {
+    char text[128];
+    add_sized(report, "b58enc", size, [&] {
+      size_t text_size = sizeof(text);
+      return b58enc(text, &text_size, input, size);
+    });
+  }
+  // P2WPKH and P2WSH/P2TR programs.
+  for (const size_t size : {size_t{20}, size_t{32}}) {
+    char text[96];
+    add_sized(report, "segwit_address::encode", size, [&] {
+      return segwit_address::encode(text, sizeof(text), "bc", size == 20 ? 0 : 1, input, size) != 0;
+    });
+  }
+
+  uint8_t private_key[kPrivateKeySize];
+  memcpy(private_key, input, sizeof(private_key));
+  uint8_t public_key[kCompressedPublicKeySize];
+  report->add(bench_run("public_key_from_private", 0, [&] {
+    return public_key_from_private(private_key, public_key) == WalletError::Ok;
+  }));
+  RecoverableSignature signature;
+  report->add(bench_run("secp256k1_sign_digest_recoverable", 0, [&] {
+    return secp256k1_sign_digest_recoverable(private_key, input + 64, &signature) == WalletError::Ok;
+  }));
+  // Clearing the top nibble keeps the scalar below the Ed25519 group order.
+  uint8_t cryptonote_scalar[kCryptoNoteScalarSize];
+  memcpy(cryptonote_scalar, input + 96, sizeof(cryptonote_scalar));
+  cryptonote_scalar[kCryptoNoteScalarSize - 1] &= 0x0f;
+  uint8_t cryptonote_public[kCryptoNotePublicKeySize];
+  report->add(bench_run("cryptonote_public_key_from_scalar", 0, [&] {
+    return cryptonote_public_key_from_scalar(cryptonote_scalar, cryptonote_public) == WalletError::Ok;
+  }));
+
+  HdPrivateNode master;
+  HdPrivateNode child;
+  HdPublicNode public_master;
+  HdPublicNode public_child;
+  if (hd_private_from_seed(input, kSeedSize, &master) != WalletError::Ok ||
+      hd_public_neuter(&master, &public_master) != WalletError::Ok) {
+    secure_zero(private_key, sizeof(private_key));
+    secure_zero(cryptonote_scalar, sizeof(cryptonote_scalar));
+    secure_zero(&master, sizeof(master));
+    return false;
+  }
+  report->add(bench_run("hd_private_derive/hardened", 0, [&] {
+    return hd_private_derive(&master, 0x80000000UL, &child) == WalletError::Ok;
+  }));
+  report->add(bench_run("hd_private_derive/normal", 0, [&] {
+    return hd_private_derive(&master, 0, &child) == WalletError::Ok;
+  }));
+  report->add(bench_run("hd_public_derive", 0, [&] {
+    return hd_public_derive(&public_master, 0, &public_child) == WalletError::Ok;
+  }));
+  secure_zero(private_key, sizeof(private_key));
+  secure_zero(cryptonote_scalar, sizeof(cryptonote_scalar));
+  secure_zero(&master, sizeof(master));
+  secure_zero(&child, sizeof(child));
+  return true;
+}
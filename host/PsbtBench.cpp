@@ -0,0 +1,164 @@
+// PSBT parse and sign latency over generated requests up to
+// kBitcoinMaxInputs x kBitcoinMaxOutputs. parse and sign time the public
+// calls. fingerprint and derivation repeat the parser's master expansion
+// and input and change path walks with the same keys. sighash, ecdsa and
+// serialization time the stages bitcoin_sign_request runs after validation:
+// the BIP143 hashing, the per-input key lookup and signature, and writing
+// the witness transaction.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../BitcoinTransaction.h"
+#include "../BitcoinTransactionInternal.h"
+#include "../CryptoPrimitives.h"
+#include "../WalletSecurity.h"
+#include "BenchSuites.h"
+#include "PsbtGenerator.h"
+
+using namespace hexwallet;
+
+namespace {
+
+constexpr char kMnemonic[] =
+    "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about";
+constexpr size_t kSamples = 21;
+
+constexpr PsbtSpec kShapes[] = {
+    {1, 2, 1, 0x00, 1},
+    {2, 2, 1, 0x02, 2},
+    {4, 4, 1, 0x0a, 3},
+    {8, 8, 2, 0xaa, 4},
+    {kBitcoinMaxInputs, kBitcoinMaxOutputs, 4, 0xaa, 5},
+};
+
+struct WalletPath {
+  uint32_t path[5];
+};
+
+// The paths the parser walks: every input, then every change output.
+size_t wallet_paths(const PsbtSpec &spec, WalletPath *out) {
+  size_t count = 0;
+  for (size_t index = 0; index < spec.input_count; ++index) {
+    const bool nested = (spec.nested_mask >> index) & 1;
+    out[count++] = {{(nested ? 49U : 84U) | kHardenedOffset, kHardenedOffset, kHardenedOffset, 0,
+                     static_cast<uint32_t>(index)}};
+  }
+  for (size_t index = 0; index < spec.change_count; ++index) {
+    out[count++] = {{(index % 2 == 1 ? 49U : 84U) | kHardenedOffset, kHardenedOffset,
+                     kHardenedOffset, 1, static_cast<uint32_t>(index)}};
+  }
+  return count;
+}
+
+// Walks the paths keeping the last account node, as the parser does.
+bool derive_paths(const HdExpandedPrivateNode &master, const WalletPath *paths, size_t count) {
+  HdExpandedPrivateNode account;
+  HdExpandedPrivateNode change;
+  HdExpandedPrivateNode leaf;
+  const uint32_t *account_path = nullptr;
+  bool ok = true;
+  for (size_t index = 0; ok && index < count; ++index) {
+    const uint32_t *path = paths[index].path;
+    if (account_path == nullptr || memcmp(account_path, path, 3 * sizeof(uint32_t)) != 0) {
+      ok = hd_private_derive_expanded(&master, path[0], &leaf) == WalletError::Ok &&
+           hd_private_derive_expanded(&leaf, path[1], &change) == WalletError::Ok &&
+           hd_private_derive_expanded(&change, path[2], &account) == WalletError::Ok;
+      account_path = path;
+    }
+    ok = ok && hd_private_derive_expanded(&account, path[3], &change) == WalletError::Ok &&
+         hd_private_derive_expanded(&change, path[4], &leaf) == WalletError::Ok;
+  }
+  secure_zero(&account, sizeof(account));
+  secure_zero(&change, sizeof(change));
+  secure_zero(&leaf, sizeof(leaf));
+  return ok;
+}
+
+// The shared BIP143 hashes once, then each input's preimage.
+bool sighash_request(const BitcoinSigningRequest &request, uint8_t digests[][kSha256Size]) {
+  Bip143Cache cache;
+  bool ok = bitcoin_stages::bip143_prepare(request, &cache) == TransactionError::Ok;
+  for (size_t index = 0; ok && index < request.input_count; ++index) {
+    ok = bitcoin_stages::bip143_digest(request, cache, index, digests[index]) ==
+         TransactionError::Ok;
+  }
+  secure_zero(&cache, sizeof(cache));
+  return ok;
+}
+
+}  // namespace
+
+bool bench_psbt(BenchReport *report) {
+  uint8_t seed[kSeedSize];
+  HdPrivateNode master;
+  const bool keyed = bip39_seed_from_english(kMnemonic, "", seed) == WalletError::Ok &&
+                     hd_private_from_seed(seed, sizeof(seed), &master) == WalletError::Ok;
+  secure_zero(seed, sizeof(seed));
+  if (!keyed) return false;
+
+  static BitcoinSigningRequest request;
+  static uint8_t psbt[HEXWALLET_MAX_PSBT_BYTES];
+  static uint8_t transaction[4096];
+  bool ok = true;
+  for (const PsbtSpec &spec : kShapes) {
+    size_t psbt_size = sizeof(psbt);
+    if (!psbt_generate(master, spec, psbt, &psbt_size) ||
+        bitcoin_parse_psbt(psbt, psbt_size, master, &request) != TransactionError::Ok) {
+      ok = false;
+      break;
+    }
+    char name[64];
+    const auto label = [&](const char *phase) {
+      snprintf(name, sizeof(name), "psbt/%zux%zu/%s", spec.input_count, spec.output_count, phase);
+      return name;
+    };
+    const auto add = [&](const BenchResult &result) {
+      report->add(result);
+      ok = ok && result.ok;
+      return result;
+    };
+
+    BitcoinSigningRequest *parsed = &request;
+    add(bench_run(label("parse"), psbt_size, [&] {
+      return bitcoin_parse_psbt(psbt, psbt_size, master, parsed) == TransactionError::Ok;
+    }, kSamples));
+    add(bench_run(label("sign"), 0, [&] {
+      size_t transaction_size = sizeof(transaction);
+      return bitcoin_sign_request(request, master, transaction, &transaction_size) ==
+             TransactionError::Ok;
+    }, kSamples));
+
+    HdExpandedPrivateNode expanded;
+    add(bench_run(label("fingerprint"), 0, [&] {
+      return hd_private_expand(&master, &expanded) == WalletError::Ok;
+    }, kSamples));
+    WalletPath paths[kBitcoinMaxInputs + kBitcoinMaxOutputs];
+    const size_t path_count = wallet_paths(spec, paths);
+    add(bench_run(label("derivation"), 0, [&] {
+      return derive_paths(expanded, paths, path_count);
+    }, kSamples));
+    secure_zero(&expanded, sizeof(expanded));
+    uint8_t digests[kBitcoinMaxInputs][kSha256Size];
+    uint8_t signatures[kBitcoinMaxInputs][kBitcoinMaxDerSignatureSize];
+    uint8_t signature_sizes[kBitcoinMaxInputs] = {};
+    add(bench_run(label("sighash"), 0, [&] {
+      return sighash_request(request, digests);
+    }, kSamples));
+    add(bench_run(label("ecdsa"), 0, [&] {
+      return bitcoin_stages::sign_inputs(request, master, digests, signatures, signature_sizes) ==
+             TransactionError::Ok;
+    }, kSamples));
+    add(bench_run(label("serialization"), 0, [&] {
+      size_t transaction_size = sizeof(transaction);
+      return bitcoin_stages::write_witness_transaction(request, signatures, signature_sizes,
+                                                       transaction, &transaction_size) ==
+             TransactionError::Ok;
+    }, kSamples));
+    secure_zero(signatures, sizeof(signatures));
+  }
+  clear_bitcoin_request(&request);
+  secure_zero(&master, sizeof(master));
+  secure_zero(transaction, sizeof(transaction));
+  return ok;
+}
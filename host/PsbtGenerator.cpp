@@ -0,0 +1,210 @@
+#include <string.h>
+
+#include "../BitcoinTransaction.h"
+#include "../CryptoPrimitives.h"
+#include "PsbtGenerator.h"
+
+using namespace hexwallet;
+
+namespace {
+
+constexpr uint8_t kPsbtMagic[] = {'p', 's', 'b', 't', 0xff};
+constexpr uint32_t kSequence = 0xfffffffd;
+constexpr uint64_t kFeeRate = 10;
+
+struct Writer {
+  uint8_t *data;
+  size_t size;
+  size_t position;
+
+  bool bytes(const void *value, size_t count) {
+    if (count > size - position) return false;
+    memcpy(data + position, value, count);
+    position += count;
+    return true;
+  }
+  bool u8(uint8_t value) { return bytes(&value, 1); }
+  bool u32(uint32_t value) {
+    const uint8_t encoded[4] = {static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8),
+                                static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 24)};
+    return bytes(encoded, sizeof(encoded));
+  }
+  bool u64(uint64_t value) {
+    return u32(static_cast<uint32_t>(value)) && u32(static_cast<uint32_t>(value >> 32));
+  }
+  // Every length in these PSBTs fits the one- or three-byte forms.
+  bool compact(size_t value) {
+    if (value < 0xfd) return u8(static_cast<uint8_t>(value));
+    return value <= 0xffff && u8(0xfd) && u8(static_cast<uint8_t>(value)) &&
+           u8(static_cast<uint8_t>(value >> 8));
+  }
+};
+
+uint32_t next_random(uint32_t *state) {
+  *state = *state * 1664525U + 1013904223U;
+  return *state;
+}
+
+struct KeyEntry {
+  uint32_t path[5];
+  uint8_t public_key[kCompressedPublicKeySize];
+  uint8_t script[kBitcoinMaxScriptSize];
+  uint8_t script_size;
+  uint8_t redeem_script[22];
+};
+
+// Derives the key at m/purpose'/0'/0'/change/index and its output script.
+bool derive_entry(const HdExpandedPrivateNode &master, bool nested, uint32_t change,
+                  uint32_t index, KeyEntry *out) {
+  const uint32_t path[5] = {(nested ? 49U : 84U) | kHardenedOffset, kHardenedOffset,
+                            kHardenedOffset, change, index};
+  HdExpandedPrivateNode current = master;
+  bool ok = true;
+  for (size_t depth = 0; ok && depth < 5; ++depth) {
+    HdExpandedPrivateNode next;
+    ok = hd_private_derive_expanded(&current, path[depth], &next) == WalletError::Ok;
+    if (ok) current = next;
+    secure_zero(&next, sizeof(next));
+  }
+  memcpy(out->path, path, sizeof(path));
+  memcpy(out->public_key, current.public_key, sizeof(out->public_key));
+  secure_zero(&current, sizeof(current));
+  out->redeem_script[0] = 0x00;
+  out->redeem_script[1] = kRipemd160Size;
+  ok = ok && crypto_hash160(out->public_key, sizeof(out->public_key), out->redeem_script + 2);
+  if (nested) {
+    out->script[0] = 0xa9;
+    out->script[1] = kRipemd160Size;
+    out->script[22] = 0x87;
+    out->script_size = 23;
+    return ok && crypto_hash160(out->redeem_script, sizeof(out->redeem_script), out->script + 2);
+  }
+  memcpy(out->script, out->redeem_script, sizeof(out->redeem_script));
+  out->script_size = sizeof(out->redeem_script);
+  return ok;
+}
+
+void external_script(uint32_t *state, KeyEntry *out) {
+  uint8_t hash[kRipemd160Size];
+  for (uint8_t &byte : hash) byte = static_cast<uint8_t>(next_random(state) >> 24);
+  switch (next_random(state) % 3) {
+    case 0:
+      out->script[0] = 0x00;
+      out->script[1] = kRipemd160Size;
+      memcpy(out->script + 2, hash, sizeof(hash));
+      out->script_size = 22;
+      break;
+    case 1:
+      out->script[0] = 0x76;
+      out->script[1] = 0xa9;
+      out->script[2] = kRipemd160Size;
+      memcpy(out->script + 3, hash, sizeof(hash));
+      out->script[23] = 0x88;
+      out->script[24] = 0xac;
+      out->script_size = 25;
+      break;
+    default:
+      out->script[0] = 0xa9;
+      out->script[1] = kRipemd160Size;
+      memcpy(out->script + 2, hash, sizeof(hash));
+      out->script[22] = 0x87;
+      out->script_size = 23;
+      break;
+  }
+}
+
+bool write_derivation(Writer *writer, uint8_t type, const KeyEntry &entry,
+                      const uint8_t fingerprint[4]) {
+  bool ok = writer->compact(1 + kCompressedPublicKeySize) && writer->u8(type) &&
+            writer->bytes(entry.public_key, sizeof(entry.public_key)) &&
+            writer->compact(4 + sizeof(entry.path)) && writer->bytes(fingerprint, 4);
+  for (const uint32_t step : entry.path) ok = ok && writer->u32(step);
+  return ok;
+}
+
+}  // namespace
+
+bool psbt_generate(const HdPrivateNode &master, const PsbtSpec &spec, uint8_t *out,
+                   size_t *in_out_size) {
+  if (out == nullptr || in_out_size == nullptr || spec.input_count == 0 ||
+      spec.input_count > kBitcoinMaxInputs || spec.output_count == 0 ||
+      spec.output_count > kBitcoinMaxOutputs || spec.change_count > spec.output_count) {
+    return false;
+  }
+  HdExpandedPrivateNode expanded;
+  if (hd_private_expand(&master, &expanded) != WalletError::Ok) return false;
+  uint8_t fingerprint[4];
+  for (size_t index = 0; index < sizeof(fingerprint); ++index) {
+    fingerprint[index] = static_cast<uint8_t>(expanded.fingerprint >> (24 - index * 8));
+  }
+  KeyEntry inputs[kBitcoinMaxInputs] = {};
+  KeyEntry outputs[kBitcoinMaxOutputs] = {};
+  bool ok = true;
+  for (size_t index = 0; ok && index < spec.input_count; ++index) {
+    ok = derive_entry(expanded, (spec.nested_mask >> index) & 1, 0, static_cast<uint32_t>(index),
+                      &inputs[index]);
+  }
+  uint32_t state = spec.seed;
+  for (size_t index = 0; ok && index < spec.output_count; ++index) {
+    if (index < spec.change_count) {
+      ok = derive_entry(expanded, index % 2 == 1, 1, static_cast<uint32_t>(index), &outputs[index]);
+    } else {
+      external_script(&state, &outputs[index]);
+    }
+  }
+  secure_zero(&expanded, sizeof(expanded));
+  if (!ok) return false;
+
+  // Amounts: the fee follows the parser's size estimate, the rest is split
+  // over the outputs.
+  uint64_t input_total = 0;
+  uint32_t stripped = 4 + 1 + 1 + 4;
+  for (size_t index = 0; index < spec.input_count; ++index) {
+    input_total += 100000 + index * 1000;
+    stripped += 32 + 4 + 1 + (inputs[index].script_size == 23 ? 23 : 0) + 4;
+  }
+  for (size_t index = 0; index < spec.output_count; ++index) {
+    stripped += 8 + 1 + outputs[index].script_size;
+  }
+  const uint32_t vbytes =
+      (stripped * 4 + 2 + static_cast<uint32_t>(spec.input_count) * 109 + 3) / 4;
+  const uint64_t spendable = input_total - kFeeRate * vbytes;
+  const uint64_t share = spendable / spec.output_count;
+
+  uint8_t transaction[1024];
+  Writer tx = {transaction, sizeof(transaction), 0};
+  ok = tx.u32(2) && tx.compact(spec.input_count);
+  for (size_t index = 0; ok && index < spec.input_count; ++index) {
+    uint8_t txid[32];
+    for (uint8_t &byte : txid) byte = static_cast<uint8_t>(next_random(&state) >> 24);
+    ok = tx.bytes(txid, sizeof(txid)) && tx.u32(next_random(&state) % 4) && tx.compact(0) &&
+         tx.u32(kSequence);
+  }
+  ok = ok && tx.compact(spec.output_count);
+  for (size_t index = 0; ok && index < spec.output_count; ++index) {
+    const uint64_t value = index == 0 ? spendable - share * (spec.output_count - 1) : share;
+    ok = tx.u64(value) && tx.compact(outputs[index].script_size) &&
+         tx.bytes(outputs[index].script, outputs[index].script_size);
+  }
+  ok = ok && tx.u32(0);
+
+  Writer psbt = {out, *in_out_size, 0};
+  ok = ok && psbt.bytes(kPsbtMagic, sizeof(kPsbtMagic)) && psbt.compact(1) && psbt.u8(0x00) &&
+       psbt.compact(tx.position) && psbt.bytes(transaction, tx.position) && psbt.compact(0);
+  for (size_t index = 0; ok && index < spec.input_count; ++index) {
+    const KeyEntry &input = inputs[index];
+    const bool nested = input.script_size == 23;
+    ok = psbt.compact(1) && psbt.u8(0x01) && psbt.compact(8 + 1 + input.script_size) &&
+         psbt.u64(100000 + index * 1000) && psbt.compact(input.script_size) &&
+         psbt.bytes(input.script, input.script_size) &&
+         (!nested || (psbt.compact(1) && psbt.u8(0x04) && psbt.compact(sizeof(input.redeem_script)) &&
+                      psbt.bytes(input.redeem_script, sizeof(input.redeem_script)))) &&
+         write_derivation(&psbt, 0x06, input, fingerprint) && psbt.compact(0);
+  }
+  for (size_t index = 0; ok && index < spec.output_count; ++index) {
+    ok = (index >= spec.change_count || write_derivation(&psbt, 0x02, outputs[index], fingerprint)) &&
+         psbt.compact(0);
+  }
+  if (ok) *in_out_size = psbt.position;
+  return ok;
+}
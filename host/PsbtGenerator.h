@@ -0,0 +1,28 @@
+#ifndef HEXWALLET_HOST_PSBT_GENERATOR_H
+#define HEXWALLET_HOST_PSBT_GENERATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../WalletSecurity.h"
+
+// Shape of a synthetic PSBT v0 spending from the wallet of master. Input i
+// spends m/49'/0'/0'/0/i as P2SH-P2WPKH when bit i of nested_mask is set and
+// m/84'/0'/0'/0/i as P2WPKH otherwise. The first change_count outputs pay
+// wallet change at m/84'/0'/0'/1/j (m/49' for odd j); the rest pay external
+// P2WPKH, P2PKH and P2SH scripts drawn from seed. The fee is 10 sat/vB of
+// the size the parser estimates.
+struct PsbtSpec {
+  size_t input_count;
+  size_t output_count;
+  size_t change_count;
+  uint32_t nested_mask;
+  uint32_t seed;
+};
+
+// Writes the PSBT into out. *in_out_size holds the capacity on entry and the
+// PSBT size on success.
+bool psbt_generate(const hexwallet::HdPrivateNode &master, const PsbtSpec &spec,
+                   uint8_t *out, size_t *in_out_size);
+
+#endif
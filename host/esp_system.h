@@ -0,0 +1,9 @@
+#ifndef HEXWALLET_HOST_ESP_SYSTEM_H
+#define HEXWALLET_HOST_ESP_SYSTEM_H
+
+#include <stddef.h>
+
+// Fills buf from the host CSPRNG; aborts if none is available.
+void esp_fill_random(void *buf, size_t len);
+
+#endif
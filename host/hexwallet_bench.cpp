@@ -0,0 +1,135 @@
+// Host benchmark for the wallet modules. Runs the firmware self-tests, then
+// the requested suites, or every suite when none is named:
+//
+//   hexwallet_bench [--self-test] [--json] [primitives] [addresses] [wallet] [psbt]
+//
+// --self-test runs only the self-tests, which is what ctest does. --json
+// prints the results as one JSON document on stdout and moves the
+// self-test lines to stderr.
+
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "../BitcoinTransaction.h"
+#include "../CryptoNoteAddress.h"
+#include "../CryptoPrimitives.h"
+#include "../EvmTransaction.h"
+#include "../WalletCli.h"
+#include "../WalletEngine.h"
+#include "../WalletSecurity.h"
+#include "../WalletTokens.h"
+#include "../WalletTransportPolicy.h"
+#include "Arduino.h"
+#include "BenchSuites.h"
+
+using namespace hexwallet;
+
+namespace {
+
+constexpr char kMnemonic[] =
+    "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about";
+
+struct SelfTest {
+  const char *name;
+  bool (*run)();
+};
+
+constexpr SelfTest kSelfTests[] = {
+    {"crypto", run_crypto_self_tests},
+    {"cryptonote", run_cryptonote_self_tests},
+    {"evm", run_evm_transaction_self_test},
+    {"bip39", run_bip39_self_test},
+    {"bip32", run_bip32_self_test},
+    {"secp256k1", run_secp256k1_self_test},
+    {"address", run_address_self_tests},
+    {"networks", run_network_profile_self_tests},
+    {"tokens", run_token_profile_self_tests},
+    {"transport", run_transport_policy_self_test},
+    {"bitcoin", run_bitcoin_transaction_self_test},
+};
+
+struct Suite {
+  const char *name;
+  bool (*run)(BenchReport *report);
+};
+
+constexpr Suite kSuites[] = {
+    {"primitives", bench_primitives},
+    {"addresses", bench_addresses},
+    {"wallet", bench_wallet},
+    {"psbt", bench_psbt},
+};
+
+bool run_self_tests(FILE *out) {
+  bool passed = true;
+  for (const SelfTest &test : kSelfTests) {
+    const auto start = std::chrono::steady_clock::now();
+    const bool result = test.run();
+    const double elapsed =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    fprintf(out, "selftest %-12s %-4s %10.1f us\n", test.name, result ? "pass" : "FAIL", elapsed);
+    passed = passed && result;
+  }
+  return passed;
+}
+
+}  // namespace
+
+// Seed and master key derivation and a muted CLI session.
+bool bench_wallet(BenchReport *report) {
+  uint8_t seed[kSeedSize];
+  report->add(bench_run("bip39_seed_from_english", 0, [&] {
+    return bip39_seed_from_english(kMnemonic, "TREZOR", seed) == WalletError::Ok;
+  }, 21));
+  HdPrivateNode master;
+  report->add(bench_run("hd_private_from_seed", 0, [&] {
+    return hd_private_from_seed(seed, sizeof(seed), &master) == WalletError::Ok;
+  }));
+  secure_zero(seed, sizeof(seed));
+  secure_zero(&master, sizeof(master));
+
+  host_serial_mute(true);
+  const bool cli_ready = wallet_cli_init(false);
+  const BenchResult cli = bench_run("cli/help+status", 0, [] {
+    host_serial_input("help\nstatus\n");
+    wallet_cli_service();
+    return true;
+  });
+  host_serial_mute(false);
+  report->add(cli);
+  return cli_ready;
+}
+
+int main(int argc, char **argv) {
+  bool self_test_only = false;
+  bool json = false;
+  bool selected[sizeof(kSuites) / sizeof(kSuites[0])] = {};
+  bool any_selected = false;
+  for (int arg = 1; arg < argc; ++arg) {
+    bool known = false;
+    if (strcmp(argv[arg], "--self-test") == 0) self_test_only = known = true;
+    else if (strcmp(argv[arg], "--json") == 0) json = known = true;
+    for (size_t suite = 0; suite < sizeof(kSuites) / sizeof(kSuites[0]); ++suite) {
+      if (strcmp(argv[arg], kSuites[suite].name) == 0) selected[suite] = any_selected = known = true;
+    }
+    if (!known) {
+      fprintf(stderr, "usage: %s [--self-test] [--json] [primitives] [addresses] [wallet] [psbt]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  if (!run_self_tests(json ? stderr : stdout)) return 1;
+  if (self_test_only) return 0;
+  BenchReport report(json);
+  bool ok = true;
+  for (size_t suite = 0; suite < sizeof(kSuites) / sizeof(kSuites[0]); ++suite) {
+    if (any_selected && !selected[suite]) continue;
+    if (!kSuites[suite].run(&report)) {
+      fprintf(stderr, "bench suite %s failed\n", kSuites[suite].name);
+      ok = false;
+    }
+  }
+  return report.finish() && ok ? 0 : 1;
+}
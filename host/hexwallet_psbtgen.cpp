@@ -0,0 +1,98 @@
+// Writes a synthetic PSBT v0 for the wallet of a test mnemonic as hex, the
+// form `tx inspect` accepts:
+//
+//   hexwallet_psbtgen [--inputs N] [--outputs N] [--change N]
+//                     [--nested-mask X] [--seed N] [--mnemonic "words"] [--verify]
+//
+// --verify parses and signs the PSBT instead of printing it, which is what
+// ctest does.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../BitcoinTransaction.h"
+#include "../WalletSecurity.h"
+#include "PsbtGenerator.h"
+
+using namespace hexwallet;
+
+namespace {
+
+constexpr char kDefaultMnemonic[] =
+    "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about";
+
+int usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [--inputs N] [--outputs N] [--change N] [--nested-mask X] [--seed N]\n"
+          "          [--mnemonic \"words\"] [--verify]\n",
+          program);
+  return 2;
+}
+
+bool verify(const uint8_t *psbt, size_t psbt_size, const HdPrivateNode &master) {
+  static BitcoinSigningRequest request;
+  static uint8_t transaction[4096];
+  size_t transaction_size = sizeof(transaction);
+  TransactionError result = bitcoin_parse_psbt(psbt, psbt_size, master, &request);
+  if (result == TransactionError::Ok) {
+    result = bitcoin_sign_request(request, master, transaction, &transaction_size);
+  }
+  printf("psbt %zu bytes: %s", psbt_size, transaction_error_text(result));
+  if (result == TransactionError::Ok) {
+    printf(", %u inputs, %u outputs, fee %llu, signed %zu bytes", request.input_count,
+           request.output_count, static_cast<unsigned long long>(request.fee), transaction_size);
+  }
+  printf("\n");
+  clear_bitcoin_request(&request);
+  return result == TransactionError::Ok;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  // Change defaults to two outputs, or every output of a smaller PSBT.
+  constexpr size_t kDefaultChange = 2;
+  PsbtSpec spec = {kBitcoinMaxInputs, kBitcoinMaxOutputs, SIZE_MAX, 0xaa, 1};
+  const char *mnemonic = kDefaultMnemonic;
+  bool verify_only = false;
+  for (int arg = 1; arg < argc; ++arg) {
+    const bool has_value = arg + 1 < argc;
+    if (strcmp(argv[arg], "--verify") == 0) verify_only = true;
+    else if (!has_value) return usage(argv[0]);
+    else if (strcmp(argv[arg], "--inputs") == 0) spec.input_count = strtoul(argv[++arg], nullptr, 0);
+    else if (strcmp(argv[arg], "--outputs") == 0) spec.output_count = strtoul(argv[++arg], nullptr, 0);
+    else if (strcmp(argv[arg], "--change") == 0) spec.change_count = strtoul(argv[++arg], nullptr, 0);
+    else if (strcmp(argv[arg], "--nested-mask") == 0) spec.nested_mask = strtoul(argv[++arg], nullptr, 0);
+    else if (strcmp(argv[arg], "--seed") == 0) spec.seed = strtoul(argv[++arg], nullptr, 0);
+    else if (strcmp(argv[arg], "--mnemonic") == 0) mnemonic = argv[++arg];
+    else return usage(argv[0]);
+  }
+
+  if (spec.change_count == SIZE_MAX) {
+    spec.change_count = spec.output_count < kDefaultChange ? spec.output_count : kDefaultChange;
+  }
+
+  uint8_t seed[kSeedSize];
+  HdPrivateNode master;
+  const bool keyed = bip39_seed_from_english(mnemonic, "", seed) == WalletError::Ok &&
+                     hd_private_from_seed(seed, sizeof(seed), &master) == WalletError::Ok;
+  secure_zero(seed, sizeof(seed));
+  uint8_t psbt[HEXWALLET_MAX_PSBT_BYTES];
+  size_t psbt_size = sizeof(psbt);
+  if (!keyed || !psbt_generate(master, spec, psbt, &psbt_size)) {
+    fprintf(stderr, "cannot generate a PSBT with this shape\n");
+    secure_zero(&master, sizeof(master));
+    return 1;
+  }
+  bool ok = true;
+  if (verify_only) {
+    ok = verify(psbt, psbt_size, master);
+  } else {
+    for (size_t index = 0; index < psbt_size; ++index) printf("%02x", psbt[index]);
+    printf("\n");
+  }
+  secure_zero(&master, sizeof(master));
+  return ok ? 0 : 1;
+}
@@ -2,11 +2,25 @@
 
 #include <string.h>
 
+// The permutation keeps each 64-bit lane either whole, or bit-interleaved as
+// two 32-bit words holding its even and odd bits, so every rotation is two
+// 32-bit rotations. The interleaved form suits 32-bit cores such as the
+// ESP32's Xtensa LX6/LX7 and is the default wherever pointers are 32 bits.
+#ifndef HEXWALLET_KECCAK_INTERLEAVED
+#if UINTPTR_MAX > 0xffffffffU
+#define HEXWALLET_KECCAK_INTERLEAVED 0
+#else
+#define HEXWALLET_KECCAK_INTERLEAVED 1
+#endif
+#endif
+
 namespace {
 
 constexpr size_t kLaneCount = kKeccak256StateLanes;
+constexpr size_t kLaneBytes = 8;
 constexpr size_t kRoundCount = 24;
 constexpr size_t kRateBytes = kKeccak256RateBytes;
+constexpr size_t kRateLanes = kRateBytes / kLaneBytes;
 constexpr size_t kDigestBytes = kKeccak256DigestBytes;
 constexpr uint8_t kKeccakDomainSuffix = 0x01;
 constexpr uint8_t kFinalBit = 0x80;
@@ -28,17 +42,10 @@ constexpr uint64_t kRoundConstants[kRoundCount] = {
     UINT64_C(0x0000000080000001), UINT64_C(0x8000000080008008),
 };
 
-constexpr uint8_t kRotation[5][5] = {
-    {0, 36, 3, 41, 18},
-    {1, 44, 10, 45, 2},
-    {62, 6, 43, 15, 61},
-    {28, 55, 25, 21, 56},
-    {27, 20, 39, 8, 14},
-};
-
-uint64_t rotate_left(uint64_t value, uint8_t shift) {
-  return shift == 0 ? value : (value << shift) | (value >> (64U - shift));
-}
+// Lane complementing, from the Keccak team's implementation overview: with
+// these six lanes stored inverted, chi needs one NOT per plane instead of
+// five. The permutation inverts them on entry and exit.
+constexpr size_t kComplementedLanes[] = {1, 2, 8, 12, 17, 20};
 
 uint64_t load_le64(const uint8_t *data) {
   uint64_t value = 0;
@@ -54,43 +61,205 @@ void store_le64(uint8_t *out, uint64_t value) {
   }
 }
 
-void permutation(uint64_t state[kLaneCount]) {
+#if HEXWALLET_KECCAK_INTERLEAVED
+
+// A lane as its even bits and its odd bits. SHA3_CTX keeps the even word in
+// the low half of each state entry.
+struct Lane {
+  uint32_t even;
+  uint32_t odd;
+};
+
+Lane operator^(const Lane &left, const Lane &right) {
+  return {left.even ^ right.even, left.odd ^ right.odd};
+}
+Lane operator&(const Lane &left, const Lane &right) {
+  return {left.even & right.even, left.odd & right.odd};
+}
+Lane operator|(const Lane &left, const Lane &right) {
+  return {left.even | right.even, left.odd | right.odd};
+}
+Lane operator~(const Lane &value) { return {~value.even, ~value.odd}; }
+
+template <unsigned kShift>
+uint32_t rotate32(uint32_t value) {
+  return kShift % 32 == 0 ? value : (value << (kShift % 32)) | (value >> ((32 - kShift % 32) % 32));
+}
+
+// Rotating a lane by an odd amount moves odd bits to even positions and even
+// bits to odd ones.
+template <unsigned kShift>
+Lane rotate(const Lane &value) {
+  if (kShift % 2 == 0) return {rotate32<kShift / 2>(value.even), rotate32<kShift / 2>(value.odd)};
+  return {rotate32<(kShift + 1) / 2>(value.odd), rotate32<kShift / 2>(value.even)};
+}
+
+// Gathers the even bits of value into its low half.
+constexpr uint32_t compress_even(uint32_t value) {
+  value &= 0x55555555U;
+  value = (value | (value >> 1)) & 0x33333333U;
+  value = (value | (value >> 2)) & 0x0f0f0f0fU;
+  value = (value | (value >> 4)) & 0x00ff00ffU;
+  return (value | (value >> 8)) & 0x0000ffffU;
+}
+
+// Spreads the low half of value over its even bits.
+constexpr uint32_t spread_even(uint32_t value) {
+  value &= 0x0000ffffU;
+  value = (value | (value << 8)) & 0x00ff00ffU;
+  value = (value | (value << 4)) & 0x0f0f0f0fU;
+  value = (value | (value << 2)) & 0x33333333U;
+  return (value | (value << 1)) & 0x55555555U;
+}
+
+constexpr uint64_t interleave(uint64_t value) {
+  const uint32_t low = static_cast<uint32_t>(value);
+  const uint32_t high = static_cast<uint32_t>(value >> 32);
+  const uint32_t even = compress_even(low) | (compress_even(high) << 16);
+  const uint32_t odd = compress_even(low >> 1) | (compress_even(high >> 1) << 16);
+  return (static_cast<uint64_t>(odd) << 32) | even;
+}
+
+uint64_t deinterleave(uint64_t value) {
+  const uint32_t even = static_cast<uint32_t>(value);
+  const uint32_t odd = static_cast<uint32_t>(value >> 32);
+  const uint32_t low = spread_even(even) | (spread_even(odd) << 1);
+  const uint32_t high = spread_even(even >> 16) | (spread_even(odd >> 16) << 1);
+  return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+Lane lane_from_state(uint64_t value) {
+  return {static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32)};
+}
+
+uint64_t lane_to_state(const Lane &lane) {
+  return (static_cast<uint64_t>(lane.odd) << 32) | lane.even;
+}
+
+struct RoundConstants {
+  Lane lane[kRoundCount];
+};
+
+constexpr RoundConstants make_round_constants() {
+  RoundConstants constants = {};
   for (size_t round = 0; round < kRoundCount; ++round) {
-    uint64_t column[5];
-    uint64_t delta[5];
-    uint64_t moved[kLaneCount];
-
-    for (uint8_t x = 0; x < 5; ++x) {
-      column[x] = state[x] ^ state[x + 5] ^ state[x + 10] ^ state[x + 15] ^ state[x + 20];
-    }
-    for (uint8_t x = 0; x < 5; ++x) {
-      delta[x] = column[(x + 4) % 5] ^ rotate_left(column[(x + 1) % 5], 1);
-    }
-    for (uint8_t y = 0; y < 5; ++y) {
-      for (uint8_t x = 0; x < 5; ++x) {
-        state[x + 5 * y] ^= delta[x];
-      }
-    }
-
-    for (uint8_t y = 0; y < 5; ++y) {
-      for (uint8_t x = 0; x < 5; ++x) {
-        moved[y + 5 * ((2 * x + 3 * y) % 5)] = rotate_left(state[x + 5 * y], kRotation[x][y]);
-      }
-    }
-
-    for (uint8_t y = 0; y < 5; ++y) {
-      for (uint8_t x = 0; x < 5; ++x) {
-        state[x + 5 * y] = moved[x + 5 * y] ^
-                             ((~moved[(x + 1) % 5 + 5 * y]) & moved[(x + 2) % 5 + 5 * y]);
-      }
-    }
-    state[0] ^= kRoundConstants[round];
+    const uint64_t value = interleave(kRoundConstants[round]);
+    constants.lane[round] = {static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32)};
   }
+  return constants;
 }
 
+constexpr RoundConstants kLaneRoundConstants = make_round_constants();
+
+const Lane &round_constant(size_t round) { return kLaneRoundConstants.lane[round]; }
+
+#else
+
+using Lane = uint64_t;
+
+template <unsigned kShift>
+Lane rotate(Lane value) {
+  return kShift == 0 ? value : (value << kShift) | (value >> ((64 - kShift) % 64));
+}
+
+constexpr uint64_t interleave(uint64_t value) { return value; }
+uint64_t deinterleave(uint64_t value) { return value; }
+Lane lane_from_state(uint64_t value) { return value; }
+uint64_t lane_to_state(Lane lane) { return lane; }
+Lane round_constant(size_t round) { return kRoundConstants[round]; }
+
+#endif
+
+// One round from a into e, with the complemented lanes of
+// kComplementedLanes in both. Theta's column sums come first; rho and pi then
+// pick the five lanes of each output plane, which chi combines at once.
+void keccak_round(const Lane a[kLaneCount], Lane e[kLaneCount], const Lane &constant) {
+  const Lane c0 = a[0] ^ a[5] ^ a[10] ^ a[15] ^ a[20];
+  const Lane c1 = a[1] ^ a[6] ^ a[11] ^ a[16] ^ a[21];
+  const Lane c2 = a[2] ^ a[7] ^ a[12] ^ a[17] ^ a[22];
+  const Lane c3 = a[3] ^ a[8] ^ a[13] ^ a[18] ^ a[23];
+  const Lane c4 = a[4] ^ a[9] ^ a[14] ^ a[19] ^ a[24];
+  const Lane d0 = c4 ^ rotate<1>(c1);
+  const Lane d1 = c0 ^ rotate<1>(c2);
+  const Lane d2 = c1 ^ rotate<1>(c3);
+  const Lane d3 = c2 ^ rotate<1>(c4);
+  const Lane d4 = c3 ^ rotate<1>(c0);
+  // Plane 0: lanes 0, 6, 12, 18, 24 after rho and pi.
+  Lane b0 = a[0] ^ d0;
+  Lane b1 = rotate<44>(a[6] ^ d1);
+  Lane b2 = rotate<43>(a[12] ^ d2);
+  Lane b3 = rotate<21>(a[18] ^ d3);
+  Lane b4 = rotate<14>(a[24] ^ d4);
+  e[0] = b0 ^ (b1 | b2) ^ constant;
+  e[1] = b1 ^ (~b2 | b3);
+  e[2] = b2 ^ (b3 & b4);
+  e[3] = b3 ^ (b4 | b0);
+  e[4] = b4 ^ (b0 & b1);
+  // Plane 1: lanes 3, 9, 10, 16, 22 after rho and pi.
+  b0 = rotate<28>(a[3] ^ d3);
+  b1 = rotate<20>(a[9] ^ d4);
+  b2 = rotate<3>(a[10] ^ d0);
+  b3 = rotate<45>(a[16] ^ d1);
+  b4 = rotate<61>(a[22] ^ d2);
+  e[5] = b0 ^ (b1 | b2);
+  e[6] = b1 ^ (b2 & b3);
+  e[7] = b2 ^ (b3 | ~b4);
+  e[8] = b3 ^ (b4 | b0);
+  e[9] = b4 ^ (b0 & b1);
+  // Plane 2: lanes 1, 7, 13, 19, 20 after rho and pi.
+  b0 = rotate<1>(a[1] ^ d1);
+  b1 = rotate<6>(a[7] ^ d2);
+  b2 = rotate<25>(a[13] ^ d3);
+  b3 = rotate<8>(a[19] ^ d4);
+  b4 = rotate<18>(a[20] ^ d0);
+  e[10] = b0 ^ (b1 | b2);
+  e[11] = b1 ^ (b2 & b3);
+  e[12] = b2 ^ (~b3 & b4);
+  e[13] = ~b3 ^ (b4 | b0);
+  e[14] = b4 ^ (b0 & b1);
+  // Plane 3: lanes 4, 5, 11, 17, 23 after rho and pi.
+  b0 = rotate<27>(a[4] ^ d4);
+  b1 = rotate<36>(a[5] ^ d0);
+  b2 = rotate<10>(a[11] ^ d1);
+  b3 = rotate<15>(a[17] ^ d2);
+  b4 = rotate<56>(a[23] ^ d3);
+  e[15] = b0 ^ (b1 & b2);
+  e[16] = b1 ^ (b2 | b3);
+  e[17] = b2 ^ (~b3 | b4);
+  e[18] = ~b3 ^ (b4 & b0);
+  e[19] = b4 ^ (b0 | b1);
+  // Plane 4: lanes 2, 8, 14, 15, 21 after rho and pi.
+  b0 = rotate<62>(a[2] ^ d2);
+  b1 = rotate<55>(a[8] ^ d3);
+  b2 = rotate<39>(a[14] ^ d4);
+  b3 = rotate<41>(a[15] ^ d0);
+  b4 = rotate<2>(a[21] ^ d1);
+  e[20] = b0 ^ (~b1 & b2);
+  e[21] = ~b1 ^ (b2 | b3);
+  e[22] = b2 ^ (b3 & b4);
+  e[23] = b3 ^ (b4 | b0);
+  e[24] = b4 ^ (b0 & b1);
+}
+
+// Keccak-f[1600]. Rounds alternate between two lane sets, so no lane is
+// copied between rounds.
+void permutation(uint64_t state[kLaneCount]) {
+  Lane a[kLaneCount];
+  Lane e[kLaneCount];
+  for (size_t lane = 0; lane < kLaneCount; ++lane) a[lane] = lane_from_state(state[lane]);
+  for (const size_t lane : kComplementedLanes) a[lane] = ~a[lane];
+  for (size_t round = 0; round < kRoundCount; round += 2) {
+    keccak_round(a, e, round_constant(round));
+    keccak_round(e, a, round_constant(round + 1));
+  }
+  for (const size_t lane : kComplementedLanes) a[lane] = ~a[lane];
+  for (size_t lane = 0; lane < kLaneCount; ++lane) state[lane] = lane_to_state(a[lane]);
+}
+
+// Absorbs one rate-sized block straight from block, which need not be aligned.
 void absorb_block(SHA3_CTX *context, const uint8_t block[kRateBytes]) {
-  for (size_t lane = 0; lane < kRateBytes / sizeof(uint64_t); ++lane) {
-    context->state[lane] ^= load_le64(block + lane * sizeof(uint64_t));
+  for (size_t lane = 0; lane < kRateLanes; ++lane) {
+    context->state[lane] ^= interleave(load_le64(block + lane * kLaneBytes));
   }
   permutation(context->state);
 }
@@ -107,18 +276,26 @@ bool keccak_update(SHA3_CTX *context, const uint8_t *data, size_t size) {
   if (context == nullptr || context->finalized || (data == nullptr && size != 0)) {
     return false;
   }
-  while (size != 0) {
+  if (size == 0) return true;
+  if (context->used != 0) {
     const size_t available = kRateBytes - context->used;
     const size_t take = size < available ? size : available;
     memcpy(context->buffer + context->used, data, take);
     context->used += take;
     data += take;
     size -= take;
-    if (context->used == kRateBytes) {
-      absorb_block(context, context->buffer);
-      memset(context->buffer, 0, sizeof(context->buffer));
-      context->used = 0;
-    }
+    if (context->used < kRateBytes) return true;
+    absorb_block(context, context->buffer);
+    memset(context->buffer, 0, sizeof(context->buffer));
+    context->used = 0;
+  }
+  // Full blocks are absorbed from the caller's memory without buffering.
+  for (; size >= kRateBytes; data += kRateBytes, size -= kRateBytes) {
+    absorb_block(context, data);
+  }
+  if (size != 0) {
+    memcpy(context->buffer, data, size);
+    context->used = size;
   }
   return true;
 }
@@ -131,8 +308,8 @@ bool keccak_final(SHA3_CTX *context, uint8_t result[kDigestBytes]) {
   context->buffer[context->used] ^= kKeccakDomainSuffix;
   context->buffer[kRateBytes - 1] ^= kFinalBit;
   absorb_block(context, context->buffer);
-  for (size_t lane = 0; lane < kDigestBytes / sizeof(uint64_t); ++lane) {
-    store_le64(result + lane * sizeof(uint64_t), context->state[lane]);
+  for (size_t lane = 0; lane < kDigestBytes / kLaneBytes; ++lane) {
+    store_le64(result + lane * kLaneBytes, deinterleave(context->state[lane]));
   }
   context->finalized = true;
   memset(context->buffer, 0, sizeof(context->buffer));
@@ -1,6 +1,3 @@
-#include <tuple>
-#include <vector>
-
 #include <stdint.h>
 #include <string.h>
 
@@ -10,43 +7,46 @@ namespace bech32 {
 
 namespace {
 
-typedef std::vector<uint8_t> data;
-
 constexpr char kCharset[] = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
 constexpr uint32_t kBech32Constant = 1;
 constexpr uint32_t kBech32mConstant = 0x2bc830a3;
 constexpr uint32_t kGenerator[] = {
     0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3,
 };
-constexpr size_t kChecksumLength = 6;
-constexpr size_t kMaximumTextLength = 90;
 constexpr uint8_t kValueBits = 5;
 constexpr uint8_t kPolymodTopShift = 25;
 constexpr uint32_t kValueMask = (1U << kValueBits) - 1;
 constexpr uint32_t kPolymodLowMask = (1U << kPolymodTopShift) - 1;
 
-data cat(data x, const data& y) {
-  x.insert(x.end(), y.begin(), y.end());
-  return x;
+// Reverse of kCharset for the 7-bit range; -1 marks characters outside it.
+struct CharsetTable {
+  int8_t value[128];
+};
+
+constexpr CharsetTable make_charset_table() {
+  CharsetTable table = {};
+  for (size_t index = 0; index < sizeof(table.value); ++index) table.value[index] = -1;
+  for (size_t index = 0; index < sizeof(kCharset) - 1; ++index) {
+    table.value[static_cast<unsigned char>(kCharset[index])] = static_cast<int8_t>(index);
+  }
+  return table;
 }
 
+constexpr CharsetTable kCharsetTable = make_charset_table();
+
 uint32_t encoding_constant(Encoding encoding) {
   if (encoding == Encoding::BECH32) return kBech32Constant;
   if (encoding == Encoding::BECH32M) return kBech32mConstant;
   return 0;
 }
 
-
-uint32_t polymod(const data& values) {
-  uint32_t c = 1;
-  for (const auto v_i : values) {
-    uint8_t c0 = c >> kPolymodTopShift;
-
-    c = ((c & kPolymodLowMask) << kValueBits) ^ v_i;
-
-    for (uint8_t bit = 0; bit < sizeof(kGenerator) / sizeof(kGenerator[0]); ++bit) {
-      if ((c0 & (1U << bit)) != 0) c ^= kGenerator[bit];
-    }
+// One step of the BCH checksum, so the expanded hrp, the data and the
+// checksum padding are fed in place instead of being concatenated first.
+uint32_t polymod_step(uint32_t c, uint8_t value) {
+  const uint8_t c0 = static_cast<uint8_t>(c >> kPolymodTopShift);
+  c = ((c & kPolymodLowMask) << kValueBits) ^ value;
+  for (uint8_t bit = 0; bit < sizeof(kGenerator) / sizeof(kGenerator[0]); ++bit) {
+    if ((c0 & (1U << bit)) != 0) c ^= kGenerator[bit];
   }
   return c;
 }
@@ -55,84 +55,92 @@ unsigned char lc(unsigned char c) {
   return (c >= 'A' && c <= 'Z') ? (c - 'A') + 'a' : c;
 }
 
-data expand_hrp(const std::string& hrp) {
-  data ret;
-  ret.reserve(hrp.size() + 90);
-  ret.resize(hrp.size() * 2 + 1);
-  for (size_t i = 0; i < hrp.size(); ++i) {
-    unsigned char c = hrp[i];
-    ret[i] = c >> kValueBits;
-    ret[i + hrp.size() + 1] = c & kValueMask;
-  }
-  ret[hrp.size()] = 0;
-  return ret;
-}
-
-Encoding verify_checksum(const std::string& hrp, const data& values) {
-  uint32_t check = polymod(cat(expand_hrp(hrp), values));
-  if (check == encoding_constant(Encoding::BECH32)) return Encoding::BECH32;
-  if (check == encoding_constant(Encoding::BECH32M)) return Encoding::BECH32M;
-  return Encoding::INVALID;
-}
-
-data create_checksum(const std::string& hrp, const data& values, Encoding encoding) {
-  data enc = cat(expand_hrp(hrp), values);
-  enc.resize(enc.size() + kChecksumLength);
-  uint32_t mod = polymod(enc) ^ encoding_constant(encoding);
-  data ret;
-  ret.resize(kChecksumLength);
-  for (size_t i = 0; i < kChecksumLength; ++i) {
-    ret[i] = (mod >> (kValueBits * (kChecksumLength - 1 - i))) & kValueMask;
-  }
-  return ret;
+// Checksum state after the expanded hrp: high bits, a zero, then low bits.
+// The hrp is read through lc() so the decoder can pass upper-case text.
+uint32_t polymod_hrp(const char *hrp, size_t hrp_size) {
+  uint32_t c = 1;
+  for (size_t i = 0; i < hrp_size; ++i) c = polymod_step(c, lc(hrp[i]) >> kValueBits);
+  c = polymod_step(c, 0);
+  for (size_t i = 0; i < hrp_size; ++i) c = polymod_step(c, lc(hrp[i]) & kValueMask);
+  return c;
 }
 
 }  // namespace
 
-std::string encode(const std::string& hrp, const data& values, Encoding encoding) {
-  if (hrp.empty() || encoding_constant(encoding) == 0) return {};
-  for (const unsigned char c : hrp) {
-    if (c < 33 || c > 126 || (c >= 'A' && c <= 'Z')) return {};
+size_t encode(char *out, size_t out_size, const char *hrp, const uint8_t *values,
+              size_t value_count, Encoding encoding) {
+  if (out == nullptr || hrp == nullptr || (values == nullptr && value_count != 0) ||
+      encoding_constant(encoding) == 0) {
+    return 0;
+  }
+  const size_t hrp_size = strlen(hrp);
+  const size_t text_size = hrp_size + 1 + value_count + kChecksumLength;
+  if (hrp_size == 0 || text_size + 1 > out_size) return 0;
+  for (size_t i = 0; i < hrp_size; ++i) {
+    const unsigned char c = hrp[i];
+    if (c < 33 || c > 126 || (c >= 'A' && c <= 'Z')) return 0;
   }
-  data checksum = create_checksum(hrp, values, encoding);
-  data combined = cat(values, checksum);
-  std::string ret = hrp + '1';
-  ret.reserve(ret.size() + combined.size());
-  for (const auto c : combined) {
-    if (c >= sizeof(kCharset) - 1) return {};
-    ret += kCharset[c];
+  uint32_t c = polymod_hrp(hrp, hrp_size);
+  memcpy(out, hrp, hrp_size);
+  out[hrp_size] = '1';
+  char *cursor = out + hrp_size + 1;
+  for (size_t i = 0; i < value_count; ++i) {
+    if (values[i] > kValueMask) {
+      out[0] = '\0';
+      return 0;
+    }
+    c = polymod_step(c, values[i]);
+    *cursor++ = kCharset[values[i]];
+  }
+  for (size_t i = 0; i < kChecksumLength; ++i) c = polymod_step(c, 0);
+  c ^= encoding_constant(encoding);
+  for (size_t i = 0; i < kChecksumLength; ++i) {
+    *cursor++ = kCharset[(c >> (kValueBits * (kChecksumLength - 1 - i))) & kValueMask];
   }
-  return ret;
+  *cursor = '\0';
+  return text_size;
 }
 
-DecodeResult decode(const std::string& str) {
+Encoding decode(const char *str, char *hrp, size_t hrp_size, uint8_t *values,
+                size_t *in_out_value_count) {
+  if (str == nullptr || hrp == nullptr || in_out_value_count == nullptr ||
+      (values == nullptr && *in_out_value_count != 0)) {
+    return Encoding::INVALID;
+  }
   bool lower = false, upper = false;
-  for (size_t i = 0; i < str.size(); ++i) {
-    unsigned char c = str[i];
+  size_t size = 0;
+  size_t pos = 0;
+  bool found = false;
+  for (; str[size] != '\0'; ++size) {
+    if (size == kMaximumTextLength) return Encoding::INVALID;
+    const unsigned char c = str[size];
     if (c >= 'a' && c <= 'z') lower = true;
     else if (c >= 'A' && c <= 'Z') upper = true;
-    else if (c < 33 || c > 126) return {};
-  }
-  if (lower && upper) return {};
-  size_t pos = str.rfind('1');
-  if (str.size() > kMaximumTextLength || pos == str.npos || pos == 0 ||
-      pos + 1 + kChecksumLength > str.size()) {
-    return {};
-  }
-  data values(str.size() - 1 - pos);
-  for (size_t i = 0; i < str.size() - 1 - pos; ++i) {
-    unsigned char c = str[i + pos + 1];
-    const char *position = strchr(kCharset, lc(c));
-    if (position == nullptr) return {};
-    values[i] = static_cast<uint8_t>(position - kCharset);
+    else if (c < 33 || c > 126) return Encoding::INVALID;
+    if (c == '1') {
+      pos = size;
+      found = true;
+    }
   }
-  std::string hrp;
-  for (size_t i = 0; i < pos; ++i) {
-    hrp += lc(str[i]);
+  if (lower && upper) return Encoding::INVALID;
+  if (!found || pos == 0 || pos + 1 + kChecksumLength > size) return Encoding::INVALID;
+  const size_t value_count = size - 1 - pos - kChecksumLength;
+  if (pos + 1 > hrp_size || value_count > *in_out_value_count) return Encoding::INVALID;
+  uint32_t c = polymod_hrp(str, pos);
+  for (size_t i = pos + 1; i < size; ++i) {
+    const int8_t value = kCharsetTable.value[lc(str[i])];
+    if (value < 0) return Encoding::INVALID;
+    c = polymod_step(c, static_cast<uint8_t>(value));
+    if (i - pos - 1 < value_count) values[i - pos - 1] = static_cast<uint8_t>(value);
   }
-  Encoding result = verify_checksum(hrp, values);
-  if (result == Encoding::INVALID) return {};
-  return { result, std::move(hrp), data(values.begin(), values.end() - kChecksumLength) };
+  Encoding result = Encoding::INVALID;
+  if (c == encoding_constant(Encoding::BECH32)) result = Encoding::BECH32;
+  if (c == encoding_constant(Encoding::BECH32M)) result = Encoding::BECH32M;
+  if (result == Encoding::INVALID) return result;
+  for (size_t i = 0; i < pos; ++i) hrp[i] = static_cast<char>(lc(str[i]));
+  hrp[pos] = '\0';
+  *in_out_value_count = value_count;
+  return result;
 }
 
 }
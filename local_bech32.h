@@ -1,9 +1,7 @@
 #ifndef __LOCAL_BECH32_H_
 #define __LOCAL_BECH32_H_
 
-#include <string>
-#include <tuple>
-#include <vector>
+#include <stddef.h>
 #include <stdint.h>
 
 namespace bech32 {
@@ -14,20 +12,20 @@ enum class Encoding {
   BECH32M,
 };
 
-std::string encode(const std::string& hrp, const std::vector<uint8_t>& values, Encoding encoding);
+constexpr size_t kMaximumTextLength = 90;
+constexpr size_t kChecksumLength = 6;
 
-struct DecodeResult {
-  Encoding encoding;
-  std::string hrp;
-  std::vector<uint8_t> data;
+// Writes hrp, the separator, the 5-bit values and the checksum as a
+// NUL-terminated string. Returns the text length, or 0 if the input is
+// invalid or out_size is too small. Nothing is allocated.
+size_t encode(char *out, size_t out_size, const char *hrp, const uint8_t *values,
+              size_t value_count, Encoding encoding);
 
-  DecodeResult()
-    : encoding(Encoding::INVALID) {}
-  DecodeResult(Encoding enc, std::string&& h, std::vector<uint8_t>&& d)
-    : encoding(enc), hrp(std::move(h)), data(std::move(d)) {}
-};
-
-DecodeResult decode(const std::string& str);
+// Decodes str into a lower-case NUL-terminated hrp and its 5-bit values
+// without the checksum. *in_out_value_count holds the capacity of values on
+// entry and the decoded count on success. Returns INVALID on any failure.
+Encoding decode(const char *str, char *hrp, size_t hrp_size, uint8_t *values,
+                size_t *in_out_value_count);
 
 }
 
@@ -0,0 +1,86 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "local_descriptor.h"
+
+namespace {
+
+// Position in this string is the symbol value: the low five bits feed the
+// polymod directly and the high bits are packed three characters at a time.
+constexpr char kInputCharset[] =
+    "0123456789()[],'/*abcdefgh@:$%{}"
+    "IJKLMNOPQRSTUVWXYZ&+-.;<=>?!^_|~"
+    "ijklmnopqrstuvwxyzABCDEFGH`#\"\\ ";
+constexpr char kChecksumCharset[] = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+constexpr uint64_t kGenerator[] = {
+    0xf5dee51989ULL, 0xa9fdca3312ULL, 0x1bab10e32dULL, 0x3706b1677aULL, 0x644d626ffdULL,
+};
+
+struct InputTable {
+  int8_t value[128];
+};
+
+constexpr InputTable make_input_table() {
+  InputTable table = {};
+  for (size_t index = 0; index < sizeof(table.value); ++index) table.value[index] = -1;
+  for (size_t index = 0; index < sizeof(kInputCharset) - 1; ++index) {
+    table.value[static_cast<unsigned char>(kInputCharset[index])] = static_cast<int8_t>(index);
+  }
+  return table;
+}
+
+constexpr InputTable kInputTable = make_input_table();
+
+uint64_t polymod_step(uint64_t checksum, uint8_t value) {
+  const uint8_t top = static_cast<uint8_t>(checksum >> 35);
+  checksum = ((checksum & 0x7ffffffffULL) << 5) ^ value;
+  for (size_t bit = 0; bit < 5; ++bit) {
+    if (((top >> bit) & 1U) != 0) checksum ^= kGenerator[bit];
+  }
+  return checksum;
+}
+
+}  // namespace
+
+bool local_descriptor_checksum(const char *descriptor,
+                               char out[kLocalDescriptorChecksumSize + 1]) {
+  if (descriptor == nullptr || out == nullptr) return false;
+  uint64_t checksum = 1;
+  uint8_t groups = 0;
+  uint8_t group_count = 0;
+  for (const char *cursor = descriptor; *cursor != '\0'; ++cursor) {
+    const unsigned char character = static_cast<unsigned char>(*cursor);
+    const int8_t value = character < sizeof(kInputTable.value) ? kInputTable.value[character] : -1;
+    if (value < 0) return false;
+    checksum = polymod_step(checksum, static_cast<uint8_t>(value & 31));
+    groups = static_cast<uint8_t>(groups * 3 + (value >> 5));
+    if (++group_count == 3) {
+      checksum = polymod_step(checksum, groups);
+      groups = 0;
+      group_count = 0;
+    }
+  }
+  if (group_count != 0) checksum = polymod_step(checksum, groups);
+  for (size_t index = 0; index < kLocalDescriptorChecksumSize; ++index) {
+    checksum = polymod_step(checksum, 0);
+  }
+  checksum ^= 1;
+  for (size_t index = 0; index < kLocalDescriptorChecksumSize; ++index) {
+    out[index] = kChecksumCharset[(checksum >> (5 * (7 - index))) & 31];
+  }
+  out[kLocalDescriptorChecksumSize] = '\0';
+  return true;
+}
+
+bool local_descriptor_append_checksum(char *descriptor, size_t out_size) {
+  if (descriptor == nullptr) return false;
+  const size_t length = strnlen(descriptor, out_size);
+  char checksum[kLocalDescriptorChecksumSize + 1];
+  if (length + 1 + kLocalDescriptorChecksumSize >= out_size ||
+      !local_descriptor_checksum(descriptor, checksum)) {
+    return false;
+  }
+  descriptor[length] = '#';
+  memcpy(descriptor + length + 1, checksum, sizeof(checksum));
+  return true;
+}
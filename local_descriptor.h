@@ -0,0 +1,18 @@
+#ifndef HEXWALLET_LOCAL_DESCRIPTOR_H
+#define HEXWALLET_LOCAL_DESCRIPTOR_H
+
+#include <stddef.h>
+
+constexpr size_t kLocalDescriptorChecksumSize = 8;
+
+// Writes the BIP380 output descriptor checksum of descriptor, which must not
+// already carry one, as eight NUL-terminated characters. Fails on characters
+// outside the descriptor character set.
+bool local_descriptor_checksum(const char *descriptor,
+                               char out[kLocalDescriptorChecksumSize + 1]);
+
+// Appends '#' and the checksum to the NUL-terminated descriptor held in a
+// buffer of out_size bytes. Leaves the text unchanged on failure.
+bool local_descriptor_append_checksum(char *descriptor, size_t out_size);
+
+#endif
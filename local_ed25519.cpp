@@ -0,0 +1,933 @@
+#include <string.h>
+
+#include "local_ed25519.h"
+#include "local_ed25519_table.h"
+
+namespace {
+
+constexpr size_t kLimbs = 10;
+constexpr size_t kWindows = 32;
+constexpr size_t kWindowDigits = 8;
+constexpr size_t kScalarDigits = 2 * kLocalEd25519ScalarSize;
+constexpr size_t kScalarLimbs = 13;
+constexpr unsigned kScalarLimbBits = 21;
+constexpr int64_t kScalarLimbMask = (int64_t{1} << kScalarLimbBits) - 1;
+constexpr size_t kProductLimbs = 24;
+
+// Limb i holds 26 bits when i is even and 25 when it is odd, so its weight is
+// 2^ceil(25.5 * i) and ten limbs span exactly 2^255. Limbs are signed and only
+// loosely reduced between operations; field_to_bytes() is canonical. Field and
+// group helpers leave their temporaries to the next call's stack frame; the
+// scalar-dependent state is wiped where the multiply and encoding finish.
+struct Field {
+  int32_t v[kLimbs];
+};
+
+// Extended coordinates: x = X / Z, y = Y / Z and x * y = T / Z.
+struct Point {
+  Field x;
+  Field y;
+  Field z;
+  Field t;
+};
+
+// The result of an addition or doubling before its final multiplications:
+// x = X / Z and y = Y / T.
+struct Completed {
+  Field x;
+  Field y;
+  Field z;
+  Field t;
+};
+
+// Projective coordinates, which is all a doubling reads.
+struct Projective {
+  Field x;
+  Field y;
+  Field z;
+};
+
+// A table entry: y + x, y - x and 2 * d * x * y of an affine point.
+struct Precomputed {
+  Field y_plus_x;
+  Field y_minus_x;
+  Field xy2d;
+};
+
+// An addend in extended coordinates: Y + X, Y - X, Z and 2 * d * T.
+struct Cached {
+  Field y_plus_x;
+  Field y_minus_x;
+  Field z;
+  Field t2d;
+};
+
+// l = 2^252 + 27742317777372353535851937790883648493, little endian.
+constexpr uint8_t kOrder[kLocalEd25519ScalarSize] = {
+    0xed,0xd3,0xf5,0x5c,0x1a,0x63,0x12,0x58,0xd6,0x9c,0xf7,0xa2,0xde,0xf9,0xde,0x14,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,
+};
+
+// 2^252 mod l as six signed 21-bit limbs, so limb k >= 12 of a scalar folds
+// into limbs k - 12 to k - 7.
+constexpr int64_t kOrderFold[6] = {666643, 470296, 654183, -997805, 136657, -683901};
+
+// d = -121665 / 121666, 2 * d and a square root of -1 mod p.
+constexpr Field kCurveD = {{56195235, 13857412, 51736253, 6949390, 114729,
+                            24766616, 60832955, 30306712, 48412415, 21499315}};
+constexpr Field kCurveD2 = {{45281625, 27714825, 36363642, 13898781, 229458,
+                             15978800, 54557047, 27058993, 29715967, 9444199}};
+constexpr Field kSqrtMinusOne = {{34513072, 25610706, 9377949, 3500415, 12389472,
+                                  33281959, 41962654, 31548777, 326685, 11406482}};
+
+void wipe(void *data, size_t size) {
+  volatile uint8_t *bytes = static_cast<volatile uint8_t *>(data);
+  while (size-- != 0) *bytes++ = 0;
+}
+
+// Masks are all ones when the condition holds and zero otherwise.
+uint32_t mask_from_bit(uint32_t bit) {
+  return 0U - bit;
+}
+
+uint32_t mask_equal(uint32_t left, uint32_t right) {
+  const uint32_t difference = left ^ right;
+  return ((difference | (0U - difference)) >> 31) - 1U;
+}
+
+unsigned limb_bits(size_t index) {
+  return (index & 1) != 0 ? 25 : 26;
+}
+
+void limbs_cmov(int32_t *out, const int32_t *in, uint32_t mask) {
+  const int32_t select = static_cast<int32_t>(mask);
+  for (size_t index = 0; index < kLimbs; ++index) out[index] ^= (out[index] ^ in[index]) & select;
+}
+
+// ---- Field arithmetic mod p = 2^255 - 19 ----
+
+void field_set_small(Field *out, int32_t value) {
+  memset(out, 0, sizeof(*out));
+  out->v[0] = value;
+}
+
+void field_add(Field *out, const Field &left, const Field &right) {
+  for (size_t index = 0; index < kLimbs; ++index) out->v[index] = left.v[index] + right.v[index];
+}
+
+void field_sub(Field *out, const Field &left, const Field &right) {
+  for (size_t index = 0; index < kLimbs; ++index) out->v[index] = left.v[index] - right.v[index];
+}
+
+void field_negate(Field *out, const Field &value) {
+  for (size_t index = 0; index < kLimbs; ++index) out->v[index] = -value.v[index];
+}
+
+// Moves the rounded excess of limb index into the next limb; 2^255 wraps to
+// limb 0 as 19.
+void carry_limb(int64_t wide[kLimbs], size_t index) {
+  const unsigned bits = limb_bits(index);
+  const int64_t carry = (wide[index] + (int64_t{1} << (bits - 1))) >> bits;
+  wide[index] -= carry * (int64_t{1} << bits);
+  if (index + 1 == kLimbs) {
+    wide[0] += carry * 19;
+  } else {
+    wide[index + 1] += carry;
+  }
+}
+
+// Carries in two interleaved chains so each step's input is already small,
+// leaving every limb within about one bit of its width.
+void field_carry(Field *out, int64_t wide[kLimbs]) {
+  carry_limb(wide, 0);
+  carry_limb(wide, 4);
+  carry_limb(wide, 1);
+  carry_limb(wide, 5);
+  carry_limb(wide, 2);
+  carry_limb(wide, 6);
+  carry_limb(wide, 3);
+  carry_limb(wide, 7);
+  carry_limb(wide, 4);
+  carry_limb(wide, 8);
+  carry_limb(wide, 9);
+  carry_limb(wide, 0);
+  for (size_t index = 0; index < kLimbs; ++index) out->v[index] = static_cast<int32_t>(wide[index]);
+}
+
+int64_t wide_mul(int32_t left, int32_t right) {
+  return int64_t{left} * right;
+}
+
+// Products of two odd limbs gain a factor of two, since both weights round up
+// by half a bit, and products past 2^255 wrap with a factor of 19. Spelled out
+// term by term as in ref10, which 32-bit cores run as single 32x32->64
+// multiplies without loop overhead.
+void field_mul(Field *out, const Field &left, const Field &right) {
+  const int32_t f0 = left.v[0], f1 = left.v[1], f2 = left.v[2], f3 = left.v[3], f4 = left.v[4],
+      f5 = left.v[5], f6 = left.v[6], f7 = left.v[7], f8 = left.v[8], f9 = left.v[9];
+  const int32_t g0 = right.v[0], g1 = right.v[1], g2 = right.v[2], g3 = right.v[3], g4 = right.v[4],
+      g5 = right.v[5], g6 = right.v[6], g7 = right.v[7], g8 = right.v[8], g9 = right.v[9];
+  const int32_t f1_2 = 2 * f1, f3_2 = 2 * f3, f5_2 = 2 * f5, f7_2 = 2 * f7, f9_2 = 2 * f9;
+  const int32_t g1_19 = 19 * g1, g2_19 = 19 * g2, g3_19 = 19 * g3, g4_19 = 19 * g4, g5_19 = 19 * g5,
+      g6_19 = 19 * g6, g7_19 = 19 * g7, g8_19 = 19 * g8, g9_19 = 19 * g9;
+  const int64_t h0 = wide_mul(f0, g0) + wide_mul(f1_2, g9_19) + wide_mul(f2, g8_19) +
+      wide_mul(f3_2, g7_19) + wide_mul(f4, g6_19) + wide_mul(f5_2, g5_19) + wide_mul(f6, g4_19) +
+      wide_mul(f7_2, g3_19) + wide_mul(f8, g2_19) + wide_mul(f9_2, g1_19);
+  const int64_t h1 = wide_mul(f0, g1) + wide_mul(f1, g0) + wide_mul(f2, g9_19) +
+      wide_mul(f3, g8_19) + wide_mul(f4, g7_19) + wide_mul(f5, g6_19) + wide_mul(f6, g5_19) +
+      wide_mul(f7, g4_19) + wide_mul(f8, g3_19) + wide_mul(f9, g2_19);
+  const int64_t h2 = wide_mul(f0, g2) + wide_mul(f1_2, g1) + wide_mul(f2, g0) +
+      wide_mul(f3_2, g9_19) + wide_mul(f4, g8_19) + wide_mul(f5_2, g7_19) + wide_mul(f6, g6_19) +
+      wide_mul(f7_2, g5_19) + wide_mul(f8, g4_19) + wide_mul(f9_2, g3_19);
+  const int64_t h3 = wide_mul(f0, g3) + wide_mul(f1, g2) + wide_mul(f2, g1) + wide_mul(f3, g0) +
+      wide_mul(f4, g9_19) + wide_mul(f5, g8_19) + wide_mul(f6, g7_19) + wide_mul(f7, g6_19) +
+      wide_mul(f8, g5_19) + wide_mul(f9, g4_19);
+  const int64_t h4 = wide_mul(f0, g4) + wide_mul(f1_2, g3) + wide_mul(f2, g2) + wide_mul(f3_2, g1) +
+      wide_mul(f4, g0) + wide_mul(f5_2, g9_19) + wide_mul(f6, g8_19) + wide_mul(f7_2, g7_19) +
+      wide_mul(f8, g6_19) + wide_mul(f9_2, g5_19);
+  const int64_t h5 = wide_mul(f0, g5) + wide_mul(f1, g4) + wide_mul(f2, g3) + wide_mul(f3, g2) +
+      wide_mul(f4, g1) + wide_mul(f5, g0) + wide_mul(f6, g9_19) + wide_mul(f7, g8_19) +
+      wide_mul(f8, g7_19) + wide_mul(f9, g6_19);
+  const int64_t h6 = wide_mul(f0, g6) + wide_mul(f1_2, g5) + wide_mul(f2, g4) + wide_mul(f3_2, g3) +
+      wide_mul(f4, g2) + wide_mul(f5_2, g1) + wide_mul(f6, g0) + wide_mul(f7_2, g9_19) +
+      wide_mul(f8, g8_19) + wide_mul(f9_2, g7_19);
+  const int64_t h7 = wide_mul(f0, g7) + wide_mul(f1, g6) + wide_mul(f2, g5) + wide_mul(f3, g4) +
+      wide_mul(f4, g3) + wide_mul(f5, g2) + wide_mul(f6, g1) + wide_mul(f7, g0) +
+      wide_mul(f8, g9_19) + wide_mul(f9, g8_19);
+  const int64_t h8 = wide_mul(f0, g8) + wide_mul(f1_2, g7) + wide_mul(f2, g6) + wide_mul(f3_2, g5) +
+      wide_mul(f4, g4) + wide_mul(f5_2, g3) + wide_mul(f6, g2) + wide_mul(f7_2, g1) +
+      wide_mul(f8, g0) + wide_mul(f9_2, g9_19);
+  const int64_t h9 = wide_mul(f0, g9) + wide_mul(f1, g8) + wide_mul(f2, g7) + wide_mul(f3, g6) +
+      wide_mul(f4, g5) + wide_mul(f5, g4) + wide_mul(f6, g3) + wide_mul(f7, g2) + wide_mul(f8, g1) +
+      wide_mul(f9, g0);
+  int64_t wide[kLimbs] = {h0, h1, h2, h3, h4, h5, h6, h7, h8, h9};
+  field_carry(out, wide);
+}
+
+// The square's uncarried limbs, each cross product counted once and doubled.
+void field_sqr_wide(int64_t wide[kLimbs], const Field &value) {
+  const int32_t f0 = value.v[0], f1 = value.v[1], f2 = value.v[2], f3 = value.v[3], f4 = value.v[4],
+      f5 = value.v[5], f6 = value.v[6], f7 = value.v[7], f8 = value.v[8], f9 = value.v[9];
+  const int32_t f0_2 = 2 * f0, f1_2 = 2 * f1, f2_2 = 2 * f2, f3_2 = 2 * f3, f4_2 = 2 * f4,
+      f5_2 = 2 * f5, f6_2 = 2 * f6, f7_2 = 2 * f7, f8_2 = 2 * f8, f9_2 = 2 * f9;
+  const int32_t f5_19 = 19 * f5, f6_19 = 19 * f6, f7_19 = 19 * f7, f8_19 = 19 * f8, f9_19 = 19 * f9;
+  const int32_t f7_38 = 38 * f7, f9_38 = 38 * f9;
+  const int64_t h0 = wide_mul(f0, f0) + wide_mul(f1_2, f9_38) + wide_mul(f2_2, f8_19) +
+      wide_mul(f3_2, f7_38) + wide_mul(f4_2, f6_19) + wide_mul(f5_2, f5_19);
+  const int64_t h1 = wide_mul(f0_2, f1) + wide_mul(f2_2, f9_19) + wide_mul(f3_2, f8_19) +
+      wide_mul(f4_2, f7_19) + wide_mul(f5_2, f6_19);
+  const int64_t h2 = wide_mul(f0_2, f2) + wide_mul(f1_2, f1) + wide_mul(f3_2, f9_38) +
+      wide_mul(f4_2, f8_19) + wide_mul(f5_2, f7_38) + wide_mul(f6, f6_19);
+  const int64_t h3 = wide_mul(f0_2, f3) + wide_mul(f1_2, f2) + wide_mul(f4_2, f9_19) +
+      wide_mul(f5_2, f8_19) + wide_mul(f6_2, f7_19);
+  const int64_t h4 = wide_mul(f0_2, f4) + wide_mul(f1_2, f3_2) + wide_mul(f2, f2) +
+      wide_mul(f5_2, f9_38) + wide_mul(f6_2, f8_19) + wide_mul(f7_2, f7_19);
+  const int64_t h5 = wide_mul(f0_2, f5) + wide_mul(f1_2, f4) + wide_mul(f2_2, f3) +
+      wide_mul(f6_2, f9_19) + wide_mul(f7_2, f8_19);
+  const int64_t h6 = wide_mul(f0_2, f6) + wide_mul(f1_2, f5_2) + wide_mul(f2_2, f4) +
+      wide_mul(f3_2, f3) + wide_mul(f7_2, f9_38) + wide_mul(f8, f8_19);
+  const int64_t h7 = wide_mul(f0_2, f7) + wide_mul(f1_2, f6) + wide_mul(f2_2, f5) +
+      wide_mul(f3_2, f4) + wide_mul(f8_2, f9_19);
+  const int64_t h8 = wide_mul(f0_2, f8) + wide_mul(f1_2, f7_2) + wide_mul(f2_2, f6) +
+      wide_mul(f3_2, f5_2) + wide_mul(f4, f4) + wide_mul(f9_2, f9_19);
+  const int64_t h9 = wide_mul(f0_2, f9) + wide_mul(f1_2, f8) + wide_mul(f2_2, f7) +
+      wide_mul(f3_2, f6) + wide_mul(f4_2, f5);
+  const int64_t limbs[kLimbs] = {h0, h1, h2, h3, h4, h5, h6, h7, h8, h9};
+  memcpy(wide, limbs, sizeof(limbs));
+}
+
+void field_sqr(Field *out, const Field &value) {
+  int64_t wide[kLimbs];
+  field_sqr_wide(wide, value);
+  field_carry(out, wide);
+}
+
+// out = 2 * value^2, doubled before the carry so the result stays small.
+void field_sqr2(Field *out, const Field &value) {
+  int64_t wide[kLimbs];
+  field_sqr_wide(wide, value);
+  for (int64_t &limb : wide) limb *= 2;
+  field_carry(out, wide);
+}
+
+void field_sqr_times(Field *out, const Field &value, size_t count) {
+  field_sqr(out, value);
+  while (--count != 0) field_sqr(out, *out);
+}
+
+// value^(2^250 - 1), the shared head of the inversion and square root
+// chains, which also leave value^11 in z11.
+void field_pow_250(Field *out, Field *z11, const Field &value) {
+  Field z2;
+  Field z9;
+  Field chain;
+  Field step;
+  field_sqr(&z2, value);
+  field_sqr_times(&step, z2, 2);
+  field_mul(&z9, step, value);
+  field_mul(z11, z9, z2);
+  field_sqr(&step, *z11);
+  field_mul(&chain, step, z9);                 // 2^5 - 1
+  field_sqr_times(&step, chain, 5);
+  field_mul(&chain, step, chain);              // 2^10 - 1
+  Field chain10 = chain;
+  field_sqr_times(&step, chain, 10);
+  field_mul(&chain, step, chain);              // 2^20 - 1
+  field_sqr_times(&step, chain, 20);
+  field_mul(&chain, step, chain);              // 2^40 - 1
+  field_sqr_times(&step, chain, 10);
+  field_mul(&chain, step, chain10);            // 2^50 - 1
+  Field chain50 = chain;
+  field_sqr_times(&step, chain, 50);
+  field_mul(&chain, step, chain);              // 2^100 - 1
+  field_sqr_times(&step, chain, 100);
+  field_mul(&chain, step, chain);              // 2^200 - 1
+  field_sqr_times(&step, chain, 50);
+  field_mul(out, step, chain50);               // 2^250 - 1
+  wipe(&z2, sizeof(z2));
+  wipe(&z9, sizeof(z9));
+  wipe(&chain, sizeof(chain));
+  wipe(&chain10, sizeof(chain10));
+  wipe(&chain50, sizeof(chain50));
+  wipe(&step, sizeof(step));
+}
+
+// value^(p - 2) with 254 squarings and 11 multiplications.
+void field_invert(Field *out, const Field &value) {
+  Field z11;
+  Field chain;
+  field_pow_250(&chain, &z11, value);
+  field_sqr_times(&chain, chain, 5);
+  field_mul(out, chain, z11);                  // 2^255 - 21
+  wipe(&z11, sizeof(z11));
+  wipe(&chain, sizeof(chain));
+}
+
+// value^((p - 5) / 8), the exponent of the square root in point_decode().
+void field_pow22523(Field *out, const Field &value) {
+  Field z11;
+  Field chain;
+  field_pow_250(&chain, &z11, value);
+  field_sqr_times(&chain, chain, 2);
+  field_mul(out, chain, value);                // 2^252 - 3
+  wipe(&z11, sizeof(z11));
+  wipe(&chain, sizeof(chain));
+}
+
+// Canonical little-endian encoding of a carried field element.
+void field_to_bytes(uint8_t out[kLocalEd25519PointSize], const Field &value) {
+  int32_t limbs[kLimbs];
+  memcpy(limbs, value.v, sizeof(limbs));
+  // quotient is 1 exactly when the value is at least p, so subtracting
+  // quotient * p leaves it in [0, p).
+  int32_t quotient = (19 * limbs[kLimbs - 1] + (1 << 24)) >> 25;
+  for (size_t index = 0; index < kLimbs; ++index) {
+    quotient = (limbs[index] + quotient) >> limb_bits(index);
+  }
+  limbs[0] += 19 * quotient;
+  for (size_t index = 0; index < kLimbs; ++index) {
+    const unsigned bits = limb_bits(index);
+    const int32_t carry = limbs[index] >> bits;
+    limbs[index] -= carry * (int32_t{1} << bits);
+    if (index + 1 < kLimbs) limbs[index + 1] += carry;
+  }
+  uint64_t pending = 0;
+  unsigned pending_bits = 0;
+  size_t written = 0;
+  for (size_t index = 0; index < kLimbs; ++index) {
+    pending |= static_cast<uint64_t>(static_cast<uint32_t>(limbs[index])) << pending_bits;
+    pending_bits += limb_bits(index);
+    for (; pending_bits >= 8; pending_bits -= 8, pending >>= 8) {
+      out[written++] = static_cast<uint8_t>(pending);
+    }
+  }
+  out[written] = static_cast<uint8_t>(pending);
+  wipe(limbs, sizeof(limbs));
+  wipe(&pending, sizeof(pending));
+}
+
+// Reads 255 bits; the top bit of the last byte is left to the caller.
+void field_from_bytes(Field *out, const uint8_t bytes[kLocalEd25519PointSize]) {
+  uint64_t pending = 0;
+  unsigned pending_bits = 0;
+  size_t read = 0;
+  for (size_t index = 0; index < kLimbs; ++index) {
+    const unsigned bits = limb_bits(index);
+    while (pending_bits < bits) {
+      const uint8_t byte = read + 1 == kLocalEd25519PointSize ? bytes[read] & 0x7fU : bytes[read];
+      pending |= static_cast<uint64_t>(byte) << pending_bits;
+      pending_bits += 8;
+      ++read;
+    }
+    out->v[index] = static_cast<int32_t>(pending & ((uint64_t{1} << bits) - 1));
+    pending >>= bits;
+    pending_bits -= bits;
+  }
+}
+
+bool field_is_zero(const Field &value) {
+  uint8_t bytes[kLocalEd25519PointSize];
+  field_to_bytes(bytes, value);
+  uint8_t any = 0;
+  for (uint8_t byte : bytes) any |= byte;
+  return any == 0;
+}
+
+// The sign of x in a point encoding: the low bit of its canonical form.
+bool field_is_negative(const Field &value) {
+  uint8_t bytes[kLocalEd25519PointSize];
+  field_to_bytes(bytes, value);
+  return (bytes[0] & 1U) != 0;
+}
+
+// ---- Group arithmetic ----
+// The twisted Edwards formulas of Hisil, Wong, Carter and Dawson (2008) as
+// arranged in ref10. With a = -1 and a non-square d they are complete, so
+// identity and doubling inputs take the same path as any other addition.
+
+void point_set_identity(Point *out) {
+  field_set_small(&out->x, 0);
+  field_set_small(&out->y, 1);
+  field_set_small(&out->z, 1);
+  field_set_small(&out->t, 0);
+}
+
+void point_from_completed(Point *out, const Completed &in) {
+  field_mul(&out->x, in.x, in.t);
+  field_mul(&out->y, in.y, in.z);
+  field_mul(&out->z, in.z, in.t);
+  field_mul(&out->t, in.x, in.y);
+}
+
+void projective_from_completed(Projective *out, const Completed &in) {
+  field_mul(&out->x, in.x, in.t);
+  field_mul(&out->y, in.y, in.z);
+  field_mul(&out->z, in.z, in.t);
+}
+
+void projective_double(Completed *out, const Projective &p) {
+  Field sum_square;
+  field_sqr(&out->x, p.x);
+  field_sqr(&out->z, p.y);
+  field_sqr2(&out->t, p.z);
+  field_add(&out->y, p.x, p.y);
+  field_sqr(&sum_square, out->y);
+  field_add(&out->y, out->z, out->x);
+  field_sub(&out->z, out->z, out->x);
+  field_sub(&out->x, sum_square, out->y);
+  field_sub(&out->t, out->t, out->z);
+}
+
+// out = p + q for a table entry q.
+void point_add_precomputed(Completed *out, const Point &p, const Precomputed &q) {
+  Field z2;
+  field_add(&out->x, p.y, p.x);
+  field_sub(&out->y, p.y, p.x);
+  field_mul(&out->z, out->x, q.y_plus_x);
+  field_mul(&out->y, out->y, q.y_minus_x);
+  field_mul(&out->t, q.xy2d, p.t);
+  field_add(&z2, p.z, p.z);
+  field_sub(&out->x, out->z, out->y);
+  field_add(&out->y, out->z, out->y);
+  field_add(&out->z, z2, out->t);
+  field_sub(&out->t, z2, out->t);
+}
+
+void point_to_cached(Cached *out, const Point &p) {
+  field_add(&out->y_plus_x, p.y, p.x);
+  field_sub(&out->y_minus_x, p.y, p.x);
+  out->z = p.z;
+  field_mul(&out->t2d, p.t, kCurveD2);
+}
+
+// out = p + q.
+void point_add(Completed *out, const Point &p, const Cached &q) {
+  Field z2;
+  field_add(&out->x, p.y, p.x);
+  field_sub(&out->y, p.y, p.x);
+  field_mul(&out->z, out->x, q.y_plus_x);
+  field_mul(&out->y, out->y, q.y_minus_x);
+  field_mul(&out->t, q.t2d, p.t);
+  field_mul(&z2, p.z, q.z);
+  field_add(&z2, z2, z2);
+  field_sub(&out->x, out->z, out->y);
+  field_add(&out->y, out->z, out->y);
+  field_add(&out->z, z2, out->t);
+  field_sub(&out->t, z2, out->t);
+}
+
+// point = 16 * point, in four doublings that skip T until the last.
+void point_mul_16(Point *point) {
+  Completed doubled;
+  Projective projective;
+  projective.x = point->x;
+  projective.y = point->y;
+  projective.z = point->z;
+  for (size_t doubling = 0; doubling < 4; ++doubling) {
+    projective_double(&doubled, projective);
+    if (doubling < 3) projective_from_completed(&projective, doubled);
+  }
+  point_from_completed(point, doubled);
+  wipe(&doubled, sizeof(doubled));
+  wipe(&projective, sizeof(projective));
+}
+
+// Decodes a point encoding, which must be canonical and on the curve. Public
+// keys only, so it runs in variable time: x is recovered from
+// x^2 = (y^2 - 1) / (d * y^2 + 1) as in ref10's ge_frombytes_negate_vartime().
+bool point_decode(Point *out, const uint8_t encoding[kLocalEd25519PointSize]) {
+  Field one;
+  Field u;
+  Field v;
+  Field v3;
+  Field check;
+  uint8_t canonical[kLocalEd25519PointSize];
+  field_set_small(&one, 1);
+  field_from_bytes(&out->y, encoding);
+  field_to_bytes(canonical, out->y);
+  canonical[kLocalEd25519PointSize - 1] |= encoding[kLocalEd25519PointSize - 1] & 0x80U;
+  if (memcmp(canonical, encoding, kLocalEd25519PointSize) != 0) return false;
+  field_set_small(&out->z, 1);
+  field_sqr(&u, out->y);
+  field_mul(&v, u, kCurveD);
+  field_sub(&u, u, one);
+  field_add(&v, v, one);
+  // x = u * v^3 * (u * v^7)^((p - 5) / 8), a square root of u / v up to a
+  // factor of sqrt(-1).
+  field_sqr(&v3, v);
+  field_mul(&v3, v3, v);
+  field_sqr(&out->x, v3);
+  field_mul(&out->x, out->x, v);
+  field_mul(&out->x, out->x, u);
+  field_pow22523(&out->x, out->x);
+  field_mul(&out->x, out->x, v3);
+  field_mul(&out->x, out->x, u);
+  field_sqr(&check, out->x);
+  field_mul(&check, check, v);
+  field_sub(&v3, check, u);
+  if (!field_is_zero(v3)) {
+    field_add(&v3, check, u);
+    if (!field_is_zero(v3)) return false;
+    field_mul(&out->x, out->x, kSqrtMinusOne);
+  }
+  const bool negative = (encoding[kLocalEd25519PointSize - 1] & 0x80U) != 0;
+  if (negative && field_is_zero(out->x)) return false;
+  if (field_is_negative(out->x) != negative) field_negate(&out->x, out->x);
+  field_mul(&out->t, out->x, out->y);
+  return true;
+}
+
+// Loads digit * 256^window * B for a digit in [-8, 8], reading every entry of
+// the window so the access pattern does not depend on the digit.
+void select_base_entry(Precomputed *out, size_t window, int32_t digit) {
+  const uint32_t negative = static_cast<uint32_t>(digit) >> 31;
+  const uint32_t magnitude = (static_cast<uint32_t>(digit) ^ mask_from_bit(negative)) + negative;
+  field_set_small(&out->y_plus_x, 1);
+  field_set_small(&out->y_minus_x, 1);
+  field_set_small(&out->xy2d, 0);
+  for (size_t entry = 0; entry < kWindowDigits; ++entry) {
+    const uint32_t mask = mask_equal(magnitude, static_cast<uint32_t>(entry + 1));
+    limbs_cmov(out->y_plus_x.v, kLocalEd25519BaseTable[window][entry][0], mask);
+    limbs_cmov(out->y_minus_x.v, kLocalEd25519BaseTable[window][entry][1], mask);
+    limbs_cmov(out->xy2d.v, kLocalEd25519BaseTable[window][entry][2], mask);
+  }
+  // -(x, y) is (-x, y), which swaps y + x with y - x and negates 2dxy.
+  Precomputed negated;
+  negated.y_plus_x = out->y_minus_x;
+  negated.y_minus_x = out->y_plus_x;
+  field_negate(&negated.xy2d, out->xy2d);
+  const uint32_t mask = mask_from_bit(negative);
+  limbs_cmov(out->y_plus_x.v, negated.y_plus_x.v, mask);
+  limbs_cmov(out->y_minus_x.v, negated.y_minus_x.v, mask);
+  limbs_cmov(out->xy2d.v, negated.xy2d.v, mask);
+}
+
+// Splits scalar < 2^255 into 64 signed radix-16 digits in [-8, 8].
+void scalar_recode(int8_t digits[kScalarDigits], const uint8_t scalar[kLocalEd25519ScalarSize]) {
+  for (size_t index = 0; index < kLocalEd25519ScalarSize; ++index) {
+    digits[2 * index] = static_cast<int8_t>(scalar[index] & 15U);
+    digits[2 * index + 1] = static_cast<int8_t>(scalar[index] >> 4);
+  }
+  int8_t carry = 0;
+  for (size_t index = 0; index + 1 < kScalarDigits; ++index) {
+    digits[index] = static_cast<int8_t>(digits[index] + carry);
+    carry = static_cast<int8_t>((digits[index] + 8) >> 4);
+    digits[index] = static_cast<int8_t>(digits[index] - carry * 16);
+  }
+  digits[kScalarDigits - 1] = static_cast<int8_t>(digits[kScalarDigits - 1] + carry);
+  wipe(&carry, sizeof(carry));
+}
+
+// scalar * B for scalar < 2^255. Odd digits are summed first and scaled by
+// 16, so the 256^window table serves both halves: 64 table additions and four
+// doublings.
+void point_mul_base(Point *out, const uint8_t scalar[kLocalEd25519ScalarSize]) {
+  int8_t digits[kScalarDigits];
+  scalar_recode(digits, scalar);
+  Precomputed entry;
+  Completed sum;
+  point_set_identity(out);
+  for (size_t index = 1; index < kScalarDigits; index += 2) {
+    select_base_entry(&entry, index / 2, digits[index]);
+    point_add_precomputed(&sum, *out, entry);
+    point_from_completed(out, sum);
+  }
+  point_mul_16(out);
+  for (size_t index = 0; index < kScalarDigits; index += 2) {
+    select_base_entry(&entry, index / 2, digits[index]);
+    point_add_precomputed(&sum, *out, entry);
+    point_from_completed(out, sum);
+  }
+  wipe(digits, sizeof(digits));
+  wipe(&entry, sizeof(entry));
+  wipe(&sum, sizeof(sum));
+}
+
+// Loads digit * p from table[k] = (k + 1) * p for a digit in [-8, 8], in
+// constant time like select_base_entry().
+void select_cached(Cached *out, const Cached table[kWindowDigits], int32_t digit) {
+  const uint32_t negative = static_cast<uint32_t>(digit) >> 31;
+  const uint32_t magnitude = (static_cast<uint32_t>(digit) ^ mask_from_bit(negative)) + negative;
+  field_set_small(&out->y_plus_x, 1);
+  field_set_small(&out->y_minus_x, 1);
+  field_set_small(&out->z, 1);
+  field_set_small(&out->t2d, 0);
+  for (size_t entry = 0; entry < kWindowDigits; ++entry) {
+    const uint32_t mask = mask_equal(magnitude, static_cast<uint32_t>(entry + 1));
+    limbs_cmov(out->y_plus_x.v, table[entry].y_plus_x.v, mask);
+    limbs_cmov(out->y_minus_x.v, table[entry].y_minus_x.v, mask);
+    limbs_cmov(out->z.v, table[entry].z.v, mask);
+    limbs_cmov(out->t2d.v, table[entry].t2d.v, mask);
+  }
+  Cached negated;
+  negated.y_plus_x = out->y_minus_x;
+  negated.y_minus_x = out->y_plus_x;
+  field_negate(&negated.t2d, out->t2d);
+  const uint32_t mask = mask_from_bit(negative);
+  limbs_cmov(out->y_plus_x.v, negated.y_plus_x.v, mask);
+  limbs_cmov(out->y_minus_x.v, negated.y_minus_x.v, mask);
+  limbs_cmov(out->t2d.v, negated.t2d.v, mask);
+  wipe(&negated, sizeof(negated));
+}
+
+// scalar * p for scalar < 2^255 and any point p, in constant time: the same
+// signed radix-16 digits over a table of p to 8p, with four doublings and one
+// addition per digit from the top.
+void point_mul(Point *out, const uint8_t scalar[kLocalEd25519ScalarSize], const Point &p) {
+  Cached table[kWindowDigits];
+  Completed sum;
+  Point multiple = p;
+  point_to_cached(&table[0], p);
+  for (size_t entry = 1; entry < kWindowDigits; ++entry) {
+    point_add(&sum, multiple, table[0]);
+    point_from_completed(&multiple, sum);
+    point_to_cached(&table[entry], multiple);
+  }
+  int8_t digits[kScalarDigits];
+  scalar_recode(digits, scalar);
+  Cached entry;
+  point_set_identity(out);
+  for (size_t index = kScalarDigits; index-- != 0;) {
+    if (index + 1 != kScalarDigits) point_mul_16(out);
+    select_cached(&entry, table, digits[index]);
+    point_add(&sum, *out, entry);
+    point_from_completed(out, sum);
+  }
+  wipe(table, sizeof(table));
+  wipe(&sum, sizeof(sum));
+  wipe(&multiple, sizeof(multiple));
+  wipe(digits, sizeof(digits));
+  wipe(&entry, sizeof(entry));
+}
+
+// Encodes X / Z, Y / Z given the inverse of Z.
+void projective_encode(uint8_t out[kLocalEd25519PointSize], const Projective &point,
+                       const Field &inverse) {
+  Field x;
+  Field y;
+  uint8_t x_bytes[kLocalEd25519PointSize];
+  field_mul(&x, point.x, inverse);
+  field_mul(&y, point.y, inverse);
+  field_to_bytes(out, y);
+  field_to_bytes(x_bytes, x);
+  out[kLocalEd25519PointSize - 1] |= static_cast<uint8_t>((x_bytes[0] & 1U) << 7);
+  wipe(&x, sizeof(x));
+  wipe(&y, sizeof(y));
+  wipe(x_bytes, sizeof(x_bytes));
+}
+
+void point_encode(uint8_t out[kLocalEd25519PointSize], const Point &point) {
+  Projective projective = {point.x, point.y, point.z};
+  Field inverse;
+  field_invert(&inverse, point.z);
+  projective_encode(out, projective, inverse);
+  wipe(&projective, sizeof(projective));
+  wipe(&inverse, sizeof(inverse));
+}
+
+// Encodes count points through one inversion: products[i] is the product of
+// the first i + 1 Z coordinates, and walking back from the inverse of the last
+// one peels off each point's own inverse.
+void projective_encode_batch(uint8_t *out, const Projective *points, Field *products,
+                             size_t count) {
+  products[0] = points[0].z;
+  for (size_t index = 1; index < count; ++index) {
+    field_mul(&products[index], products[index - 1], points[index].z);
+  }
+  Field inverse;
+  Field own;
+  field_invert(&inverse, products[count - 1]);
+  for (size_t index = count - 1; index != 0; --index) {
+    field_mul(&own, inverse, products[index - 1]);
+    field_mul(&inverse, inverse, points[index].z);
+    projective_encode(out + index * kLocalEd25519PointSize, points[index], own);
+  }
+  projective_encode(out, points[0], inverse);
+  wipe(&inverse, sizeof(inverse));
+  wipe(&own, sizeof(own));
+}
+
+// ---- Scalar arithmetic mod l ----
+// Scalars are reduced in 21-bit limbs, the shape of ref10's sc_reduce():
+// limb 12 sits at 2^252 and folds back through kOrderFold.
+
+void scalar_load(int64_t limbs[kScalarLimbs], const uint8_t bytes[kLocalEd25519ScalarSize]) {
+  uint64_t buffer = 0;
+  unsigned buffered = 0;
+  size_t byte = 0;
+  for (size_t index = 0; index < kScalarLimbs; ++index) {
+    while (buffered < kScalarLimbBits && byte < kLocalEd25519ScalarSize) {
+      buffer |= static_cast<uint64_t>(bytes[byte++]) << buffered;
+      buffered += 8;
+    }
+    limbs[index] = static_cast<int64_t>(buffer & kScalarLimbMask);
+    buffer >>= kScalarLimbBits;
+    buffered = buffered > kScalarLimbBits ? buffered - kScalarLimbBits : 0;
+  }
+  wipe(&buffer, sizeof(buffer));
+}
+
+// Writes limbs 0 to 11, which must be carried into [0, 2^21).
+void scalar_store(uint8_t out[kLocalEd25519ScalarSize], const int64_t limbs[kScalarLimbs]) {
+  uint64_t buffer = 0;
+  unsigned buffered = 0;
+  size_t byte = 0;
+  for (size_t index = 0; index + 1 < kScalarLimbs; ++index) {
+    buffer |= static_cast<uint64_t>(limbs[index]) << buffered;
+    buffered += kScalarLimbBits;
+    for (; buffered >= 8; buffered -= 8, buffer >>= 8) out[byte++] = static_cast<uint8_t>(buffer);
+  }
+  out[byte] = static_cast<uint8_t>(buffer);
+  wipe(&buffer, sizeof(buffer));
+}
+
+void scalar_fold(int64_t *limbs, size_t top) {
+  for (size_t index = 0; index < 6; ++index) limbs[top - 12 + index] += limbs[top] * kOrderFold[index];
+  limbs[top] = 0;
+}
+
+// Floor carries, so every limb below last ends up in [0, 2^21).
+void scalar_carry(int64_t *limbs, size_t last) {
+  for (size_t index = 0; index < last; ++index) {
+    limbs[index + 1] += limbs[index] >> kScalarLimbBits;
+    limbs[index] &= kScalarLimbMask;
+  }
+}
+
+// Moves the rounded excess of one limb into the next, leaving it in
+// [-2^20, 2^20).
+void scalar_carry_rounded(int64_t *limbs, size_t index) {
+  const int64_t carry = (limbs[index] + (int64_t{1} << (kScalarLimbBits - 1))) >> kScalarLimbBits;
+  limbs[index + 1] += carry;
+  limbs[index] -= carry * (int64_t{1} << kScalarLimbBits);
+}
+
+void scalar_carry_rounded_range(int64_t *limbs, size_t first, size_t last) {
+  for (size_t index = first; index <= last; index += 2) scalar_carry_rounded(limbs, index);
+}
+
+static_assert(kWindows * 2 == kScalarDigits, "one table window per pair of digits");
+
+}  // namespace
+
+bool local_ed25519_scalar_is_valid(const uint8_t scalar[kLocalEd25519ScalarSize]) {
+  if (scalar == nullptr) return false;
+  uint32_t borrow = 0;
+  uint32_t nonzero = 0;
+  for (size_t index = 0; index < kLocalEd25519ScalarSize; ++index) {
+    const uint32_t difference = static_cast<uint32_t>(scalar[index]) - kOrder[index] - borrow;
+    borrow = (difference >> 8) & 1U;
+    nonzero |= scalar[index];
+  }
+  return (borrow & mask_from_bit(nonzero != 0)) != 0;
+}
+
+void local_ed25519_scalar_reduce(const uint8_t input[kLocalEd25519ScalarSize],
+                                 uint8_t out[kLocalEd25519ScalarSize]) {
+  int64_t limbs[kScalarLimbs];
+  scalar_load(limbs, input);
+  // The first fold leaves a value in (-2^252, 2^252), whose limb 12 is 0 or
+  // -1; the second brings it into [0, l).
+  scalar_fold(limbs, 12);
+  scalar_carry(limbs, kScalarLimbs - 1);
+  scalar_fold(limbs, 12);
+  scalar_carry(limbs, kScalarLimbs - 2);
+  scalar_store(out, limbs);
+  wipe(limbs, sizeof(limbs));
+}
+
+// The product in 24 limbs, then ref10's sc_muladd() sequence: rounded carries
+// keep each limb near 21 bits before every group of folds, from limb 23 down.
+void local_ed25519_scalar_mul(const uint8_t left[kLocalEd25519ScalarSize],
+                              const uint8_t right[kLocalEd25519ScalarSize],
+                              uint8_t out[kLocalEd25519ScalarSize]) {
+  int64_t a[kScalarLimbs];
+  int64_t b[kScalarLimbs];
+  int64_t product[kProductLimbs] = {};
+  scalar_load(a, left);
+  scalar_load(b, right);
+  a[11] += a[12] * (int64_t{1} << kScalarLimbBits);
+  b[11] += b[12] * (int64_t{1} << kScalarLimbBits);
+  for (size_t i = 0; i < 12; ++i) {
+    for (size_t j = 0; j < 12; ++j) product[i + j] += a[i] * b[j];
+  }
+  scalar_carry_rounded_range(product, 0, 22);
+  scalar_carry_rounded_range(product, 1, 21);
+  for (size_t top = 23; top >= 18; --top) scalar_fold(product, top);
+  scalar_carry_rounded_range(product, 6, 16);
+  scalar_carry_rounded_range(product, 7, 15);
+  for (size_t top = 17; top >= 12; --top) scalar_fold(product, top);
+  scalar_carry_rounded_range(product, 0, 10);
+  scalar_carry_rounded_range(product, 1, 11);
+  scalar_fold(product, 12);
+  scalar_carry(product, 12);
+  scalar_fold(product, 12);
+  scalar_carry(product, 11);
+  scalar_store(out, product);
+  wipe(a, sizeof(a));
+  wipe(b, sizeof(b));
+  wipe(product, sizeof(product));
+}
+
+bool local_ed25519_public_key(const uint8_t scalar[kLocalEd25519ScalarSize],
+                              uint8_t out[kLocalEd25519PointSize]) {
+  if (scalar == nullptr || out == nullptr || (scalar[kLocalEd25519ScalarSize - 1] & 0x80U) != 0) {
+    return false;
+  }
+  Point point;
+  point_mul_base(&point, scalar);
+  point_encode(out, point);
+  wipe(&point, sizeof(point));
+  return true;
+}
+
+bool local_ed25519_tweak_base_init(LocalEd25519TweakBase *out,
+                                   const uint8_t public_key[kLocalEd25519PointSize],
+                                   const uint8_t scale[kLocalEd25519ScalarSize]) {
+  static_assert(sizeof(Cached) == sizeof(out->addends[0]), "addend layout");
+  if (out == nullptr || public_key == nullptr || !local_ed25519_scalar_is_valid(scale)) {
+    return false;
+  }
+  Point base;
+  if (!point_decode(&base, public_key)) return false;
+  // scale * (P + t * B) = scale * P + (scale * t) * B, so after this one
+  // variable-base multiply both keys are fixed-base multiplies plus an addition.
+  Point scaled_base;
+  Cached addend;
+  point_mul(&scaled_base, scale, base);
+  memcpy(out->scale, scale, kLocalEd25519ScalarSize);
+  point_to_cached(&addend, base);
+  memcpy(out->addends[0], &addend, sizeof(addend));
+  point_to_cached(&addend, scaled_base);
+  memcpy(out->addends[1], &addend, sizeof(addend));
+  wipe(&scaled_base, sizeof(scaled_base));
+  wipe(&addend, sizeof(addend));
+  return true;
+}
+
+bool local_ed25519_tweak_add_scale_batch(const LocalEd25519TweakBase &base,
+                                         const uint8_t *tweaks, size_t count,
+                                         uint8_t *out_tweaked, uint8_t *out_scaled) {
+  if (tweaks == nullptr || out_tweaked == nullptr || count == 0 || count > kLocalEd25519MaxBatch) {
+    return false;
+  }
+  for (size_t index = 0; index < count; ++index) {
+    if ((tweaks[index * kLocalEd25519ScalarSize + kLocalEd25519ScalarSize - 1] & 0x80U) != 0) {
+      return false;
+    }
+  }
+  Cached addends[2];
+  memcpy(addends, base.addends, sizeof(addends));
+  Projective points[2 * kLocalEd25519MaxBatch];
+  Field products[2 * kLocalEd25519MaxBatch];
+  uint8_t scaled_tweak[kLocalEd25519ScalarSize];
+  Point multiple;
+  Completed sum;
+  for (size_t index = 0; index < count; ++index) {
+    const uint8_t *tweak = tweaks + index * kLocalEd25519ScalarSize;
+    point_mul_base(&multiple, tweak);
+    point_add(&sum, multiple, addends[0]);
+    projective_from_completed(&points[index], sum);
+    if (out_scaled == nullptr) continue;
+    local_ed25519_scalar_mul(base.scale, tweak, scaled_tweak);
+    point_mul_base(&multiple, scaled_tweak);
+    point_add(&sum, multiple, addends[1]);
+    projective_from_completed(&points[count + index], sum);
+  }
+  uint8_t encodings[2 * kLocalEd25519MaxBatch * kLocalEd25519PointSize];
+  projective_encode_batch(encodings, points, products, out_scaled == nullptr ? count : 2 * count);
+  memcpy(out_tweaked, encodings, count * kLocalEd25519PointSize);
+  if (out_scaled != nullptr) {
+    memcpy(out_scaled, encodings + count * kLocalEd25519PointSize, count * kLocalEd25519PointSize);
+  }
+  wipe(addends, sizeof(addends));
+  wipe(points, sizeof(points));
+  wipe(products, sizeof(products));
+  wipe(scaled_tweak, sizeof(scaled_tweak));
+  wipe(&multiple, sizeof(multiple));
+  wipe(&sum, sizeof(sum));
+  wipe(encodings, sizeof(encodings));
+  return true;
+}
+
+bool local_ed25519_derivation_batch(const uint8_t scalar[kLocalEd25519ScalarSize],
+                                    const uint8_t *points, size_t count,
+                                    uint8_t *out, bool *out_valid) {
+  if (points == nullptr || out == nullptr || out_valid == nullptr || count == 0 ||
+      count > kLocalEd25519MaxBatch || !local_ed25519_scalar_is_valid(scalar)) {
+    return false;
+  }
+  Projective derivations[kLocalEd25519MaxBatch];
+  Field products[kLocalEd25519MaxBatch];
+  Point point;
+  Point product;
+  Completed doubled;
+  for (size_t index = 0; index < count; ++index) {
+    out_valid[index] = point_decode(&point, points + index * kLocalEd25519PointSize);
+    if (!out_valid[index]) {
+      // The identity keeps the shared inversion defined; its encoding is
+      // cleared below.
+      field_set_small(&derivations[index].x, 0);
+      field_set_small(&derivations[index].y, 1);
+      field_set_small(&derivations[index].z, 1);
+      continue;
+    }
+    point_mul(&product, scalar, point);
+    derivations[index] = {product.x, product.y, product.z};
+    // Clearing the cofactor takes three doublings, none of which needs T.
+    for (size_t doubling = 0; doubling < 3; ++doubling) {
+      projective_double(&doubled, derivations[index]);
+      projective_from_completed(&derivations[index], doubled);
+    }
+  }
+  projective_encode_batch(out, derivations, products, count);
+  for (size_t index = 0; index < count; ++index) {
+    if (!out_valid[index]) memset(out + index * kLocalEd25519PointSize, 0, kLocalEd25519PointSize);
+  }
+  wipe(derivations, sizeof(derivations));
+  wipe(products, sizeof(products));
+  wipe(&point, sizeof(point));
+  wipe(&product, sizeof(product));
+  wipe(&doubled, sizeof(doubled));
+  return true;
+}
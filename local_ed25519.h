@@ -0,0 +1,65 @@
+#ifndef HEXWALLET_LOCAL_ED25519_H
+#define HEXWALLET_LOCAL_ED25519_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Heap-free edwards25519 arithmetic on ten signed 25.5-bit limbs, which keeps
+// every product in 64 bits on 32-bit cores. Scalars and points use the usual
+// 32-byte little-endian encodings. Operations on private data run in constant
+// time; the base-point multiply uses a flash-resident table.
+constexpr size_t kLocalEd25519ScalarSize = 32;
+constexpr size_t kLocalEd25519PointSize = 32;
+
+// True when 0 < scalar < l, the group order.
+bool local_ed25519_scalar_is_valid(const uint8_t scalar[kLocalEd25519ScalarSize]);
+
+// Writes input mod l, reading input as a 256-bit little-endian integer like
+// CryptoNote's sc_reduce32(). Runs in constant time. Input and out may alias.
+void local_ed25519_scalar_reduce(const uint8_t input[kLocalEd25519ScalarSize],
+                                 uint8_t out[kLocalEd25519ScalarSize]);
+
+// out = left * right mod l, for inputs below 2^256. Runs in constant time.
+void local_ed25519_scalar_mul(const uint8_t left[kLocalEd25519ScalarSize],
+                              const uint8_t right[kLocalEd25519ScalarSize],
+                              uint8_t out[kLocalEd25519ScalarSize]);
+
+// Writes the encoding of scalar * B. The scalar is used as is, not clamped,
+// and must be below 2^255.
+bool local_ed25519_public_key(const uint8_t scalar[kLocalEd25519ScalarSize],
+                              uint8_t out[kLocalEd25519PointSize]);
+
+// Batched key pairs around one public key P: tweaked key i is
+// P + tweaks[i] * B and scaled key i is scale * (P + tweaks[i] * B), the
+// spend and view keys of a CryptoNote subaddress. init decodes P and
+// multiplies it by scale once; each batch of count <= kLocalEd25519MaxBatch
+// tweaks, 32 bytes each and below 2^255, then costs two fixed-base multiplies
+// per pair, and all 2 * count encodings share one field inversion. Keys are
+// written back to back; out_scaled may be null to skip the scaled keys. The
+// base holds scale, so callers wipe it.
+constexpr size_t kLocalEd25519MaxBatch = 8;
+
+struct LocalEd25519TweakBase {
+  uint8_t scale[kLocalEd25519ScalarSize];
+  // P and scale * P in the engine's addend form.
+  int32_t addends[2][4][10];
+};
+
+// Fails if P is not a canonical point encoding or scale is not a valid scalar.
+bool local_ed25519_tweak_base_init(LocalEd25519TweakBase *out,
+                                   const uint8_t public_key[kLocalEd25519PointSize],
+                                   const uint8_t scale[kLocalEd25519ScalarSize]);
+bool local_ed25519_tweak_add_scale_batch(const LocalEd25519TweakBase &base,
+                                         const uint8_t *tweaks, size_t count,
+                                         uint8_t *out_tweaked, uint8_t *out_scaled);
+
+// CryptoNote key derivations 8 * scalar * P for count <= kLocalEd25519MaxBatch
+// points, written back to back. The scalar is secret and must be valid, so
+// every multiply is the constant-time fixed-window one; all count encodings
+// share one field inversion. A point that is not a canonical encoding clears
+// its out_valid entry and gets a zeroed derivation.
+bool local_ed25519_derivation_batch(const uint8_t scalar[kLocalEd25519ScalarSize],
+                                    const uint8_t *points, size_t count,
+                                    uint8_t *out, bool *out_valid);
+
+#endif
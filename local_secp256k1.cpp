@@ -0,0 +1,823 @@
+#include "local_secp256k1.h"
+
+#include <string.h>
+
+#include "local_secp256k1_table.h"
+
+namespace {
+
+constexpr size_t kLimbs = 8;
+constexpr size_t kWindows = 64;
+constexpr size_t kWindowDigits = 8;
+constexpr size_t kOrderComplementLimbs = 5;
+
+// Field elements are kept fully reduced mod p, scalars fully reduced mod n.
+struct Field {
+  uint32_t v[kLimbs];
+};
+
+struct Scalar {
+  uint32_t v[kLimbs];
+};
+
+// Homogeneous projective coordinates; the identity is (0 : 1 : 0).
+struct Point {
+  Field x;
+  Field y;
+  Field z;
+};
+
+struct Affine {
+  Field x;
+  Field y;
+};
+
+constexpr uint32_t kPrime[kLimbs] = {
+    0xfffffc2fU, 0xfffffffeU, 0xffffffffU, 0xffffffffU,
+    0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU,
+};
+constexpr uint32_t kPrimeMinusTwo[kLimbs] = {
+    0xfffffc2dU, 0xfffffffeU, 0xffffffffU, 0xffffffffU,
+    0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU,
+};
+// (p + 1) / 4; p = 3 mod 4, so a^((p + 1) / 4) is a square root of a square.
+constexpr uint32_t kPrimeSqrtExponent[kLimbs] = {
+    0xbfffff0cU, 0xffffffffU, 0xffffffffU, 0xffffffffU,
+    0xffffffffU, 0xffffffffU, 0xffffffffU, 0x3fffffffU,
+};
+constexpr uint32_t kOrder[kLimbs] = {
+    0xd0364141U, 0xbfd25e8cU, 0xaf48a03bU, 0xbaaedce6U,
+    0xfffffffeU, 0xffffffffU, 0xffffffffU, 0xffffffffU,
+};
+constexpr uint32_t kOrderMinusTwo[kLimbs] = {
+    0xd036413fU, 0xbfd25e8cU, 0xaf48a03bU, 0xbaaedce6U,
+    0xfffffffeU, 0xffffffffU, 0xffffffffU, 0xffffffffU,
+};
+constexpr uint32_t kHalfOrder[kLimbs] = {
+    0x681b20a0U, 0xdfe92f46U, 0x57a4501dU, 0x5d576e73U,
+    0xffffffffU, 0xffffffffU, 0xffffffffU, 0x7fffffffU,
+};
+// 2^256 - n, used to fold wide products back below 2^256.
+constexpr uint32_t kOrderComplement[kOrderComplementLimbs] = {
+    0x2fc9bebfU, 0x402da173U, 0x50b75fc4U, 0x45512319U, 0x00000001U,
+};
+// 2^256 = 2^32 + 977 (mod p).
+constexpr uint32_t kPrimeFold = 977U;
+constexpr uint32_t kCurveB = 7U;
+constexpr uint32_t kCurveB3 = 3U * kCurveB;
+
+void wipe(void *data, size_t size) {
+  volatile uint8_t *bytes = static_cast<volatile uint8_t *>(data);
+  while (size-- != 0) *bytes++ = 0;
+}
+
+// Masks are all ones when the condition holds and zero otherwise.
+uint32_t mask_from_bit(uint32_t bit) {
+  return 0U - bit;
+}
+
+uint32_t mask_nonzero(uint32_t value) {
+  return mask_from_bit((value | (0U - value)) >> 31);
+}
+
+uint32_t mask_equal(uint32_t left, uint32_t right) {
+  return ~mask_nonzero(left ^ right);
+}
+
+uint32_t limbs_add(uint32_t *out, const uint32_t *left, const uint32_t *right) {
+  uint64_t carry = 0;
+  for (size_t index = 0; index < kLimbs; ++index) {
+    carry += static_cast<uint64_t>(left[index]) + right[index];
+    out[index] = static_cast<uint32_t>(carry);
+    carry >>= 32;
+  }
+  return static_cast<uint32_t>(carry);
+}
+
+uint32_t limbs_sub(uint32_t *out, const uint32_t *left, const uint32_t *right) {
+  uint64_t borrow = 0;
+  for (size_t index = 0; index < kLimbs; ++index) {
+    const uint64_t difference = static_cast<uint64_t>(left[index]) - right[index] - borrow;
+    out[index] = static_cast<uint32_t>(difference);
+    borrow = (difference >> 32) & 1U;
+  }
+  return static_cast<uint32_t>(borrow);
+}
+
+void limbs_cmov(uint32_t *out, const uint32_t *in, uint32_t mask) {
+  for (size_t index = 0; index < kLimbs; ++index) out[index] ^= mask & (out[index] ^ in[index]);
+}
+
+uint32_t limbs_zero_mask(const uint32_t *value) {
+  uint32_t bits = 0;
+  for (size_t index = 0; index < kLimbs; ++index) bits |= value[index];
+  return ~mask_nonzero(bits);
+}
+
+// Mask of value < modulus.
+uint32_t limbs_below_mask(const uint32_t *value, const uint32_t *modulus) {
+  uint32_t difference[kLimbs];
+  const uint32_t borrow = limbs_sub(difference, value, modulus);
+  wipe(difference, sizeof(difference));
+  return mask_from_bit(borrow);
+}
+
+// Subtracts modulus once when carry:value >= modulus.
+void limbs_reduce_once(uint32_t *value, uint32_t carry, const uint32_t *modulus) {
+  uint32_t reduced[kLimbs];
+  const uint32_t borrow = limbs_sub(reduced, value, modulus);
+  limbs_cmov(value, reduced, mask_from_bit(carry | (borrow ^ 1U)));
+  wipe(reduced, sizeof(reduced));
+}
+
+void limbs_from_bytes(uint32_t *out, const uint8_t *bytes) {
+  for (size_t index = 0; index < kLimbs; ++index) {
+    const uint8_t *word = bytes + (kLimbs - 1 - index) * 4;
+    out[index] = (static_cast<uint32_t>(word[0]) << 24) | (static_cast<uint32_t>(word[1]) << 16) |
+                 (static_cast<uint32_t>(word[2]) << 8) | word[3];
+  }
+}
+
+void limbs_to_bytes(uint8_t *out, const uint32_t *value) {
+  for (size_t index = 0; index < kLimbs; ++index) {
+    uint8_t *word = out + (kLimbs - 1 - index) * 4;
+    word[0] = static_cast<uint8_t>(value[index] >> 24);
+    word[1] = static_cast<uint8_t>(value[index] >> 16);
+    word[2] = static_cast<uint8_t>(value[index] >> 8);
+    word[3] = static_cast<uint8_t>(value[index]);
+  }
+}
+
+void limbs_mul_wide(uint32_t wide[2 * kLimbs], const uint32_t *left, const uint32_t *right) {
+  memset(wide, 0, 2 * kLimbs * sizeof(uint32_t));
+  for (size_t i = 0; i < kLimbs; ++i) {
+    uint64_t carry = 0;
+    for (size_t j = 0; j < kLimbs; ++j) {
+      const uint64_t current = static_cast<uint64_t>(left[i]) * right[j] + wide[i + j] + carry;
+      wide[i + j] = static_cast<uint32_t>(current);
+      carry = current >> 32;
+    }
+    wide[i + kLimbs] = static_cast<uint32_t>(carry);
+  }
+}
+
+// ---- Field arithmetic mod p ----
+
+void field_set_small(Field *out, uint32_t value) {
+  memset(out, 0, sizeof(*out));
+  out->v[0] = value;
+}
+
+void field_add(Field *out, const Field &left, const Field &right) {
+  const uint32_t carry = limbs_add(out->v, left.v, right.v);
+  limbs_reduce_once(out->v, carry, kPrime);
+}
+
+void field_sub(Field *out, const Field &left, const Field &right) {
+  const uint32_t mask = mask_from_bit(limbs_sub(out->v, left.v, right.v));
+  uint32_t correction[kLimbs];
+  for (size_t index = 0; index < kLimbs; ++index) correction[index] = kPrime[index] & mask;
+  limbs_add(out->v, out->v, correction);
+}
+
+void field_negate(Field *out, const Field &value) {
+  Field zero;
+  field_set_small(&zero, 0);
+  field_sub(out, zero, value);
+}
+
+// Folds a 512-bit product below p using 2^256 = 2^32 + 977 (mod p).
+void field_reduce_wide(Field *out, const uint32_t wide[2 * kLimbs]) {
+  uint32_t folded[kLimbs];
+  uint64_t carry = 0;
+  for (size_t index = 0; index < kLimbs; ++index) {
+    carry += static_cast<uint64_t>(wide[index]) +
+             static_cast<uint64_t>(wide[kLimbs + index]) * kPrimeFold;
+    if (index != 0) carry += wide[kLimbs + index - 1];
+    folded[index] = static_cast<uint32_t>(carry);
+    carry >>= 32;
+  }
+  const uint64_t top = carry + wide[2 * kLimbs - 1];
+  carry = static_cast<uint64_t>(folded[0]) + top * kPrimeFold;
+  folded[0] = static_cast<uint32_t>(carry);
+  carry = (carry >> 32) + folded[1] + top;
+  folded[1] = static_cast<uint32_t>(carry);
+  carry >>= 32;
+  for (size_t index = 2; index < kLimbs; ++index) {
+    carry += folded[index];
+    folded[index] = static_cast<uint32_t>(carry);
+    carry >>= 32;
+  }
+  // A final wrap leaves a small value, so one more fold cannot carry out.
+  const uint32_t wrap = static_cast<uint32_t>(carry);
+  carry = static_cast<uint64_t>(folded[0]) + static_cast<uint64_t>(wrap) * kPrimeFold;
+  folded[0] = static_cast<uint32_t>(carry);
+  carry = (carry >> 32) + folded[1] + wrap;
+  folded[1] = static_cast<uint32_t>(carry);
+  carry >>= 32;
+  for (size_t index = 2; index < kLimbs; ++index) {
+    carry += folded[index];
+    folded[index] = static_cast<uint32_t>(carry);
+    carry >>= 32;
+  }
+  limbs_reduce_once(folded, 0, kPrime);
+  memcpy(out->v, folded, sizeof(folded));
+  wipe(folded, sizeof(folded));
+}
+
+void field_mul(Field *out, const Field &left, const Field &right) {
+  uint32_t wide[2 * kLimbs];
+  limbs_mul_wide(wide, left.v, right.v);
+  field_reduce_wide(out, wide);
+  wipe(wide, sizeof(wide));
+}
+
+void field_sqr(Field *out, const Field &value) {
+  field_mul(out, value, value);
+}
+
+void field_mul_small(Field *out, const Field &value, uint32_t factor) {
+  uint32_t wide[2 * kLimbs] = {};
+  uint64_t carry = 0;
+  for (size_t index = 0; index < kLimbs; ++index) {
+    carry += static_cast<uint64_t>(value.v[index]) * factor;
+    wide[index] = static_cast<uint32_t>(carry);
+    carry >>= 32;
+  }
+  wide[kLimbs] = static_cast<uint32_t>(carry);
+  field_reduce_wide(out, wide);
+  wipe(wide, sizeof(wide));
+}
+
+uint32_t field_zero_mask(const Field &value) {
+  return limbs_zero_mask(value.v);
+}
+
+bool field_equal(const Field &left, const Field &right) {
+  uint32_t bits = 0;
+  for (size_t index = 0; index < kLimbs; ++index) bits |= left.v[index] ^ right.v[index];
+  return bits == 0;
+}
+
+// ---- Scalar arithmetic mod n ----
+
+// out = low + high * (2^256 - n), which is congruent to low + high * 2^256.
+void scalar_fold(uint32_t *out, size_t out_size, const uint32_t *low, const uint32_t *high,
+                 size_t high_size) {
+  for (size_t index = 0; index < out_size; ++index) out[index] = index < kLimbs ? low[index] : 0;
+  for (size_t i = 0; i < high_size; ++i) {
+    uint64_t carry = 0;
+    for (size_t j = 0; j < kOrderComplementLimbs; ++j) {
+      const uint64_t current =
+          static_cast<uint64_t>(high[i]) * kOrderComplement[j] + out[i + j] + carry;
+      out[i + j] = static_cast<uint32_t>(current);
+      carry = current >> 32;
+    }
+    for (size_t index = i + kOrderComplementLimbs; index < out_size; ++index) {
+      carry += out[index];
+      out[index] = static_cast<uint32_t>(carry);
+      carry >>= 32;
+    }
+  }
+}
+
+// Reduces a 512-bit product: 2^512 -> 2^386 -> 2^260 -> 2^257 -> below 2^256.
+void scalar_reduce_wide(Scalar *out, const uint32_t wide[2 * kLimbs]) {
+  uint32_t first[14];
+  uint32_t second[11];
+  uint32_t third[kLimbs + 1];
+  uint32_t fourth[kLimbs + 1];
+  scalar_fold(first, 14, wide, wide + kLimbs, kLimbs);
+  scalar_fold(second, 11, first, first + kLimbs, 5);
+  scalar_fold(third, kLimbs + 1, second, second + kLimbs, 1);
+  scalar_fold(fourth, kLimbs + 1, third, third + kLimbs, 1);
+  limbs_reduce_once(fourth, 0, kOrder);
+  memcpy(out->v, fourth, sizeof(out->v));
+  wipe(first, sizeof(first));
+  wipe(second, sizeof(second));
+  wipe(third, sizeof(third));
+  wipe(fourth, sizeof(fourth));
+}
+
+void scalar_mul(Scalar *out, const Scalar &left, const Scalar &right) {
+  uint32_t wide[2 * kLimbs];
+  limbs_mul_wide(wide, left.v, right.v);
+  scalar_reduce_wide(out, wide);
+  wipe(wide, sizeof(wide));
+}
+
+void scalar_add(Scalar *out, const Scalar &left, const Scalar &right) {
+  const uint32_t carry = limbs_add(out->v, left.v, right.v);
+  limbs_reduce_once(out->v, carry, kOrder);
+}
+
+void scalar_set_one(Scalar *out) {
+  memset(out, 0, sizeof(*out));
+  out->v[0] = 1;
+}
+
+void field_set_one(Field *out) {
+  field_set_small(out, 1);
+}
+
+// Fixed public exponent, four bits at a time. The table index depends only on
+// the exponent, so the running time does not depend on the base.
+template <typename Element, void (*Multiply)(Element *, const Element &, const Element &),
+          void (*SetOne)(Element *)>
+void power(Element *out, const Element &base, const uint32_t exponent[kLimbs]) {
+  Element table[16];
+  SetOne(&table[0]);
+  table[1] = base;
+  for (size_t index = 2; index < 16; ++index) Multiply(&table[index], table[index - 1], base);
+  Element accumulator;
+  SetOne(&accumulator);
+  for (size_t window = kWindows; window-- != 0;) {
+    for (size_t bit = 0; bit < 4; ++bit) Multiply(&accumulator, accumulator, accumulator);
+    const uint32_t nibble = (exponent[window / 8] >> (4 * (window % 8))) & 15U;
+    Multiply(&accumulator, accumulator, table[nibble]);
+  }
+  *out = accumulator;
+  wipe(table, sizeof(table));
+  wipe(&accumulator, sizeof(accumulator));
+}
+
+void field_invert(Field *out, const Field &value) {
+  power<Field, field_mul, field_set_one>(out, value, kPrimeMinusTwo);
+}
+
+void scalar_invert(Scalar *out, const Scalar &value) {
+  power<Scalar, scalar_mul, scalar_set_one>(out, value, kOrderMinusTwo);
+}
+
+// Loads a scalar and returns whether it lies in [1, n).
+bool scalar_load_valid(Scalar *out, const uint8_t bytes[kLocalSecp256k1ScalarSize]) {
+  limbs_from_bytes(out->v, bytes);
+  return (limbs_below_mask(out->v, kOrder) & ~limbs_zero_mask(out->v)) != 0;
+}
+
+void scalar_load_reduced(Scalar *out, const uint8_t bytes[kLocalSecp256k1ScalarSize]) {
+  limbs_from_bytes(out->v, bytes);
+  limbs_reduce_once(out->v, 0, kOrder);
+}
+
+// ---- Group arithmetic ----
+// Complete formulas for a = 0 from Renes, Costello and Batina (2016),
+// algorithms 7, 8 and 9. They have no exceptional cases, so the identity and
+// doubling inputs take the same path as any other addition.
+
+void point_set_identity(Point *out) {
+  field_set_small(&out->x, 0);
+  field_set_small(&out->y, 1);
+  field_set_small(&out->z, 0);
+}
+
+void point_from_affine(Point *out, const Affine &in) {
+  out->x = in.x;
+  out->y = in.y;
+  field_set_small(&out->z, 1);
+}
+
+void point_cmov(Point *out, const Point &in, uint32_t mask) {
+  limbs_cmov(out->x.v, in.x.v, mask);
+  limbs_cmov(out->y.v, in.y.v, mask);
+  limbs_cmov(out->z.v, in.z.v, mask);
+}
+
+void point_add(Point *out, const Point &p, const Point &q) {
+  Field t0, t1, t2, t3, t4, x3, y3, z3;
+  field_mul(&t0, p.x, q.x);
+  field_mul(&t1, p.y, q.y);
+  field_mul(&t2, p.z, q.z);
+  field_add(&t3, p.x, p.y);
+  field_add(&t4, q.x, q.y);
+  field_mul(&t3, t3, t4);
+  field_add(&t4, t0, t1);
+  field_sub(&t3, t3, t4);
+  field_add(&t4, p.y, p.z);
+  field_add(&x3, q.y, q.z);
+  field_mul(&t4, t4, x3);
+  field_add(&x3, t1, t2);
+  field_sub(&t4, t4, x3);
+  field_add(&x3, p.x, p.z);
+  field_add(&y3, q.x, q.z);
+  field_mul(&x3, x3, y3);
+  field_add(&y3, t0, t2);
+  field_sub(&y3, x3, y3);
+  field_add(&x3, t0, t0);
+  field_add(&t0, x3, t0);
+  field_mul_small(&t2, t2, kCurveB3);
+  field_add(&z3, t1, t2);
+  field_sub(&t1, t1, t2);
+  field_mul_small(&y3, y3, kCurveB3);
+  field_mul(&x3, t4, y3);
+  field_mul(&t2, t3, t1);
+  field_sub(&x3, t2, x3);
+  field_mul(&y3, y3, t0);
+  field_mul(&t1, t1, z3);
+  field_add(&y3, t1, y3);
+  field_mul(&t0, t0, t3);
+  field_mul(&z3, z3, t4);
+  field_add(&z3, z3, t0);
+  out->x = x3;
+  out->y = y3;
+  out->z = z3;
+}
+
+// q must not be the identity, which has no affine form.
+void point_add_affine(Point *out, const Point &p, const Affine &q) {
+  Field t0, t1, t2, t3, t4, x3, y3, z3;
+  field_mul(&t0, p.x, q.x);
+  field_mul(&t1, p.y, q.y);
+  field_add(&t3, q.x, q.y);
+  field_add(&t4, p.x, p.y);
+  field_mul(&t3, t3, t4);
+  field_add(&t4, t0, t1);
+  field_sub(&t3, t3, t4);
+  field_mul(&t4, q.y, p.z);
+  field_add(&t4, t4, p.y);
+  field_mul(&y3, q.x, p.z);
+  field_add(&y3, y3, p.x);
+  field_add(&x3, t0, t0);
+  field_add(&t0, x3, t0);
+  field_mul_small(&t2, p.z, kCurveB3);
+  field_add(&z3, t1, t2);
+  field_sub(&t1, t1, t2);
+  field_mul_small(&y3, y3, kCurveB3);
+  field_mul(&x3, t4, y3);
+  field_mul(&t2, t3, t1);
+  field_sub(&x3, t2, x3);
+  field_mul(&y3, y3, t0);
+  field_mul(&t1, t1, z3);
+  field_add(&y3, t1, y3);
+  field_mul(&t0, t0, t3);
+  field_mul(&z3, z3, t4);
+  field_add(&z3, z3, t0);
+  out->x = x3;
+  out->y = y3;
+  out->z = z3;
+}
+
+void point_double(Point *out, const Point &p) {
+  Field t0, t1, t2, x3, y3, z3;
+  field_sqr(&t0, p.y);
+  field_add(&z3, t0, t0);
+  field_add(&z3, z3, z3);
+  field_add(&z3, z3, z3);
+  field_mul(&t1, p.y, p.z);
+  field_sqr(&t2, p.z);
+  field_mul_small(&t2, t2, kCurveB3);
+  field_mul(&x3, t2, z3);
+  field_add(&y3, t0, t2);
+  field_mul(&z3, t1, z3);
+  field_add(&t1, t2, t2);
+  field_add(&t2, t1, t2);
+  field_sub(&t0, t0, t2);
+  field_mul(&y3, t0, y3);
+  field_add(&y3, x3, y3);
+  field_mul(&t1, p.x, p.y);
+  field_mul(&x3, t0, t1);
+  field_add(&x3, x3, x3);
+  out->x = x3;
+  out->y = y3;
+  out->z = z3;
+}
+
+// Constant-time k * G for 0 <= k < n. Scalars with the top bit set are
+// replaced by n - k and the result negated, so every signed 4-bit digit of
+// the recoded scalar fits the table's multiples 1..8 without a carry out.
+void base_mul(Point *out, const Scalar &scalar) {
+  Scalar negated;
+  limbs_sub(negated.v, kOrder, scalar.v);
+  const uint32_t flip = mask_from_bit(scalar.v[kLimbs - 1] >> 31);
+  Scalar recoded = scalar;
+  limbs_cmov(recoded.v, negated.v, flip);
+
+  point_set_identity(out);
+  Affine entry;
+  Field negated_y;
+  Point sum;
+  uint32_t carry = 0;
+  for (size_t window = 0; window < kWindows; ++window) {
+    const uint32_t value = ((recoded.v[window / 8] >> (4 * (window % 8))) & 15U) + carry;
+    carry = window + 1 < kWindows ? (value + 8) >> 4 : 0;
+    const uint32_t negative = mask_from_bit(carry);
+    const uint32_t magnitude = (value & ~negative) | ((16U - value) & negative);
+    memset(&entry, 0, sizeof(entry));
+    for (size_t digit = 0; digit < kWindowDigits; ++digit) {
+      const uint32_t mask = mask_equal(magnitude, static_cast<uint32_t>(digit + 1));
+      limbs_cmov(entry.x.v, kLocalSecp256k1BaseTable[window][digit], mask);
+      limbs_cmov(entry.y.v, kLocalSecp256k1BaseTable[window][digit] + kLimbs, mask);
+    }
+    field_negate(&negated_y, entry.y);
+    limbs_cmov(entry.y.v, negated_y.v, negative);
+    point_add_affine(&sum, *out, entry);
+    point_cmov(out, sum, mask_nonzero(magnitude));
+  }
+  field_negate(&negated_y, out->y);
+  limbs_cmov(out->y.v, negated_y.v, flip);
+  wipe(&negated, sizeof(negated));
+  wipe(&recoded, sizeof(recoded));
+  wipe(&entry, sizeof(entry));
+  wipe(&negated_y, sizeof(negated_y));
+  wipe(&sum, sizeof(sum));
+  wipe(&carry, sizeof(carry));
+}
+
+// Variable-time k * P for verification, where every input is public.
+void point_mul_public(Point *out, const Point &point, const Scalar &scalar) {
+  Point table[16];
+  point_set_identity(&table[0]);
+  table[1] = point;
+  for (size_t index = 2; index < 16; ++index) point_add(&table[index], table[index - 1], point);
+  point_set_identity(out);
+  for (size_t window = kWindows; window-- != 0;) {
+    for (size_t bit = 0; bit < 4; ++bit) point_double(out, *out);
+    const uint32_t nibble = (scalar.v[window / 8] >> (4 * (window % 8))) & 15U;
+    if (nibble != 0) point_add(out, *out, table[nibble]);
+  }
+}
+
+bool point_to_affine(Affine *out, const Point &point) {
+  if (field_zero_mask(point.z) != 0) return false;
+  Field inverse;
+  field_invert(&inverse, point.z);
+  field_mul(&out->x, point.x, inverse);
+  field_mul(&out->y, point.y, inverse);
+  wipe(&inverse, sizeof(inverse));
+  return true;
+}
+
+void curve_rhs(Field *out, const Field &x) {
+  Field b;
+  field_set_small(&b, kCurveB);
+  field_sqr(out, x);
+  field_mul(out, *out, x);
+  field_add(out, *out, b);
+}
+
+bool parse_public_key(Affine *out, const uint8_t *bytes, size_t size) {
+  if (bytes == nullptr) return false;
+  Field rhs;
+  Field check;
+  if (size == kLocalSecp256k1CompressedSize && (bytes[0] == 0x02 || bytes[0] == 0x03)) {
+    limbs_from_bytes(out->x.v, bytes + 1);
+    if (limbs_below_mask(out->x.v, kPrime) == 0) return false;
+    curve_rhs(&rhs, out->x);
+    power<Field, field_mul, field_set_one>(&out->y, rhs, kPrimeSqrtExponent);
+    field_sqr(&check, out->y);
+    if (!field_equal(check, rhs)) return false;
+    if ((out->y.v[0] & 1U) != (bytes[0] & 1U)) field_negate(&out->y, out->y);
+    return true;
+  }
+  if (size == kLocalSecp256k1UncompressedSize && bytes[0] == 0x04) {
+    limbs_from_bytes(out->x.v, bytes + 1);
+    limbs_from_bytes(out->y.v, bytes + 1 + kLocalSecp256k1ScalarSize);
+    if (limbs_below_mask(out->x.v, kPrime) == 0 || limbs_below_mask(out->y.v, kPrime) == 0) {
+      return false;
+    }
+    curve_rhs(&rhs, out->x);
+    field_sqr(&check, out->y);
+    return field_equal(check, rhs);
+  }
+  return false;
+}
+
+void serialize_public_key(const Affine &point, bool compressed, uint8_t *out) {
+  if (compressed) {
+    out[0] = static_cast<uint8_t>(0x02 | (point.y.v[0] & 1U));
+    limbs_to_bytes(out + 1, point.x.v);
+    return;
+  }
+  out[0] = 0x04;
+  limbs_to_bytes(out + 1, point.x.v);
+  limbs_to_bytes(out + 1 + kLocalSecp256k1ScalarSize, point.y.v);
+}
+
+}  // namespace
+
+bool local_secp256k1_scalar_is_valid(const uint8_t scalar[kLocalSecp256k1ScalarSize]) {
+  if (scalar == nullptr) return false;
+  Scalar value;
+  const bool valid = scalar_load_valid(&value, scalar);
+  wipe(&value, sizeof(value));
+  return valid;
+}
+
+void local_secp256k1_scalar_reduce(const uint8_t value[kLocalSecp256k1ScalarSize],
+                                   uint8_t out[kLocalSecp256k1ScalarSize]) {
+  Scalar scalar;
+  scalar_load_reduced(&scalar, value);
+  limbs_to_bytes(out, scalar.v);
+  wipe(&scalar, sizeof(scalar));
+}
+
+bool local_secp256k1_scalar_add(const uint8_t left[kLocalSecp256k1ScalarSize],
+                                const uint8_t right[kLocalSecp256k1ScalarSize],
+                                uint8_t out[kLocalSecp256k1ScalarSize]) {
+  if (left == nullptr || right == nullptr || out == nullptr) return false;
+  Scalar a;
+  Scalar b;
+  limbs_from_bytes(a.v, left);
+  limbs_from_bytes(b.v, right);
+  const bool in_range = (limbs_below_mask(a.v, kOrder) & limbs_below_mask(b.v, kOrder)) != 0;
+  scalar_add(&a, a, b);
+  const bool valid = in_range && limbs_zero_mask(a.v) == 0;
+  if (valid) limbs_to_bytes(out, a.v);
+  wipe(&a, sizeof(a));
+  wipe(&b, sizeof(b));
+  return valid;
+}
+
+bool local_secp256k1_public_key(const uint8_t scalar[kLocalSecp256k1ScalarSize], bool compressed,
+                                uint8_t *out) {
+  if (scalar == nullptr || out == nullptr) return false;
+  Scalar value;
+  Point point;
+  Affine affine;
+  bool ok = scalar_load_valid(&value, scalar);
+  if (ok) {
+    base_mul(&point, value);
+    ok = point_to_affine(&affine, point);
+  }
+  if (ok) serialize_public_key(affine, compressed, out);
+  wipe(&value, sizeof(value));
+  wipe(&point, sizeof(point));
+  wipe(&affine, sizeof(affine));
+  return ok;
+}
+
+bool local_secp256k1_public_key_is_valid(const uint8_t *public_key, size_t public_key_size) {
+  Affine point;
+  return parse_public_key(&point, public_key, public_key_size);
+}
+
+bool local_secp256k1_public_key_tweak_add(
+    const uint8_t public_key[kLocalSecp256k1CompressedSize],
+    const uint8_t tweak[kLocalSecp256k1ScalarSize],
+    uint8_t out[kLocalSecp256k1CompressedSize]) {
+  if (tweak == nullptr || out == nullptr) return false;
+  Affine parent;
+  Scalar offset;
+  if (!parse_public_key(&parent, public_key, kLocalSecp256k1CompressedSize) ||
+      !scalar_load_valid(&offset, tweak)) {
+    wipe(&offset, sizeof(offset));
+    return false;
+  }
+  Point sum;
+  Affine child;
+  base_mul(&sum, offset);
+  point_add_affine(&sum, sum, parent);
+  const bool ok = point_to_affine(&child, sum);
+  if (ok) serialize_public_key(child, true, out);
+  wipe(&offset, sizeof(offset));
+  wipe(&sum, sizeof(sum));
+  return ok;
+}
+
+// Montgomery's trick: with prefix products z0, z0*z1, ..., one inversion of the
+// last product yields every 1/zi by walking back down the prefixes.
+bool local_secp256k1_public_key_tweak_add_batch(
+    const uint8_t public_key[kLocalSecp256k1CompressedSize], const uint8_t *tweaks, size_t count,
+    bool compressed, uint8_t *out) {
+  if (tweaks == nullptr || out == nullptr || count == 0 || count > kLocalSecp256k1MaxBatch) {
+    return false;
+  }
+  Affine parent;
+  if (!parse_public_key(&parent, public_key, kLocalSecp256k1CompressedSize)) return false;
+  Point sums[kLocalSecp256k1MaxBatch];
+  Field prefixes[kLocalSecp256k1MaxBatch];
+  Scalar offset;
+  bool ok = true;
+  for (size_t index = 0; ok && index < count; ++index) {
+    ok = scalar_load_valid(&offset, tweaks + index * kLocalSecp256k1ScalarSize);
+    if (!ok) break;
+    base_mul(&sums[index], offset);
+    point_add_affine(&sums[index], sums[index], parent);
+    ok = field_zero_mask(sums[index].z) == 0;
+    if (!ok) break;
+    if (index == 0) prefixes[0] = sums[0].z;
+    else field_mul(&prefixes[index], prefixes[index - 1], sums[index].z);
+  }
+  wipe(&offset, sizeof(offset));
+  if (!ok) return false;
+  Field inverse;
+  Field point_inverse;
+  Affine child;
+  const size_t key_size = compressed ? kLocalSecp256k1CompressedSize : kLocalSecp256k1UncompressedSize;
+  field_invert(&inverse, prefixes[count - 1]);
+  for (size_t index = count; index-- != 0;) {
+    if (index == 0) {
+      point_inverse = inverse;
+    } else {
+      field_mul(&point_inverse, inverse, prefixes[index - 1]);
+      field_mul(&inverse, inverse, sums[index].z);
+    }
+    field_mul(&child.x, sums[index].x, point_inverse);
+    field_mul(&child.y, sums[index].y, point_inverse);
+    serialize_public_key(child, compressed, out + index * key_size);
+  }
+  return true;
+}
+
+bool local_secp256k1_sign(const uint8_t private_key[kLocalSecp256k1ScalarSize],
+                          const uint8_t digest[kLocalSecp256k1ScalarSize],
+                          const uint8_t nonce[kLocalSecp256k1ScalarSize],
+                          uint8_t out_r[kLocalSecp256k1ScalarSize],
+                          uint8_t out_s[kLocalSecp256k1ScalarSize],
+                          uint8_t *out_recovery_id) {
+  if (private_key == nullptr || digest == nullptr || nonce == nullptr || out_r == nullptr ||
+      out_s == nullptr || out_recovery_id == nullptr) {
+    return false;
+  }
+  Scalar key;
+  Scalar k;
+  Scalar z;
+  Scalar r;
+  Scalar s;
+  Point nonce_point;
+  Affine nonce_affine;
+  const bool key_valid = scalar_load_valid(&key, private_key);
+  const bool nonce_valid = scalar_load_valid(&k, nonce);
+  scalar_load_reduced(&z, digest);
+  bool ok = key_valid && nonce_valid;
+  if (ok) {
+    base_mul(&nonce_point, k);
+    ok = point_to_affine(&nonce_affine, nonce_point);
+  }
+  uint8_t recovery_id = 0;
+  if (ok) {
+    memcpy(r.v, nonce_affine.x.v, sizeof(r.v));
+    const uint32_t overflow = ~limbs_below_mask(r.v, kOrder) & 1U;
+    limbs_reduce_once(r.v, 0, kOrder);
+    recovery_id = static_cast<uint8_t>((nonce_affine.y.v[0] & 1U) | (overflow << 1));
+    ok = limbs_zero_mask(r.v) == 0;
+  }
+  if (ok) {
+    scalar_mul(&s, r, key);
+    scalar_add(&s, s, z);
+    scalar_invert(&k, k);
+    scalar_mul(&s, s, k);
+    ok = limbs_zero_mask(s.v) == 0;
+  }
+  if (ok) {
+    // s > n / 2 becomes n - s, which also negates the effective nonce point.
+    if (limbs_below_mask(kHalfOrder, s.v) != 0) {
+      limbs_sub(s.v, kOrder, s.v);
+      recovery_id ^= 1U;
+    }
+    limbs_to_bytes(out_r, r.v);
+    limbs_to_bytes(out_s, s.v);
+    *out_recovery_id = recovery_id;
+  }
+  wipe(&key, sizeof(key));
+  wipe(&k, sizeof(k));
+  wipe(&z, sizeof(z));
+  wipe(&r, sizeof(r));
+  wipe(&s, sizeof(s));
+  wipe(&nonce_point, sizeof(nonce_point));
+  wipe(&nonce_affine, sizeof(nonce_affine));
+  return ok;
+}
+
+bool local_secp256k1_verify(const uint8_t *public_key, size_t public_key_size,
+                            const uint8_t digest[kLocalSecp256k1ScalarSize],
+                            const uint8_t r[kLocalSecp256k1ScalarSize],
+                            const uint8_t s[kLocalSecp256k1ScalarSize],
+                            uint8_t *out_recovery_id) {
+  if (digest == nullptr || r == nullptr || s == nullptr) return false;
+  Affine key;
+  Scalar r_value;
+  Scalar s_value;
+  if (!parse_public_key(&key, public_key, public_key_size) || !scalar_load_valid(&r_value, r) ||
+      !scalar_load_valid(&s_value, s)) {
+    return false;
+  }
+  Scalar z;
+  Scalar inverse;
+  Scalar u1;
+  Scalar u2;
+  scalar_load_reduced(&z, digest);
+  scalar_invert(&inverse, s_value);
+  scalar_mul(&u1, z, inverse);
+  scalar_mul(&u2, r_value, inverse);
+  Point generator_part;
+  Point key_point;
+  Point key_part;
+  Affine reconstructed;
+  base_mul(&generator_part, u1);
+  point_from_affine(&key_point, key);
+  point_mul_public(&key_part, key_point, u2);
+  point_add(&generator_part, generator_part, key_part);
+  if (!point_to_affine(&reconstructed, generator_part)) return false;
+  Scalar x_value;
+  memcpy(x_value.v, reconstructed.x.v, sizeof(x_value.v));
+  const uint32_t overflow = ~limbs_below_mask(x_value.v, kOrder) & 1U;
+  limbs_reduce_once(x_value.v, 0, kOrder);
+  uint32_t difference = 0;
+  for (size_t index = 0; index < kLimbs; ++index) difference |= x_value.v[index] ^ r_value.v[index];
+  if (difference != 0) return false;
+  if (out_recovery_id != nullptr) {
+    *out_recovery_id = static_cast<uint8_t>((reconstructed.y.v[0] & 1U) | (overflow << 1));
+  }
+  return true;
+}
@@ -0,0 +1,63 @@
+#ifndef HEXWALLET_LOCAL_SECP256K1_H
+#define HEXWALLET_LOCAL_SECP256K1_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Heap-free secp256k1 arithmetic on 32-bit limbs. Scalars, field elements and
+// keys use the usual 32-byte big-endian encodings. Operations on private data
+// run in constant time; the generator multiply uses a flash-resident table.
+constexpr size_t kLocalSecp256k1ScalarSize = 32;
+constexpr size_t kLocalSecp256k1CompressedSize = 33;
+constexpr size_t kLocalSecp256k1UncompressedSize = 65;
+
+// True when 0 < scalar < n.
+bool local_secp256k1_scalar_is_valid(const uint8_t scalar[kLocalSecp256k1ScalarSize]);
+// Writes value mod n, as used by RFC6979 bits2octets and ECDSA digest input.
+void local_secp256k1_scalar_reduce(const uint8_t value[kLocalSecp256k1ScalarSize],
+                                   uint8_t out[kLocalSecp256k1ScalarSize]);
+// out = (left + right) mod n. Both inputs must be below n; a zero sum fails.
+bool local_secp256k1_scalar_add(const uint8_t left[kLocalSecp256k1ScalarSize],
+                                const uint8_t right[kLocalSecp256k1ScalarSize],
+                                uint8_t out[kLocalSecp256k1ScalarSize]);
+
+// Writes scalar * G as a 33-byte compressed or 65-byte uncompressed key.
+bool local_secp256k1_public_key(const uint8_t scalar[kLocalSecp256k1ScalarSize], bool compressed,
+                                uint8_t *out);
+// Accepts compressed or uncompressed keys and checks the point is on the curve.
+bool local_secp256k1_public_key_is_valid(const uint8_t *public_key, size_t public_key_size);
+// out = public_key + tweak * G, the BIP32 public child step. The tweak must be
+// a valid scalar and the sum must not be the point at infinity.
+bool local_secp256k1_public_key_tweak_add(
+    const uint8_t public_key[kLocalSecp256k1CompressedSize],
+    const uint8_t tweak[kLocalSecp256k1ScalarSize],
+    uint8_t out[kLocalSecp256k1CompressedSize]);
+// Batched public child steps from one parent: key i is public_key + tweaks[i] * G
+// for count <= kLocalSecp256k1MaxBatch tweaks of 32 bytes each. The parent is
+// decompressed once and the affine conversions share one field inversion.
+// Keys are written back to back, compressed or uncompressed. Fails as a whole
+// if any tweak is invalid or any sum is the point at infinity.
+constexpr size_t kLocalSecp256k1MaxBatch = 16;
+bool local_secp256k1_public_key_tweak_add_batch(
+    const uint8_t public_key[kLocalSecp256k1CompressedSize], const uint8_t *tweaks, size_t count,
+    bool compressed, uint8_t *out);
+
+// ECDSA with a caller-chosen nonce. The signature is normalized to low S and
+// the recovery id describes the nonce point of the normalized signature: bit 0
+// is its Y parity and bit 1 is set when its X coordinate was reduced mod n.
+// Fails for an invalid nonce or a zero r or s, so the caller draws another.
+bool local_secp256k1_sign(const uint8_t private_key[kLocalSecp256k1ScalarSize],
+                          const uint8_t digest[kLocalSecp256k1ScalarSize],
+                          const uint8_t nonce[kLocalSecp256k1ScalarSize],
+                          uint8_t out_r[kLocalSecp256k1ScalarSize],
+                          uint8_t out_s[kLocalSecp256k1ScalarSize],
+                          uint8_t *out_recovery_id);
+// Verifies a signature over a 32-byte digest. When out_recovery_id is not null
+// it receives the recovery id of the reconstructed nonce point.
+bool local_secp256k1_verify(const uint8_t *public_key, size_t public_key_size,
+                            const uint8_t digest[kLocalSecp256k1ScalarSize],
+                            const uint8_t r[kLocalSecp256k1ScalarSize],
+                            const uint8_t s[kLocalSecp256k1ScalarSize],
+                            uint8_t *out_recovery_id);
+
+#endif
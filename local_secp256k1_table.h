@@ -0,0 +1,1162 @@
+// Generated by tools/generate_secp256k1_table.py. Do not edit.
+#ifndef HEXWALLET_LOCAL_SECP256K1_TABLE_H
+#define HEXWALLET_LOCAL_SECP256K1_TABLE_H
+
+#include <stdint.h>
+
+constexpr uint32_t kLocalSecp256k1BaseTable[64][8][16] = {
+    {
+        {0x16f81798U, 0x59f2815bU, 0x2dce28d9U, 0x029bfcdbU, 0xce870b07U, 0x55a06295U, 0xf9dcbbacU, 0x79be667eU,
+         0xfb10d4b8U, 0x9c47d08fU, 0xa6855419U, 0xfd17b448U, 0x0e1108a8U, 0x5da4fbfcU, 0x26a3c465U, 0x483ada77U},
+        {0x5c709ee5U, 0xabac09b9U, 0x8cef3ca7U, 0x5c778e4bU, 0x95c07cd8U, 0x3045406eU, 0x41ed7d6dU, 0xc6047f94U,
+         0x50cfe52aU, 0x236431a9U, 0x3266d0e1U, 0xf7f63265U, 0x466ceaeeU, 0xa3c58419U, 0xa63dc339U, 0x1ae168feU},
+        {0xbce036f9U, 0x8601f113U, 0x836f99b0U, 0xb531c845U, 0xf89d5229U, 0x49344f85U, 0x9258c310U, 0xf9308a01U,
+         0x84b8e672U, 0x6cb9fd75U, 0x34c2231bU, 0x6500a999U, 0x2a37f356U, 0x0fe337e6U, 0x632de814U, 0x388f7b0fU},
+        {0xe8c4cd13U, 0x74fa94abU, 0x0ee07584U, 0xcc6c1390U, 0x930b1404U, 0x581e4904U, 0xc10d80f3U, 0xe493dbf1U,
+         0x47739922U, 0xcfe97bdcU, 0xbfbdfe40U, 0xd967ae33U, 0x8ea51448U, 0x5642e209U, 0xa0d455b7U, 0x51ed993eU},
+        {0xb240efe4U, 0xcba8d569U, 0xdc619ab7U, 0xe88b84bdU, 0x0a5c5128U, 0x55b4a725U, 0x1a072093U, 0x2f8bde4dU,
+         0xa6ac62d6U, 0xdca87d3aU, 0xab0d6840U, 0xf788271bU, 0xa6c9c426U, 0xd4dba9ddU, 0x36e5e3d6U, 0xd8ac2226U},
+        {0x60297556U, 0x2f057a14U, 0x8568a18bU, 0x82f6472fU, 0x355235d3U, 0x20453a14U, 0x755eeea4U, 0xfff97bd5U,
+         0xb075f297U, 0x3c870c36U, 0x518fe4a0U, 0xde80f0f6U, 0x7f45c560U, 0xf3be9601U, 0xacfbb620U, 0xae12777aU},
+        {0xcac4f9bcU, 0xe92bddedU, 0x0330e39cU, 0x3d419b7eU, 0xf2ea7a0eU, 0xa398f365U, 0x6e5db4eaU, 0x5cbdf064U,
+         0x087264daU, 0xa5082628U, 0x13fde7b5U, 0xa813d0b8U, 0x861a54dbU, 0xa3178d6dU, 0xba255960U, 0x6aebca40U},
+        {0xe10a2a01U, 0x67784ef3U, 0xe5af888aU, 0x0a1bdd05U, 0xb70f3c2fU, 0xaff3843fU, 0x5cca351dU, 0x2f01e5e1U,
+         0x6cbde904U, 0xb5da2cb7U, 0xba5b7617U, 0xc2e213d6U, 0x132d13b4U, 0x293d082aU, 0x41539949U, 0x5c4da8a7U},
+    },
+    {
+        {0x2a6dec0aU, 0xc44ee89eU, 0xb87a5ae9U, 0xb2a31369U, 0x21c23e97U, 0x3011aabcU, 0xb59e9ec5U, 0xe60fce93U,
+         0x69616821U, 0xe1f32cceU, 0x44d23f0bU, 0x1296891eU, 0xf5793710U, 0x9db99f34U, 0x99e59592U, 0xf7e35073U},
+        {0x07143e65U, 0x75d0dbd4U, 0x9904a61dU, 0xdacffcb8U, 0xe2f378ceU, 0x47b6e054U, 0x4fb5a22dU, 0xd30199d7U,
+         0x24106ab9U, 0x05b3ff1fU, 0x64ed8196U, 0x1f760cc3U, 0xe9838065U, 0xb3d6dec9U, 0x0ae3d5c3U, 0x95038d9dU},
+        {0x1118e5c3U, 0x9bd870aaU, 0x452bebc1U, 0xfc579b27U, 0xf4e65b4bU, 0xb441656eU, 0x9645307dU, 0x6eca335dU,
+         0x05a08668U, 0x498a2f78U, 0x3bf8ec34U, 0x3a496a3aU, 0x74b875a0U, 0x592f5790U, 0x7a7a0710U, 0xd50123b5U},
+        {0xf874ef8bU, 0xe37918e6U, 0xcdbafd81U, 0xfc4c6f1dU, 0xf832823cU, 0x0b1051eaU, 0x2d16eab7U, 0xbf23c154U,
+         0x66831d9fU, 0x4dc37efeU, 0x811e2f78U, 0xc522fc54U, 0xba5392e4U, 0x7ad928a0U, 0xc3300373U, 0x5cb3866fU},
+        {0x4f87f62eU, 0x0ecd31e1U, 0x63716127U, 0x10e6e638U, 0xd34659f0U, 0x0d7c744eU, 0xf1bf90ecU, 0xe9623bbeU,
+         0xa44ee737U, 0x53013eafU, 0xdd68844eU, 0xfe6043c9U, 0x8edaa929U, 0xe0fe953aU, 0x4bc299e9U, 0x38a9743bU},
+        {0x7f8cb0e3U, 0x43933acaU, 0xe1efe3a4U, 0xa22eb53fU, 0x4b2eb72eU, 0x8fa64e04U, 0x74456d8fU, 0x3f0e80e5U,
+         0xea5f404fU, 0xcb0289e2U, 0xa65b53a4U, 0x9501253aU, 0x485d01b3U, 0xe90b9c08U, 0x296cbc91U, 0xcb66d7d7U},
+        {0x2a8d733cU, 0xeb0aadf8U, 0x62fca8f9U, 0xffc274bfU, 0x2080d682U, 0x0884a36fU, 0xe5161dbaU, 0xbc82dd73U,
+         0xf47797f0U, 0x1e786104U, 0xe7389730U, 0xae93a0baU, 0x719f02dfU, 0x54a9b4bfU, 0x044b1cacU, 0xe5f28c3aU},
+        {0x6769a24eU, 0x64707745U, 0x00535655U, 0xbcf55cd7U, 0xf7d1671cU, 0x696c3d09U, 0x033f7a06U, 0x34ff3be4U,
+         0x73cc2f1aU, 0x8491067aU, 0xe8f8b681U, 0x55df16c3U, 0x9832098cU, 0x3f6619d8U, 0x3a236c55U, 0x5d9d1162U},
+    },
+    {
+        {0xd5f51508U, 0x0646e23fU, 0xd5ac1ca1U, 0xd8c39cabU, 0x172de238U, 0xea2a6e3eU, 0x12c609d9U, 0x82822632U,
+         0xf6e26cafU, 0xd31b6eafU, 0x2f7b17beU, 0x62d613acU, 0x30b60aceU, 0x5e8256e8U, 0x8557dfe4U, 0x11f8a809U},
+        {0xef34a24dU, 0x926e2c00U, 0xd9e159d0U, 0x0adbc968U, 0x9cf918d5U, 0x905a857aU, 0x87a79ff3U, 0x465370b2U,
+         0xb33887f4U, 0xa2f8fb20U, 0x15d37a10U, 0x588e09b2U, 0xfdeec2c1U, 0xa4af8bdaU, 0x8368c082U, 0x35e531b3U},
+        {0xe57e8dfaU, 0xfcfc0cb9U, 0xa3c7e184U, 0x09809191U, 0xaca98ca0U, 0x0d9a30f8U, 0xf0799c4cU, 0x8262cf2fU,
+         0xfbac376aU, 0x35cff8d8U, 0x2b14c478U, 0x57b6ed33U, 0xc5b34f34U, 0x66fee22eU, 0x09109e4eU, 0x83fd95e2U},
+        {0xe285131fU, 0xd5b901b2U, 0xc813b088U, 0xaaec6ecdU, 0x66ad6240U, 0xd664a18fU, 0xe23cbd77U, 0x241febb8U,
+         0x2750026dU, 0xabb3e66fU, 0xbd0cb5afU, 0xcd50fd0fU, 0x13981df8U, 0xd6c420bdU, 0xff94f8d3U, 0x513378d9U},
+        {0x026bdb6fU, 0x9052e48bU, 0x7b734b94U, 0x7ca41bd4U, 0x4ce99c87U, 0x168105b2U, 0x1da0ddd5U, 0x19825c8bU,
+         0xc49cfc9bU, 0xb5df7084U, 0x8cf6d3a6U, 0xebe9eeccU, 0x94f59f6cU, 0x320261ccU, 0x0d4c878fU, 0x6294310fU},
+        {0x7c70620cU, 0xd17cc1f2U, 0xabc288d9U, 0x4998c4beU, 0x2b671780U, 0xc60dd31aU, 0x8d2c236dU, 0x1653a8a4U,
+         0x315b32cdU, 0x6ca2e81dU, 0xdfd3dc52U, 0x012af748U, 0x4efa701cU, 0xeafa9947U, 0x35af7f7aU, 0x03382909U},
+        {0x3d82824cU, 0x50ed0952U, 0x5e1534e6U, 0xdfa58e34U, 0xc6c2999eU, 0x43c5f56eU, 0x11601914U, 0x6f12d86cU,
+         0x06eb34d0U, 0x8579c348U, 0x0854bc5bU, 0x391c9241U, 0xfd623769U, 0x875994f3U, 0x4ab3bfa0U, 0x5c4ff7f4U},
+        {0x9b920471U, 0xedcb6306U, 0xf423de0dU, 0xfc318b85U, 0x83d8f8d9U, 0xfce4cc29U, 0xa172fa79U, 0x5d1bdb4eU,
+         0xf7b83103U, 0x70330666U, 0x96c56e7bU, 0x79eb1e99U, 0x38a22656U, 0x794bb994U, 0x79379e2eU, 0x28438267U},
+    },
+    {
+        {0x51e5b739U, 0x73fce5b5U, 0xfd2222edU, 0xe0b93833U, 0xc6fc846dU, 0x72f99cc6U, 0x728b865aU, 0x175e159fU,
+         0xe9fed695U, 0x6efa6ffeU, 0xdd24345cU, 0xacb5955aU, 0x1ff71f5eU, 0xa4ef97a5U, 0x9e3c79ebU, 0xd3506e0dU},
+        {0x46bc47d6U, 0xce78049eU, 0xc6da121bU, 0x30fdfeb5U, 0xe139c621U, 0xa5ffbcc8U, 0x03ff32d7U, 0x423a013fU,
+         0x8b548a34U, 0xd1236e6dU, 0x524f009eU, 0x720d8ec3U, 0xbaf6b3c7U, 0xa1179f7bU, 0xe1e1d970U, 0xb91ae00fU},
+        {0xc5041216U, 0x65b7f8f1U, 0x842b836aU, 0x3f7335f6U, 0xdc2fed52U, 0x128b59efU, 0x21f7acf4U, 0xda75317bU,
+         0x6e708572U, 0xdaed3298U, 0xe77acedaU, 0xe9aac07aU, 0x342d7fc6U, 0xdf19e21bU, 0xbf72d5f0U, 0x73f8a046U},
+        {0x8416824aU, 0x302df6f7U, 0x3b3e2741U, 0x49df662fU, 0xbcd68776U, 0x08907a7aU, 0xac1fb905U, 0x111d6a45U,
+         0x2108e9d0U, 0xa9a111d4U, 0x96daca4cU, 0xf0700089U, 0xff065952U, 0xb90d48dbU, 0x478eaffbU, 0x0696911cU},
+        {0xe465a930U, 0xb0143e71U, 0x6b1352fdU, 0x2587f1c1U, 0x4a82eb1eU, 0x0573c58cU, 0x8e9749d7U, 0x1c71c5b4U,
+         0xc34638b5U, 0x1d873f6cU, 0xb7174d47U, 0x79345e3fU, 0x824bb68cU, 0x2713f1f2U, 0xe8f5fa0cU, 0x4a91c334U},
+        {0x3c62bac0U, 0x9505324fU, 0x51f0ab06U, 0x19150ddfU, 0xc3e8b70eU, 0x1364b7d2U, 0x023f469cU, 0x9530f0f9U,
+         0x7618e309U, 0x478abda9U, 0x2f1fdc68U, 0xe25b3285U, 0x59b333e0U, 0x34dd2f7fU, 0x8f9f21e2U, 0x8f3c305aU},
+        {0xbadb6ee7U, 0xe318dae5U, 0x2744a077U, 0x7850dd43U, 0x909b4c9cU, 0x936e837aU, 0x1f31a566U, 0xd84e4afcU,
+         0xd42ebed2U, 0x82d556e6U, 0x4aa3e649U, 0xfdd8ac97U, 0xf565de4dU, 0x12a38d58U, 0x7c7b79ceU, 0xe525809aU},
+        {0x1bced775U, 0xab5edde0U, 0x5ef74e56U, 0x7290b68aU, 0xbcb9dcffU, 0xad795dbeU, 0x7ac7c8b8U, 0x4a4a6dc9U,
+         0xa78dd66dU, 0xb2bf8f68U, 0x424742acU, 0x1de90cdbU, 0x39c0f457U, 0x943ef9f7U, 0x16631e72U, 0x529911b0U},
+    },
+    {
+        {0x83ff4640U, 0x526bad8fU, 0x55552ffeU, 0x53441c7eU, 0xb6262ee0U, 0x99ceac05U, 0x47b00c9cU, 0x363d90d4U,
+         0x3bee9de9U, 0x62003c7fU, 0x08199ecbU, 0x45b9a890U, 0x97f33631U, 0x953b4453U, 0xfc732221U, 0x04e273adU},
+        {0xaf92c541U, 0xd2712a5cU, 0x2edfb59dU, 0x0b62fb01U, 0xc93b02bfU, 0x553973c6U, 0xed9a7e9bU, 0x4c1b9866U,
+         0xc68fe020U, 0x72c4f3fdU, 0xe43eb1adU, 0xc652ead7U, 0xce56e69cU, 0x7fbcb753U, 0x20be8a0fU, 0xc1f792d3U},
+        {0xf6e55dc8U, 0x4b891216U, 0xeaca0439U, 0x6ff95ab6U, 0xc0509442U, 0xba84a440U, 0x90c5ffb2U, 0x44314047U,
+         0xdbe323b3U, 0x31d944aeU, 0x9eaa2e50U, 0xa66a29b7U, 0x5642fed7U, 0xfe99837fU, 0xe65366f8U, 0x96b0c142U},
+        {0xbeaaf3d1U, 0xe0c8f28cU, 0x1a28f135U, 0x3233edbcU, 0x0780b54eU, 0x529a2f3cU, 0xba83b12bU, 0xa4083877U,
+         0xf0b254b9U, 0xb12b534dU, 0x6ed1ef90U, 0x2001e757U, 0x9361b3e2U, 0xb8bf83d6U, 0xfeefbc79U, 0x40e9f612U},
+        {0x701b23a8U, 0xdfe9485dU, 0x0a87ee0aU, 0xab7b7d47U, 0xb921089dU, 0x126243d5U, 0x866ca87cU, 0x9e22fe8dU,
+         0x0884edaeU, 0xf7a413c5U, 0xfb511cecU, 0xc0f7c949U, 0x099c1533U, 0x177f3f02U, 0xca122d10U, 0xfd2ff0e9U},
+        {0x33f0e9aaU, 0x3eb5e196U, 0xb11bd34bU, 0x68112776U, 0xd58138d2U, 0xb7924ae0U, 0x575f26adU, 0xe5380fe8U,
+         0x4082720fU, 0xc4ba4136U, 0xf468318eU, 0x6fb94e5dU, 0x924c8e01U, 0x5b691363U, 0x9087b41dU, 0xb97fd873U},
+        {0x071a70e4U, 0xdd7408bfU, 0x5f5cf475U, 0xcd5ee51fU, 0x4705306dU, 0x2edd69e6U, 0x03ce2a8dU, 0x508df6d5U,
+         0x29950984U, 0xdf2e5bf7U, 0xee8aadfeU, 0x4ec03228U, 0x733e49c5U, 0x777304aaU, 0x933bc42dU, 0x154c439bU},
+        {0x7940d33aU, 0x8cd3db5aU, 0x454203b9U, 0x6e0d880aU, 0x2f56c86fU, 0x3a4e3e1aU, 0xd28cc0b5U, 0xa804c641U,
+         0x6d46967aU, 0x43ce95faU, 0x9cf736a9U, 0x1af18ca8U, 0xc16047e8U, 0x3dec2842U, 0x2b2fa6d0U, 0x95be8325U},
+    },
+    {
+        {0xdffdf80cU, 0x69f79a55U, 0xa15bcd1bU, 0x43e4a781U, 0xb7456388U, 0x8c6244b5U, 0x5df3c2beU, 0x8b4b5f16U,
+         0x5fd4fd36U, 0xb3eff0c6U, 0x6162ee56U, 0xf9e33654U, 0x3ab0da04U, 0xb3fbd781U, 0x68d308b4U, 0x4aad0a6fU},
+        {0x4755e4beU, 0xbb3f2671U, 0x417c997aU, 0x71af64eeU, 0xc83c6110U, 0x8ce17c7eU, 0xe1329171U, 0xed0c5ce4U,
+         0xa07bf42fU, 0x63f9fa6eU, 0x763ddab1U, 0x49d93925U, 0x5a7ea680U, 0xbf3dad7fU, 0xbc2345bdU, 0x221a9fc7U},
+        {0xf55812ddU, 0xa0a2a582U, 0x552d30e2U, 0x3d446723U, 0xc058f78eU, 0x0b6abed6U, 0x92ff352fU, 0x7029bd7aU,
+         0x1a2d2927U, 0x721cc66bU, 0x43b2c73cU, 0x47dae842U, 0xe30683acU, 0x7dd6544aU, 0xfde8b3d2U, 0xb0eefadaU},
+        {0x07cec8abU, 0xd4b6e6c8U, 0x6e0552ceU, 0xe5325456U, 0x83f1fae8U, 0xb3b15c3fU, 0xc44ce694U, 0xfaecb013U,
+         0xab155070U, 0x8981dfd9U, 0xb85e2e2eU, 0x9c32b286U, 0xec2fb13dU, 0xfc2e02c6U, 0x0e9ecb57U, 0xcc09b5e9U},
+        {0xbd486ed1U, 0x49ce5683U, 0x49565b6aU, 0x5745bebaU, 0xd8cf7560U, 0x009d4109U, 0xeae65c99U, 0x9ccfedcaU,
+         0x75e95d8dU, 0x4f6d59edU, 0x69592aa2U, 0x24216759U, 0x200b3411U, 0xb6122481U, 0x3d6a32cfU, 0x7c2f4d71U},
+        {0xb181fdc2U, 0xdcdabff9U, 0x5cc62364U, 0xdd2f62bbU, 0x18a34e7eU, 0x4aa264b8U, 0xf47e6e47U, 0xf42c102aU,
+         0xa485d7fdU, 0x81f00093U, 0x9a2acf26U, 0x4c15502dU, 0xb86fe22aU, 0x78fad05cU, 0x6cfe806cU, 0x57503ab4U},
+        {0x5bd0eacaU, 0xa206b1a7U, 0xba2d4ab7U, 0xd0c74576U, 0x3ca4df19U, 0x35a8fde3U, 0x63414143U, 0xcd9a4b87U,
+         0xabff4accU, 0x6e6fafb5U, 0xed6f634fU, 0x0127b38eU, 0x933ea08bU, 0x815488aeU, 0xa1e8f23eU, 0xf0455879U},
+        {0x9ad1b1f7U, 0x07f64eaeU, 0x4f23cd3eU, 0xb3b2dd82U, 0x37cbcafdU, 0xc8731a0bU, 0x2dcad2f2U, 0x09bb8a13U,
+         0xc3811c80U, 0x64130627U, 0xf4752d53U, 0x0f54a840U, 0x4f863e85U, 0xb6f9dd28U, 0xafeee3b9U, 0x945bb2b2U},
+    },
+    {
+        {0x5232fcdaU, 0xcb611592U, 0xa6c0e77bU, 0xb700dbffU, 0x0bd548c7U, 0x6bf771c0U, 0xe5db996dU, 0x723cbaa6U,
+         0x9eb39f5fU, 0x01dc069dU, 0x37794948U, 0x2660a065U, 0x88824d6eU, 0xa9211374U, 0x595cc498U, 0x96e867b5U},
+        {0x0ca030d5U, 0x1fd383d6U, 0x07984907U, 0x2d240a43U, 0x5773a3c6U, 0x343d7dc4U, 0x437b744dU, 0x57efa786U,
+         0x74b02f9eU, 0xb07ab442U, 0xe5e9974aU, 0x689b6d2aU, 0x28de03ecU, 0x893627c9U, 0xd1b48518U, 0xd712db0bU},
+        {0x80633cb1U, 0x2567e09eU, 0x69d02113U, 0x575a224bU, 0x12181fcbU, 0x00c62732U, 0x17aacad4U, 0x6dde9cf3U,
+         0x67ce6b34U, 0x57dd49aaU, 0xcf859ef3U, 0x80b27fdaU, 0xa1ba66a8U, 0x5c99ef86U, 0xa707e41dU, 0x9188fbe7U},
+        {0x0c584dd5U, 0x7fafc777U, 0x327b012aU, 0x1080577eU, 0xd5226cb9U, 0xa2df7e9cU, 0x6a28bc42U, 0x264bbd43U,
+         0x7704ab11U, 0xe6122793U, 0x717b8d8dU, 0x6a118243U, 0x4c33be22U, 0xd4f75ce2U, 0x4ee093b4U, 0xd87c6fa9U},
+        {0x2933f3c5U, 0x419a518dU, 0x15f12522U, 0x085a0f71U, 0x8e47b850U, 0x13c4bb7fU, 0xd5b5cde8U, 0x486fa72cU,
+         0xcafb0f53U, 0x9ad4a71aU, 0xcf0f23b7U, 0x62d9b783U, 0xecc8f19fU, 0xe48c48baU, 0xf56bdd43U, 0x62e12319U},
+        {0x44e5467dU, 0x4d0bd76aU, 0x19bbfaceU, 0x40908ab8U, 0x0ec970e9U, 0x2c21f62eU, 0xfc69a122U, 0x97d064f0U,
+         0x1e9cb3faU, 0x797300fdU, 0x54f17ccdU, 0xda5fb3b8U, 0xa850861fU, 0x03f7c66fU, 0xd33402ccU, 0x89974f2eU},
+        {0x5e99f728U, 0xebd59422U, 0xe6f12204U, 0x677375fbU, 0xb76a5303U, 0xb664ff27U, 0xa894af4fU, 0x24796974U,
+         0xebaaebffU, 0x37a00516U, 0x9575a2d8U, 0x5adbf3c0U, 0x7d8d664aU, 0xec52e87eU, 0x688f3001U, 0xe3d78d44U},
+        {0x4b2438e8U, 0x2bf26bd8U, 0xd5bdec9dU, 0xa78bc61fU, 0x6236a79dU, 0xdac85c05U, 0xbd40d2bbU, 0xa94c6524U,
+         0xf18661f4U, 0xc2e2c8dbU, 0xa0e39b2bU, 0x7e5d3c60U, 0x05019e3aU, 0xfd792195U, 0x92f96280U, 0xb5201fd9U},
+    },
+    {
+        {0x0e7dd7faU, 0x9a533ecaU, 0x37a91983U, 0x09479612U, 0x12c2d3b5U, 0xba5feec8U, 0x93bebf98U, 0xeebfa4d4U,
+         0xe1de8999U, 0xddfd4fdaU, 0xa711f712U, 0x9ae4cdc3U, 0xf178089dU, 0x69ee7edaU, 0x970ef0f2U, 0x5d9a8ca3U},
+        {0x47d297fdU, 0x76bee908U, 0x8f6766d6U, 0xc4ea4bc0U, 0xc118495fU, 0xa61c6031U, 0xa7a97bfdU, 0x381c4ad7U,
+         0x7d493fc5U, 0x93ace318U, 0xdb939c00U, 0xf0451032U, 0x09915eccU, 0x8f3e5fa7U, 0x238eeee4U, 0x936af53bU},
+        {0xbb7cecebU, 0xf3f678ffU, 0x8897faf0U, 0x73a59f93U, 0x6f6e6814U, 0x36ffb812U, 0x4276d450U, 0x437a8620U,
+         0x56c181e1U, 0x7363bcc3U, 0xdc8f9782U, 0x87220fcfU, 0x99d297ffU, 0x69b8feb6U, 0x3eeac32fU, 0x0b916ba1U},
+        {0x2ede454cU, 0x448d7042U, 0xefdd08b2U, 0x9cf1d05fU, 0xd9538c47U, 0xcce10831U, 0x05adc63bU, 0xe1efb9cdU,
+         0xa8913797U, 0xad9fd233U, 0xa7a2d4c6U, 0x464e3244U, 0xfe477123U, 0xb0154c1fU, 0xd8af9be7U, 0x0ecb4530U},
+        {0x097f96f2U, 0xd58d729eU, 0xd2c8735cU, 0x35823529U, 0x9a3cc273U, 0x83cb7e3bU, 0xe2a489bcU, 0xa9ef9f13U,
+         0x56c04be4U, 0xc03d55b0U, 0x5a9b4702U, 0xb74f89afU, 0x0ebb613dU, 0xd956ee16U, 0x94559d7cU, 0xe814cce5U},
+        {0xdcbf00ebU, 0x4c9d9d87U, 0xc18d0227U, 0x41b4e98bU, 0xa1a30bc2U, 0x49be16f6U, 0x96ead4dcU, 0xb89070aeU,
+         0x1b0e664eU, 0x1b7f1bcdU, 0xb6b96a67U, 0xcb0d8b06U, 0xc1c4a766U, 0x472294e4U, 0xc8a2d88fU, 0x6f24c8c2U},
+        {0x350cf77eU, 0xbc0ab5a1U, 0x54a8ab0dU, 0x07dbf574U, 0x9faa0642U, 0x553827d6U, 0xee1d35beU, 0x66d80541U,
+         0xa0eaa3a6U, 0x2a5f97afU, 0xb7b1b76dU, 0x9444b43aU, 0x535613f6U, 0xc3f1d420U, 0x32fffb42U, 0x51cfdfe7U},
+        {0x29eb99a4U, 0xd33feeb3U, 0x33d47b18U, 0xc7e5419fU, 0x9af475a8U, 0xc5ac235eU, 0xa2697010U, 0x5318f9b1U,
+         0xfe91f92dU, 0x2c726eeeU, 0xd1e3ec65U, 0xa41f2b40U, 0xebb405e8U, 0x5772d93aU, 0x4beda419U, 0xf44ccfebU},
+    },
+    {
+        {0x39a48db0U, 0xefd7835bU, 0x9b3c03bfU, 0x9f1215a2U, 0x9b7bde45U, 0x2791d0a0U, 0x696e7167U, 0x100f44daU,
+         0x2bc65a09U, 0x0fbd5cd6U, 0xff5195acU, 0xb7ff4a18U, 0x0c090666U, 0x2ec8f330U, 0x92a00b77U, 0xcdd9e131U},
+        {0x1e4df706U, 0x4b05284fU, 0x237d0808U, 0xd8d9c8f9U, 0x2b4c4199U, 0xa8415dffU, 0xceb5c771U, 0x8c0989f2U,
+         0x5d72fa98U, 0x736ac5a3U, 0x156511aaU, 0x60de6bf5U, 0xb9dc966cU, 0xffd2172cU, 0x4f432034U, 0xfb4dbd04U},
+        {0x95bc15b4U, 0x9cb9a134U, 0x465a2ee6U, 0x9275028eU, 0xced7ca8dU, 0xed858ee9U, 0x51eeadc9U, 0x10e90e2eU,
+         0x58aa258dU, 0x34ebe609U, 0x02bb6a88U, 0x4ca58963U, 0x16ad1f75U, 0x4d57a8c6U, 0x80d5e042U, 0xc68a3703U},
+        {0xdc47bffdU, 0xb1e63c33U, 0xbc95bc1bU, 0x9c528539U, 0x3262c025U, 0xc4a48174U, 0x5e266704U, 0xfb8f153cU,
+         0xd949b095U, 0x090a45ddU, 0xac542613U, 0x1dde1389U, 0xb4bccd53U, 0x16fa11d9U, 0xc5e06218U, 0x6ca27a9dU},
+        {0x3fe75269U, 0x2dd3fc30U, 0x053d3318U, 0xa377a3ccU, 0x714b7dcdU, 0x4575b90bU, 0xda541638U, 0xf7422f42U,
+         0x17e49bd5U, 0x18980e87U, 0xf4a398e0U, 0x7fb3a237U, 0xb9f63597U, 0xd18ce7dcU, 0x3313093fU, 0x406c2f1aU},
+        {0x7a1c0a80U, 0x0f62abc8U, 0xc65a9c74U, 0x4d625158U, 0x002ff9c3U, 0xb17c9be7U, 0xa614cca5U, 0xb6b15a68U,
+         0x41ce0a03U, 0xb6cd0110U, 0x082e16eeU, 0x9c9a12b3U, 0xef6536d4U, 0xa54e223eU, 0xd6cdb61eU, 0xfae62e14U},
+        {0xf5a7175fU, 0x653b6696U, 0xd31cf42aU, 0xedb8e771U, 0x82d5debbU, 0x72879a55U, 0x17d43cffU, 0x2d8cad04U,
+         0xbb9d592aU, 0xcf37bb91U, 0x9cb5e5e0U, 0x7a846bfdU, 0x612c9d37U, 0x7bb232faU, 0x318ca94aU, 0xc73f3b83U},
+        {0x4bb2629aU, 0xb8fa1b8bU, 0x7737a7b8U, 0x65a02c58U, 0xa7287084U, 0x5a0cc9f0U, 0xd75d5175U, 0xe747333fU,
+         0x6946f6d6U, 0x9f8d961aU, 0x6e1a969aU, 0xc88376aaU, 0x804c2581U, 0x4cc43603U, 0x45070c11U, 0xf2affe01U},
+    },
+    {
+        {0xe534fd2dU, 0x2c8acde6U, 0x64f3b385U, 0xa77f8d44U, 0x4a04c017U, 0x1dc9227aU, 0x62c7ed1bU, 0xe1031be2U,
+         0x9456a00dU, 0xa44f18f2U, 0x9e1ced79U, 0xf292dd41U, 0x6597535aU, 0x6bb6a417U, 0x8940405eU, 0x9d706192U},
+        {0xa95c8356U, 0x84e27e36U, 0xde94d857U, 0x028a6ac5U, 0x0f29b2c9U, 0xb9f95dcdU, 0x4c8089eaU, 0xf4b93f22U,
+         0xbe001fd3U, 0xbd5861b9U, 0x4915609aU, 0xc37ef134U, 0xa40eee90U, 0xb0e5f6a7U, 0x062962dfU, 0xa67a92ecU},
+        {0xef028d83U, 0x579623aeU, 0xba743961U, 0x6195926dU, 0x15de69dbU, 0x6a5abe5aU, 0xe3c785ecU, 0xa7ebf7c4U,
+         0x99d0bed1U, 0x9640392bU, 0x4b053919U, 0x47a38927U, 0x7044804bU, 0xcfd9c737U, 0xbfe362d5U, 0x6205152fU},
+        {0x7b160e8aU, 0x20d62fe1U, 0xf97e696cU, 0xd51e8512U, 0x025b08b0U, 0xb19622eaU, 0xfce55236U, 0x09d1aca1U,
+         0x7ca04c44U, 0x34e050c5U, 0x9212b5e5U, 0x6fe9e0eeU, 0xe0d8c27eU, 0x3e56692cU, 0x5101f0c6U, 0x1153188fU},
+        {0x27dd5cfaU, 0xbae0e402U, 0x7f09d4b5U, 0x6a89c513U, 0x42634633U, 0x1cdc6a53U, 0xcb024f4cU, 0x5b5ca08dU,
+         0x9e48e98cU, 0xe664a6f9U, 0xaf3269d3U, 0xbfd067ccU, 0xa8869094U, 0xe991f0ceU, 0x0aa15825U, 0x3eccb6f7U},
+        {0x7bb61ee5U, 0xf2884413U, 0xfb1f0c13U, 0xda4f04e2U, 0x8974ae6eU, 0x662638cdU, 0xcc8721b8U, 0xd4933230U,
+         0xe5d694a8U, 0x662da4d0U, 0x5a438ddcU, 0x1ad12c8cU, 0x1ecafb5eU, 0xedcc5e9dU, 0xf51a9d23U, 0x021c09abU},
+        {0x23531f82U, 0x2b9528e3U, 0xb10c2c9fU, 0xff51326bU, 0x89c22c29U, 0xccef3e74U, 0xc1114bb5U, 0x046f26acU,
+         0x0bceda07U, 0xa505fc8bU, 0xdab55c7fU, 0xd025945cU, 0x2fc32579U, 0xce2370acU, 0x635b82eaU, 0x6b804b31U},
+        {0x75ba7fc2U, 0xe97d7d04U, 0xbfc39562U, 0x518b3a93U, 0x3821cde7U, 0x18a2ad79U, 0x454c2b9eU, 0xc66c59ccU,
+         0xf75f5956U, 0x7ec3c69cU, 0xb1595597U, 0xf00a60ddU, 0xaac10cb2U, 0xbea4f3ceU, 0xbfb30fcfU, 0xd9592fe2U},
+    },
+    {
+        {0x9094696dU, 0x2d5e688dU, 0xa41d6af5U, 0x5cf8b266U, 0x143bd7ecU, 0x0ac2839fU, 0x46d55b53U, 0xfeea6caeU,
+         0x18090088U, 0x3155debfU, 0xcc41442dU, 0x981c8957U, 0xbf3ecd5cU, 0xb06e4e12U, 0x97dce1baU, 0xe57c6b6cU},
+        {0xee752b08U, 0x0aa4040aU, 0xb331a187U, 0x141ecae0U, 0x9db2e179U, 0xc53261afU, 0x1adb87e1U, 0x4d000b62U,
+         0x48302ceaU, 0x3e72851fU, 0x19c7293aU, 0xcb7df5f1U, 0x82d972ccU, 0xcb6d8255U, 0x18e0d255U, 0x6a0d5b8fU},
+        {0x48dfd587U, 0x079361bbU, 0xc9b02656U, 0x5ec4ba38U, 0x2cf5a12dU, 0x34867aaaU, 0xacf4508bU, 0x5084b41bU,
+         0x91470e89U, 0x6e79e97fU, 0x6891f560U, 0x5db6f560U, 0x55292747U, 0x619aa6c8U, 0x1d980d31U, 0x34a9631aU},
+        {0x475c58efU, 0xf89962fdU, 0x3e1f1b77U, 0xd657a040U, 0x14717128U, 0xd6aa2621U, 0x203da05dU, 0x71f570caU,
+         0xd35d420eU, 0xf8649a72U, 0xc3363e7dU, 0xf2445d00U, 0x5bc95b8dU, 0xd2555734U, 0x95dc880dU, 0xeb42415bU},
+        {0x7ab34cc6U, 0xd0823261U, 0x7cf30a12U, 0xc80c2976U, 0xd18d7128U, 0x53fb3f1fU, 0x0642d5eaU, 0x4f14c03eU,
+         0x987e681fU, 0x25ec252fU, 0x8e81dd02U, 0xb9de3cceU, 0x43a62540U, 0xc653a70fU, 0xcaa4e894U, 0x7b53d0a8U},
+        {0x6c953fa9U, 0x4d05956dU, 0xf0b8c3dbU, 0x28ab2629U, 0x4bd18c06U, 0x3a5f485dU, 0xaaab9323U, 0xa49ed10eU,
+         0x46fb4c72U, 0x67b2bd22U, 0x968e181bU, 0x5ae87534U, 0xa0dfddfbU, 0xe03476c0U, 0x660f5398U, 0xcc72b894U},
+        {0x1241d90dU, 0x34277101U, 0xdb2444f8U, 0xe81cf141U, 0x5eddd363U, 0xd4143609U, 0x49c79ed1U, 0xa74db87eU,
+         0x3f7adad4U, 0xf32518b8U, 0x44a0a313U, 0xa9ee5093U, 0x588171c8U, 0x27fdd08aU, 0xaf23eef3U, 0xf78691cdU},
+        {0x43ff8359U, 0x6048b060U, 0xc65e7651U, 0x46b4821dU, 0xc21da014U, 0xb7d282b5U, 0x9f7bd253U, 0xa2b7b362U,
+         0xfe86fec2U, 0xa2397fecU, 0x046f3835U, 0x10d10835U, 0xf71e29c9U, 0x57a937a3U, 0x1695122dU, 0x69303894U},
+    },
+    {
+        {0xc1ec6cb1U, 0x33fa978bU, 0x808583deU, 0xfeed657dU, 0xe6ffca3cU, 0xb367be4bU, 0x91049cdcU, 0xda67a91dU,
+         0x7a68be1dU, 0x7e9ea8e2U, 0x08f740a1U, 0xdec7adc5U, 0xec9780e5U, 0x41f463f7U, 0x481642bcU, 0x9bacaa35U},
+        {0x1fe741c9U, 0x5ee3cc82U, 0xccea5a83U, 0x8bbd9f35U, 0xaf00d871U, 0x7c0c0cfaU, 0x5fa1ef58U, 0x4dbacd36U,
+         0x338eb623U, 0x60be10f8U, 0x9fc0535fU, 0x0cc384a0U, 0xe838299dU, 0x7fdcfd59U, 0x8a51892eU, 0x16c3540eU},
+        {0x15bc8a44U, 0x9efdd065U, 0xcbe151a1U, 0x68410177U, 0xba5a5fc7U, 0xd38565a4U, 0x3cfceda3U, 0x4d018058U,
+         0x1adbc09eU, 0x2f1f94c9U, 0x8582da36U, 0x96942046U, 0x07d63813U, 0x67e9ba80U, 0x8cb4f5d3U, 0x3a33c6c1U},
+        {0xb4e218daU, 0x87eda8baU, 0x52686050U, 0x0f4c85f1U, 0xff41c259U, 0xe68f17d8U, 0x81509beeU, 0x13d1ffc4U,
+         0xdb191c19U, 0xe0db419dU, 0x6d5bd127U, 0xa4ad0120U, 0xb1b758bdU, 0xcecb9337U, 0xa991961dU, 0x6008391fU},
+        {0x65daeb00U, 0xbc1ab528U, 0xce645f76U, 0x5923eb24U, 0x73b6e9d1U, 0x082cb6a2U, 0xdf5cf957U, 0x2f661507U,
+         0x833992c0U, 0x12276789U, 0x195d308cU, 0x6ecdee27U, 0x8200add0U, 0x6ef9537aU, 0x6f52b33fU, 0xfd5c1213U},
+        {0x935b4eb8U, 0xf52213e4U, 0xab8b5a3cU, 0x07f557f1U, 0xccaf2dceU, 0xf0ff54a3U, 0x3adf2256U, 0xc11968e4U,
+         0x6f911addU, 0x7044996dU, 0x12a7149bU, 0x42f8b494U, 0xe6766f82U, 0x8379d81fU, 0x7786458fU, 0xbff5e693U},
+        {0x916aa6d9U, 0x182a90a0U, 0x47702dcfU, 0x3662c8b6U, 0xa1835a38U, 0x254f174dU, 0x05fe47d2U, 0xf594117dU,
+         0xbf2e50cfU, 0xc7d0696eU, 0x3e6b5b86U, 0x7a927788U, 0xb094bcebU, 0xcf65dbdaU, 0x6e971b12U, 0xcaa761a5U},
+        {0xa2e96db8U, 0x133b40caU, 0xce29dbffU, 0x3cc9d916U, 0x45b0533bU, 0x7659c79cU, 0xef6c6000U, 0x219b4f9cU,
+         0x8d3b6bc7U, 0x27df01a7U, 0x3e905765U, 0x394f8ac5U, 0xc0372a6eU, 0xf5a44180U, 0xd959efeaU, 0x24d9c605U},
+    },
+    {
+        {0x1a37b7c0U, 0x57545cccU, 0xbb11069fU, 0xec08d0f7U, 0x5ef22151U, 0xa6e00093U, 0x0b334cddU, 0x53904faaU,
+         0x022771c8U, 0x9dcb096bU, 0xe1443469U, 0x13999981U, 0xc20d3c1cU, 0x88c9eccaU, 0xbc80106dU, 0x5bc087d0U},
+        {0x38a47ca9U, 0x57cd0f1fU, 0xad0f85adU, 0x2a6ee7aaU, 0x6316995dU, 0x3cf99119U, 0x9d414675U, 0x01a575afU,
+         0x77ebcdb7U, 0x67c5df2eU, 0x9f4d7ea6U, 0xbdb93c5dU, 0xe1bb8698U, 0xcc55fc52U, 0x8ab20dc3U, 0x3038f1cbU},
+        {0x48a2050eU, 0x71ac42feU, 0x615f8a67U, 0x742ef557U, 0x6e479b89U, 0x96b769ccU, 0x24bc7318U, 0x673724fdU,
+         0x061d3d70U, 0xb90c9a49U, 0x43349cc2U, 0xbe6bacfdU, 0x9a886b6dU, 0x203482c0U, 0x896a4a20U, 0xe4cf8257U},
+        {0xe315565bU, 0xe309d755U, 0xd3c20c6eU, 0xd3a61a83U, 0xb76155d6U, 0xca71f5c1U, 0x7621d439U, 0xf5f0e043U,
+         0xdd2ecc82U, 0x678430afU, 0x3ed7e40aU, 0xa5bf61bfU, 0x0df7101aU, 0xf6218916U, 0xbe5a052bU, 0x6b9f4e62U},
+        {0x82de63bfU, 0xcbf6e483U, 0x87261c66U, 0xe03af532U, 0x1f6166a8U, 0x9e598a63U, 0x72df4c30U, 0x4366efa4U,
+         0xe17924cdU, 0x02c6a408U, 0x5aaa6d6bU, 0xf33b0c52U, 0x130268eaU, 0x2ee2537eU, 0xbee2d7ceU, 0x2e7dd909U},
+        {0xa9a78179U, 0x34cf601fU, 0x260d6afeU, 0x6b50e905U, 0x6209ed9fU, 0x905a4733U, 0x7081b8dcU, 0x995ca7f3U,
+         0xafec1f47U, 0x931fbb4cU, 0x9ab64e52U, 0xbbcc8556U, 0x0492863aU, 0xb5e34d88U, 0x5553573aU, 0xd9a059e9U},
+        {0x06f96190U, 0xf10527ffU, 0x07c9525eU, 0xd1f02de9U, 0x667aa75fU, 0x97be5569U, 0x7991ab1fU, 0x7bd75362U,
+         0xabda00f6U, 0xa3d17204U, 0x1e0ea695U, 0xce0fcc5cU, 0x943827d6U, 0xd5ed6474U, 0xdbba6309U, 0x8336f2b3U},
+        {0xf5362d33U, 0xcbe781d9U, 0x46227642U, 0x47cbc921U, 0x970ca4e3U, 0x57a7f36dU, 0x6c0b6e9aU, 0x8f506f0bU,
+         0x87fa243fU, 0x30487d0cU, 0x43bb8eafU, 0x48cf925dU, 0x4f1c3368U, 0x9530c542U, 0x2afa6171U, 0x469f955dU},
+    },
+    {
+        {0x3ad86047U, 0xeff959f4U, 0x3a9b8bcaU, 0x79b53a04U, 0x64ca9067U, 0x719cca77U, 0xd35983a7U, 0x8e7bcd0bU,
+         0x8460372aU, 0xea10047eU, 0x47fd68b3U, 0x79e88e2eU, 0x0ca95145U, 0x94031042U, 0x2a3da4b3U, 0x10b7770bU},
+        {0xf13f0351U, 0x77d2808bU, 0x3d0389e7U, 0x3bc15b8dU, 0x996950dfU, 0xc350f319U, 0x195e729dU, 0x33b35baaU,
+         0xcb8d7418U, 0x2bc503ccU, 0xbc889b70U, 0xaa6560efU, 0x248d52bcU, 0xf9464036U, 0x640abf87U, 0xa58a0185U},
+        {0x041ead4bU, 0xffe8879aU, 0x691b03c1U, 0x3a75edfbU, 0xfafe76beU, 0xc714734eU, 0x8c8f337eU, 0xbfc90c0cU,
+         0x86fedaedU, 0x7452c6f0U, 0x32e0ae3eU, 0xfb468effU, 0xd5042d36U, 0x4dba718dU, 0xe09cded2U, 0x7a9481b1U},
+        {0x4414bb36U, 0xd71dc7b2U, 0xcad7bca6U, 0x56f6e109U, 0x071f7e22U, 0x5cb83ad2U, 0x22c93f95U, 0x374deeaeU,
+         0x8daf734aU, 0x7875bea9U, 0x00e54321U, 0x3828d663U, 0xf806f729U, 0x16032c06U, 0x4fcd4f99U, 0x171165b6U},
+        {0x75bb3b3eU, 0x26e7bd07U, 0xef9f73cbU, 0x50753617U, 0x8c2d3f5bU, 0xdca5993eU, 0xbe3faaa4U, 0x732df11cU,
+         0xd7366693U, 0xcc577e1eU, 0x64c58436U, 0xe69dad6dU, 0x40253916U, 0xcb7e2558U, 0xde8f9977U, 0x7f41903eU},
+        {0xe5b7ad0dU, 0x694c856eU, 0xa9d0d1d3U, 0x76ee767cU, 0x96d16c44U, 0xc2d0d8a4U, 0xabb5e00dU, 0x3a55690dU,
+         0xb2e8c407U, 0xd6c98790U, 0xcac31218U, 0x01cacb8aU, 0x97ef99f3U, 0xfb21fbacU, 0x75a0657bU, 0xc3e28e19U},
+        {0x888dc3b9U, 0xc5f5b3c1U, 0xe9774c99U, 0x19a66924U, 0xcc97ef60U, 0x28da8840U, 0x603947b4U, 0x4ce094b9U,
+         0xe5c0de52U, 0x2c14f7b6U, 0xc9ea0650U, 0x16205b20U, 0xca76aca2U, 0xd57b4d80U, 0xbf1a9b3eU, 0x05390fbaU},
+        {0x6ae7d616U, 0x5e8a64adU, 0xb62a9f0cU, 0x944dbaf2U, 0x95aeb0dcU, 0x7c46e073U, 0x7f3aeae5U, 0x2380c09cU,
+         0x161bbc1aU, 0x0099be48U, 0x8f846756U, 0x93af9214U, 0xd509b09aU, 0xf1598aefU, 0x3464956aU, 0x6f8e8619U},
+    },
+    {
+        {0x99c43862U, 0x0a841e15U, 0x8397e669U, 0x71a7f4f1U, 0x89b81bdeU, 0xe6d08186U, 0xc1cdff21U, 0x385eed34U,
+         0x542e5453U, 0xc0458fe5U, 0x2086dc8cU, 0x6b304eecU, 0xe9ebf457U, 0x6701de19U, 0xe8ea23f5U, 0x283bebc3U},
+        {0x78f2827cU, 0xdc83a270U, 0xbefc1ce2U, 0x47c82642U, 0x4d5f67d1U, 0x0456be13U, 0x3daf5480U, 0xf6f62208U,
+         0x20aaa102U, 0xd15b20b5U, 0x48321bf6U, 0xe657ca74U, 0xb367cee7U, 0xaf2c5715U, 0x7de73a0fU, 0x1bcd4e81U},
+        {0xb6e2d9b3U, 0x14bd306aU, 0x1b38d635U, 0x41db9283U, 0x39cf8456U, 0x5e12ea61U, 0x97c705e7U, 0x19a314f3U,
+         0xcbaaaf33U, 0xd552ee25U, 0x2404be56U, 0xa5021d1dU, 0x87f528b3U, 0x234965f8U, 0xdac728ddU, 0x6cacd8f5U},
+        {0x715adcb6U, 0x9d893209U, 0x7d8c6f36U, 0xcd91c3ceU, 0x3d1fc255U, 0xbd70cb3cU, 0x8f953de2U, 0xfb26e518U,
+         0x58ba68f3U, 0x49dbca3bU, 0xb8b7ab54U, 0x16d2cb31U, 0x19d01769U, 0x58e846a7U, 0x1012a34dU, 0xf3e12881U},
+        {0x12f00480U, 0x7d8587ebU, 0xa100dceeU, 0x20358804U, 0x64f67219U, 0x55dc9863U, 0x95a8daa3U, 0x5840ed4bU,
+         0xbe22cf9eU, 0x1592d5e2U, 0x52ae3872U, 0xba752254U, 0xa15dd8daU, 0x07968deaU, 0x220bf141U, 0x670cda6bU},
+        {0x63a52264U, 0x52e737d9U, 0x15400b37U, 0xd0adfc03U, 0xaae51cffU, 0xa806e2a9U, 0xe8187fe9U, 0x85ffdc0dU,
+         0x82da2082U, 0x98c7d29aU, 0x2b179d04U, 0x678182c9U, 0x0554706cU, 0x0be568f5U, 0x7ae2948dU, 0x3fee3018U},
+        {0x23f54c42U, 0xe484dee8U, 0x269a3dc8U, 0x45dc1a3cU, 0x4ece5325U, 0x1dc58c1fU, 0x346918fbU, 0x9f5701a5U,
+         0x2feb6a21U, 0x860e1c49U, 0xb219e527U, 0x89ee784aU, 0x5729bfddU, 0xbfb95b6bU, 0x801d9e57U, 0xce7b8fb8U},
+        {0x60788c1eU, 0xed44db75U, 0x0e8bd1d7U, 0xd18c3706U, 0x763ceab7U, 0x28f5c6bcU, 0x11b9132dU, 0x89912259U,
+         0x8e8f0ef1U, 0x635c4222U, 0xfdef9e11U, 0x36969c84U, 0x59b136faU, 0x27b87635U, 0x7cc9ac9bU, 0xda8b4d98U},
+    },
+    {
+        {0xc3fac3a7U, 0xc606ed86U, 0x5947fbc9U, 0x0fddf84aU, 0x413dfa18U, 0x637c73a4U, 0x03ecf191U, 0x06f9d9b8U,
+         0x3a842160U, 0xd8689060U, 0x5c281002U, 0x7ea4dd2fU, 0x0e45c4d4U, 0x69b8e2a3U, 0x603059baU, 0x7c80c68eU},
+        {0x4b7fd72dU, 0x5c9d2274U, 0xa7e4da17U, 0xda1745e5U, 0x84482939U, 0x1cdc36c2U, 0x252b411cU, 0xae86eeeaU,
+         0x4eee38bcU, 0x2334cb7aU, 0x1472f728U, 0x8d921155U, 0x589ff0e9U, 0x62ab0aceU, 0x707302f9U, 0x19e993c9U},
+        {0xd21ce204U, 0x24ed75e8U, 0x426763d5U, 0xb2a7258eU, 0x9ca6f72fU, 0xb8374d85U, 0x62b3c64fU, 0x43ca41d1U,
+         0x934a8f6bU, 0xe525044eU, 0x3ea4a468U, 0x9ab6c7b3U, 0x18dba31fU, 0x1c650f92U, 0xe37023faU, 0xdcea5a82U},
+        {0x7c169290U, 0x7a147426U, 0xcf36f2eeU, 0x8718be75U, 0x56dc2c48U, 0xe61d2f8cU, 0x0bbfff55U, 0x2248c9f9U,
+         0x883ea257U, 0x369d8a12U, 0x35da2be2U, 0xe1637502U, 0xb435ba18U, 0xa506bb55U, 0x2d21eed7U, 0xfa059469U},
+        {0xebe6efdaU, 0x64fce92cU, 0xf8728059U, 0x922d4ff3U, 0x785a506dU, 0xb666f723U, 0x22892bf5U, 0x9c3e06efU,
+         0xa7aefc7dU, 0xdf140f32U, 0x7b36fdf7U, 0xd43bc868U, 0x4ce26fd5U, 0x8af0b2d4U, 0xe762923dU, 0xa7b709e5U},
+        {0x14978583U, 0x5b3a4320U, 0xf061613fU, 0xcdd6e9aeU, 0x90f92214U, 0x49784199U, 0x9cf23137U, 0x30abf89bU,
+         0x1dc75777U, 0x44618035U, 0x3bb584acU, 0x63120ea2U, 0xd0e1ab80U, 0xcdf7b4f2U, 0x477f7498U, 0x4b035115U},
+        {0xc6c88be2U, 0x79127ab5U, 0xd06ee5e2U, 0xea2c7820U, 0xd830775bU, 0x3bb72759U, 0x13e20f03U, 0x5d6f8aa3U,
+         0x0d7ad75dU, 0x892e553fU, 0xa6bf92c2U, 0xedab6f8eU, 0xab08bc20U, 0xc71aaf33U, 0x8d56d4e8U, 0xadc4b18dU},
+        {0xb50964e3U, 0xfd0dac4bU, 0xdd1c6f76U, 0xa99f0877U, 0xd94085d0U, 0x4ac11b48U, 0xe05c4407U, 0xe11a6e16U,
+         0x0682bfc8U, 0x767fbf8bU, 0x38318c6fU, 0x17adc6e1U, 0x96f0af24U, 0xe1ad5e25U, 0x87a2d430U, 0x87d6065bU},
+    },
+    {
+        {0x42d0e6bdU, 0x13b7e0e7U, 0xdb0f5e53U, 0xf774d163U, 0x104d6ecbU, 0x82a2147cU, 0x243c4e25U, 0x3322d401U,
+         0x6c28b2a0U, 0x24f3a2e9U, 0xa2873af6U, 0x2805f63eU, 0x4ddaf9b7U, 0xbfb019bcU, 0xe9664ef5U, 0x56e70797U},
+        {0xc0ade462U, 0xfc696d32U, 0xeadbcf29U, 0x0d4cddc8U, 0x04c80cd5U, 0x120ef31bU, 0x50cebdaeU, 0x8d262002U,
+         0x0f26470cU, 0xd8e0a8b9U, 0x72678b3aU, 0x1d4afb4eU, 0xc3ee36baU, 0xd31f6f2dU, 0x715bf437U, 0xebed3bb4U},
+        {0x059ab499U, 0xabd9d3f2U, 0x6e73c330U, 0x0b13299cU, 0xc67f01bcU, 0x5d2196b3U, 0x015c05baU, 0x78baaff3U,
+         0xfee097fdU, 0x681d2318U, 0x8d125199U, 0x91632eeeU, 0xed82082eU, 0xafca84e0U, 0xdb06c0afU, 0xad4bdcdbU},
+        {0x1516e633U, 0x9164643eU, 0x072d9c8bU, 0x8ed4930dU, 0xf594d03bU, 0xce4068a1U, 0x6eaebea9U, 0x1238c076U,
+         0xc77b7805U, 0x05cdb728U, 0xcc740228U, 0x0946252dU, 0xd1c3dc17U, 0xd6c979e2U, 0xbb271359U, 0x8a9db02dU},
+        {0xfd06ace6U, 0x4493e16cU, 0xf83a20caU, 0x23709b36U, 0x4929ab1aU, 0xc20b8498U, 0xa14ae3d4U, 0x6f70f211U,
+         0xb602d5deU, 0x048bed34U, 0xbe5ac5eeU, 0x75329566U, 0x47b99f50U, 0x6f95d8f3U, 0x94027b73U, 0x791e8a30U},
+        {0xa5cd5379U, 0xc3063330U, 0x5870bcadU, 0x2db79438U, 0x8aa4d223U, 0xa782481bU, 0x6bdd1382U, 0x17c072d5U,
+         0xb108cd25U, 0xf7cae051U, 0x265bad0dU, 0x8959ac76U, 0xaf1d034fU, 0xe77c1247U, 0x283da064U, 0xd901bdf4U},
+        {0x60ee1b40U, 0xdc8ee3eeU, 0x71e96247U, 0x8ced485bU, 0x9103ccd4U, 0xf80949f1U, 0x9d6aa415U, 0xe1599db2U,
+         0xd78f93a6U, 0xe1d6265eU, 0xbc32999dU, 0xa6363a74U, 0xaa2fc7cfU, 0xefaf894aU, 0x2a81d4a0U, 0x79336223U},
+        {0x788e7a66U, 0x19b01552U, 0x2b0ec216U, 0xcddcd728U, 0x8a6a11b9U, 0xe7b2ea75U, 0x70cb9c15U, 0x271d5b07U,
+         0xe03c9727U, 0x7a8d7258U, 0x508a824eU, 0xe2a065e3U, 0x49ac877fU, 0xe457d099U, 0x34e7f491U, 0x5d3aa458U},
+    },
+    {
+        {0x8134ab83U, 0x721d74d2U, 0xf7643397U, 0x741b3f9aU, 0x89665868U, 0x2bd1770dU, 0x2de0b7daU, 0x85672c7dU,
+         0x790313a6U, 0xc8e3094fU, 0xc5298f44U, 0xe77f17fcU, 0xfa62c2e5U, 0x6374049bU, 0x5b43b2ebU, 0x7c481b9bU},
+        {0x1f17fc25U, 0x998b90bcU, 0xdf2e6d96U, 0x3b89ea46U, 0x15c8a61fU, 0x36c18612U, 0x740f9ec0U, 0x534ccf6bU,
+         0xcfe86e76U, 0xd71c7f6eU, 0xbfdd28ddU, 0x0ae3d277U, 0x32d54355U, 0x462ae3ddU, 0x9c8b2ddbU, 0xd5715cb0U},
+        {0x83ba9000U, 0xfdf0723aU, 0x6825e8b6U, 0xc4872f9cU, 0x5840143dU, 0x68487607U, 0xfff1d8c1U, 0xac3874f9U,
+         0x6f10cf0aU, 0x4da3c7d9U, 0x7f66e9faU, 0x085e350dU, 0x94117f93U, 0xb862dde8U, 0x08a1c069U, 0xaa65e923U},
+        {0xe8bee8b6U, 0xc7170923U, 0xecfbc8d2U, 0x79020d47U, 0x18f8aaedU, 0x081e1420U, 0xee87b7f3U, 0xa91d1f5cU,
+         0x410644c1U, 0x003d16aaU, 0x628cb225U, 0xf800569fU, 0xdddad3b2U, 0x5a7189c8U, 0xe2df8ee1U, 0x748a324eU},
+        {0xed06dbd4U, 0x1a606f66U, 0x78a20d08U, 0xec0e3f85U, 0xe9a3e729U, 0x9ad14075U, 0xaa687013U, 0x570d5ce7U,
+         0xbd1ed495U, 0x5a65beceU, 0xc6460bedU, 0xb683a36dU, 0x11d01bbbU, 0x05b66e67U, 0x420e02f6U, 0xa6ae5349U},
+        {0x17ba402eU, 0xae5d630bU, 0x2d042989U, 0xc3b81a5cU, 0x4848e3c3U, 0x58bead0cU, 0xd18fa02aU, 0x8e891b5cU,
+         0xc4fad9e0U, 0x8e1b6279U, 0x2157a7eeU, 0xaf650c24U, 0x04f2a306U, 0x0b38d0e4U, 0x6a9ec668U, 0xe5d30e0eU},
+        {0x092d230eU, 0x434c1f92U, 0xd2933928U, 0xdaee32a0U, 0xe0366ef5U, 0xf87c229eU, 0x28268bb6U, 0x75b5f870U,
+         0xd51570b8U, 0x037cbdfbU, 0x0511f8fbU, 0x0267a4b0U, 0x54ddfa8eU, 0x63d78745U, 0xe3a78523U, 0x527cce21U},
+        {0x5984cf74U, 0xaa1a1c25U, 0xbef61f10U, 0x0735ae45U, 0xe2d4383cU, 0xc1a214ddU, 0xd90c8e35U, 0xc15c8c23U,
+         0x39ccb000U, 0xc4a48cd8U, 0x50b015a2U, 0x47bf772dU, 0xe25fd7baU, 0xc8dc6f45U, 0x28522235U, 0x2ba954d8U},
+    },
+    {
+        {0x60c82a0aU, 0xffd959afU, 0x0f668832U, 0x0f9226c6U, 0x919413b1U, 0x6b06c9f1U, 0x9b1988a4U, 0x0948bf80U,
+         0xd8c8e589U, 0xd4cb7f88U, 0xc97cd2beU, 0x6d4dff08U, 0xd1c3418cU, 0xdc6b74c5U, 0x6dcb6646U, 0x53a56285U},
+        {0x7e8b000aU, 0x396eb045U, 0x1e825e51U, 0xef16c133U, 0x6291f0b6U, 0x0d5ce4c6U, 0x372e5936U, 0x26952c7fU,
+         0x05ef705aU, 0x8c3d401fU, 0x653d6731U, 0xdebe398fU, 0x2d688422U, 0x62bc893dU, 0x5800a688U, 0xf513ea4cU},
+        {0xb8c8ac7fU, 0x7282fe5fU, 0x65e2aa52U, 0x641242eeU, 0x2056f849U, 0xb5c3396dU, 0xe3822bbcU, 0x9945b2fbU,
+         0x69aea3b0U, 0x96d943a1U, 0xeedacdfaU, 0x282f7a23U, 0xfb28eff5U, 0x607db44fU, 0x4b0f282dU, 0x3eefed82U},
+        {0x76134f96U, 0xf1025889U, 0x72d6b0e9U, 0xf5211965U, 0x131ff243U, 0xbef2be8bU, 0xfc23c5bdU, 0xc62e58e6U,
+         0xd14cf97eU, 0x82277ed4U, 0x63731c3eU, 0xbcfb8535U, 0x53141fc5U, 0x8c3d6767U, 0x45b1a167U, 0x4397827dU},
+        {0x969e353aU, 0xed1d79e3U, 0x52bbe1f6U, 0x10a04408U, 0x7107d5feU, 0x235f8222U, 0x205870e6U, 0x2a314c6bU,
+         0xe5746067U, 0xc25926e1U, 0xdb2658bfU, 0x138a54aaU, 0x6baa1ba0U, 0x1a463e47U, 0xf35a27acU, 0x15a4ac0bU},
+        {0x92fccf64U, 0x3baa4998U, 0x2581318eU, 0x3bd278deU, 0x77c95dbfU, 0xb068772cU, 0x0eb4637dU, 0x0c7d115cU,
+         0x2878fee0U, 0x53f6d3b3U, 0x959ae68dU, 0x48785d83U, 0x478af145U, 0x7aa424b8U, 0x1925b044U, 0x4aa8747bU},
+        {0xe9b84966U, 0x89e2f49eU, 0xdd7f3ff9U, 0x1b4f4106U, 0x3a6b6c91U, 0x498b6fafU, 0xb703fc2dU, 0x5959a500U,
+         0x87473a6aU, 0x40a66321U, 0x8cfe2426U, 0x9100dcc0U, 0x0dc82a70U, 0xf9431282U, 0x1f5ca897U, 0x0370e674U},
+        {0x0b188cbbU, 0x3686f880U, 0x0807de97U, 0xb81c0320U, 0x716622b0U, 0x1683329aU, 0x0eec5c74U, 0x10746052U,
+         0x1f272124U, 0x01d7b636U, 0x8dce3da6U, 0x242e0d74U, 0x9cf54a11U, 0x35326b9bU, 0x9a21598cU, 0xabe5d4c0U},
+    },
+    {
+        {0xf38fd8e8U, 0xccecd819U, 0xfc69752aU, 0xf1b0e44dU, 0xf02873a8U, 0x4f067ce0U, 0x461801c3U, 0x6260ce7fU,
+         0xb2b4ae17U, 0xc1a84e95U, 0x8051c198U, 0xecd29223U, 0x776a1ef7U, 0xa7f09049U, 0x6fa5b571U, 0xbc2da82bU},
+        {0x3d477c2dU, 0x0766746fU, 0x96aad27eU, 0x16e65c51U, 0xe84f1a13U, 0xdec8409bU, 0x48ad1a73U, 0x85d8da47U,
+         0xc7d1dd70U, 0x2079816fU, 0x33c4d5a6U, 0x94b0a020U, 0x31efc7bcU, 0x586b5365U, 0x665c6690U, 0x58948b53U},
+        {0x41136602U, 0xbb0ba465U, 0x0d9e3a5bU, 0x38c46f48U, 0xf2333b3dU, 0x3d058937U, 0x0482dfc3U, 0x87d12728U,
+         0xd8af6aacU, 0x4f683c41U, 0x6fd3bf7cU, 0x87a88474U, 0xff677453U, 0x926a276cU, 0x0a5a03deU, 0x71ce2487U},
+        {0x6c0b80d9U, 0x4850312dU, 0x0fdc47f0U, 0x4d1e7e10U, 0xcc3ee3eeU, 0x8c0892e9U, 0xe7ec4b96U, 0x8e2a7166U,
+         0xd6b29f50U, 0x49c61f2aU, 0xd706349aU, 0x5297b688U, 0x716a9d48U, 0x2cedd29bU, 0xae2cbe59U, 0xeadb0ba9U},
+        {0x48c5a916U, 0x5b205d73U, 0x535610f2U, 0x3f5c440dU, 0xdab54aa1U, 0x6b0acc63U, 0xe261e974U, 0xfd5d7d3fU,
+         0x7adb8bdaU, 0xb14b37b0U, 0xbdcf6faaU, 0xe5d73814U, 0x79c7b52fU, 0xd2b43ca6U, 0xeeb55b07U, 0x0dd83ed0U},
+        {0xb0e74459U, 0x674a35c8U, 0x87ddb6ddU, 0xfef23763U, 0x713c8a91U, 0x590f4658U, 0x4ec05680U, 0x28df781dU,
+         0xef5e656fU, 0x8de07cc0U, 0x01ae6f0aU, 0xa3795ba5U, 0x90f22794U, 0xcb0db178U, 0x6a130f17U, 0xf1499ea6U},
+        {0x35f7529cU, 0x45d99096U, 0xb5bd51ddU, 0x38765b98U, 0x2d344381U, 0x2ba453c3U, 0x981c2612U, 0xde0dd410U,
+         0xe4cd88feU, 0x63c20c02U, 0x889b7740U, 0x178924c6U, 0x2d7a3570U, 0x9b210982U, 0x10a2145fU, 0xd70a6e9dU},
+        {0x2c4561beU, 0x9921fa3dU, 0x1359d90fU, 0xee4ab2e8U, 0xd78f8950U, 0xdc8366ecU, 0x42bff58eU, 0x769bc758U,
+         0xb0d9685fU, 0xd5920bffU, 0x7b7873adU, 0x41a17776U, 0xf73f5d47U, 0xc8dce4ceU, 0x2fe783baU, 0x4bf81736U},
+    },
+    {
+        {0x2037fa2dU, 0x2953cc8dU, 0x75bfdc43U, 0x043ec8f5U, 0x4bbf4103U, 0x3d834841U, 0xafc1d8d4U, 0xe5037de0U,
+         0x1d755bdaU, 0xe0e5dc84U, 0xec481f10U, 0xbd5f5b03U, 0xfb990bddU, 0xf9f98d09U, 0xaa94d3b5U, 0x4571534bU},
+        {0x9e3d34efU, 0x8c63c8c7U, 0x792a2ddbU, 0xc3ab217cU, 0xd2d61b3eU, 0xf40b6cf7U, 0x67fd5494U, 0xa5e00da4U,
+         0x2f7adb4cU, 0xb855c5ceU, 0x790900acU, 0x5b60dcfeU, 0x99bf43d2U, 0x421726feU, 0xe5608555U, 0x098fe5f5U},
+        {0x177e7775U, 0x388a8a6eU, 0x88ed95f6U, 0xb5e15593U, 0xcf5291aeU, 0xe58543baU, 0xff9633ceU, 0x9d896a3aU,
+         0xba056691U, 0xefcf6d3aU, 0xe299253bU, 0xe899cd7eU, 0x7250927dU, 0x94e964edU, 0x3f49bf0bU, 0xdd91a9e4U},
+        {0xd7b91252U, 0xe6737160U, 0x4477572aU, 0x6d4afd2eU, 0x1c9bfbc4U, 0x3519f4bbU, 0xef3a2b40U, 0xa99415f5U,
+         0x4bedc264U, 0x73a377acU, 0x590f4dddU, 0x899a16adU, 0x24f6f6b6U, 0xb9e2f10fU, 0xae81f84bU, 0x82d0e64cU},
+        {0x3c2a3293U, 0x5fde04deU, 0xe903476cU, 0x5688b86eU, 0x3282f4cdU, 0xd0eb0a57U, 0x71163792U, 0x8327b8eeU,
+         0x8e0df9bdU, 0x6bc854e1U, 0xee326a41U, 0x96afdab4U, 0x62797084U, 0x18bb3ea6U, 0x6ee0a98eU, 0x04997e26U},
+        {0x8c904ed3U, 0x15957f1eU, 0x90585784U, 0xdf2a7458U, 0x31272384U, 0xf97f8e64U, 0x2db818dfU, 0x00cf8c2dU,
+         0x796f77c1U, 0xb009963bU, 0xd32f6827U, 0x22991d79U, 0xd51bd811U, 0x19dd5c1bU, 0xa781d441U, 0xaaad000eU},
+        {0x4562c042U, 0x2421b26cU, 0x4b8dfb1aU, 0x092d2323U, 0x8f9a8ed6U, 0x97d6661dU, 0x2a6db168U, 0x5ae42aaaU,
+         0x8f79269cU, 0xf905ccdfU, 0x107cd8dbU, 0x94e0db95U, 0x60389d4aU, 0xab5c1ddcU, 0x05ff051eU, 0x99d93a7cU},
+        {0x6a540f17U, 0xd8c465b6U, 0x5f0c132bU, 0x4c750d70U, 0x98f935f8U, 0x7d8edde0U, 0x9e4fd1fcU, 0xb56f4e9fU,
+         0x0200102dU, 0x46a2fcaeU, 0xcbcca854U, 0x21d42963U, 0xf0582d1dU, 0xd3dc11adU, 0x29cca856U, 0x32e8e534U},
+    },
+    {
+        {0xe4fce725U, 0x25866a0aU, 0xc6a6c5b7U, 0xe7e8dbd1U, 0x8f1771b4U, 0xf5ea905eU, 0xf4a207adU, 0xe06372b0U,
+         0x4eee31ddU, 0xb27034f9U, 0x87104870U, 0xd7484a77U, 0xad5a488cU, 0x12a27bb2U, 0xbce18cfeU, 0x7a908974U},
+        {0x3ed2ff3eU, 0xfe09aee4U, 0x4ec6ed3cU, 0x045ebfdbU, 0x4fad3f3cU, 0x9c8dbd30U, 0xa2046b8fU, 0x0eac134cU,
+         0x7d210988U, 0xe1720620U, 0xb7f21376U, 0xac19f696U, 0xf2b11799U, 0x45bf103bU, 0x79359b42U, 0x49630dbeU},
+        {0xda328d6aU, 0xdbaa8188U, 0x95adc18bU, 0xb24d773aU, 0x85b08fa7U, 0xa3468991U, 0xa6234e00U, 0xc663c05bU,
+         0xbec9b8c0U, 0x23b0bb6aU, 0x512bf9ccU, 0xdd8551eaU, 0x27571317U, 0xd39afdcfU, 0x5f721c38U, 0x3331e98dU},
+        {0xdfbfa4dcU, 0x476706e4U, 0x04c85b17U, 0xf5948a78U, 0x7adbb41fU, 0x8392119dU, 0x731fea19U, 0xd6788590U,
+         0xbd3b5406U, 0xca7bcd6bU, 0xddc9a07cU, 0x6206f1c4U, 0xd21c13aaU, 0x940ef5c6U, 0x9d5063c4U, 0x28eaa8c8U},
+        {0x3996de2fU, 0xbc91c848U, 0xe0b25114U, 0x77cedf2eU, 0xea0fe4e9U, 0x9ceb30deU, 0xdfb86a45U, 0xd3fc2682U,
+         0xd4526f8cU, 0x8c492241U, 0xdf7abf16U, 0x4e59b498U, 0xd4f781daU, 0xf68b4754U, 0xa45f0a18U, 0xc4f0df99U},
+        {0x62143fb0U, 0x6dc35a65U, 0x0bc205ddU, 0xa9fb9283U, 0x94799597U, 0x0cfaff33U, 0x33af8379U, 0x292adc1cU,
+         0xe36ad01cU, 0x8a9db63cU, 0x735e9d4dU, 0xd83e662dU, 0x0cc4ecf6U, 0xf3f1968aU, 0xcee0b647U, 0xa072661bU},
+        {0x03e697eaU, 0x5c6c48d1U, 0x985f83e8U, 0x9ce678fbU, 0x9a3fabd1U, 0x7dca1fecU, 0xfeb2c023U, 0xc17a4b43U,
+         0xdedc6c87U, 0x0ee3b87dU, 0x7f9f02abU, 0x96e1a1b5U, 0x19601faeU, 0xcae178f7U, 0x55ab5954U, 0x39355c2dU},
+        {0xe48ff9b3U, 0x7275fb40U, 0x5599b01aU, 0xc7b1a620U, 0x12b71d4bU, 0x4abf210fU, 0xd9a04097U, 0x6930fccbU,
+         0x8ee96a4eU, 0xcfddab5fU, 0xe4acc51aU, 0x090f9b13U, 0x875f6d78U, 0xda30fcdbU, 0xb94701eaU, 0x7f02ae94U},
+    },
+    {
+        {0xd0559754U, 0x40ad6908U, 0xe2a3f585U, 0x04b10bddU, 0xdc0ce022U, 0x58d0bbf9U, 0x5cd5d453U, 0x213c7a71U,
+         0x34b458f2U, 0xdff2c275U, 0xf36a7eedU, 0xbb4850f5U, 0x245ba190U, 0x7013ad06U, 0x5ae46250U, 0x4b6dad0bU},
+        {0x0ec87facU, 0x8993895eU, 0x622e7cf0U, 0x0d1ab974U, 0x8323480eU, 0x66ae9fedU, 0x32b49a7fU, 0x1c5e5481U,
+         0x5fc2d4efU, 0x555d7b3dU, 0x26fe324cU, 0xa3deacebU, 0x1d4c2ad3U, 0x2bb959faU, 0x837f468fU, 0x4ffcf60fU},
+        {0x9e05dcccU, 0x532d8011U, 0x4c19a93eU, 0xae3fa3edU, 0xb953d172U, 0x9546e096U, 0x753da030U, 0xb8cef6e1U,
+         0xcc6d5750U, 0x3014a0cfU, 0x6a6b6813U, 0xdf757fc3U, 0xe4d2bd99U, 0x6a4d4a74U, 0xa6cc9bbfU, 0x302b8a60U},
+        {0xd4531dbcU, 0xe20fcba1U, 0xfed5c970U, 0x1f901c19U, 0x10bbc7ceU, 0xdef6e942U, 0x02c5668dU, 0x46276d06U,
+         0x9686b8e2U, 0xaf873009U, 0xffe1bc99U, 0x498badfbU, 0x570ded99U, 0x4a292287U, 0xd44c75b8U, 0x0e0f7f24U},
+        {0x373bb31aU, 0x85bdfee1U, 0x5fdb97b4U, 0x701f7b6bU, 0x2ebb5f49U, 0xe02a0bdeU, 0x79b47385U, 0x03fb33e7U,
+         0x7d215c9eU, 0xe34cbe69U, 0xc47640d4U, 0xc65a7c76U, 0xabbb572bU, 0x1e0c161aU, 0x548efe28U, 0xf36ad952U},
+        {0x686df50dU, 0x0c4eed01U, 0x1c6f92bdU, 0xcd5e792aU, 0x2c082060U, 0xd6fd8744U, 0x935c1f02U, 0x3a571630U,
+         0xe859679bU, 0xd2158b28U, 0xbb781a11U, 0xe0aaf81eU, 0xe570a0ddU, 0x516f3ff2U, 0xb599f32fU, 0x85e13873U},
+        {0xdd9a4ab4U, 0xa5b515ebU, 0x855bb7c0U, 0x717c36c1U, 0x4d0f7a36U, 0x61f16f7bU, 0x09ec3e11U, 0x4b177cd1U,
+         0x635ab6f7U, 0x8aaddfe4U, 0xf1741f55U, 0x6e37e255U, 0x93626b48U, 0xfda8f672U, 0xa5e2fa65U, 0x3ec966e9U},
+        {0x522f001dU, 0x6114ef13U, 0xdc78d899U, 0x6850e0acU, 0x1c319163U, 0x4e65eb21U, 0xa7a6c24fU, 0xefea68ecU,
+         0x73bc4415U, 0xc128419fU, 0xb3848771U, 0xe413959fU, 0xa3719a17U, 0xda150307U, 0x9d583c14U, 0xaab84786U},
+    },
+    {
+        {0x08fbd53cU, 0xf0cc3a3bU, 0xadc62cddU, 0xe2838c70U, 0xa5419a87U, 0x8dbb9352U, 0x7af4b34eU, 0x4e7c272aU,
+         0x17dcaae6U, 0xe0b39418U, 0xbff7dd33U, 0x530b9614U, 0x6def681bU, 0xe16fd09fU, 0x6c9d0b18U, 0x17749c76U},
+        {0x7c6e1b4dU, 0xe2821e6eU, 0x1bef8790U, 0x9b11f25aU, 0x4e385d9cU, 0x268a269fU, 0x2696888fU, 0x899017b0U,
+         0xd814ab2bU, 0x009aebdaU, 0xf932b212U, 0xe4e51bc0U, 0x36358bfaU, 0xbb457983U, 0xb5b334f0U, 0x43ae2cdaU},
+        {0xe521b3ffU, 0xee298464U, 0xe9aa750cU, 0x233c0717U, 0xe9ae24a5U, 0x75e44d2bU, 0x10c9455cU, 0x02484e30U,
+         0x0269da7eU, 0xcc1ae4b9U, 0x923ac8bbU, 0xad7006deU, 0x2b2d0eebU, 0x07ec2b3cU, 0xaa23e30dU, 0x9619d0a0U},
+        {0x7e5f712fU, 0xaf2635a1U, 0x91b583a8U, 0x2831f5bfU, 0x63227f0eU, 0xa8f4728eU, 0x6e905fd4U, 0x67f644f7U,
+         0x707160e5U, 0xd68acb5eU, 0xf7d36198U, 0x5e0e1488U, 0xb586cf78U, 0xf05adeb7U, 0x66445d04U, 0xb833d68fU},
+        {0x804ba7b9U, 0xf96b79faU, 0x30741751U, 0x20d6a470U, 0x672c954eU, 0xef79b70dU, 0xcfb6ce57U, 0x16c1c526U,
+         0x1c5bd741U, 0x475be3a5U, 0xbdc9a9ccU, 0xec755c01U, 0x9c8a94deU, 0x06262745U, 0x34031439U, 0xdb157f7cU},
+        {0x40692fd1U, 0x2b260961U, 0xcbd90dfeU, 0xdcf43c6cU, 0x4b1f190eU, 0x0e0aadefU, 0x9901ff80U, 0x4e53c8b4U,
+         0x328625e0U, 0x934930e7U, 0x57fc9753U, 0xa87a50daU, 0xa7219da1U, 0x186cd709U, 0x4d41a01eU, 0xdd6e3e4fU},
+        {0xa36683faU, 0xe836487aU, 0x80ec0825U, 0x95821b53U, 0x74527b66U, 0x87a89ce7U, 0x53f931afU, 0x03973cd7U,
+         0x7f4a577fU, 0xdf5fb2b7U, 0x8fe981deU, 0xd77884e1U, 0x32b5a26cU, 0x643e12b6U, 0xc30ca3a3U, 0x38cf5a2cU},
+        {0x3b89a762U, 0xc10263edU, 0x12ee6b8dU, 0x930dc930U, 0x968b4712U, 0xfa80a054U, 0x93652555U, 0x327f876cU,
+         0xb9203301U, 0x9c9fd959U, 0xfebd7dfeU, 0x75535070U, 0x5e1997b9U, 0xb0996925U, 0xb3524026U, 0xb2d404eaU},
+    },
+    {
+        {0x40fb27b6U, 0x32427e28U, 0xbe430576U, 0xc76e3db2U, 0x61686aa5U, 0x10f238adU, 0xbe778b1bU, 0xfea74e3dU,
+         0xf23cb96fU, 0x701d3db7U, 0x973f7b77U, 0x126b596bU, 0xccb6af93U, 0x7cf674deU, 0x9b0b1329U, 0x6e0568dbU},
+        {0x1f9756e4U, 0x8fd97c96U, 0xde373048U, 0xbb570ee5U, 0x50e8cd0eU, 0x180e03d8U, 0x304280ffU, 0xed9441c8U,
+         0x3f3abfaeU, 0xff0e09f9U, 0xfe4de98bU, 0x09f23774U, 0x8b13911eU, 0xafa17612U, 0xfe8bfa19U, 0x3dbe9e9eU},
+        {0xbe889756U, 0x5dd81ae9U, 0x7b004bb2U, 0xf27b6499U, 0x271899f3U, 0x226cd97bU, 0x3211fea8U, 0x762e8bc3U,
+         0x7ca6b774U, 0x25e259e0U, 0x4884fa5eU, 0x1972db31U, 0x4982e347U, 0x3c7cc4f1U, 0x0af3e97cU, 0xc0289426U},
+        {0xd51cf119U, 0x15bad033U, 0x4fab4d30U, 0x5b10bdd8U, 0x24b48751U, 0xc9fed3f6U, 0xe67a7c3fU, 0x29d9698eU,
+         0x75056339U, 0x3c887405U, 0x93a7c296U, 0xb89c940eU, 0x04f1c96fU, 0x277a1254U, 0x7dc82b45U, 0x7fd02c51U},
+        {0x0975d2eaU, 0x26f75e97U, 0x1014e8eaU, 0x1e52acfaU, 0x2308f4a9U, 0x8e19bdbbU, 0xdf609534U, 0xdf077d47U,
+         0x31936f95U, 0xaa3c2d9eU, 0x4fbdd277U, 0x8a1ec5b8U, 0x98a2527cU, 0x24c8425cU, 0x00ef7f44U, 0xf8617a88U},
+        {0xa6714560U, 0x875580a5U, 0x7e56c6c2U, 0x247f2102U, 0xf1a5a85cU, 0x9d47ef64U, 0x579ad36bU, 0x38b82a75U,
+         0xa774299eU, 0xada87334U, 0xef716284U, 0x7d94f23bU, 0x61643459U, 0x28bf5634U, 0x6f261ef4U, 0xf9d8a697U},
+        {0xbc4c92d7U, 0x5b8491fbU, 0xe54391b4U, 0x35db4d6eU, 0x334b1429U, 0x2e17dea8U, 0x8bd3da03U, 0x9f3e7d75U,
+         0xb14906ddU, 0x6cbbbfcfU, 0xd694e118U, 0x452a2303U, 0xcbab1502U, 0x58862b21U, 0xa77d466bU, 0xecd2841eU},
+        {0x7f422491U, 0x467c4453U, 0x86060cffU, 0xfd453e4aU, 0x33580a31U, 0x6f3fb7bdU, 0x5013936dU, 0x126b57d0U,
+         0x9da3ef84U, 0xafa31f19U, 0x0bf39347U, 0xe148bac3U, 0xa2bf3fb0U, 0xe3c4a3ebU, 0x061662c2U, 0xc1a7dc13U},
+    },
+    {
+        {0x17bdde39U, 0x52c02a44U, 0xb7604329U, 0x1544e179U, 0x599968d3U, 0x10a2570dU, 0xf677cf0eU, 0x76e64113U,
+         0x1901ac01U, 0xb4b1752dU, 0xb56d2032U, 0x5e2a33d2U, 0x0681f0d3U, 0x577066d7U, 0xee4e95cfU, 0xc90ddf8dU},
+        {0x3a1187a5U, 0x1cf999a8U, 0x2c29ae69U, 0x005d5762U, 0x8161c810U, 0xee87c9d8U, 0x9e52c73bU, 0x708a530eU,
+         0x473db9c0U, 0x58a4f19bU, 0x6d353e8aU, 0x3ecda73cU, 0xbb6d3828U, 0xfa9656dcU, 0xe1f9a897U, 0x9b884811U},
+        {0xc078ee8dU, 0x2f05091cU, 0x50691944U, 0x4ebf20ceU, 0xaa9b4ff6U, 0x25ff7263U, 0x859da9beU, 0xd08e57adU,
+         0x2da63e86U, 0xe997f4dcU, 0x9422ed9dU, 0x123ef7cfU, 0x757e6df4U, 0x2d6172eeU, 0x4ab488d7U, 0x852e9798U},
+        {0xcde4f5beU, 0x2e1b16c6U, 0x86b2b59eU, 0x9f374b6dU, 0x95e462cfU, 0x19bd6483U, 0xc48b3be2U, 0x19cf034fU,
+         0x6f321af2U, 0x0a91532bU, 0x3f0f1c0cU, 0xef91d1c9U, 0xab181947U, 0xc3b4be68U, 0xa15ab466U, 0x28e32b06U},
+        {0x429129ecU, 0x15914670U, 0x1e482548U, 0x0cae3acfU, 0xecd31d08U, 0x5f58be80U, 0xe4d44d27U, 0x7da6c085U,
+         0xacd9ff0eU, 0xeb50aee2U, 0x54ca586aU, 0x0448c086U, 0x491627bfU, 0x511d0207U, 0xb9f41857U, 0xf498146bU},
+        {0x0e9c22bcU, 0xd43ae543U, 0x91bcc42fU, 0x01da67d6U, 0xd9bc7be6U, 0x765b3444U, 0xe99eeb23U, 0x5335cea5U,
+         0xcbdacb60U, 0x3c2c2672U, 0x6ca1f19bU, 0xc8c30c23U, 0xf0ceb86aU, 0xa067f080U, 0x769c5224U, 0x3bf8d020U},
+        {0x51654f22U, 0x4f83d495U, 0x231aaee9U, 0xb2f7f394U, 0xbe69d94fU, 0x21be9001U, 0xf5c1be6eU, 0x90d090cfU,
+         0x601a43e1U, 0x0f5de057U, 0x3da3f874U, 0x6dd63565U, 0x06bf7033U, 0x953f021eU, 0x2bacf61aU, 0xcd569a1dU},
+        {0xd17cf3e8U, 0xe3abc209U, 0x4bea2219U, 0xee93bd03U, 0x8397f576U, 0x7c719c2fU, 0x78cb5f0dU, 0xaf6c44a0U,
+         0x1751baeaU, 0xb8add060U, 0x7ca0d435U, 0xec362aeaU, 0x3cb246dfU, 0xaf9e7315U, 0xe85d4b30U, 0x0784096fU},
+    },
+    {
+        {0x2bcbb891U, 0x3ab15024U, 0xdf26cbeeU, 0x8f7cc643U, 0x743f8f9aU, 0xe8281baaU, 0x03b2abe1U, 0xc738c56bU,
+         0x699a84c3U, 0x17e735d9U, 0x7880cfe9U, 0x82314eefU, 0xacbfbbbbU, 0x7f718f2eU, 0x951ad253U, 0x893fb578U},
+        {0x4662ab1bU, 0xddaab078U, 0x49b8c9e4U, 0x647197eaU, 0x92e7aa94U, 0x35b32a69U, 0xcd7c0374U, 0x5578845eU,
+         0x056f3511U, 0x316d18f3U, 0x6a5d64deU, 0xf653a774U, 0x1d2a4053U, 0xcea6d0a5U, 0x8b6de2c3U, 0xe61d0797U},
+        {0x8761d58dU, 0x34baaf33U, 0x08d60e2fU, 0xca4c9be4U, 0x5720df7aU, 0x10a240a3U, 0x823f6146U, 0xb8c46127U,
+         0x9d1051a4U, 0x638ea0baU, 0x5e107c5bU, 0x3f750478U, 0x97f3c505U, 0x14a458f6U, 0x5170e37dU, 0x8f9ed96cU},
+        {0x948b6c29U, 0x94f869b8U, 0xfce39960U, 0x22f12354U, 0x1d0ceccdU, 0x4abfa3bcU, 0x88a364ccU, 0x47f33838U,
+         0x0e537ef9U, 0x1edee112U, 0x88f994a8U, 0x18bb4995U, 0x5b416c71U, 0x190e4867U, 0x0f032937U, 0x48ca9a8dU},
+        {0x050b0040U, 0x2db0b304U, 0xf0134adcU, 0xf3f47db9U, 0xfe9a3671U, 0xa350c993U, 0x710271f7U, 0x08d56e9fU,
+         0x5b3fd0a1U, 0xb58e267aU, 0x0e1782beU, 0xf6d7c472U, 0x8d79b285U, 0x1ffd150aU, 0xbd0a9aa2U, 0xa12185aeU},
+        {0x1166ff40U, 0xa14dea1aU, 0x41fff36dU, 0xcaeebf4aU, 0x8e480a2eU, 0x7c78125dU, 0x18818d2bU, 0x6b004033U,
+         0x9d71b847U, 0xeb74130eU, 0xe7f3ede9U, 0x076883f6U, 0x590bf2f0U, 0x968943a0U, 0xe8aafac9U, 0x41cd1b3aU},
+        {0x13573b7fU, 0xf56563dfU, 0xd30b6270U, 0x889a1c5eU, 0x7be65a37U, 0x41e20f97U, 0xd42fce63U, 0xdc13f232U,
+         0x4c1f2ba6U, 0x42acd228U, 0x17404b1cU, 0x70455470U, 0x84a90a76U, 0x3c7410daU, 0x429e340cU, 0xc909ba80U},
+        {0x05ff4adbU, 0xa81a6c8fU, 0xfcbef768U, 0x14f570d6U, 0xc6a5d5f6U, 0xe466b4c9U, 0xae41b8cfU, 0xc0c01f34U,
+         0xac351065U, 0xfc4eff73U, 0x70d15b85U, 0xcdbc43d1U, 0x4075b8ceU, 0x7c937a0bU, 0xe4357f5cU, 0x0b84f5beU},
+    },
+    {
+        {0x88f6c14bU, 0x372e9f65U, 0x3a925014U, 0xd1d72e5fU, 0x7c972877U, 0xe264c763U, 0x48b65b81U, 0xd8956265U,
+         0x5d7d991fU, 0x79363ed7U, 0x2bb067e1U, 0x03428d63U, 0x18c340ebU, 0x728ec608U, 0xf2bc7eaeU, 0xfebfaa38U},
+        {0x77078424U, 0xba5b594bU, 0x0ec40c3fU, 0x03ecaf7aU, 0x2003a267U, 0x8a3a4362U, 0x8971044eU, 0xfd136eefU,
+         0xc671ddf1U, 0xcd61eeefU, 0x8a2adfa8U, 0x7cf2b1f7U, 0xb5c5efa5U, 0x67a1d191U, 0xf3c652ccU, 0x218da834U},
+        {0x6127b756U, 0x80ba87ffU, 0xaba09704U, 0x03428be4U, 0x5060b416U, 0x72d362daU, 0x716df126U, 0x6d8c782fU,
+         0xbf172571U, 0x6551f74aU, 0x2d7cdccaU, 0x4e3aa6daU, 0x36d34dafU, 0x1459a82dU, 0x96fdb911U, 0x99aedf08U},
+        {0x8db1cb3cU, 0x5f1d84ecU, 0xd43f024aU, 0x1b7003a0U, 0x67519f86U, 0x0e9cca53U, 0xd9638d14U, 0xd99e8e9dU,
+         0x6b8637a7U, 0xd88a29e3U, 0xffc8765cU, 0x6286fef8U, 0x1bceba6eU, 0xa945bb32U, 0x1cc0a3a7U, 0x36dc19adU},
+        {0x758cf17aU, 0x4dee1a73U, 0xa5882352U, 0xf1f85dcbU, 0x1b4097f8U, 0x8d059aefU, 0x95bf7acaU, 0xebcabeddU,
+         0x5caa0ccdU, 0x446cdc5fU, 0xd0ace95cU, 0x10fad212U, 0x67c32e6bU, 0x02c00a1bU, 0x8f22b9cbU, 0x47d3ce0fU},
+        {0x51a3c43cU, 0xe4c4b2c5U, 0x8ecee258U, 0x0df701caU, 0x4aae6714U, 0x48cc1f2bU, 0x67cacd5bU, 0x56c9da94U,
+         0x20d7c9edU, 0x824d8b7dU, 0x32edcaa1U, 0x41d40ff9U, 0xddcb6852U, 0xf33c7964U, 0x42c79ec2U, 0x38d46acbU},
+        {0xac855c5bU, 0xbceee515U, 0x017c8afbU, 0x1185621aU, 0x9e17fc28U, 0x45331a36U, 0x4bd4ce24U, 0xe8df4d2eU,
+         0x2e465650U, 0x59d5e72cU, 0x1e1e4d7dU, 0x9663b55fU, 0x59ef32c5U, 0x4444db4fU, 0xc47f9b26U, 0x6c57fd70U},
+        {0x3c385172U, 0xfd46f68dU, 0x0440e636U, 0xd203351eU, 0xe5b09191U, 0xa1bd8a54U, 0x9a198317U, 0x03fdf161U,
+         0xfccb9794U, 0x79ac67f0U, 0x90e7232bU, 0x5b9b929eU, 0x3c857375U, 0xfe470c7dU, 0x6e5c12c3U, 0x408d02c0U},
+    },
+    {
+        {0x4f676e03U, 0x49150a56U, 0x93e84eddU, 0xceffc736U, 0x571e8761U, 0xeb0f6433U, 0x2a957518U, 0xb8da9403U,
+         0x4efdf6e7U, 0x1488e4e7U, 0x95ff3b51U, 0x92cc584dU, 0x762808b0U, 0xd7c99cc9U, 0x4805a1e4U, 0x2804dfa4U},
+        {0xc5af726aU, 0xd413f414U, 0xb25bf6e6U, 0x469a3e5cU, 0x8ab620f9U, 0x53f2cb69U, 0xed8cc5ceU, 0x6d36d105U,
+         0x13f9fc7dU, 0xc570491aU, 0xb4108a35U, 0xdcc59936U, 0x95c50029U, 0x72d8c66cU, 0xe377669eU, 0xe4ba5c34U},
+        {0xc6e1346bU, 0xea19849dU, 0x385af1c5U, 0x5abe7b10U, 0x14d152c0U, 0xe54c761fU, 0x0982d10bU, 0x069068ffU,
+         0xd7226c13U, 0x7bb58a54U, 0x94c6026eU, 0xa4f68939U, 0xd086442aU, 0xda85db2bU, 0x90bfde26U, 0xb863e3e0U},
+        {0xa540db99U, 0x86e2a30cU, 0x534b8122U, 0xeb1309c0U, 0x66f0b0e3U, 0xd06883faU, 0x0cd3ac0cU, 0x3ab6bde1U,
+         0x1bda78a3U, 0xe6873fe3U, 0xe369c043U, 0x38d137b0U, 0x6a13e99cU, 0xfc3117a9U, 0x9be871d7U, 0xbaca6207U},
+        {0xdca1f6a1U, 0x30e691fcU, 0x348cff1aU, 0x068cbd14U, 0xb1e86ce1U, 0x5286dc5cU, 0xcb259761U, 0x898c3493U,
+         0x164f647cU, 0xa4adc20fU, 0x9f2bd79cU, 0xb2a7cf97U, 0x52ac6e93U, 0x9d845424U, 0xab56a554U, 0x75f75986U},
+        {0x7235c795U, 0x584e2bbcU, 0xebd541d7U, 0x0b0d8958U, 0x7d1c89d7U, 0x393b05b3U, 0x35ef974bU, 0x063c4624U,
+         0x5b110258U, 0x3f32dc09U, 0xfa49a9bdU, 0x9e4acbacU, 0x931c85b6U, 0x431f660dU, 0x13038404U, 0xe27f9bb9U},
+        {0x3d1e3998U, 0xaa69e03cU, 0x17a04328U, 0x5e56c8b9U, 0x022a274eU, 0x1a5299d7U, 0xd2918bf0U, 0xb213e2feU,
+         0x325fb81eU, 0xec2cbdc6U, 0xebded175U, 0xd534165bU, 0x83a43bc3U, 0xc3d61ebfU, 0x0f2d3c12U, 0x229f8ec2U},
+        {0x9f1048daU, 0x7777bf27U, 0x73ddd3baU, 0xba2fd4f3U, 0x9d07bce2U, 0xfdba069dU, 0xf1ad56f0U, 0x796634e3U,
+         0xa106cf01U, 0xe8f9be24U, 0xcfd74862U, 0x532576d8U, 0x5a7927f2U, 0x56de7473U, 0xcfb20b89U, 0x4d8ee2b6U},
+    },
+    {
+        {0xe3c0df5dU, 0xf1a11778U, 0x5156a792U, 0x2019effbU, 0x475d7fabU, 0x7d8adab9U, 0x441fb33aU, 0xe80fea14U,
+         0x6ac9ec78U, 0xfcb4291bU, 0xaf322ea9U, 0x2d155e80U, 0xa3ca9447U, 0x1e89768cU, 0x638e0077U, 0xeed1de7fU},
+        {0x0f83cd58U, 0x2db0e78bU, 0x77d2f916U, 0x122dcc38U, 0x1efe7a37U, 0x981ac4edU, 0x8ea41265U, 0x440ca1f0U,
+         0xb88a3f4bU, 0xb07bc069U, 0x69c0a260U, 0xa21e4d42U, 0x9d4e2f02U, 0xaf8954dcU, 0xcd5ee122U, 0xa6c8b0d2U},
+        {0xd7592d55U, 0x2c0359ecU, 0x40e35019U, 0x06d5b947U, 0x633ce3b1U, 0x08afef69U, 0xc4a10526U, 0x5d2ec6dbU,
+         0xaf5183a7U, 0x266e5d0eU, 0xad115174U, 0x0e2a7bcdU, 0x268cd695U, 0x58f710faU, 0x9c6e45ebU, 0x0a92cdf8U},
+        {0x12998b10U, 0xe81bda27U, 0xc1b229d9U, 0x9bc70ebcU, 0xd3a90781U, 0xc5f7f829U, 0x2b966c1cU, 0xf694cbafU,
+         0x00f05e51U, 0xf6788b17U, 0x183c2a47U, 0xeb6c64c3U, 0xcc46d82aU, 0x633c5ffaU, 0x61bef03dU, 0x40a63ebaU},
+        {0xfe8f9f5cU, 0x991f4b49U, 0x59880a51U, 0x7361f1e1U, 0x215f404dU, 0xfe2cae34U, 0xb11bf742U, 0xac371dc3U,
+         0x325a503cU, 0x17a83ff3U, 0xee751e1dU, 0x22953458U, 0x3254e735U, 0xff2101e7U, 0x8709a477U, 0xc51616c1U},
+        {0xe55bf84cU, 0xa744b8f8U, 0x570d9027U, 0xd964c6edU, 0x223cae4fU, 0xe5dd3c25U, 0xceb96cc8U, 0x62782899U,
+         0x5f15fa2aU, 0x6f51cfabU, 0xddd176edU, 0x9a020de7U, 0x29726783U, 0x01c54972U, 0x0911a289U, 0xd670aca4U},
+        {0x19e33446U, 0xf4a1c8d5U, 0x52af385dU, 0x40893bc4U, 0x0222a17aU, 0x9348c0bdU, 0x14f1840cU, 0x8942003aU,
+         0xe6387689U, 0x40d38a00U, 0x79e74f98U, 0x6bfd7736U, 0x0efde4e0U, 0x4d8b2d6dU, 0x95a5077aU, 0xa9fd0395U},
+        {0x8dd553fdU, 0xf95a1335U, 0xc08b6414U, 0x47abf695U, 0x39a25950U, 0x50b6d4f4U, 0x35566848U, 0x8b6e862aU,
+         0x3e9be5edU, 0xd803dad3U, 0x183383d0U, 0x24ac3c5aU, 0xf4eb9fa1U, 0x0d10bc2dU, 0x0ed11cb4U, 0xea5e0891U},
+    },
+    {
+        {0xc4e16070U, 0xddc07bbcU, 0x1efd6915U, 0xf2a18203U, 0x1d567543U, 0x13ba48e5U, 0xdfcd7043U, 0xa301697bU,
+         0x1e177ea1U, 0x0c0d1a04U, 0xc0a11a13U, 0x1735dbf7U, 0x25d40f9bU, 0x081809faU, 0xfb67e4f5U, 0x7370f91cU},
+        {0xf24ba5aeU, 0x11420316U, 0x4c34b5d8U, 0xb4396500U, 0x9e0bff74U, 0xf3e8d241U, 0xff79f049U, 0x27e1e59cU,
+         0x883a45b3U, 0x84a5bfeeU, 0x9afa63f7U, 0xdf48a1a6U, 0xfc79df05U, 0xee1b5e3cU, 0xc804e209U, 0x310b26a6U},
+        {0x138011fcU, 0x67012700U, 0xad728562U, 0x83596a67U, 0x82200a4dU, 0x156b1330U, 0x0815eb11U, 0x6e8313a3U,
+         0x3f15ab7dU, 0x6acb69faU, 0xe9c51f9aU, 0x26af915aU, 0x01dac304U, 0xc1a12db2U, 0xdc24f204U, 0xc147818bU},
+        {0x9caed7aeU, 0x9969175cU, 0x84fbfb4fU, 0x5a39addeU, 0x892d7e4fU, 0x16588ec3U, 0xf6864aeeU, 0xc712e7a5U,
+         0x46156294U, 0x84d148aaU, 0x4b0ce637U, 0x380d8e54U, 0x311dd9e5U, 0x65ed4b82U, 0x516363b3U, 0x49644107U},
+        {0xd00e6ba7U, 0x53a749b8U, 0x44916f7fU, 0x3d36ec5bU, 0xa4d9e1b4U, 0x2bd1e038U, 0x9784851fU, 0xf952a909U,
+         0x0175e4c1U, 0x8dbaeee5U, 0x4c62a2b9U, 0x5557167bU, 0xe27fa0f6U, 0x861376a2U, 0x08abcebfU, 0xd8a93a5bU},
+        {0x595b6f7eU, 0xf9549f5cU, 0xd38b2021U, 0xbeb32b53U, 0xd09876cdU, 0x83a053aaU, 0x04cda30cU, 0xa5ac7d1dU,
+         0x8ab19c84U, 0x48dbb730U, 0xf5818a48U, 0x99e39160U, 0x47d9ee1bU, 0x36cc3c92U, 0xb540f55bU, 0xdf0b8a0aU},
+        {0x83aa0e93U, 0x690065a2U, 0xaefb1f62U, 0x8f2e3943U, 0x9d9e893aU, 0x504031a1U, 0x31d3fee7U, 0x94016d5eU,
+         0x87addac2U, 0x38eed268U, 0xaa57b07aU, 0xf484373bU, 0x4eee6fd7U, 0x40355d35U, 0x5c454d96U, 0x675032eeU},
+        {0x44a6db03U, 0x1b43e1feU, 0x58275d79U, 0xb2c85d6fU, 0x6b8675fcU, 0x065c0d42U, 0xa4b3235dU, 0x0bfc0504U,
+         0x464b8542U, 0x58ac8d1aU, 0x345d4f05U, 0x37427197U, 0x94a6c992U, 0x3fb8ec7fU, 0x6c34f345U, 0x1955467aU},
+    },
+    {
+        {0x3fb04ed4U, 0xab7ac63eU, 0x11307fffU, 0x08cc330bU, 0x12678de2U, 0x463f9d05U, 0x89d6b936U, 0x90ad85b3U,
+         0xcb6ef150U, 0x991d4d48U, 0x1582894dU, 0x39aefabeU, 0x427222b8U, 0xaffdcbd9U, 0x20a38261U, 0x0e507a36U},
+        {0xa7dc0151U, 0x2818b0edU, 0x46707badU, 0x7e125be6U, 0x48425e3dU, 0xf44b1d15U, 0xf8c94077U, 0x7e2cd40eU,
+         0x20721ec7U, 0x9a3bc539U, 0xaeee082cU, 0x889bee40U, 0x321ef95dU, 0x82a61a8bU, 0x2adcfab3U, 0x905b7508U},
+        {0xb0b7b678U, 0x6275db33U, 0xbcf63816U, 0xf13c4311U, 0x426b6c76U, 0xa1986bcaU, 0x34e4231bU, 0x186e4973U,
+         0xf8d91fc1U, 0xa7a076f2U, 0x449535dcU, 0x11077225U, 0xc0b7e67eU, 0xaa7fc825U, 0x9807bd84U, 0xc0d460e4U},
+        {0x1345e597U, 0x0e103ae4U, 0xdb853cf9U, 0x9c636bf9U, 0xd1ef52a7U, 0x21c975bbU, 0x95bedaceU, 0xa146f521U,
+         0xf45a770aU, 0x7675676aU, 0x21f094b0U, 0xea67a5b2U, 0xdbb31b40U, 0x9ae95dd2U, 0xb053feb0U, 0xa5a99b0aU},
+        {0xb3421fb8U, 0xcf06e5cbU, 0xef5a55d0U, 0x984971f2U, 0xc3b72412U, 0xe7e06b34U, 0x4f6dbf62U, 0x061c8d83U,
+         0x4e3ccd80U, 0x995ef668U, 0x3a6fcdd2U, 0x8067134bU, 0x0e05eb5cU, 0xba939259U, 0x9003b4b7U, 0x6dfc6ad9U},
+        {0x4bb9dc8fU, 0xd08c89b8U, 0xf5edd333U, 0xaba9e93eU, 0x352787d1U, 0x248f7035U, 0xe1c26864U, 0xfd9941ceU,
+         0xe59780d5U, 0x743eae53U, 0xeefe938dU, 0x7872b2fdU, 0x788859e6U, 0x6de97e05U, 0xbd40e6f4U, 0x7a41ec75U},
+        {0xaf6b35a4U, 0x7124be18U, 0xab27fb48U, 0x889f37a6U, 0x733a68adU, 0xb7363240U, 0x208ee513U, 0xf6a6b63aU,
+         0x81f422a6U, 0xcaeb6fecU, 0x75ee1862U, 0x19d5756eU, 0xf560186fU, 0x1cad3704U, 0x002d138bU, 0x3df7c8a8U},
+        {0x4ce45444U, 0x0cbb53fcU, 0xfeccc4e2U, 0xdbde421eU, 0xb25a8114U, 0xbcfbf9daU, 0xcf1993b9U, 0xd24c75a1U,
+         0x87dd4a57U, 0xcb932469U, 0x99f1e524U, 0xbf7593f4U, 0x10e5a78aU, 0xcfcb7d18U, 0xe84dc1d1U, 0x58fe1d2dU},
+    },
+    {
+        {0x9ec4c0daU, 0x1b7b444cU, 0x723ea335U, 0xe88c5678U, 0x981f162eU, 0x9239c1adU, 0xf63b5f33U, 0x8f68b9d2U,
+         0x501fff82U, 0xf23cbf79U, 0x95510bfdU, 0xbbea2cfeU, 0xb6be215dU, 0xde1d90c2U, 0xba063986U, 0x662a9f2dU},
+        {0x4cf27076U, 0xe6847df8U, 0xe7627eaeU, 0xd89858adU, 0x7fd9af59U, 0xfcafebe7U, 0x784e8158U, 0x4d49aefdU,
+         0x03aa781eU, 0x6b90b662U, 0x7df4d846U, 0x6e0f2d1aU, 0x359ca6f0U, 0xe723f210U, 0xa10dd135U, 0xcd32fc59U},
+        {0xd23809faU, 0x18e2b8edU, 0x51d954beU, 0xfd845cb3U, 0xf2451f08U, 0x8ba93363U, 0x2e509f22U, 0x38381dbeU,
+         0x331fed52U, 0xbd707518U, 0x32d8f24dU, 0x3681fccbU, 0x520eb1ccU, 0xb09405a5U, 0x0fb917dcU, 0xe4a32d0aU},
+        {0x29b62026U, 0xe8dbcb57U, 0x889d1d4eU, 0x8d2a3de0U, 0x1f5c5aa7U, 0x37d6619eU, 0x85d56f85U, 0x7564539eU,
+         0xdace0cf3U, 0x4172c8faU, 0x54b79f33U, 0x684aacd9U, 0x4a722925U, 0x5231df52U, 0x3749b3c6U, 0xc1d68541U},
+        {0x97c2a310U, 0x3ea42648U, 0x40122630U, 0xf186aea5U, 0xaa4699a1U, 0xf6921b82U, 0xe4372ae6U, 0x49262724U,
+         0x5e27ded0U, 0x0c41b681U, 0xa75ff8ceU, 0x6d163612U, 0x9714303bU, 0x5a2cfa56U, 0xbca7abf9U, 0x1337e773U},
+        {0x03663da4U, 0xf8166c19U, 0x9f5d0b81U, 0xa5a36291U, 0x7c44aa2bU, 0x6808a6edU, 0x6aa5705eU, 0x6a664a35U,
+         0x33fc22c4U, 0xc28313fbU, 0x7e6c04c9U, 0x08991612U, 0x96bf0cd5U, 0x29f86ec1U, 0x54fde98bU, 0x449a1259U},
+        {0xcebd2d31U, 0x1384b079U, 0xff06db8dU, 0x4dcc1a56U, 0xe477e2f8U, 0xd5e253b3U, 0x1a240c90U, 0xe306568cU,
+         0x92546e44U, 0x692b4083U, 0xbe373826U, 0xffbc8042U, 0x7f7d0db6U, 0x888f2b10U, 0x78934260U, 0x0eac6fe3U},
+        {0x57b4a278U, 0x5364dacdU, 0x1ff4082bU, 0x78f61a5fU, 0x1ad9ccc8U, 0x6746ff30U, 0xd9df2779U, 0x210a917aU,
+         0x0c7b2231U, 0x7f2713fdU, 0xaff20bfcU, 0x3789e61aU, 0xf8d6737dU, 0x7a39be81U, 0x50b5e57bU, 0x670e1b54U},
+    },
+    {
+        {0x53231e11U, 0x6686fd50U, 0x03681e3eU, 0x1f48e865U, 0x198c3609U, 0x5ff99ff9U, 0x76af85d6U, 0xe4f3fb01U,
+         0x6feb73bcU, 0x822c3857U, 0xc951d1c9U, 0x6cc7e74eU, 0xea02b728U, 0x1661a6d0U, 0xd0ef4f1cU, 0x1e63633aU},
+        {0x3bcdaf2fU, 0x3bfee223U, 0x5ba17295U, 0x88531a82U, 0xabdb362fU, 0x1ec64110U, 0x686773e0U, 0x4b30cbb7U,
+         0x3d26b5b7U, 0x68033d46U, 0xe4348575U, 0x1fdf3c81U, 0x77c3c4a9U, 0x6f9e2c57U, 0x65bb629bU, 0x74c63502U},
+        {0x6bf05bd6U, 0x5399f04eU, 0x212a9946U, 0xa2f56e03U, 0xeb470decU, 0x0832f51fU, 0xbee44fe9U, 0x900c3241U,
+         0xf00d358bU, 0xde52ad3bU, 0x3c4efb15U, 0xd6985358U, 0x570b2439U, 0xf95c7204U, 0xe8b1f0f5U, 0x6c31f9e8U},
+        {0xa673059fU, 0x2ffe9c29U, 0x50e0fa19U, 0xec117150U, 0x17464817U, 0xcd15b20bU, 0x7ae1700dU, 0xcbb434aaU,
+         0x227c070cU, 0xb7da9642U, 0x0ad5f845U, 0x41d45e4fU, 0x38b5dfadU, 0x562d4923U, 0xb4dabd17U, 0x4a1a200aU},
+        {0x9f105c50U, 0x7a7c28ccU, 0x7b138525U, 0x82e0deefU, 0x03c233cdU, 0xd628cc34U, 0xab0590aaU, 0x5a8d0362U,
+         0x38a4cde9U, 0x5c9b2018U, 0x66d013c3U, 0xa605f68aU, 0x4143ff74U, 0x936a6b72U, 0x13d4e536U, 0xc059eab1U},
+        {0xa72e294dU, 0xbe6fb2f7U, 0xf00d0dd5U, 0xf158eba3U, 0xedf7edc6U, 0x1a6289eaU, 0x5cd534b9U, 0x29dfe480U,
+         0xec469b52U, 0x44137260U, 0x3929ee69U, 0xd1f1961cU, 0x88a05e4dU, 0x9b434e75U, 0xd00672e1U, 0xbf66d826U},
+        {0xb2d64febU, 0x647e18b9U, 0x9292292cU, 0x3772f8a5U, 0x76cba4e8U, 0x48ef3a57U, 0x1232f60aU, 0xd93f4d03U,
+         0x34698359U, 0x7b0fbd59U, 0xeec90da3U, 0x93e0430bU, 0x54dc8c4dU, 0xa237311cU, 0x45cb2733U, 0x7925555dU},
+        {0x06de12c0U, 0x4d4786e1U, 0x874610e9U, 0x6d9cdac5U, 0x7557244cU, 0xd06d7b1eU, 0x9c102c1cU, 0xf478056dU,
+         0xca5361feU, 0x69a76ce6U, 0x09ab92d7U, 0x26c17ef6U, 0x1068694cU, 0xe68095e0U, 0xf33e3946U, 0x7f09e610U},
+    },
+    {
+        {0x20eae29eU, 0x16fb6eaeU, 0x0d4e1d07U, 0xc7034f2fU, 0xa45a4266U, 0xeb961537U, 0x18ebf331U, 0x8c00fa9bU,
+         0x6702414bU, 0xe7d2a4c6U, 0x81e36c54U, 0xc2fadafaU, 0x3736c974U, 0xa9dc343aU, 0xfea521a1U, 0xefa47267U},
+        {0xc18ada5fU, 0xe84c9ab0U, 0x29122fb3U, 0xfd7e297fU, 0x636be1efU, 0xa8bb5bf9U, 0x6da2b46fU, 0x24cfc017U,
+         0x978a586bU, 0x68fa6139U, 0xa4f814f2U, 0xed959ca1U, 0x5deda927U, 0x9868714dU, 0x079c61a6U, 0xebff8fbbU},
+        {0xebfd913dU, 0xc3f95603U, 0xee54c9eaU, 0x50a680e6U, 0x4c2a8d20U, 0x74d07a08U, 0xe907ddf8U, 0x36362aa7U,
+         0xc52e243dU, 0xc44f9aeaU, 0xd6b2faafU, 0xd830bb10U, 0x70da2a82U, 0x34162443U, 0x6cb8afd5U, 0x48f27867U},
+        {0x94679da2U, 0xf1031895U, 0xc7f057edU, 0x16ddd67fU, 0xa1292ec6U, 0xea2ded72U, 0xd4b9bc82U, 0x004a7d58U,
+         0x779ffe26U, 0x4877f484U, 0x963fa28aU, 0x71c3b494U, 0x7ec71b3bU, 0xe6b1d814U, 0x6702cb75U, 0xb98ac5b7U},
+        {0xad132896U, 0x7cababf9U, 0xb7bc6c96U, 0xfcb1e3baU, 0x2dd9200dU, 0xf295ad96U, 0xf32a1e02U, 0x4487976dU,
+         0xaf685248U, 0x48c01b12U, 0x6276aa7aU, 0x06b40d5aU, 0x74561a33U, 0xefc9a907U, 0xd115afe1U, 0x27bd5860U},
+        {0x775732c0U, 0x859864d3U, 0x233777aaU, 0x202fe5e7U, 0x7cb1096eU, 0x624a5d1bU, 0xf8b74b9bU, 0x8f3ccf31U,
+         0x65b9415bU, 0xe73bde5eU, 0x54858825U, 0xa90e6877U, 0x97ce53d8U, 0x89ef46d9U, 0x2d39e531U, 0x67f1cd3eU},
+        {0xbfa2670cU, 0xe08156f6U, 0xa06273e6U, 0x7400f82bU, 0x83350324U, 0x8b6a9caaU, 0x8bcb8378U, 0x4a4d3ac2U,
+         0xd6c1764dU, 0x808b9ffdU, 0xbf29beedU, 0x4930594cU, 0xdef02b9dU, 0x17e7711dU, 0x01845a4fU, 0x70abb91cU},
+        {0xc87c4b65U, 0xccf34eadU, 0x1e07b2a9U, 0x96f8808aU, 0xc066ce49U, 0xfc76c5e2U, 0xcbd001c7U, 0xee7d69c4U,
+         0xd136a95aU, 0x23e8f44eU, 0xbae942e5U, 0xc33e8999U, 0x030f2ee2U, 0x1a192abfU, 0xc1a41382U, 0xecc8626eU},
+    },
+    {
+        {0x60cb3e41U, 0x997fddfcU, 0x308b92c0U, 0x143d084fU, 0xa9e98ed3U, 0x3e10cec0U, 0x9dd4829fU, 0xe7a26ce6U,
+         0xcf2cfd51U, 0x0e8a9421U, 0x420e83e2U, 0xd0a6b2c0U, 0x1aafbb18U, 0x471b006aU, 0x0fa7984bU, 0x2a758e30U},
+        {0x7b4ae861U, 0xd97e5b91U, 0xd6e32fa9U, 0x203c35e4U, 0x772089f5U, 0x0d38bfb6U, 0x036bf8d0U, 0xf5cafabaU,
+         0x0d82239cU, 0xcc9c239cU, 0x552f05f3U, 0x9b3b2a9cU, 0x64083915U, 0x7bff9904U, 0x022a6d81U, 0x19e83b8aU},
+        {0xfaee42dbU, 0x70f9fd2bU, 0x4730714aU, 0xd9bbbc5bU, 0x91ecbfc1U, 0xfc7b6edbU, 0xd9b59150U, 0xcc3427e7U,
+         0x15d87bdbU, 0xc6229c01U, 0x8e72422dU, 0x10e5cbadU, 0xfb215200U, 0x885e3fd3U, 0xa521c6a1U, 0xea249841U},
+        {0xbd2a9651U, 0x84fd4cd7U, 0x494c9820U, 0x8f9e509cU, 0xd7e80542U, 0x12df5156U, 0xceb63f1fU, 0xe9389024U,
+         0x5e786824U, 0xfefde2b7U, 0xc6770bfeU, 0x8d7110ceU, 0xf671aaf1U, 0xf9287abaU, 0x23726595U, 0x86486887U},
+        {0x7ed4a086U, 0xff4366c6U, 0x8e9c410eU, 0xb1d75c15U, 0xfbcb5cf4U, 0xec83c585U, 0xcd98445dU, 0x948f05baU,
+         0x9e2bca4bU, 0xa2a1800fU, 0x1c3fa2d1U, 0x1c2328a7U, 0x60113941U, 0x82f450a6U, 0xfb5a2a33U, 0x864ca89fU},
+        {0x2e96e4f1U, 0xcb0a7165U, 0x0ae80030U, 0xff5f0160U, 0x335efccaU, 0x20177708U, 0x0198197eU, 0x56bb148fU,
+         0xeeb0582eU, 0x5889f019U, 0x004af0ebU, 0x7313d1d2U, 0xbe30ea9fU, 0xbeb03ed8U, 0x61300a33U, 0xa09584a5U},
+        {0xb7542c21U, 0xc0cbea6cU, 0x8ea64c15U, 0xae19f4d2U, 0x451d6d43U, 0x0656fc45U, 0x92919ac9U, 0x25841962U,
+         0x672bfabfU, 0x3bebe319U, 0xe4c2ad7bU, 0xf3e3a186U, 0xcc7513d5U, 0x01e5daa4U, 0x1cdb2448U, 0xfcb35b1fU},
+        {0x7cddab8bU, 0xcf2d41aeU, 0x53c68e6fU, 0x9f0e4d12U, 0xd82d0c37U, 0xed116900U, 0x7829256bU, 0x264559d8U,
+         0x001de473U, 0xc9f64b45U, 0x39caf1e6U, 0x7a8631afU, 0x034072d7U, 0xef7bc637U, 0x26d3512cU, 0x79e5bd19U},
+    },
+    {
+        {0xde6b80efU, 0x3cf29eb3U, 0x7d79424fU, 0x71cbcb96U, 0x23bcbdc5U, 0xd23540c2U, 0xe3662ec8U, 0xb6459e0eU,
+         0x1a71ba45U, 0xf30bf0b6U, 0x48e35b2fU, 0xc4b3ae6dU, 0xe5661db3U, 0xe1dadf16U, 0x06f3e06dU, 0x067c876dU},
+        {0x033eb51fU, 0x253ef375U, 0xbe79c211U, 0xb6890576U, 0x01f41593U, 0xe4d36f73U, 0xd9823c88U, 0xe5d8e8f0U,
+         0x5a62a2d9U, 0x79d5bd96U, 0xd9f0f549U, 0xe509dc46U, 0xd8feeef0U, 0xabb16a57U, 0x861e3e04U, 0x4dc1e9b7U},
+        {0x319888e9U, 0x439cf279U, 0xf2448a8bU, 0x3d12ba6bU, 0x29668167U, 0xdde60d30U, 0x3ac3a6e2U, 0x1f90ea77U,
+         0xef113b79U, 0x56fdfc97U, 0xe59522e6U, 0x213751feU, 0x71eb96a8U, 0x958153d2U, 0x15daa10eU, 0x89be367cU},
+        {0x0f155e64U, 0x37a67648U, 0xa8a30117U, 0xab66be4fU, 0x21bae0ddU, 0xc56b0f73U, 0x7dbc8c3dU, 0xa9ca27f7U,
+         0x561b3297U, 0x1f3f333cU, 0x1bcaf0aeU, 0x875d4182U, 0x6c02d004U, 0xd197d224U, 0x78fb14d4U, 0xf4bb3356U},
+        {0x3562222cU, 0x085efb6fU, 0x91e6f2c6U, 0xde034479U, 0x334b52baU, 0x6e702badU, 0xedffe0adU, 0x13a4e54dU,
+         0xa8200145U, 0x8cb1668cU, 0xadc904c0U, 0xd4f9c577U, 0x1d609a52U, 0xb2cac2f8U, 0x5816e813U, 0xc9d67d4eU},
+        {0xc1bf6c42U, 0x93eab3ddU, 0x11988753U, 0xf7793d9bU, 0x16cee74eU, 0xee746548U, 0xd6c105c7U, 0xd02e1b3cU,
+         0x87bc54ccU, 0x1336328fU, 0x931b6aacU, 0xbca5879bU, 0xd0d24526U, 0x12732270U, 0xca8e2258U, 0x9a0b74f3U},
+        {0xf43b46bbU, 0x437e4dc0U, 0xfac92525U, 0x12ed3a63U, 0xd8455dbdU, 0x1d407c05U, 0x233caaddU, 0x61991ebfU,
+         0xcc20a848U, 0xf48f5901U, 0xa52ecd8eU, 0x1ca8729cU, 0x66fbadf1U, 0x952f3871U, 0xf3fde492U, 0x01c5e308U},
+        {0xd6ee247cU, 0x6d4bc629U, 0x7f51cee0U, 0x1f478e84U, 0x11cfe759U, 0x5eba1056U, 0x0686d7f2U, 0x68fb7180U,
+         0x1a01865dU, 0xae1f822dU, 0x04c73c9dU, 0x9a8d580bU, 0x501b0c07U, 0x73735427U, 0x62dd9636U, 0xcd12d234U},
+    },
+    {
+        {0x496943e8U, 0xdeda0f5bU, 0x7e73c5a5U, 0x1d6f1fc6U, 0x118f0623U, 0x793234aaU, 0x280bb840U, 0xd68a80c8U,
+         0x6b133120U, 0x294c8426U, 0x7845295aU, 0x5b0e7b8fU, 0x77b0e28bU, 0x0c4b1f91U, 0xf4b586d0U, 0xdb8ba9ffU},
+        {0xa412b6fdU, 0x8bda222cU, 0x6f702b82U, 0xaced053cU, 0x3752373cU, 0x402f8efbU, 0x677a40beU, 0xf16a409cU,
+         0xeca052daU, 0x268dae77U, 0x249ebca4U, 0x16540659U, 0x74e30e4eU, 0xd7a6a75aU, 0x14532799U, 0x2a413117U},
+        {0x8ca1c4f9U, 0x35b42aa1U, 0xcab7e282U, 0x4f4efe34U, 0xa61f16f4U, 0x4c40b83dU, 0x22bd728cU, 0x7815f78fU,
+         0xb778bc15U, 0x9ab1ea36U, 0x1577d1e1U, 0x5cb42de6U, 0x1458c35dU, 0x7dd93cf3U, 0xcd39af6aU, 0xc1c601e8U},
+        {0x326dd4e4U, 0x5c1a0b6eU, 0x6bed9832U, 0xb89f4f2fU, 0x9976f84dU, 0xfbe37f69U, 0xab766f42U, 0x4154b506U,
+         0x075ded1cU, 0x6c859295U, 0xd1e22dd4U, 0x414ea9d9U, 0x61025ff6U, 0x94c6e44dU, 0x43c59888U, 0x23ad0750U},
+        {0xee8c8530U, 0x6d26e1c3U, 0xef8f4d8eU, 0x512df681U, 0x016a6c6dU, 0x6e377c64U, 0xa0ec4017U, 0xc39273cdU,
+         0x798446c7U, 0xc4030f0fU, 0xa2eed715U, 0x50edfcbdU, 0x41c31998U, 0x9d01d394U, 0x57433c8eU, 0x8c41be42U},
+        {0x43ed5996U, 0xbde4ce8bU, 0x9360af53U, 0x6831fe59U, 0x3281b924U, 0x492fbc90U, 0xfe99a4eaU, 0x1a46b7e9U,
+         0xe8c85caeU, 0x2ee4ed11U, 0xef52745cU, 0x508794a9U, 0xa063ebf5U, 0x0e3ee084U, 0xa3f1dc57U, 0x683ce81eU},
+        {0x237a26c1U, 0x31f240bbU, 0xc0dbf6a5U, 0x166c6e58U, 0xc1d03b25U, 0x27522431U, 0xf58411b0U, 0xda317447U,
+         0xecf74d6fU, 0xf51836ecU, 0xd7a81525U, 0xd36836c5U, 0xc259d8b7U, 0xd2384167U, 0x7f5d8c69U, 0x753b97b8U},
+        {0x3f7f0246U, 0x4c51a7a6U, 0xfc727ddfU, 0x93e86e49U, 0x0b5956eaU, 0x080a8d4dU, 0x69cc95c1U, 0xb73c6527U,
+         0xea2a407bU, 0x597e5164U, 0xc6e554e5U, 0x1a0d72e4U, 0xc5b6c1eaU, 0x4b535893U, 0x7174ca9dU, 0x9a67db10U},
+    },
+    {
+        {0xc28d3d5dU, 0x4095980fU, 0x73449ceaU, 0x9612aeb9U, 0x907a30b0U, 0x52dc0270U, 0xf65c8042U, 0x324aed7dU,
+         0x96ab7c84U, 0x967224afU, 0x7e332843U, 0x19213b0cU, 0x5aec1f4fU, 0xf130c0c3U, 0x74b61f2fU, 0x648a3657U},
+        {0xb2919749U, 0xa8f38381U, 0x8de0db1fU, 0xf72b3e4aU, 0x880d7203U, 0x28d32681U, 0xa26f4902U, 0x32c9331eU,
+         0xf290b5e3U, 0x631e97b0U, 0xae39ab09U, 0x268a4abdU, 0xb6f3dbb8U, 0x695a2f02U, 0x34209cb5U, 0xd7cd272bU},
+        {0x2fd53ed3U, 0xf5c91758U, 0x9da56cceU, 0x163f74fbU, 0x31df7c49U, 0x5b8f60b9U, 0x996772adU, 0x20840bd5U,
+         0x1a7a7132U, 0x87143fe5U, 0x94e70899U, 0x5487c473U, 0xa6bafac2U, 0x487bd476U, 0xcec18243U, 0xf2993497U},
+        {0x7b9795e4U, 0x1e1c2252U, 0xe1846b8eU, 0x69c161b6U, 0x0fec6b1cU, 0x4a02f6a7U, 0x3b983785U, 0xeb292f3bU,
+         0xae53a0feU, 0x5b7e9d2fU, 0x09111c6fU, 0x57131d75U, 0xf145835bU, 0x1696634aU, 0x96eebe80U, 0x8c43c25aU},
+        {0x88a35b35U, 0xdbd2cbb5U, 0x5c0a121eU, 0x1ab5d88aU, 0xe588ebfdU, 0xbd13d029U, 0x0eb339bbU, 0xe6b6bff6U,
+         0x9c1007bdU, 0xc57293dbU, 0x3be999c7U, 0xfe3b6c9dU, 0x835961ddU, 0x266f43e3U, 0x3300d2f3U, 0x1a5ff2bdU},
+        {0x2032f9a2U, 0xc48b8e29U, 0xfa1fc6ccU, 0xce566f50U, 0x31ff8f63U, 0xed2374cbU, 0x9a6b2640U, 0x25aac6bdU,
+         0x2b51d4f0U, 0xe76230a1U, 0xc419f3d9U, 0x559883bbU, 0xf4f190f6U, 0x16f32f54U, 0xa644546cU, 0xf5a6c63bU},
+        {0xc0360dd3U, 0x0d4ef8d2U, 0xd850e209U, 0x47a8a836U, 0x6e0ce3bbU, 0x88b0b808U, 0x5be499b2U, 0xe0531774U,
+         0x3c24f87bU, 0xb2aecd91U, 0x98103dc2U, 0x61b987deU, 0xb5b6a014U, 0xcd809582U, 0xa5d92f39U, 0xdc1c3b71U},
+        {0x89303fddU, 0xaea39d57U, 0x19d1ed35U, 0x4d71457fU, 0x0049fbe1U, 0xe620d431U, 0xdf3b5ef2U, 0xa65a3a01U,
+         0x02e68703U, 0xdad44a8dU, 0x4faed3caU, 0x86861d02U, 0x90ed2c76U, 0xb8f43d8dU, 0x0cff5c6fU, 0x798ea094U},
+    },
+    {
+        {0xfd054c96U, 0x8e8bd373U, 0xa8d1ca88U, 0xeec4143bU, 0xe5fee5dcU, 0x6d51dfdbU, 0x19cde61fU, 0x4df9c149U,
+         0xcad10d5dU, 0x92ebac06U, 0xc2884901U, 0xb5d506cdU, 0x3a1d85d4U, 0x050974c2U, 0x092d8728U, 0x0035ec51U},
+        {0x1da49e04U, 0xc0c6b0fcU, 0xe57a8d70U, 0xe9de4554U, 0xe4b87088U, 0xd25317d4U, 0xd2cc998cU, 0xed32cad8U,
+         0x7c1db9e0U, 0xb63120d1U, 0xb49fab7dU, 0x52da9facU, 0x5859d20bU, 0xa541ca37U, 0x1d030204U, 0x129fef5fU},
+        {0x5def001dU, 0xf4f225daU, 0x989ba27eU, 0x21f9bbd6U, 0x09e3b64bU, 0x20e0bd1cU, 0xb27e2cafU, 0xa549a32dU,
+         0xf0624783U, 0xdd5db1a7U, 0x62c9705aU, 0xeb141e2aU, 0xd8a59456U, 0xdf4cc30eU, 0x06d966cbU, 0x799b7a79U},
+        {0xe883f855U, 0xcb7418d4U, 0x63c34016U, 0x28c36dcbU, 0x1c70366eU, 0x8049e411U, 0x4d6360f1U, 0xe821ab72U,
+         0x59852ddfU, 0xed4e0c6aU, 0x14ec23efU, 0x8b3b19c6U, 0x5416cf59U, 0x67d0d411U, 0x63f53ce3U, 0xadefcbf8U},
+        {0xc52ed4cbU, 0x05aef1e5U, 0x3c09ec5aU, 0xc954defbU, 0x83532e6eU, 0x23f08bd9U, 0xda07ecd1U, 0x7e798f30U,
+         0x94bb9462U, 0x25716607U, 0xff9f37a1U, 0xb173571bU, 0xdef2f057U, 0x041a9549U, 0xa24dac83U, 0xd23dccc4U},
+        {0x4206e37aU, 0xa24778acU, 0x8c504731U, 0x4d8c1894U, 0x6b5a274fU, 0xcf4e83f4U, 0xf2868002U, 0xb526ab87U,
+         0xf0c5ccabU, 0xbf3678ffU, 0x00fa392aU, 0x28ce539bU, 0x60a6f18dU, 0xd5caacedU, 0x78100d8eU, 0x641f35d7U},
+        {0xd3630834U, 0xfdf3a0fbU, 0x63dac067U, 0x8463f128U, 0xba8c8108U, 0xad5b9e96U, 0x31514783U, 0x224fa200U,
+         0xc47a2272U, 0xcd3c4737U, 0xc0a50f75U, 0x3d62924eU, 0x391d09f5U, 0x3c4b70faU, 0xbb3eda5cU, 0xbbe54e32U},
+        {0xb441742eU, 0xfbff59eeU, 0xaf3806e9U, 0x2f14a547U, 0xbc9693a7U, 0xf455452fU, 0xe51ad212U, 0x3f0d8994U,
+         0xcfecadbeU, 0x8c65363bU, 0x3ad13d95U, 0x1e205e2cU, 0x847a6e0bU, 0x45e5cb0eU, 0xf28c3dc4U, 0xfbd76c23U},
+    },
+    {
+        {0xac1f98cdU, 0xcbfc99c8U, 0x4d7f0308U, 0x52348905U, 0x1cc66021U, 0xfaed8a9cU, 0x4a474870U, 0x9c3919a8U,
+         0xd4fc599dU, 0xbe7e5e03U, 0x6c64c8e6U, 0x905326f7U, 0xf260e641U, 0x584f044bU, 0x4a4ddd57U, 0xddb84f0fU},
+        {0x694a09ecU, 0x435efb7bU, 0x3e8535f0U, 0x0cd326a5U, 0xd5c92aa4U, 0x0a42fc69U, 0x6255d80fU, 0x2e3c0532U,
+         0x88c7327eU, 0x25348681U, 0x707b6651U, 0xe048a53cU, 0xb82fc1abU, 0xbddae240U, 0x656c6fb5U, 0x001ff891U},
+        {0x8fb64db3U, 0x17b98d53U, 0x39dd5384U, 0xa7ede4caU, 0xbe53b8d6U, 0x40bbb83fU, 0x29bdccb7U, 0xc1142392U,
+         0xfc0259beU, 0xe230ce9fU, 0x4d4567d1U, 0xa8758090U, 0xfe978bd1U, 0xa5cecde4U, 0x5b486fc2U, 0x1237f6dcU},
+        {0xab9c7ce6U, 0x205f19a2U, 0xa1908934U, 0x33710316U, 0x3e24dda4U, 0xae15fb7eU, 0xcfa41587U, 0xe8e2a24cU,
+         0x8836267cU, 0xb2c01eb6U, 0xb5c27a73U, 0x6e09e603U, 0x3bee2059U, 0x4caf2b2bU, 0x0c6f5d1bU, 0x46c983ceU},
+        {0x03081e46U, 0x1eded834U, 0x554559eaU, 0x3a52218cU, 0x19263471U, 0x082d9c2cU, 0x31a77224U, 0x6c5b4bf8U,
+         0x0bfbcd70U, 0xed1f9cb8U, 0x6ac22a62U, 0x41d0cf82U, 0xce2be478U, 0xb2347863U, 0x4926d42fU, 0xcb051371U},
+        {0xf11349e2U, 0x80832addU, 0x17524c05U, 0x60e3ecf4U, 0xa41ad78dU, 0xe62147e9U, 0xc6b9c2e7U, 0xf8058324U,
+         0x5b2025fcU, 0x5fac469eU, 0x626de88dU, 0x509498b5U, 0x0ea11223U, 0xcde81aa6U, 0x0a8856cdU, 0x95c60e5aU},
+        {0x464dcd4bU, 0xdcae5aecU, 0x9911c124U, 0x0c30c7d5U, 0xcab10a45U, 0xb5670665U, 0x670cade4U, 0xe1e9a856U,
+         0xbb041f2cU, 0x2d0b625eU, 0xaca16b29U, 0x7f44d19aU, 0x9b257792U, 0xb7ac4359U, 0x4455c531U, 0x562b0a95U},
+        {0x8ac7b3c2U, 0x5b0d3966U, 0x383d5b5fU, 0x12acaf92U, 0x170032a2U, 0xb2f0a38bU, 0x5d8573c2U, 0xa7549aacU,
+         0x9287eaefU, 0xfa0c9171U, 0x537116dfU, 0x5d6b5115U, 0xc1947d2bU, 0x335a1d70U, 0x0d1c2415U, 0xbd17d1b9U},
+    },
+    {
+        {0x20a959e5U, 0x5a213821U, 0x8b91d4ccU, 0x91e1493aU, 0x1d8e06bbU, 0x8de05f28U, 0x1dd12fdfU, 0x6057170bU,
+         0x2385a2a8U, 0xe899be93U, 0x3ee24c65U, 0x465152bcU, 0xf71df262U, 0xadd9a2daU, 0x6a6a4807U, 0x9a1af0b2U},
+        {0x82fd545cU, 0x1899ca5dU, 0xd4a28e66U, 0x7c133f8dU, 0x46dc85dfU, 0x0394110aU, 0x7c52e064U, 0x6773fd67U,
+         0x947eb1aeU, 0xe8c7f034U, 0xa1c6cf98U, 0xead780f5U, 0xdd2b246bU, 0x0f0f25c9U, 0xcd97652fU, 0x444eb6d8U},
+        {0x971c032bU, 0x0d4da162U, 0x17afdc98U, 0xff6b668aU, 0xdfc766c5U, 0x3dd11b5fU, 0xd6e00260U, 0x71eba8fcU,
+         0x1668359fU, 0xe7ab5a8eU, 0x774b4755U, 0x71931ad1U, 0xf54cbb7fU, 0xef660516U, 0x4b61d39dU, 0xd2ff1262U},
+        {0x0b86f021U, 0x373c616bU, 0x10468050U, 0x0374e438U, 0xce0c87c2U, 0x237c79aaU, 0xd17ce565U, 0xe0f86d94U,
+         0xb5bf325aU, 0x3b6b79ccU, 0x115fc45bU, 0x9a80bcc0U, 0xf1c89a2cU, 0x7a91e832U, 0x730abcf4U, 0x0c571c73U},
+        {0x2a03a61cU, 0xd06e4745U, 0x69070574U, 0x507868f4U, 0xbaaa9dd0U, 0x2ca17442U, 0xb3249d23U, 0x855ec305U,
+         0xc65dfc07U, 0x5dfc6eaaU, 0xa17e4496U, 0xd332f74eU, 0x9b42fb4eU, 0xf543cbffU, 0xc5f01c17U, 0x0dd85d2eU},
+        {0x3aaa138bU, 0x6df0d9f7U, 0xef786cd6U, 0x63efba0bU, 0x8c4671ffU, 0x7943ebc1U, 0xd3c3ae28U, 0x417fe249U,
+         0x4a1ae869U, 0xd1c91b33U, 0xc05566afU, 0xc19dafdeU, 0xf0fa9e57U, 0xc20a5d29U, 0xbcd23e38U, 0x023589d7U},
+        {0x1f32d706U, 0xb00c0a48U, 0x746a0678U, 0x0618cca4U, 0x3095bfa2U, 0xf150d29aU, 0xbab3fbf1U, 0x3ce4486aU,
+         0xfc7fd9e4U, 0x40b73637U, 0xcd61e89fU, 0xedd15643U, 0xb1094906U, 0x88efd046U, 0xaae37852U, 0xe775408dU},
+        {0x02da6e03U, 0x8ad0772cU, 0x08cad603U, 0x4c277df9U, 0x3d696f4fU, 0xce991e19U, 0x9f245041U, 0x42ca15abU,
+         0x8c347793U, 0x836889faU, 0x8106bea7U, 0xd66e85a6U, 0xfcb800eeU, 0x647ce4d1U, 0xc81c57c9U, 0x68d2ef26U},
+    },
+    {
+        {0xecb94266U, 0xb1a6973eU, 0xa7d4df12U, 0x80cef0fbU, 0x518da318U, 0x421439a4U, 0x23a08411U, 0xa576df8eU,
+         0xe1b28ec8U, 0xee8be11aU, 0xf514d9f3U, 0x432e10a7U, 0xe58cd82cU, 0xc92b97afU, 0xe76640b2U, 0x40a6bf20U},
+        {0xda704896U, 0xcec5725bU, 0xc9acfb8dU, 0x6f3ba063U, 0x7be71baeU, 0x54652086U, 0xef3b5a3bU, 0x9e5dcc62U,
+         0xca82c835U, 0x48f2769dU, 0x6030f512U, 0x79605d18U, 0x54c76122U, 0xa5fd3a21U, 0xdb925f3eU, 0x6fedd12dU},
+        {0xcd9ed6c1U, 0xb68aeb58U, 0xc3d593d6U, 0xc24e745bU, 0x705edd0eU, 0x80bfc187U, 0xcb74f53eU, 0x0328336dU,
+         0xf8fafeeeU, 0xdec6ebe6U, 0x25cb494aU, 0x265bf4dfU, 0xa20d7c8cU, 0xc46d5943U, 0x12fd9f28U, 0x71a89838U},
+        {0x44bf7ea0U, 0x953ed587U, 0x5cef5833U, 0xe33625a0U, 0x76f03b20U, 0xf8d6e9f9U, 0x5b8745adU, 0xa7de0837U,
+         0x9bbcabaaU, 0xe04c0553U, 0xfebc5aa2U, 0x645a47c0U, 0x34888e9aU, 0x2104a0b3U, 0x57ada5e5U, 0xa63d96b0U},
+        {0x3235983aU, 0x919a9a8dU, 0x013bceb2U, 0xe38a1037U, 0x70fe1531U, 0xdc63926dU, 0x8b911c54U, 0xce4f4eaeU,
+         0x0d3cdecfU, 0xecfd6b19U, 0x8ebf740aU, 0x526c6522U, 0x9e707543U, 0x3eade024U, 0xc390fbbbU, 0xf3c9f973U},
+        {0x66da57e4U, 0x6b75648aU, 0xfdcdd9f8U, 0x98c4996eU, 0x4631bc1eU, 0xdbdea2a7U, 0x983918b9U, 0x690cdae3U,
+         0x933f33bbU, 0x2b6195b4U, 0xce95a3d4U, 0xf863d8fbU, 0xf595894dU, 0x7a9fd91bU, 0x677b79a4U, 0x840adc79U},
+        {0x55b0e6c9U, 0xa6daab66U, 0x786e4c89U, 0xdb5ff9cfU, 0x6df8bcbdU, 0x78e28fb3U, 0x4b986222U, 0x4dbebfa5U,
+         0x5eb2cc25U, 0xe94a7855U, 0xbc504efaU, 0x589311b2U, 0x6e2229f3U, 0xf45a626eU, 0x3c913aedU, 0x10fee7b0U},
+        {0x4ad916fbU, 0xa9f8fa10U, 0xe949e4a3U, 0xe68065fdU, 0x01cff4cbU, 0xc13c35acU, 0x689080c9U, 0xc266658eU,
+         0xa0887814U, 0x56aef52bU, 0xeb611388U, 0x6b8fecdfU, 0xb24627abU, 0x0f798170U, 0x54e7daabU, 0xe7e85938U},
+    },
+    {
+        {0xbe58ad71U, 0x8f763889U, 0xcf9a3a20U, 0xbb30d1f5U, 0x29de8c38U, 0x0a05fe96U, 0x28dec3e3U, 0x7778a78cU,
+         0xfd9f43acU, 0x3b513fc1U, 0xff24ac56U, 0x87b38411U, 0xf2ff5800U, 0xf7098e12U, 0xb5a5b22fU, 0x34626d9aU},
+        {0x1073e879U, 0xa7ea1c25U, 0xe104eea7U, 0x2cf16a5aU, 0x7f0fe393U, 0x632f482dU, 0x5ca006d1U, 0xe7b9796bU,
+         0xbaa89d98U, 0x38e71089U, 0xeda98af3U, 0x9cb5bf25U, 0x737cc1caU, 0xdf42102aU, 0x19169e2fU, 0x12b8988cU},
+        {0x3319c869U, 0x2f7c6eaeU, 0x761eb270U, 0x18a9f95dU, 0x2fccacdcU, 0xd0183902U, 0x98173fc8U, 0x3018045dU,
+         0xd2b856f0U, 0xfc0c76c9U, 0x4a3d9a7bU, 0xca2a84caU, 0x0d622e3bU, 0xf8662432U, 0x2503b7b6U, 0xac5fc578U},
+        {0xf2628f0fU, 0x865d722bU, 0xf2aee919U, 0x65423daaU, 0x4be09a73U, 0xc2c915a2U, 0x50876203U, 0x071bf018U,
+         0x45a1c334U, 0xb57c5cbdU, 0x231c80bbU, 0x098f9c6aU, 0x1c084ce2U, 0xe33600bcU, 0x504dcf4aU, 0x527aa15dU},
+        {0xa5ed29b5U, 0x4c66986fU, 0x712add1bU, 0xf5830b60U, 0x9a63c885U, 0x43ab67dbU, 0x1ee57ef3U, 0x322881b6U,
+         0x7cd15ad2U, 0xef4f126eU, 0x94ee7604U, 0xca83aeabU, 0xf41531e1U, 0xb110b19dU, 0x17a0344eU, 0x16770284U},
+        {0x18953133U, 0x6477dc9bU, 0x748721aeU, 0x7fb3b42aU, 0x0fccdfa9U, 0x8812806cU, 0xed0ddd23U, 0x0a0b2b4fU,
+         0x34af0fc9U, 0x4bc24a37U, 0xb0ed4ba9U, 0x6fa384e8U, 0x86458c8dU, 0x03c1c6caU, 0xfb5abf2fU, 0xcda1182cU},
+        {0x86c96100U, 0x3bfa8407U, 0xa6e9c8e6U, 0xa163011aU, 0x2df3dbccU, 0xfb43dd9bU, 0xc0fb1b9fU, 0x3f38473aU,
+         0xf2624707U, 0xf1e2ac1bU, 0x0b75f1bcU, 0x66571c7cU, 0x2f079ce5U, 0x2534c446U, 0xf5d40395U, 0x70c69c55U},
+        {0xa39620e1U, 0x6f6376dfU, 0x50121378U, 0x5b1911c8U, 0x4c03c39eU, 0x33a32e59U, 0xcb9be568U, 0x0218343aU,
+         0x506998b5U, 0x5e0199f6U, 0x2f43c9ecU, 0x443299a4U, 0x602fbfc0U, 0xaf3f24fdU, 0x970a50beU, 0xbea81d48U},
+    },
+    {
+        {0x06d903acU, 0xb09eda9cU, 0xe5ad7e5cU, 0xd5f96274U, 0x0e7afd2eU, 0x63729fd3U, 0xe637a844U, 0x0928955eU,
+         0x5bcd091fU, 0xc5180e93U, 0xa8a8d83fU, 0xac3d26efU, 0x093a95eeU, 0x27b78a13U, 0x3d3f42a8U, 0xc2562100U},
+        {0x0f59dd9eU, 0x231047a6U, 0x5b58f0e7U, 0x7ce5e9c5U, 0x4cb18ad6U, 0xdad163b0U, 0x3771d350U, 0x4f89bdeeU,
+         0x0156b049U, 0x1016ae32U, 0x6638df5cU, 0x1e488250U, 0x043bb247U, 0x5c4baf4cU, 0x227a1f69U, 0xca7952d5U},
+        {0x7874b839U, 0x81112875U, 0x953d2b41U, 0xbe4115b3U, 0xb230b6aeU, 0x053df0dfU, 0xc0e1e5a8U, 0x3e03b81fU,
+         0x7c0594baU, 0xa0c1ce56U, 0xfdab5b8dU, 0x7de5c5f0U, 0x57198f66U, 0xc44f6607U, 0xdff07f42U, 0xd13ae163U},
+        {0xfff01197U, 0x529c314cU, 0x79a245bfU, 0x94b668f0U, 0xa2c3c4c9U, 0x0c396bacU, 0xcae3c5a8U, 0xcb9e8304U,
+         0x3b989c1dU, 0xc334e076U, 0x015e0a24U, 0x41b2d18cU, 0xff088917U, 0x127258cdU, 0x1eb80e6aU, 0x62c7d280U},
+        {0x8357a513U, 0x3a3f78e6U, 0x45b3023fU, 0xf151bd13U, 0xaa2922c5U, 0xd62fa283U, 0xa2f4492cU, 0xe662c0b7U,
+         0xa017d07eU, 0x192a201cU, 0x25538d89U, 0xd8035cd6U, 0xa121a419U, 0x05dae208U, 0xe6124523U, 0xab0b193cU},
+        {0xb9a7d197U, 0x9bae90d3U, 0x88ea5945U, 0x5e83a8c1U, 0xa22c234bU, 0x4778ffe0U, 0x280df639U, 0xc2c58a54U,
+         0x89eeb5e9U, 0x4e41ccbfU, 0x45ad8248U, 0x0a47ec45U, 0x62ed39a6U, 0x573041abU, 0x366e0927U, 0x72ea3288U},
+        {0xdf37d242U, 0x4995f7efU, 0x079c14b0U, 0xc29feca6U, 0xcbe3587dU, 0x843862c7U, 0xc94cf6cbU, 0x40bf80b1U,
+         0xa6405088U, 0x3d1d8279U, 0x42bd3558U, 0x74321ebaU, 0x1b26fe12U, 0x4f53fe9bU, 0xd856aaf0U, 0xb579dd35U},
+        {0x508d2cc2U, 0x15f9ffc2U, 0x7048c58cU, 0x8e0beed4U, 0x10730dc5U, 0x3c8cf2a4U, 0xf89c69bdU, 0xe2f349b0U,
+         0xe0d4c04fU, 0x7e347bd8U, 0xe09cbdb3U, 0x42344be8U, 0x760215baU, 0x81860aecU, 0x0f827237U, 0x1feb2f28U},
+    },
+    {
+        {0x63d82751U, 0x27aae751U, 0x07ad3545U, 0x5645b4a9U, 0xa0e3b285U, 0x399064f3U, 0xec6db109U, 0x85d0fef3U,
+         0x4eb1f962U, 0x82c237a2U, 0x68773315U, 0x3e8751e9U, 0x582cf566U, 0xe29d496eU, 0x13a38c0bU, 0x1f036484U},
+        {0x1d5fcadeU, 0x56356d14U, 0x09711ff7U, 0x68b482e0U, 0xcd11df04U, 0xf607a6cfU, 0x19a4c4f4U, 0x6b790f4bU,
+         0xc338d3ffU, 0xb6fff86fU, 0x7be26b0aU, 0xa83fa5b4U, 0x9cae09cbU, 0xf296661fU, 0x2ff9eb3eU, 0xd03a981bU},
+        {0xecde4cf3U, 0xb9955061U, 0x478a066aU, 0x9340e535U, 0xd15d9ae7U, 0xbe7c2d26U, 0xc11422c3U, 0x384dab4aU,
+         0x252d0566U, 0xb7c796b2U, 0x9751ba73U, 0x1f430a33U, 0xa2b4c6f0U, 0xbfb4ed6dU, 0xd1b9ca43U, 0xd6e3c5bcU},
+        {0xe3a3e0cbU, 0xbb0ccdabU, 0x85978be0U, 0x3d2479deU, 0xacc4f8feU, 0xc162c367U, 0x2d7ebed3U, 0x41149b2cU,
+         0x339033a8U, 0x70e92e98U, 0xef490f24U, 0xb3ec7805U, 0x9902cf28U, 0x2b415c9bU, 0xdb7c3054U, 0xc90d5b92U},
+        {0x1e5238c2U, 0x98af3e92U, 0x380ecb8bU, 0x40355f5cU, 0x4e82ed48U, 0x41b1610bU, 0xb7d415aaU, 0x14f0ec0eU,
+         0x92f07922U, 0x6e86a347U, 0x0304939dU, 0xd25c00d8U, 0x3842747fU, 0x921fc73eU, 0xd4835d80U, 0xab12d53dU},
+        {0x8a972627U, 0x8a4366a0U, 0x02521e1fU, 0xe1921604U, 0xcbc441a0U, 0x8198c1efU, 0x49bfe15cU, 0x8a318709U,
+         0x46bb8af9U, 0xe7b47b56U, 0xc3efcbccU, 0x1744365aU, 0x8587baa4U, 0x09577ed2U, 0x68f7a64dU, 0x64bb7c87U},
+        {0xd543e94dU, 0x8f6352efU, 0x56f98e18U, 0xdd1302a7U, 0x8a5a0ddaU, 0xc41c3467U, 0x782c287eU, 0xeb42f3bbU,
+         0x45924d89U, 0x40559de4U, 0xe60d6d42U, 0x4cd8468dU, 0x2fcdfb77U, 0xc9a0dd57U, 0x4f25d92dU, 0x234a6d07U},
+        {0xe3f3d3fcU, 0xf8dddd28U, 0x05c29cebU, 0x664a9b82U, 0x2872a7baU, 0xfaec3dfeU, 0x4e7c849dU, 0xd1fad4faU,
+         0x50f3704dU, 0xed22343cU, 0xeff37326U, 0xbad37131U, 0x858b7818U, 0x5473f70eU, 0xa348fdfeU, 0x8fe19714U},
+    },
+    {
+        {0x4526087eU, 0x8f540482U, 0x82da2030U, 0xfdfb6d88U, 0x1798b85dU, 0xc1c9b604U, 0x97eece97U, 0xff2b0dceU,
+         0xf0c29907U, 0x2c951e01U, 0xb90e2cebU, 0xc7b7ed6fU, 0x54d07936U, 0x8af4c4dcU, 0xf524ba18U, 0x493d13feU},
+        {0x3149f8efU, 0x3bd3a9afU, 0xe638b458U, 0x3deb5c4eU, 0xecb1bb22U, 0x78e29ebbU, 0x5f366c9fU, 0x2982dbbcU,
+         0x16c7a248U, 0x56e726b0U, 0x12e3ed84U, 0x095db994U, 0xc7b5bc9dU, 0xb9fa5339U, 0xaf66220aU, 0xa61b5be9U},
+        {0x79d681f9U, 0xc59054feU, 0xac8feb9fU, 0x66ce0eefU, 0xe02c94b0U, 0x88b7ff25U, 0x775f2308U, 0xc745fdf2U,
+         0x7bbb1247U, 0x60317343U, 0xc67d45c7U, 0x8cdbd335U, 0x70e81867U, 0x8a71394cU, 0xf6b9e5e7U, 0x590222f2U},
+        {0x2380441bU, 0x85289f61U, 0x80e17658U, 0x60011f45U, 0x0497db58U, 0xb436eb59U, 0x2af0c0f6U, 0x1a28e504U,
+         0x8452af25U, 0xb05f606aU, 0x46ee67aeU, 0x04b3e75bU, 0x8976f0edU, 0x7c78329aU, 0x96c59dabU, 0x55779a79U},
+        {0x35cd0ea3U, 0x5e04ceedU, 0x20cac481U, 0xb34478e8U, 0xb672e7f2U, 0x27a59e5eU, 0xa975050bU, 0xabb279f3U,
+         0x7c307bceU, 0x47093133U, 0x9e02f3b6U, 0x7c976905U, 0x03078ed4U, 0x9fb4be0cU, 0xbf17970dU, 0x5dee103bU},
+        {0x649a2115U, 0xe77fd534U, 0x17a565ebU, 0xec796009U, 0xd640981aU, 0xdd46aca9U, 0xb194c6c6U, 0xfd73c052U,
+         0xa6ba6cdaU, 0x049cab7bU, 0x2e9d421fU, 0x04f60156U, 0x26f7d6d9U, 0x020abab0U, 0xc8178844U, 0x620768c1U},
+        {0x1bc9ee3eU, 0x5c2e2f3fU, 0x63e7382cU, 0xea9fa1a9U, 0x4267ed11U, 0x27faeaa7U, 0x59fc6828U, 0x3f81150bU,
+         0x599aae06U, 0x3ceadb0cU, 0xfcda8160U, 0x7623b2dcU, 0xc4795662U, 0x4671beb3U, 0xfdbfa82dU, 0x19c88a68U},
+        {0x621e30a7U, 0x2eef0e39U, 0x985d8324U, 0x2edd5eb7U, 0xbd3f2014U, 0x1d250cc0U, 0x535f3060U, 0x0c8b83e9U,
+         0x9ff688deU, 0xbebf7bebU, 0xb987134dU, 0xaacad237U, 0x7efdc854U, 0xb850e3f1U, 0x065fdac7U, 0x0dcc7077U},
+    },
+    {
+        {0xf856e241U, 0x780e5e2cU, 0x8cd6dd28U, 0x57f1ee14U, 0x301b212bU, 0x9ed2b2e6U, 0xb1e880eaU, 0x827fbbe4U,
+         0xaec293ecU, 0xd605b68bU, 0x86903166U, 0x7ff7a631U, 0x7d1d1268U, 0x71bef2c6U, 0x3c727b0bU, 0xc60f9c92U},
+        {0x0cb1815dU, 0xef6e44b7U, 0x18b87461U, 0x60470a92U, 0x576e6b36U, 0x3e2d7c8dU, 0xdce56b97U, 0xb77f12a7U,
+         0x8e57dbc5U, 0x6ba3d2bcU, 0x1a44816dU, 0x4c42f0f9U, 0x73cc2e65U, 0x3f0cefb3U, 0x4f86acc4U, 0x4b6f85b1U},
+        {0x3bb80fa7U, 0x634485cbU, 0xb7041388U, 0x3aa7da6bU, 0xd320819fU, 0xc0d1a06bU, 0x6308c2fbU, 0x0857e31fU,
+         0x09366b2dU, 0xbd98211fU, 0x3cd7016aU, 0x172e3704U, 0x1dcb7147U, 0x92d7cc9dU, 0x3ae01720U, 0xf6439342U},
+        {0xc45565ecU, 0x0fe5dad2U, 0x4977c597U, 0xd858d8dfU, 0xcb79f956U, 0x47b308b2U, 0x3018bf12U, 0x48973b94U,
+         0xfaed07e9U, 0x3b879075U, 0x580477b8U, 0x511b3596U, 0x01445af1U, 0x6437bb3aU, 0x4f3cdc1bU, 0x761f7568U},
+        {0x09c70e63U, 0xf5d02c3aU, 0xe753d496U, 0x9cbb8b78U, 0x764a672eU, 0x3545c655U, 0x56bd6004U, 0x28aacceaU,
+         0xf057da4eU, 0xb9f03882U, 0x444da1e8U, 0xf5fc59ceU, 0xc768ebb7U, 0x67a89667U, 0xf81a0e15U, 0x2b69322eU},
+        {0x7b6d6cd3U, 0x33a00abeU, 0x03893788U, 0x3416611dU, 0x05652397U, 0x81a69b87U, 0x7f2b8184U, 0xea126616U,
+         0xf4f450beU, 0xaae62925U, 0xebbe1a88U, 0xb1c9752dU, 0xf1145e25U, 0xaace112bU, 0x078ee3fdU, 0x21a4e2e5U},
+        {0x73e674b5U, 0x601dc52fU, 0xe7060aacU, 0x92d8f69cU, 0xbceb8a4fU, 0x45ddb2c9U, 0xa055a661U, 0xa2f3b625U,
+         0x0e937941U, 0xb0938c8eU, 0x7c33fa53U, 0x9222fa31U, 0xf32a7c4bU, 0x80044a90U, 0x614c68aeU, 0x620ea159U},
+        {0xbbfd71faU, 0xa4d4d742U, 0x5b4527d4U, 0x0b775a26U, 0x8a704c17U, 0x6d697272U, 0x8eb5559cU, 0xe931258eU,
+         0x174d3307U, 0x3d9bd0d3U, 0xbb5e35f3U, 0xb3946ce1U, 0x9c954b40U, 0xe85eb416U, 0x4c3fdee0U, 0xfb1e3336U},
+    },
+    {
+        {0x2120e2b3U, 0x7f3b58faU, 0x7f47f9aaU, 0x7a58fdceU, 0x4ce6e521U, 0xe7be4ae3U, 0x1f51bdbaU, 0xeaa649f2U,
+         0xba5ad93dU, 0xd47a5305U, 0xf13f7e59U, 0x01a6b965U, 0x9879aa5aU, 0xc69a80f8U, 0x5bbbb03aU, 0xbe3279edU},
+        {0x1fc9b0a8U, 0x53dbc1ccU, 0x705f3db4U, 0x9e337b5cU, 0x002279eaU, 0xc2623ea5U, 0xbeb997eeU, 0x3adb9db3U,
+         0xf05bbddaU, 0x61ae7975U, 0x870266ccU, 0xaad9c8f9U, 0x7c095ff6U, 0x3c774de0U, 0xaee74e71U, 0x374e2d6dU},
+        {0x3f2e070dU, 0xf583fd3aU, 0xc52a6a98U, 0x29aab71cU, 0xb85047e2U, 0xf48731c3U, 0x042f4abfU, 0x4b72a5e9U,
+         0xe96dd780U, 0xe44ba82eU, 0xd2948c3dU, 0xb0b465ddU, 0x6d0f3c10U, 0x60277bb3U, 0x1d6ae1cfU, 0x599e1d4eU},
+        {0x90ae86f9U, 0x054e9e0cU, 0x963e7cafU, 0xfefdff56U, 0x56c5fc69U, 0x7e10955eU, 0x428e9cbbU, 0x129e53acU,
+         0x1e89c85dU, 0x822efdcdU, 0x16b3e01bU, 0xb2a232fdU, 0xb712183fU, 0xb2da2115U, 0x8aee9a29U, 0x415ecb95U},
+        {0x4a02591cU, 0xe9ce7fd8U, 0x585125a1U, 0x3ef54996U, 0xb5e1fd61U, 0x85a6bfbeU, 0x6539c8e2U, 0xa9fc93fcU,
+         0x69bec2dcU, 0x790addefU, 0x5fcf7253U, 0xca888c41U, 0x1a9165e5U, 0x3e84c17aU, 0xdc538717U, 0x9c2ce739U},
+        {0xf85912ecU, 0x428700a0U, 0xe4609113U, 0x27f9ca04U, 0x4aaf0543U, 0x6ab49969U, 0xe3fb5b78U, 0xaa7121d4U,
+         0x4ae35978U, 0xb114cb26U, 0xce056cbdU, 0xfee134a8U, 0x96a2edebU, 0xc505266bU, 0xdad09509U, 0xc690f077U},
+        {0x2d968b59U, 0x11006e0eU, 0x13cbbc2eU, 0x09a28baeU, 0x209b0277U, 0x6a7d7ac1U, 0x1a6f9f0aU, 0xc940017cU,
+         0x8de572fbU, 0xfefd7640U, 0x4390c9c8U, 0xe2842cb6U, 0xa5b5742cU, 0x13b8a1bfU, 0x0c9b8620U, 0x39d92250U},
+        {0xe855b8daU, 0x922243d5U, 0x12894711U, 0xc756267dU, 0xaee10956U, 0x5b85ecb6U, 0xc8f69448U, 0x60144494U,
+         0xf34e4bbdU, 0xad500590U, 0x7e3f2a4bU, 0x543955c2U, 0x9132e65bU, 0x9e8be1fdU, 0xf681e646U, 0x8bb5d669U},
+    },
+    {
+        {0xda34d24fU, 0x1e23632dU, 0xc9a13740U, 0x41b6d8f0U, 0xecf42ee5U, 0x9391df6dU, 0xc5cf169dU, 0xe4a42d43U,
+         0xdeba9414U, 0x3a7f7131U, 0xa8d8e4f1U, 0xe886eedfU, 0xfb8ad34cU, 0x26fc99ccU, 0x16d1c735U, 0x4d9f92e7U},
+        {0x3e8f62bbU, 0x303f2ea3U, 0xf7ae4d2aU, 0x0553c562U, 0x56c4ef4dU, 0x3ef0acf8U, 0x84cfb18dU, 0xfd6451fbU,
+         0x132c0911U, 0xd0ad9086U, 0xd200e83fU, 0xfa2ab492U, 0x1bc344ccU, 0xb6fe7a5cU, 0xb1871578U, 0xe745ceb2U},
+        {0x3bea0c68U, 0x5c8410afU, 0x677b392bU, 0x09430123U, 0x8d396fafU, 0x4949bc8eU, 0xe156a3a2U, 0x3e419634U,
+         0x1a45edb6U, 0xbcbb6ff7U, 0x303cda1aU, 0x2fa11946U, 0x37069306U, 0xf373cbfeU, 0x924b21f7U, 0x0123c59dU},
+        {0xd5fe696bU, 0xfa1d1fb9U, 0xdcf3c7a1U, 0x0042e2d5U, 0x6f9edbbbU, 0x716e81a0U, 0xb24086bcU, 0x1eee207cU,
+         0x7429337bU, 0xbb45670eU, 0x0afd694eU, 0x7a02062eU, 0x2461c95fU, 0xd2b196d1U, 0xaef6269cU, 0x652cbd19U},
+        {0x939824d7U, 0xaf75d23cU, 0x351c9897U, 0x6eb7b64cU, 0x2f7f0b57U, 0xeed4a3e6U, 0x455d7508U, 0x8d9438f5U,
+         0x9366489fU, 0x8a004f48U, 0x326b063dU, 0x8fb9e2b8U, 0x1ab6ef6fU, 0x2ca60bd3U, 0x4fee6c2aU, 0x3261e073U},
+        {0x17d4b84aU, 0x9a9814c4U, 0xf1f433e6U, 0x621ddf48U, 0xd2850704U, 0x0c62a492U, 0x8dc72fcbU, 0xf13a99e5U,
+         0x53fd1c81U, 0x85990fc5U, 0x10f2d962U, 0xb6e37d47U, 0x1e3fe06eU, 0xaa6b91cdU, 0x0f0be995U, 0x33c2c8cdU},
+        {0x98d713deU, 0x8e48071aU, 0x7428e620U, 0x9360c2fbU, 0x2fe54543U, 0x0d4a912aU, 0x58ee5442U, 0xb72524c5U,
+         0x9b8350e9U, 0x76ffe525U, 0xe44a5fcbU, 0x0482d26fU, 0xe9d69415U, 0x1042d182U, 0x8a283e45U, 0x4c51b39aU},
+        {0xef94c0d5U, 0x08d40f19U, 0x7c572579U, 0xe1c0fc01U, 0x346e2111U, 0xd465ab2cU, 0xa8a9eb14U, 0xcc0ea33eU,
+         0xaf452fe6U, 0xdeabe597U, 0x6113f543U, 0xf6074f26U, 0xb5fbe663U, 0xb23dd203U, 0x711c8a2fU, 0xf9907a3bU},
+    },
+    {
+        {0x4300bf19U, 0x47173b9dU, 0xa88fea49U, 0x92b53576U, 0xab352b6bU, 0x54160fadU, 0x360cbdd9U, 0x1ec80fefU,
+         0xc107cefdU, 0x671cdc1cU, 0x6295a07bU, 0x0146e77fU, 0xa7abbf5eU, 0x2f3a4958U, 0x56b5340dU, 0xaeefe937U},
+        {0x414ff9e4U, 0x0dae805dU, 0xebd89056U, 0x8e8462f6U, 0x44fc90bbU, 0xcbeeaa03U, 0x19f04bc6U, 0x5be7ea35U,
+         0x47e0bdbbU, 0x4030b078U, 0x2119a309U, 0x0e99c630U, 0x655ab7feU, 0x477f890fU, 0xf638e605U, 0x32f32ec3U},
+        {0x52fea1f9U, 0x4b17cbbcU, 0x8c0452b9U, 0xc4ff0b50U, 0x67106531U, 0x3bcfddabU, 0x55d1f2e8U, 0xa6dc880aU,
+         0x7bc345e9U, 0x3b1c14e4U, 0x7e68f7e6U, 0x057b89dbU, 0x16acbc50U, 0x038683a1U, 0x7dc367c3U, 0x7ef1a854U},
+        {0x4ddb7bb8U, 0xe3fb545fU, 0x9f853991U, 0xd5002864U, 0x98df7f5cU, 0x0813fc86U, 0x6eae4e65U, 0x58f09911U,
+         0x2e5b2d6eU, 0xbdec7358U, 0x2d174302U, 0x507ee406U, 0x14638066U, 0x0d62ff76U, 0xaffe111aU, 0x7e07002aU},
+        {0x06d6c9b3U, 0xc8d40c3fU, 0x74865637U, 0x8c6c4ce8U, 0x78a481baU, 0x2bdc229cU, 0xea424599U, 0xfe6ba93fU,
+         0xa948bdfbU, 0x0c2c788fU, 0x05c2e9b0U, 0xd980f1bfU, 0x45413b56U, 0xb6bb41b3U, 0x40539872U, 0x7ee918d7U},
+        {0x1c7985c4U, 0x8b613e77U, 0x5b9e2b10U, 0x134bfc49U, 0x02f74c34U, 0xe5428428U, 0xf7b59b7cU, 0x2320b5caU,
+         0x4c2c6d44U, 0x4ff4f1dfU, 0x1cd9eb8dU, 0xd96f1021U, 0x1f9bca93U, 0x18c721b8U, 0xc88be943U, 0xc79f943dU},
+        {0x0cf95151U, 0x422f1073U, 0x442c4b64U, 0xb964806eU, 0xdc08ded1U, 0xb020c8c2U, 0x46fc98bfU, 0x15d5e2f1U,
+         0x2ff8ecf2U, 0x482a07ccU, 0x7dd8c0f9U, 0xbb204fb9U, 0x789023f9U, 0x7f90e109U, 0x915fd4ecU, 0xa5b72e31U},
+        {0xcc9a8e2cU, 0x413c1606U, 0x4cc1a1c1U, 0x823d8d1aU, 0xd860cb0fU, 0x33bcc04fU, 0xb29790b6U, 0xb0f9e4b9U,
+         0xdf3d0db4U, 0x6c2066c4U, 0xc171cee7U, 0x3350cc02U, 0x06fde3f0U, 0x41cbb0b9U, 0x843ade6dU, 0x49e82bf1U},
+    },
+    {
+        {0x366642beU, 0x9ddb5928U, 0x7d58ba88U, 0xce349071U, 0x680dfa8bU, 0x91b00af4U, 0x04670c2fU, 0x146a778cU,
+         0x3d83efd0U, 0xd0b29748U, 0x2f7e5ed1U, 0x0aaa971dU, 0xf9d4b287U, 0xdd669827U, 0x3354028aU, 0xb318e0ecU},
+        {0x79de5cacU, 0x11b23655U, 0x7ecb2619U, 0xeefc983cU, 0x0bcd14cfU, 0xe5670b5cU, 0x8a597e24U, 0x574ef0ceU,
+         0xc75a4805U, 0xae59aea6U, 0xef10008cU, 0x1a260a7bU, 0x569b7845U, 0x3bd6ada0U, 0x281f19c7U, 0x09b99930U},
+        {0x27315443U, 0x9d938738U, 0x4ae86729U, 0x3d79bbd5U, 0x20a142a1U, 0xf42c8998U, 0x0660935fU, 0xfc696c04U,
+         0x57d28960U, 0x7490d60bU, 0x109bd1b1U, 0x487ff486U, 0xd69677b5U, 0xbbf0e1cdU, 0xf83b5892U, 0xe0ce27ebU},
+        {0x260966d3U, 0x808c2d74U, 0xaeff8645U, 0x10a770c1U, 0xb98c835dU, 0x5d909397U, 0x9d8bf9f8U, 0xd3d97e79U,
+         0x833c2e52U, 0xbddeb850U, 0xbe8dc4eeU, 0xb5e48711U, 0x5d403ad3U, 0x6aaa8927U, 0x76bac95eU, 0x8ddbb463U},
+        {0x16fdb4ebU, 0xd1bb2f5cU, 0xc62e6a79U, 0x8fa3dd79U, 0x62beb092U, 0x1ae56a35U, 0xff4ff2adU, 0x974af221U,
+         0xa9f6f484U, 0x8409c3dfU, 0x3bffc234U, 0x111c572aU, 0x02c090edU, 0x64d1e43dU, 0x535003caU, 0x5552387dU},
+        {0x7c6b5b56U, 0x7f3615fdU, 0xed888b60U, 0x4185c8aaU, 0x3bf200e5U, 0xcdf587edU, 0x00ef4338U, 0xa0e88657U,
+         0x3a1d7518U, 0xa16bde51U, 0x70858a51U, 0x526b871dU, 0xb853deadU, 0xb99a6b89U, 0x9fa9ad50U, 0xf5ba4683U},
+        {0x5d5aeee3U, 0x73904adbU, 0x6658c813U, 0xe8284bc3U, 0x669270c5U, 0x09121b3aU, 0x49de398bU, 0x5baab59bU,
+         0x70f69717U, 0x82d29afbU, 0xabd31eedU, 0x215ddc9dU, 0x61ffdaf7U, 0x6e5a0086U, 0x7c0f7e85U, 0x8a577f61U},
+        {0x968c6d4bU, 0x0040fb93U, 0x8f494c12U, 0xb2be78cfU, 0x2cbbee0aU, 0x7b974e78U, 0x88b31898U, 0xb1aa6532U,
+         0xe891ac51U, 0x83d9e62aU, 0x9d623cc3U, 0x100a1d90U, 0x2d63a83bU, 0x2684aa8eU, 0x60810d71U, 0x7ed6071cU},
+    },
+    {
+        {0x3180eef9U, 0x6d76a879U, 0x9a28b977U, 0x8d001220U, 0x1aa07b12U, 0x7e3acebbU, 0x1d22e5f0U, 0xfa50c0f6U,
+         0x3f4f2811U, 0x38cd8d7dU, 0xa57a213bU, 0x5e683293U, 0x2281a68aU, 0xb72cd287U, 0x2397eba9U, 0x6b84c692U},
+        {0x187f5048U, 0x59c5be23U, 0x448386d4U, 0xe72328d2U, 0x02e90836U, 0x780140feU, 0x619074e0U, 0x63964eeeU,
+         0x89309df8U, 0x383a284dU, 0x4dde6c84U, 0x3d580b93U, 0xc34bfbc9U, 0xa39ff9b1U, 0x6b89cf41U, 0x3b6cfb3aU},
+        {0x91da5e12U, 0x71ee0e33U, 0x15cacb29U, 0xa9c60a40U, 0x3a1ca2b6U, 0xcda329f9U, 0x4379e31bU, 0xf7502e3cU,
+         0x8385f4ebU, 0x7a4b9c5eU, 0xf725cebcU, 0x7b86d32eU, 0xc3d67204U, 0x59970945U, 0xd67cfafdU, 0x3c57f5edU},
+        {0xbadb2a65U, 0xf814ba1eU, 0xd3cbda31U, 0xafd7f12aU, 0xf0fc9f75U, 0x2d1469ddU, 0x4d15b7e2U, 0x5a3ce25bU,
+         0x1d327f1dU, 0xd8b170cfU, 0xd825fe8eU, 0x3ee28bc3U, 0xbf3f99afU, 0x873a6dbfU, 0x92e05f63U, 0x8b34125bU},
+        {0x10b7d105U, 0x20749331U, 0x94e57c9fU, 0xf4ca5c4bU, 0x4e3455b3U, 0xa3a4f662U, 0x83ae5862U, 0x12fe78f9U,
+         0x9f794a60U, 0x458ac6fbU, 0xd6ee90b8U, 0x1dece265U, 0x99a7cb77U, 0x786b5aa1U, 0x38d6bcf7U, 0x2062f1a3U},
+        {0x3e32478eU, 0x23731207U, 0x2a9ba7edU, 0x24ab318fU, 0x3f332b20U, 0x0fec6b7fU, 0x01061388U, 0xd42011d6U,
+         0xd04e88d4U, 0x1ce05681U, 0x35508cc3U, 0x6fb24b2fU, 0x44bf847bU, 0x1b2d5f5fU, 0xa37d4e0cU, 0xbae5d4e9U},
+        {0x9e0c5d05U, 0xf621d833U, 0xaa572dafU, 0x480e6c50U, 0x28084b1aU, 0x58c4bb10U, 0x47df473dU, 0x76aac313U,
+         0x51ece63eU, 0x556619b7U, 0x015e6ee3U, 0x4b1225cfU, 0x3202625fU, 0xabef32c8U, 0x0d5c70efU, 0xef5576efU},
+        {0x4a9f44d0U, 0x16a73375U, 0x69a8fa00U, 0x85dbcb6eU, 0xf0de41ffU, 0x6910be34U, 0x98f93edaU, 0x5ce605afU,
+         0x89d30105U, 0xc0d05f34U, 0xa32eccc6U, 0xab3cb1bfU, 0x31c76c58U, 0x7ba56bd0U, 0xec226bfeU, 0x4cddcf9bU},
+    },
+    {
+        {0x5f067ec2U, 0x0e53d32bU, 0xd5bba522U, 0x1a288ab5U, 0x7d88e842U, 0xb1a5bf6bU, 0xca721a11U, 0xda1d61d0U,
+         0x1ad836f1U, 0x655fba0fU, 0xd279b48aU, 0x66a73899U, 0x61c91e29U, 0x79c07661U, 0x7c99306cU, 0x8157f55aU},
+        {0x2cd3c369U, 0xb3c210d2U, 0xe1f8e934U, 0x23605483U, 0x1dc1283aU, 0xdf85d5f6U, 0x4ef4c444U, 0x9c7be00bU,
+         0xa2329515U, 0x29ee3febU, 0x16769cbdU, 0x3e31153aU, 0x5ce40148U, 0x52a26d45U, 0x74b20d20U, 0x9220c0deU},
+        {0xfa95a8dbU, 0x15d87732U, 0x479d36f6U, 0xb83ec0c4U, 0x991b1723U, 0x19e96646U, 0x6303dd04U, 0xe3e90da4U,
+         0x1b0d1cf9U, 0x1016cf7fU, 0xcc984d3dU, 0xfbb1ef97U, 0xc702e76aU, 0xb00faa90U, 0x056c178bU, 0xfbe53bc0U},
+        {0x7bb8c9e3U, 0x76bcd92dU, 0x0541178eU, 0x74dd06a7U, 0x38ccc491U, 0xb55664b2U, 0x2825263bU, 0x0fcd83f4U,
+         0xdf4aa9adU, 0xe86d55fbU, 0xf1627bf4U, 0xadbeaecdU, 0xe5fdb683U, 0xd1d8232dU, 0xeac5fbceU, 0x6c0bc1cfU},
+        {0x112ee214U, 0x17aafd64U, 0x95931540U, 0x782a4e97U, 0xd5c0c01cU, 0xa8b650dfU, 0x32e3d775U, 0x9f4ffec7U,
+         0x5085f37aU, 0x3ef44222U, 0x0bc88028U, 0x9719b693U, 0xfd75c69dU, 0x60e96682U, 0x318e2f2eU, 0x639ce2e1U},
+        {0x541d0ce6U, 0xf4fc3dcbU, 0xcf598d41U, 0x748992a2U, 0x33a05fb2U, 0x2ee14cceU, 0x37f1a941U, 0x14295a29U,
+         0xd738bb86U, 0x52a81a8aU, 0x1b5d241aU, 0x31089560U, 0x844083b1U, 0x1b031c44U, 0xdf115071U, 0xfea75363U},
+        {0x1f61a0a5U, 0xf8b68145U, 0xb3c14e3eU, 0x4b1253e1U, 0x1f440b2cU, 0xb171a0a4U, 0x41134ac1U, 0x431f622dU,
+         0x78cef899U, 0x46b7b7feU, 0x35565772U, 0x41baaa04U, 0x9723aa72U, 0x6d6de651U, 0xe7aa438fU, 0xa298327fU},
+        {0xb26b64f1U, 0x5cf39944U, 0xf5476d99U, 0xb7edcf28U, 0x2511e59dU, 0xd4cda4c6U, 0x1b58f010U, 0x7175407fU,
+         0xb24234d5U, 0x426e7efaU, 0x74471d2aU, 0xb01fe8b7U, 0x134cc86eU, 0xf36d3401U, 0x44e3d550U, 0x43b45543U},
+    },
+    {
+        {0x0d064e13U, 0x2a73b061U, 0x446f1e06U, 0x15311de0U, 0xe8fd4166U, 0x7215ff98U, 0x0c970690U, 0xa8e282ffU,
+         0x11f4cc0cU, 0xcef7c731U, 0x50dd6bd6U, 0x8b679a3eU, 0x5b251588U, 0xabfb7f3cU, 0x8db81c09U, 0x7f97355bU},
+        {0x7f7653a1U, 0xc15eb9eaU, 0x753d67c1U, 0xefbe9eaaU, 0x5ea66e63U, 0xcb876f80U, 0xe27faecbU, 0xcac6f2e7U,
+         0xfec5e556U, 0x68c10ad0U, 0x688103a0U, 0x81e83ae5U, 0xa42a3450U, 0x4cdb65d9U, 0xe2aa6f19U, 0xf7d416e5U},
+        {0xba3979b5U, 0x22a199b0U, 0xe67e829eU, 0xba288f8dU, 0x1ee40e50U, 0x27f37f0bU, 0xcdade263U, 0xae2207c5U,
+         0x8450fa6fU, 0x68f3cd66U, 0x37d4f889U, 0xfca87b7dU, 0x23ad7060U, 0xad4c9245U, 0x0c079f71U, 0xea91fe51U},
+        {0x8624003dU, 0xcc9f4ab0U, 0x4238cb11U, 0x4ab76729U, 0xe58e4325U, 0xefbc5932U, 0xee37d206U, 0xe6dfde46U,
+         0x2216b93bU, 0x7548650eU, 0x527fd7ddU, 0x3b1ce5eaU, 0xb88f9220U, 0x8f2f48f7U, 0xbe913949U, 0x8727b3b7U},
+        {0x0efca824U, 0xe4101910U, 0xea2164faU, 0xe0be0c4fU, 0x06585461U, 0x9cec5410U, 0xad72ace5U, 0xcb8ded0cU,
+         0x8f227361U, 0xf140bd05U, 0xc7931742U, 0x96ad1fdfU, 0x7a2ccbc4U, 0x5b316c48U, 0x740d88c8U, 0x33a5008fU},
+        {0xece4dd6aU, 0x559e11e1U, 0xa3221cefU, 0x0a00e49cU, 0xe8d64c46U, 0xbc9eca37U, 0xb2792b64U, 0x49dbe4f7U,
+         0x2a9e3eaeU, 0xb13b72a4U, 0xca05bb69U, 0x1c38552fU, 0xb692255aU, 0x2c5fe33dU, 0x470481c7U, 0xb8b57298U},
+        {0x3bcbd327U, 0x9411b4daU, 0x21e4aaeeU, 0xb04e0852U, 0xd7e76ed6U, 0x08e94900U, 0x8af18367U, 0xb0c53b29U,
+         0x2d7be436U, 0x1616bc4aU, 0x74636a0fU, 0xd82a220cU, 0x1b66b2afU, 0x638f6a60U, 0x1fbd7ea1U, 0xee2a9740U},
+        {0x48dce109U, 0xb0e11035U, 0x9cf211d3U, 0xe250e314U, 0x7ac96082U, 0x66a40cfcU, 0xd9a6823dU, 0x3c4e089cU,
+         0x3a19aeeaU, 0xe2bf6592U, 0xd97fe697U, 0x9579e142U, 0x15764d37U, 0x80757bcaU, 0x9fe191b4U, 0x43fbbe66U},
+    },
+    {
+        {0x8319497cU, 0x22f382deU, 0x512508c0U, 0x5d59b1faU, 0x6913cab1U, 0x2d39e56eU, 0xc9a28587U, 0x174a53b9U,
+         0x079afa73U, 0x83da13acU, 0x8cb98543U, 0x646b3a1dU, 0x2c47f9e6U, 0x57b4155fU, 0xabfc9c16U, 0xccc9dc37U},
+        {0x840dd273U, 0x5f5da36fU, 0x0e450111U, 0xd53d280eU, 0xf1b92ea3U, 0x30c7071eU, 0x96946bb6U, 0x20e6e2e7U,
+         0xbb46b593U, 0xc07cfd15U, 0x3da8693cU, 0x811ec979U, 0x97874655U, 0x4a0ba1adU, 0x4f1559e4U, 0xd3ad7afeU},
+        {0x754b8367U, 0xe948073dU, 0x67d506bfU, 0xb775b77dU, 0x58436a5dU, 0x40caa5d4U, 0xe446526eU, 0x5e5a094aU,
+         0x91ce85caU, 0x45329a9dU, 0x3de5ffa4U, 0x796aa9efU, 0x572a4b7aU, 0xc2c901f1U, 0xa4795e05U, 0xae8af8c9U},
+        {0x1a077674U, 0xe7b54f30U, 0x6cc24ca3U, 0x35ae6813U, 0x7e71db70U, 0xa80280a0U, 0xd7a351dbU, 0x8e0ca824U,
+         0x12b7ed98U, 0x0b84cbecU, 0xd2f91029U, 0xcff60419U, 0xda62cf57U, 0xdc569d24U, 0x59192d41U, 0x04ec5607U},
+        {0x97b10d9dU, 0xf1985793U, 0x9d1f8fcaU, 0xe6a52f18U, 0x310cb82dU, 0x9deccb83U, 0xb9702e85U, 0x00d4e0adU,
+         0x7140dcedU, 0xe8210048U, 0x78e2d923U, 0x0b5898c9U, 0x432287f7U, 0x47d2f846U, 0x18376409U, 0x87b80198U},
+        {0x0cbcad59U, 0x7b05e836U, 0xa4e0aaa0U, 0x7c845a05U, 0xa5f902f1U, 0x7aa17c85U, 0x52ac3600U, 0x2ed76c11U,
+         0xc4ea66feU, 0x14ac7a89U, 0x30a7f941U, 0x5f72c601U, 0xc81767edU, 0x2cda6eaeU, 0x43b85f22U, 0x639f4d40U},
+        {0x9c9caee8U, 0x20811a60U, 0xb1a270bbU, 0x632e2045U, 0xeec4a667U, 0xf6f7a19aU, 0x68ef74c0U, 0x03665213U,
+         0xb772b711U, 0x0a9ec6a3U, 0x3295ba7fU, 0x01cba989U, 0x1ba69445U, 0x9949fc68U, 0x2a93ded9U, 0x1f18c32bU},
+        {0xa8192441U, 0xe96afc5eU, 0xa321b4afU, 0xafdb5821U, 0x3e3d66c1U, 0xc5fa6355U, 0x51c982d1U, 0xf7bb50daU,
+         0xd45165aeU, 0xbc640ea1U, 0xbbc4c74bU, 0xb1cfdc1fU, 0xdde6485dU, 0x311bc63bU, 0x0334a526U, 0x93cc3be3U},
+    },
+    {
+        {0x9475b7baU, 0x884fdff0U, 0xe4918b3dU, 0xe039e730U, 0xf5018cdbU, 0x3d3e57edU, 0x1943785cU, 0x95939698U,
+         0x7524f2fdU, 0xe9b8abf8U, 0xc8709385U, 0x9c653f64U, 0x4b9cd684U, 0x8ba0386aU, 0x88c331ddU, 0x2e7e5528U},
+        {0x0bc8f53bU, 0x07275a94U, 0x391747c7U, 0xd702226bU, 0xdd73d95eU, 0xafe32ca7U, 0xff0da7deU, 0xcbee1405U,
+         0x78c87f45U, 0x2922e6b2U, 0x8126f728U, 0x0d9ff4f6U, 0x9b8294cfU, 0xb51f3e68U, 0x4e75f902U, 0xf6211f4fU},
+        {0x0fd69985U, 0xa09c5dd9U, 0x6ddf72aeU, 0x9f309ccbU, 0xfbcccf14U, 0x788f690dU, 0xceb72f7eU, 0x0ae97675U,
+         0x1409a003U, 0x89c8eb41U, 0x7aee1affU, 0xd0b99d41U, 0x051a54c5U, 0xe9b8dfeeU, 0xf6e48d14U, 0x91219973U},
+        {0x14b311ddU, 0xf377c88bU, 0xfbd71b9cU, 0x3de3beaeU, 0x0ba252e0U, 0xdd580bfaU, 0x8faaf5acU, 0xadd5bad2U,
+         0x49d6c38dU, 0x02f982f3U, 0x669b9b89U, 0x52d4e1e7U, 0x8359814fU, 0x974e434fU, 0xda3dc3a5U, 0xe9c43cf4U},
+        {0xd9262b90U, 0x9dc193dfU, 0xfe3cc29aU, 0xb723c4c1U, 0x78025d1fU, 0xc9b65f17U, 0x5ac1612eU, 0x2b15862aU,
+         0x483d7557U, 0x991996e6U, 0xf99489a4U, 0x6f534970U, 0xda874906U, 0xa7a30d52U, 0xaa0a33faU, 0x2eb0053dU},
+        {0x6078afb0U, 0x4e75ae79U, 0xc4126197U, 0x14ff12c6U, 0xc66d1707U, 0x248d4468U, 0x766163b5U, 0x209d6bcdU,
+         0xa740b310U, 0x85d1b775U, 0x39f4e3e3U, 0x01edb793U, 0xa9898a5bU, 0xa0965babU, 0x9e7b3280U, 0x1a2f1342U},
+        {0xa8e7be40U, 0x93f9714cU, 0x91040ee5U, 0xf2d2c894U, 0x16e4769aU, 0x7ee95c16U, 0x1a96ee67U, 0x6af9eaedU,
+         0x6e387e1cU, 0xfa416e02U, 0xa0f59569U, 0x45e3f666U, 0x8347dc81U, 0x6709ea42U, 0x69006649U, 0xb3812a11U},
+        {0x0d7c0979U, 0xf5f6400aU, 0xbc5a8c96U, 0x4a29b314U, 0xff41ced2U, 0x3fa9df3dU, 0xa8171714U, 0x53f2432bU,
+         0x537b36a2U, 0xf9f7e90cU, 0xc9e8b845U, 0x4bd5a4f5U, 0x911b07deU, 0xccd4e3e0U, 0xc1f079b7U, 0xbd52effbU},
+    },
+    {
+        {0x9d82b151U, 0xbb51340cU, 0x561fba2dU, 0xcca0a43dU, 0x3b109a8fU, 0xd645a115U, 0xae401e56U, 0xd2a63a50U,
+         0xdcf89405U, 0xd4142174U, 0xf484ca52U, 0xa70f750aU, 0xb2948220U, 0x565aee58U, 0x6443fcb7U, 0xe82d86fbU},
+        {0xca72da5fU, 0x7c6c4bacU, 0x36c41349U, 0x22b9cd6bU, 0x033725f9U, 0x23bc7202U, 0x6100525eU, 0xbaf183a7U,
+         0xa8f2a0cfU, 0x377ce628U, 0xca739361U, 0x8e2336c5U, 0xdd69b1d1U, 0x5688bd58U, 0x9ccb4d33U, 0xdeac9fbeU},
+        {0xee4b3ba0U, 0x7859f635U, 0xf18bf1f1U, 0x5c2abef5U, 0x31bf245fU, 0xbefe170fU, 0x221ffb73U, 0x41081105U,
+         0x17525595U, 0x486961dcU, 0x65a06455U, 0x13364985U, 0x1d6b8498U, 0xf2ca65aeU, 0x76ff5668U, 0xdc37f369U},
+        {0xc56c3943U, 0xfa5aca58U, 0x56b76a5fU, 0x5adbd02dU, 0x6e48f6fdU, 0x8f933290U, 0xe3844023U, 0xf7aef8a7U,
+         0xacf442f1U, 0x431f627fU, 0xa8dcd003U, 0xeec30184U, 0xc3ab3fcfU, 0x7c442bbdU, 0xd5ffda79U, 0x4e3b0b44U},
+        {0x93d98dedU, 0x4629c9b8U, 0x3b8a0218U, 0xdbdf2283U, 0x0531d65eU, 0xc8cf2299U, 0xa16cc0c8U, 0x63a2a210U,
+         0xe0d1cfc2U, 0x519197d4U, 0x09c7873aU, 0x1fabf6a0U, 0x54ed9446U, 0xd0650332U, 0xe7fec76fU, 0x882b42e2U},
+        {0x000e5485U, 0x2089e66aU, 0xf5da5df0U, 0x4513068bU, 0x27320f12U, 0x8e2c7086U, 0x93a2bdffU, 0x1cd276d7U,
+         0x885fbd7fU, 0xca5cf051U, 0xb209a4ecU, 0x99d0e270U, 0x552e977fU, 0x8d4b34d4U, 0x8b2eaf73U, 0x6615bdd1U},
+        {0xb8045445U, 0xea861a50U, 0x901e8d7eU, 0x80ff7371U, 0x5d57bef0U, 0x3df12e2eU, 0x449d67caU, 0x0c15815dU,
+         0x4054a206U, 0x214f87d5U, 0x3658cea3U, 0xba3054e4U, 0x6663cd28U, 0xd0a93c3bU, 0x3ae94115U, 0x2f30d60aU},
+        {0x11924459U, 0x1fac9457U, 0xa3c7a78cU, 0x7af2fa25U, 0x0dddbb1fU, 0xc5a2e29fU, 0x10019036U, 0xdfb547cbU,
+         0xcc65fd9eU, 0xfa205e0dU, 0xe5c031dcU, 0x22af0930U, 0x9dc864ccU, 0x8b8389ceU, 0xba0f4708U, 0x9accd2a9U},
+    },
+    {
+        {0x5617e073U, 0x3436f9b4U, 0x3839317bU, 0x6bacbdbdU, 0xd7cfdc86U, 0x90ee7896U, 0x35471eb8U, 0x64587e23U,
+         0x9faf6589U, 0x58299e5eU, 0x133aeab3U, 0x85b90a39U, 0x47c299a1U, 0xae96dd64U, 0xbf6902e2U, 0xd99fcdd5U},
+        {0x4384480dU, 0x44bcd88cU, 0x2a91f2efU, 0x94e0b6a2U, 0xc92f0c12U, 0x2cf28b54U, 0x42df940fU, 0xb866d6b1U,
+         0x0c4cafa8U, 0x0e659b47U, 0x4b1d86d6U, 0x24e52280U, 0xea9ad7acU, 0x89a278d7U, 0x426aeb70U, 0x1914b0b3U},
+        {0x0e103dd6U, 0xadf71472U, 0x7c004859U, 0xc34604c0U, 0xc592a17aU, 0x36a213cfU, 0x5a4203f8U, 0xbc477bd5U,
+         0xd6f7c343U, 0x639082d8U, 0xc63b44acU, 0x5d293572U, 0xc6dea639U, 0x6cbac552U, 0x29a8dd52U, 0xe31e1e24U},
+        {0x1db20d6cU, 0xd229cda8U, 0xed4fe455U, 0xe2d52ae4U, 0x6102ba87U, 0xc4d9d164U, 0x85de819eU, 0xec2bb890U,
+         0x629cf4a0U, 0xa0e99c4dU, 0xe87efa98U, 0x33a2364bU, 0x650940c6U, 0x332f66f0U, 0x61e013a1U, 0xccecc176U},
+        {0xd44eab31U, 0x7d0dc3b0U, 0x04e63490U, 0x0ac5af14U, 0x267bf8e8U, 0x0303b423U, 0x5a6bb838U, 0x589db4feU,
+         0x51361f6aU, 0x941aebe7U, 0x2148f8dbU, 0x1f610e55U, 0x24bd90f3U, 0xf6070620U, 0x108aa2a4U, 0x6255445cU},
+        {0x36695f94U, 0x92d80b18U, 0x91627fa5U, 0x62a169c6U, 0x3af9a9cfU, 0xd0ccb868U, 0xb4558f5fU, 0xb1d25d51U,
+         0x5ee32736U, 0xa5b7eb9aU, 0xab863edcU, 0x60f6f18dU, 0x19aba817U, 0xf7bea0acU, 0x030e90b1U, 0x706dda72U},
+        {0x9a0c2c41U, 0x7bf96172U, 0x560336c6U, 0x42831c1cU, 0xad6edb7cU, 0xea8a1860U, 0xd16e2fa2U, 0x1339b337U,
+         0xa9f1bc2bU, 0x185f054bU, 0x7de923a4U, 0x6b1227f8U, 0xd113a340U, 0xa7a3240fU, 0x62c7ae5bU, 0x9f9b2963U},
+        {0x23b09d0fU, 0x38a60ecbU, 0x0f50becfU, 0xe5005064U, 0x5e545905U, 0xd39d75efU, 0x89e296ceU, 0x71c4a7e3U,
+         0x720ddb62U, 0x637b1f01U, 0x4a62ffc7U, 0x786f2b08U, 0x92f810aaU, 0x0af3e0a2U, 0x737af3baU, 0x1313fadbU},
+    },
+    {
+        {0xdd45e458U, 0x358d6c86U, 0xa250e7fdU, 0x2f0aa6ceU, 0xe549de04U, 0xb3a546d3U, 0xe4e4d885U, 0x8481bde0U,
+         0x9779057eU, 0x6d64b1b5U, 0x2b262e55U, 0x900a79c4U, 0x9cecb2caU, 0x84a25bf3U, 0xba5404ddU, 0x38ee7b8cU},
+        {0x6ce9f114U, 0xe5443352U, 0x299561ddU, 0x392ed605U, 0xd1d492bfU, 0x9fd43c6cU, 0xbd383a8bU, 0x9629a450U,
+         0xa24aa391U, 0xca3972c4U, 0x5c56af8dU, 0xb925593eU, 0x20cef64dU, 0x576befd2U, 0x0c5fb6d7U, 0xbf439b28U},
+        {0x152da17dU, 0x160a0fa4U, 0x08d0646bU, 0x11dc13dbU, 0x5fe00bc8U, 0x0894e6b0U, 0x0f518c5fU, 0x3beaed1eU,
+         0xecc768d2U, 0xce704985U, 0x8dfec416U, 0x54cde77bU, 0xbe80e1b5U, 0xfef4a8beU, 0x5aff7acdU, 0xc3b0d7f5U},
+        {0x26ca6cc3U, 0x83d38d96U, 0xe187e183U, 0x1477d747U, 0x7cc893dfU, 0xeb1730daU, 0xef1e4688U, 0xb73b1c47U,
+         0xa54fdba3U, 0xfac35d76U, 0x09757f5aU, 0x7322a252U, 0xbcc80509U, 0x0a57d64bU, 0x294922a9U, 0x584315cbU},
+        {0xba4edcc5U, 0x234fa17dU, 0x420311b7U, 0xe74e3221U, 0x39275997U, 0x8752dfc0U, 0xcbdc9d61U, 0x6e73dba0U,
+         0xd59da0e4U, 0x7b31f7cdU, 0x70067903U, 0x278a77daU, 0x88828693U, 0xbea45508U, 0x49eecc48U, 0xee0ac1fcU},
+        {0xd063e1beU, 0xc1b9ad04U, 0xf7e39a75U, 0xa92429a2U, 0x3dbcf027U, 0x72261525U, 0x1d602b14U, 0x131641d1U,
+         0x21fec890U, 0xfdd1ff3eU, 0xf9745b77U, 0xbd0faec0U, 0xcdbd2bebU, 0x6a42e30fU, 0x796039f0U, 0x4c3bda61U},
+        {0x4a80b979U, 0x409c4c42U, 0x329abb31U, 0x0490f5faU, 0xaa47c310U, 0x7627d97eU, 0x37e5b592U, 0x7706dd89U,
+         0x4126cfdeU, 0x14cf4810U, 0xfd7efe32U, 0x17fa0a34U, 0x91ea9c71U, 0x7778dd79U, 0x7d5bb714U, 0x8a02a982U},
+        {0xd38f93e0U, 0x9c6e2192U, 0xb676899fU, 0xd05b2a3bU, 0x07a2fef7U, 0x11f98920U, 0xdb401803U, 0xedfe16b2U,
+         0xe29405adU, 0x3d01793dU, 0xc46e227eU, 0x5b3d5100U, 0x4b05d0d2U, 0x94d74faaU, 0xfca5db36U, 0xee6902f1U},
+    },
+    {
+        {0x6caf666bU, 0xbcd6303fU, 0xc4b1ce30U, 0x7ffcfed3U, 0xe817f463U, 0x62b6979aU, 0xa78102aaU, 0x13464a57U,
+         0x7f6ecc27U, 0x3f495a90U, 0x1d0942e1U, 0x48f300a8U, 0x53ccb0caU, 0xef7e4334U, 0x04614580U, 0x69be1590U},
+        {0x065084aeU, 0xc75849c6U, 0xceabe577U, 0x9182be7dU, 0x85fe12d1U, 0xec05c88cU, 0x32245362U, 0xeb3cf8f5U,
+         0xf96b9480U, 0x6f67c1ffU, 0xe7dbd2a6U, 0xf52b45c5U, 0xefdca4a1U, 0x43fe63dcU, 0x22d9d700U, 0xc833c782U},
+        {0x8eca5f51U, 0xf216b209U, 0x94fc9aebU, 0xddea171bU, 0xbf05b5cfU, 0x2c6ed6b2U, 0xdd9ee696U, 0xdde9d514U,
+         0xd0c638f7U, 0x9ad69a73U, 0xde89571fU, 0x50feebe8U, 0x0a7f8f09U, 0xd891f34bU, 0x3ce28111U, 0xb84e6913U},
+        {0xc2e9a5d0U, 0xf8e5bcbcU, 0x84a201d9U, 0xa576fcf9U, 0x184519b2U, 0x4f7a60f2U, 0x092d9997U, 0xbdf1a67dU,
+         0x8562ff7bU, 0xcdb4f701U, 0xe5626461U, 0xa6280b61U, 0x86bf7baaU, 0xa80be54aU, 0xab65a1aaU, 0x4095902bU},
+        {0x999c88e4U, 0x2f906b05U, 0x20ad46ecU, 0x9aed513eU, 0xb1204b17U, 0x6e9f406eU, 0x23699373U, 0xfd1a6210U,
+         0x595bc8dfU, 0x99c8c916U, 0x95cc00f2U, 0xdc6b71d4U, 0x54977782U, 0xfb13c069U, 0xb9c8c20bU, 0x1ac97b54U},
+        {0xa09b0ccaU, 0x1ccc6a55U, 0x24a4d6f0U, 0xa3457589U, 0x8a28da59U, 0xd5c454f6U, 0xdbb0f4c8U, 0x0d538cb1U,
+         0x0c929e05U, 0x731b147eU, 0xd89134c9U, 0x8534cd99U, 0x40eed7cfU, 0xcb0a8d5cU, 0x7a3ec110U, 0xc8196bacU},
+        {0x5f8018ceU, 0xbd515b5bU, 0x8d892d68U, 0xcf2da573U, 0xf2c86dc7U, 0xf13ffce4U, 0xd8c296b9U, 0x4ee48531U,
+         0x1e48381fU, 0x3c35a61bU, 0xb4e80601U, 0x71074971U, 0xd0c7c5e6U, 0xfc7b4408U, 0x810bf8b5U, 0xb68f9ed4U},
+        {0x3b27e771U, 0xbde5fc17U, 0x477da62aU, 0x8c3b4196U, 0xb64483b4U, 0xcd5be267U, 0xddc4ec29U, 0x68856a6eU,
+         0x07bbdab6U, 0x6118d62aU, 0x93b0733aU, 0x331d22f2U, 0xc19f7b4aU, 0x13b6fd49U, 0x4f79a1fbU, 0x77a33df1U},
+    },
+    {
+        {0x2d83f366U, 0xcada3a0dU, 0xe2f28588U, 0x0cd9ccedU, 0xcc1dc97aU, 0x9aef430bU, 0xb713fe2eU, 0xbc4a9df5U,
+         0x581f33c1U, 0xd758d666U, 0xfa547b16U, 0xa6e8a9fbU, 0xf4b798caU, 0x383937adU, 0x6e785c06U, 0x0d3a81caU},
+        {0xf3fceb19U, 0x282de545U, 0xf785c409U, 0x2e89b221U, 0x6ce7bab4U, 0xabc5c762U, 0x11ceccc0U, 0xda433d5eU,
+         0xa6f5cc64U, 0x684e7120U, 0x9227b277U, 0x8e77fc2dU, 0xaf95e521U, 0x1debbdc4U, 0x21a81030U, 0xe498dbd3U},
+        {0xf712be3cU, 0xb06a2e32U, 0xda146a66U, 0x7295f18eU, 0xab001534U, 0xd3c725dbU, 0x9331b378U, 0x39d7349dU,
+         0x1c6ff65cU, 0xcc3019f4U, 0xeca41644U, 0xef5ef7a5U, 0xc66812e8U, 0xfb127554U, 0x56ef3bf7U, 0x8f929b4fU},
+        {0x5acf692aU, 0x54de275cU, 0x72207e06U, 0xbcc4838aU, 0x81c16efdU, 0x1c1c1169U, 0xe9e8c7ecU, 0x031e8e1eU,
+         0xb16f667aU, 0x9cc2a84eU, 0xc5bf73b0U, 0x70649827U, 0x90d6743bU, 0xd9d09702U, 0x465b353dU, 0xad7e7f5bU},
+        {0xdf77f22bU, 0x5aae4fbcU, 0x94f82e03U, 0xc6997239U, 0x2995af26U, 0x9e51cd6cU, 0xf7dc1dd0U, 0xf0cba617U,
+         0x5909a03cU, 0x1fc8e2c7U, 0x90a09566U, 0x04f18c7eU, 0x6516d040U, 0x9ef326c3U, 0x13f9df98U, 0x1a25ab43U},
+        {0x77829372U, 0xdec0aa4aU, 0x88ba4553U, 0xc49b300cU, 0x5385796bU, 0x313626aeU, 0x0f3e0d3bU, 0xb4319cc9U,
+         0x0add5427U, 0x7729ccc0U, 0xca3e11bbU, 0x707b1215U, 0x9c21c5a2U, 0xffb7afe0U, 0x9a6f502bU, 0x4707d449U},
+        {0xc6509c12U, 0x58acdcd4U, 0x5bd1f476U, 0x8d6bfe23U, 0xd87268edU, 0x21d170e8U, 0xdb2154d3U, 0x381d7ab9U,
+         0x2eb46102U, 0x54642a8eU, 0x6ce6eaf7U, 0x20582858U, 0x3a6581e7U, 0xeb5d2457U, 0x7fda3da9U, 0xa47aab5bU},
+        {0x81f488b6U, 0x92bbd7ffU, 0x3fc7a915U, 0xe9c9bf36U, 0x62657f73U, 0x5d3e00d8U, 0xa88d6115U, 0xa9878607U,
+         0x031dab1dU, 0x495a7bbbU, 0x64ad5c6dU, 0x39d0f019U, 0x82157c22U, 0x1c063e7cU, 0xd58895d6U, 0xd181a1abU},
+    },
+    {
+        {0xe5324caaU, 0x954ab30fU, 0x0a9472a3U, 0x694b65e3U, 0x9452a32eU, 0xd23d8c74U, 0xf8298bc0U, 0x8c28a97bU,
+         0xcbef9482U, 0x9e71dc73U, 0x451cb945U, 0x7ae784f0U, 0x1f7cc0ebU, 0x378fedf3U, 0xa3305193U, 0x40a30463U},
+        {0x7611d8e2U, 0x5dfb201fU, 0xde49fc4dU, 0xc8130fe8U, 0x047f0da2U, 0x96bed5a6U, 0x2a38a2f1U, 0xab1ac187U,
+         0xc429d15bU, 0x01a581f3U, 0x3e1e545fU, 0xf7ef93d3U, 0xdb6a42b6U, 0xe9aa5f39U, 0x324d17a1U, 0x13f4a37aU},
+        {0x4754dd40U, 0x863e8715U, 0xfc3466cfU, 0xa2422631U, 0xcd72f6e9U, 0x45b4841fU, 0x32c0dfcfU, 0x97292470U,
+         0x2aa36143U, 0x384b492fU, 0x55acaf49U, 0x90dae852U, 0xcbd4df36U, 0xcd15c75dU, 0x265fea1dU, 0x91d1a244U},
+        {0x2651b3faU, 0x226aee64U, 0x772df434U, 0x8ea1b365U, 0x253f31efU, 0x3703a607U, 0x5beef82dU, 0x2564fe9bU,
+         0x01e5122dU, 0xdb82e6a3U, 0x6b79816eU, 0x14f37dabU, 0x1203925fU, 0x95fa14aeU, 0x06783890U, 0x8ad9f7a6U},
+        {0x8c2ca7ffU, 0x3c2d82ebU, 0x95df021aU, 0x1803645dU, 0x5a2f27afU, 0x050791adU, 0x580a796eU, 0x89637f97U,
+         0x70493e68U, 0xbed415e1U, 0x8e42eab7U, 0xf87bc6a3U, 0x54357489U, 0xd57b9cf1U, 0x8c888424U, 0x2d1fe124U},
+        {0x0c7a89eeU, 0x057c3533U, 0x7ab6d4f8U, 0x4bdbc59cU, 0xfc98658aU, 0x12860b88U, 0x6a4179e1U, 0x71efa4e2U,
+         0xc1366a2eU, 0x4f489329U, 0x8e5e9a0bU, 0x2aaafab8U, 0xb17294a2U, 0x9efb2c32U, 0x8bb624aeU, 0x145fa81fU},
+        {0x0ca8dd7fU, 0x6186d63aU, 0x56a1381aU, 0x1bc72803U, 0x3d535742U, 0x2fdc9da0U, 0x1be25e09U, 0x308138e7U,
+         0x8a92c7f2U, 0xe415f247U, 0x434ad915U, 0xc8165646U, 0xd1408e18U, 0x5e39ec45U, 0x8828fc92U, 0x28d1e2d2U},
+        {0xae180068U, 0xb178e3d3U, 0x20bd3103U, 0x7ea3d56cU, 0xc30dc01aU, 0xbfc6c5c0U, 0xffac5b0cU, 0xff3d6136U,
+         0x188c6077U, 0x70a6bb6eU, 0x4001f5e6U, 0x547676f2U, 0xdd96adc1U, 0x40d0372cU, 0x84e4000eU, 0x133239beU},
+    },
+    {
+        {0x1faccae0U, 0x48c4ba11U, 0x5a4bb337U, 0x3c8b350cU, 0x4f071fd2U, 0xc1dd94ceU, 0x139527a8U, 0x08ea9666U,
+         0x0e62b945U, 0x55af34a3U, 0x9cf0f8e9U, 0x35b783beU, 0xfb95c5d7U, 0xe24e7c0cU, 0xc8ee2782U, 0x620efabbU},
+        {0xa190b632U, 0xa293131dU, 0xa4ab5ab9U, 0x63cf2a23U, 0x15559d82U, 0xf3a66df3U, 0x76220cd9U, 0xc25f6371U,
+         0xfc9590cfU, 0x6eebf3d6U, 0x9e027a1dU, 0x0a9f04ffU, 0x3809d798U, 0x98904990U, 0xe94d2873U, 0x53154fedU},
+        {0x66a06f5eU, 0x21a40b59U, 0x6ea08370U, 0xa3419251U, 0x1263b716U, 0xc37b0d42U, 0xea14253aU, 0x383b24fbU,
+         0xd3c6e772U, 0x089f4786U, 0xbb8c2b04U, 0xe8f6ae74U, 0x54ea5a19U, 0x44cf566dU, 0xc4edba20U, 0x54cf706aU},
+        {0xd466d561U, 0xe2ccb3b7U, 0x31978b4dU, 0x0c7b55dcU, 0x5688544cU, 0x3e82d82aU, 0x3cce6babU, 0x2a9e8dfeU,
+         0x52e76373U, 0xf96ccf52U, 0x17a02182U, 0x5e01eaecU, 0x608b96cfU, 0xbac7b5adU, 0xc16e651fU, 0x01dfeda5U},
+        {0x4638a136U, 0xc7975c1dU, 0x36838195U, 0x2b0d1ce3U, 0xb60d790cU, 0x789e59c6U, 0x3e02ed6dU, 0xe68432d0U,
+         0x8c6c2584U, 0xaafd1810U, 0xdb357336U, 0x2e09e3ebU, 0x3a01e647U, 0x24d2a730U, 0x98e35a66U, 0xca5be413U},
+        {0xdbcf2dceU, 0x2139b408U, 0x5c1dc6c0U, 0x68114a10U, 0x92ff9980U, 0xbd49e4c9U, 0x92e46218U, 0x95e62d42U,
+         0x58c86594U, 0x62bddfdfU, 0x3704d20eU, 0x5e7b3060U, 0xb428d52eU, 0x183a26e2U, 0x296c2875U, 0x06b68184U},
+        {0x16e8c10cU, 0x7ce87c44U, 0x391bd680U, 0xb472985fU, 0xe7306e7fU, 0x0eefbdecU, 0xe2fe5c2aU, 0x395dd559U,
+         0x05fe638eU, 0xbc3d6d93U, 0xdc66922cU, 0x4c909c04U, 0xaffa4e27U, 0xd0413e87U, 0xb4592ac5U, 0xfd62dcd4U},
+        {0x3f8be384U, 0xe8bd3204U, 0xa31db6c3U, 0x71ec0aadU, 0x4fdef072U, 0x251ad6c9U, 0x2be63e1bU, 0xb23790a4U,
+         0xeb19880eU, 0xd10a473dU, 0x149ecb58U, 0x17f004f4U, 0xaa81f945U, 0xe8d50f88U, 0x19d55edbU, 0xfc6b6949U},
+    },
+};
+
+#endif
@@ -1,56 +1,92 @@
 #include "local_segwit.h"
 #include "local_bech32.h"
 
-#include <tuple>
+#include <string.h>
 
 namespace {
 
-typedef std::vector<uint8_t> data;
+// The witness version plus a 40-byte program in 5-bit groups.
+constexpr size_t kMaximumValueCount = 1 + (segwit_address::kMaximumProgramSize * 8 + 4) / 5;
 
 template<int frombits, int tobits, bool pad>
-bool convertbits(data& out, const data& in) {
+bool convertbits(uint8_t *out, size_t out_capacity, size_t *out_size,
+                 const uint8_t *in, size_t in_size) {
   int acc = 0;
   int bits = 0;
+  size_t written = 0;
   const int maxv = (1 << tobits) - 1;
   const int max_acc = (1 << (frombits + tobits - 1)) - 1;
-  for (size_t i = 0; i < in.size(); ++i) {
+  for (size_t i = 0; i < in_size; ++i) {
     int value = in[i];
     acc = ((acc << frombits) | value) & max_acc;
     bits += frombits;
     while (bits >= tobits) {
       bits -= tobits;
-      out.push_back((acc >> bits) & maxv);
+      if (written == out_capacity) return false;
+      out[written++] = (acc >> bits) & maxv;
     }
   }
   if (pad) {
-    if (bits) out.push_back((acc << (tobits - bits)) & maxv);
+    if (bits) {
+      if (written == out_capacity) return false;
+      out[written++] = (acc << (tobits - bits)) & maxv;
+    }
   } else if (bits >= frombits || ((acc << (tobits - bits)) & maxv)) {
     return false;
   }
+  *out_size = written;
   return true;
 }
 
+// The BIP141/BIP350 program rules shared by encode and decode.
+bool valid_program(int witver, size_t witprog_size) {
+  return witver >= 0 && witver <= 16 && witprog_size >= 2 &&
+         witprog_size <= segwit_address::kMaximumProgramSize &&
+         (witver != 0 || witprog_size == 20 || witprog_size == 32);
+}
+
 }
 
 namespace segwit_address {
 
-std::string encode(const std::string& hrp, int witver, const data& witprogram) {
-  data enc;
-  enc.push_back(witver);
-  convertbits<8, 5, true>(enc, witprogram);
-  std::string ret = bech32::encode(hrp, enc, witver > 0 ? bech32::Encoding::BECH32M : bech32::Encoding::BECH32);
-  if (decode(hrp, ret).first == -1) return "";
-  return ret;
+size_t encode(char *out, size_t out_size, const char *hrp, int witver,
+              const uint8_t *witprog, size_t witprog_size) {
+  if (hrp == nullptr || witprog == nullptr || !valid_program(witver, witprog_size)) return 0;
+  uint8_t enc[kMaximumValueCount];
+  size_t converted = 0;
+  enc[0] = static_cast<uint8_t>(witver);
+  if (!convertbits<8, 5, true>(enc + 1, sizeof(enc) - 1, &converted, witprog, witprog_size)) {
+    return 0;
+  }
+  // BIP173 caps the whole address at 90 characters; bech32::encode() rejects
+  // hrp characters outside 33..126 and upper case.
+  if (strlen(hrp) + 1 + converted + 1 + bech32::kChecksumLength > bech32::kMaximumTextLength) {
+    return 0;
+  }
+  return bech32::encode(out, out_size, hrp, enc, converted + 1,
+                        witver > 0 ? bech32::Encoding::BECH32M : bech32::Encoding::BECH32);
 }
 
-std::pair<int, data> decode(const std::string& hrp, const std::string& addr) {
-  const auto dec = bech32::decode(addr);
-  if (dec.hrp != hrp || dec.data.size() < 1) return std::make_pair(-1, data());
-  data conv;
-  uint8_t witver = dec.data[0];
-  if (!convertbits<5, 8, false>(conv, data(dec.data.begin() + 1, dec.data.end())) || conv.size() < 2 || conv.size() > 40 || witver > 16 || (witver == 0 && conv.size() != 20 && conv.size() != 32) || (witver == 0 && dec.encoding != bech32::Encoding::BECH32) || (witver != 0 && dec.encoding != bech32::Encoding::BECH32M)) {
-    return std::make_pair(-1, data());
+int decode(const char *hrp, const char *addr, uint8_t *witprog, size_t *in_out_size) {
+  if (hrp == nullptr || witprog == nullptr || in_out_size == nullptr) return -1;
+  char dec_hrp[bech32::kMaximumTextLength];
+  uint8_t values[bech32::kMaximumTextLength];
+  size_t value_count = sizeof(values);
+  const bech32::Encoding encoding = bech32::decode(addr, dec_hrp, sizeof(dec_hrp), values, &value_count);
+  if (encoding == bech32::Encoding::INVALID || strcmp(dec_hrp, hrp) != 0 || value_count < 1) {
+    return -1;
+  }
+  const int witver = values[0];
+  size_t converted = 0;
+  uint8_t conv[kMaximumProgramSize];
+  if (!convertbits<5, 8, false>(conv, sizeof(conv), &converted, values + 1, value_count - 1) ||
+      !valid_program(witver, converted) ||
+      (witver == 0 && encoding != bech32::Encoding::BECH32) ||
+      (witver != 0 && encoding != bech32::Encoding::BECH32M) || converted > *in_out_size) {
+    return -1;
   }
-  return std::make_pair(dec.data[0], conv);
+  memcpy(witprog, conv, converted);
+  *in_out_size = converted;
+  return witver;
 }
 }
@@ -1,14 +1,23 @@
 #ifndef __LOCAL_SEGWIT_H_
 #define __LOCAL_SEGWIT_H_
 
+#include <stddef.h>
 #include <stdint.h>
-#include <vector>
-#include <string>
 
 namespace segwit_address {
-std::string encode(const std::string& hrp, int witver, const std::vector<uint8_t>& witprog);
 
-std::pair<int, std::vector<uint8_t> > decode(const std::string& hrp, const std::string& addr);
+constexpr size_t kMaximumProgramSize = 40;
+
+// Writes the address for witness version witver and its program into out.
+// Returns the text length, or 0 if the program is invalid for witver, hrp is
+// invalid, the address would exceed 90 characters or out_size is too small.
+size_t encode(char *out, size_t out_size, const char *hrp, int witver,
+              const uint8_t *witprog, size_t witprog_size);
+
+// Returns the witness version and writes the program, or returns -1 if addr
+// is not a valid address for hrp. *in_out_size holds the capacity of witprog
+// on entry and the program size on success.
+int decode(const char *hrp, const char *addr, uint8_t *witprog, size_t *in_out_size);
 
 }
 #endif
@@ -0,0 +1,286 @@
+#include "local_sha256.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr size_t kBlockSize = 64;
+constexpr size_t kStateWords = 8;
+constexpr size_t kBlockWords = 16;
+constexpr size_t kRounds = 64;
+constexpr uint32_t kPaddingBit = UINT32_C(0x80000000);
+// Bit length of a pad block followed by one 32-byte digest.
+constexpr uint32_t kPaddedDigestBits = (kBlockSize + kLocalSha256DigestSize) * 8;
+
+constexpr uint32_t kInitialState[kStateWords] = {
+    UINT32_C(0x6a09e667), UINT32_C(0xbb67ae85), UINT32_C(0x3c6ef372), UINT32_C(0xa54ff53a),
+    UINT32_C(0x510e527f), UINT32_C(0x9b05688c), UINT32_C(0x1f83d9ab), UINT32_C(0x5be0cd19),
+};
+constexpr uint32_t kRoundConstants[kRounds] = {
+    UINT32_C(0x428a2f98), UINT32_C(0x71374491), UINT32_C(0xb5c0fbcf), UINT32_C(0xe9b5dba5),
+    UINT32_C(0x3956c25b), UINT32_C(0x59f111f1), UINT32_C(0x923f82a4), UINT32_C(0xab1c5ed5),
+    UINT32_C(0xd807aa98), UINT32_C(0x12835b01), UINT32_C(0x243185be), UINT32_C(0x550c7dc3),
+    UINT32_C(0x72be5d74), UINT32_C(0x80deb1fe), UINT32_C(0x9bdc06a7), UINT32_C(0xc19bf174),
+    UINT32_C(0xe49b69c1), UINT32_C(0xefbe4786), UINT32_C(0x0fc19dc6), UINT32_C(0x240ca1cc),
+    UINT32_C(0x2de92c6f), UINT32_C(0x4a7484aa), UINT32_C(0x5cb0a9dc), UINT32_C(0x76f988da),
+    UINT32_C(0x983e5152), UINT32_C(0xa831c66d), UINT32_C(0xb00327c8), UINT32_C(0xbf597fc7),
+    UINT32_C(0xc6e00bf3), UINT32_C(0xd5a79147), UINT32_C(0x06ca6351), UINT32_C(0x14292967),
+    UINT32_C(0x27b70a85), UINT32_C(0x2e1b2138), UINT32_C(0x4d2c6dfc), UINT32_C(0x53380d13),
+    UINT32_C(0x650a7354), UINT32_C(0x766a0abb), UINT32_C(0x81c2c92e), UINT32_C(0x92722c85),
+    UINT32_C(0xa2bfe8a1), UINT32_C(0xa81a664b), UINT32_C(0xc24b8b70), UINT32_C(0xc76c51a3),
+    UINT32_C(0xd192e819), UINT32_C(0xd6990624), UINT32_C(0xf40e3585), UINT32_C(0x106aa070),
+    UINT32_C(0x19a4c116), UINT32_C(0x1e376c08), UINT32_C(0x2748774c), UINT32_C(0x34b0bcb5),
+    UINT32_C(0x391c0cb3), UINT32_C(0x4ed8aa4a), UINT32_C(0x5b9cca4f), UINT32_C(0x682e6ff3),
+    UINT32_C(0x748f82ee), UINT32_C(0x78a5636f), UINT32_C(0x84c87814), UINT32_C(0x8cc70208),
+    UINT32_C(0x90befffa), UINT32_C(0xa4506ceb), UINT32_C(0xbef9a3f7), UINT32_C(0xc67178f2),
+};
+
+struct Context {
+  uint32_t state[kStateWords];
+  uint8_t buffer[kBlockSize];
+  size_t used;
+  uint64_t total;
+};
+
+void wipe(void *data, size_t size) {
+  volatile uint8_t *bytes = static_cast<volatile uint8_t *>(data);
+  while (size-- != 0) *bytes++ = 0;
+}
+
+inline uint32_t rotate_right(uint32_t value, unsigned count) {
+  return (value >> count) | (value << (32U - count));
+}
+
+uint32_t load_be32(const uint8_t *data) {
+  return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) |
+         (static_cast<uint32_t>(data[2]) << 8) | data[3];
+}
+
+void store_be32(uint8_t *out, uint32_t value) {
+  out[0] = static_cast<uint8_t>(value >> 24);
+  out[1] = static_cast<uint8_t>(value >> 16);
+  out[2] = static_cast<uint8_t>(value >> 8);
+  out[3] = static_cast<uint8_t>(value);
+}
+
+// One round with the working variables passed in rotated order, so eight
+// calls advance the state without moving values between registers.
+inline void round_step(uint32_t a, uint32_t b, uint32_t c, uint32_t &d, uint32_t e,
+                       uint32_t f, uint32_t g, uint32_t &h, uint32_t constant, uint32_t word) {
+  const uint32_t t1 = h + (rotate_right(e, 6) ^ rotate_right(e, 11) ^ rotate_right(e, 25)) +
+                      ((e & f) ^ (~e & g)) + constant + word;
+  const uint32_t t2 = (rotate_right(a, 2) ^ rotate_right(a, 13) ^ rotate_right(a, 22)) +
+                      ((a & b) ^ (a & c) ^ (b & c));
+  d += t1;
+  h = t1 + t2;
+}
+
+inline uint32_t schedule(uint32_t words[kBlockWords], size_t round) {
+  const uint32_t w15 = words[(round - 15) & 15];
+  const uint32_t w2 = words[(round - 2) & 15];
+  words[round & 15] += (rotate_right(w2, 17) ^ rotate_right(w2, 19) ^ (w2 >> 10)) +
+                       words[(round - 7) & 15] +
+                       (rotate_right(w15, 7) ^ rotate_right(w15, 18) ^ (w15 >> 3));
+  return words[round & 15];
+}
+
+void compress_words(uint32_t state[kStateWords], const uint32_t block[kBlockWords]) {
+  uint32_t words[kBlockWords];
+  memcpy(words, block, sizeof(words));
+  uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+  uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+  for (size_t round = 0; round < 16; round += 8) {
+    round_step(a, b, c, d, e, f, g, h, kRoundConstants[round], words[round]);
+    round_step(h, a, b, c, d, e, f, g, kRoundConstants[round + 1], words[round + 1]);
+    round_step(g, h, a, b, c, d, e, f, kRoundConstants[round + 2], words[round + 2]);
+    round_step(f, g, h, a, b, c, d, e, kRoundConstants[round + 3], words[round + 3]);
+    round_step(e, f, g, h, a, b, c, d, kRoundConstants[round + 4], words[round + 4]);
+    round_step(d, e, f, g, h, a, b, c, kRoundConstants[round + 5], words[round + 5]);
+    round_step(c, d, e, f, g, h, a, b, kRoundConstants[round + 6], words[round + 6]);
+    round_step(b, c, d, e, f, g, h, a, kRoundConstants[round + 7], words[round + 7]);
+  }
+  for (size_t round = 16; round < kRounds; round += 8) {
+    round_step(a, b, c, d, e, f, g, h, kRoundConstants[round], schedule(words, round));
+    round_step(h, a, b, c, d, e, f, g, kRoundConstants[round + 1], schedule(words, round + 1));
+    round_step(g, h, a, b, c, d, e, f, kRoundConstants[round + 2], schedule(words, round + 2));
+    round_step(f, g, h, a, b, c, d, e, kRoundConstants[round + 3], schedule(words, round + 3));
+    round_step(e, f, g, h, a, b, c, d, kRoundConstants[round + 4], schedule(words, round + 4));
+    round_step(d, e, f, g, h, a, b, c, kRoundConstants[round + 5], schedule(words, round + 5));
+    round_step(c, d, e, f, g, h, a, b, kRoundConstants[round + 6], schedule(words, round + 6));
+    round_step(b, c, d, e, f, g, h, a, kRoundConstants[round + 7], schedule(words, round + 7));
+  }
+  state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+  state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+  wipe(words, sizeof(words));
+}
+
+void compress_bytes(uint32_t state[kStateWords], const uint8_t block[kBlockSize]) {
+  uint32_t words[kBlockWords];
+  for (size_t index = 0; index < kBlockWords; ++index) words[index] = load_be32(block + index * 4);
+  compress_words(state, words);
+  wipe(words, sizeof(words));
+}
+
+void context_init(Context *context) {
+  memcpy(context->state, kInitialState, sizeof(context->state));
+  context->used = 0;
+  context->total = 0;
+}
+
+void context_update(Context *context, const uint8_t *data, size_t size) {
+  context->total += size;
+  while (size != 0) {
+    if (context->used == 0 && size >= kBlockSize) {
+      compress_bytes(context->state, data);
+      data += kBlockSize;
+      size -= kBlockSize;
+      continue;
+    }
+    size_t take = kBlockSize - context->used;
+    if (take > size) take = size;
+    memcpy(context->buffer + context->used, data, take);
+    context->used += take;
+    data += take;
+    size -= take;
+    if (context->used == kBlockSize) {
+      compress_bytes(context->state, context->buffer);
+      context->used = 0;
+    }
+  }
+}
+
+void context_final(Context *context, uint32_t out[kStateWords]) {
+  const uint64_t bits = context->total * 8U;
+  context->buffer[context->used++] = 0x80;
+  if (context->used > kBlockSize - 8) {
+    memset(context->buffer + context->used, 0, kBlockSize - context->used);
+    compress_bytes(context->state, context->buffer);
+    context->used = 0;
+  }
+  memset(context->buffer + context->used, 0, kBlockSize - 8 - context->used);
+  store_be32(context->buffer + kBlockSize - 8, static_cast<uint32_t>(bits >> 32));
+  store_be32(context->buffer + kBlockSize - 4, static_cast<uint32_t>(bits));
+  compress_bytes(context->state, context->buffer);
+  memcpy(out, context->state, sizeof(context->state));
+  wipe(context, sizeof(*context));
+}
+
+}  // namespace
+
+void local_sha256(const uint8_t *data, size_t data_size,
+                  uint8_t digest[kLocalSha256DigestSize]) {
+  if (digest == nullptr || (data == nullptr && data_size != 0)) {
+    return;
+  }
+  Context context;
+  uint32_t state[kStateWords];
+  context_init(&context);
+  context_update(&context, data, data_size);
+  context_final(&context, state);
+  for (size_t index = 0; index < kStateWords; ++index) store_be32(digest + index * 4, state[index]);
+  wipe(state, sizeof(state));
+}
+
+bool local_pbkdf2_sha256_begin(LocalPbkdf2Sha256 *state, const uint8_t *password,
+                               size_t password_size, const uint8_t *salt, size_t salt_size,
+                               uint32_t iterations, uint32_t block_index) {
+  if (state == nullptr || (password == nullptr && password_size != 0) ||
+      (salt == nullptr && salt_size != 0) || iterations == 0 || block_index == 0) {
+    return false;
+  }
+  uint8_t key_block[kBlockSize] = {};
+  if (password_size > kBlockSize) {
+    local_sha256(password, password_size, key_block);
+  } else if (password_size != 0) {
+    memcpy(key_block, password, password_size);
+  }
+  Context inner;
+  Context outer;
+  context_init(&inner);
+  context_init(&outer);
+  for (size_t index = 0; index < kBlockSize; ++index) key_block[index] ^= 0x36;
+  context_update(&inner, key_block, kBlockSize);
+  for (size_t index = 0; index < kBlockSize; ++index) key_block[index] ^= 0x36 ^ 0x5c;
+  context_update(&outer, key_block, kBlockSize);
+  wipe(key_block, sizeof(key_block));
+  memcpy(state->inner, inner.state, sizeof(state->inner));
+  memcpy(state->outer, outer.state, sizeof(state->outer));
+
+  const uint8_t counter[4] = {
+      static_cast<uint8_t>(block_index >> 24), static_cast<uint8_t>(block_index >> 16),
+      static_cast<uint8_t>(block_index >> 8), static_cast<uint8_t>(block_index),
+  };
+  uint8_t digest[kLocalSha256DigestSize];
+  context_update(&inner, salt, salt_size);
+  context_update(&inner, counter, sizeof(counter));
+  context_final(&inner, state->block);
+  for (size_t index = 0; index < kStateWords; ++index) store_be32(digest + index * 4, state->block[index]);
+  context_update(&outer, digest, sizeof(digest));
+  context_final(&outer, state->block);
+  memcpy(state->accumulated, state->block, sizeof(state->accumulated));
+  state->remaining = iterations - 1;
+  wipe(digest, sizeof(digest));
+  return true;
+}
+
+bool local_pbkdf2_sha256_step(LocalPbkdf2Sha256 *state, uint32_t max_iterations) {
+  if (state == nullptr) return false;
+  // U_(j-1) hashed as a single pre-padded block after the pad midstate.
+  uint32_t block[kBlockWords] = {};
+  block[kStateWords] = kPaddingBit;
+  block[kBlockWords - 1] = kPaddedDigestBits;
+  uint32_t digest[kStateWords];
+  const uint32_t count = max_iterations < state->remaining ? max_iterations : state->remaining;
+  for (uint32_t iteration = 0; iteration < count; ++iteration) {
+    memcpy(block, state->block, sizeof(state->block));
+    memcpy(digest, state->inner, sizeof(digest));
+    compress_words(digest, block);
+    memcpy(block, digest, sizeof(digest));
+    memcpy(state->block, state->outer, sizeof(state->block));
+    compress_words(state->block, block);
+    for (size_t index = 0; index < kStateWords; ++index) state->accumulated[index] ^= state->block[index];
+  }
+  state->remaining -= count;
+  wipe(block, sizeof(block));
+  wipe(digest, sizeof(digest));
+  return state->remaining == 0;
+}
+
+bool local_pbkdf2_sha256_finish(LocalPbkdf2Sha256 *state,
+                                uint8_t out[kLocalSha256DigestSize]) {
+  if (state == nullptr || out == nullptr) return false;
+  const bool finished = state->remaining == 0;
+  if (finished) {
+    for (size_t index = 0; index < kStateWords; ++index) store_be32(out + index * 4, state->accumulated[index]);
+  }
+  local_pbkdf2_sha256_clear(state);
+  return finished;
+}
+
+void local_pbkdf2_sha256_clear(LocalPbkdf2Sha256 *state) {
+  if (state != nullptr) wipe(state, sizeof(*state));
+}
+
+bool local_pbkdf2_hmac_sha256(const uint8_t *password, size_t password_size,
+                              const uint8_t *salt, size_t salt_size, uint32_t iterations,
+                              uint8_t *out, size_t out_size) {
+  if (out == nullptr || out_size == 0 || out_size / kLocalSha256DigestSize >= UINT32_MAX) {
+    return false;
+  }
+  LocalPbkdf2Sha256 state;
+  uint8_t digest[kLocalSha256DigestSize];
+  for (uint32_t block_index = 1; out_size != 0; ++block_index) {
+    if (!local_pbkdf2_sha256_begin(&state, password, password_size, salt, salt_size,
+                                   iterations, block_index)) {
+      return false;
+    }
+    local_pbkdf2_sha256_step(&state, iterations);
+    local_pbkdf2_sha256_finish(&state, digest);
+    const size_t take = out_size < sizeof(digest) ? out_size : sizeof(digest);
+    memcpy(out, digest, take);
+    out += take;
+    out_size -= take;
+  }
+  wipe(digest, sizeof(digest));
+  return true;
+}
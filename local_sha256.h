@@ -0,0 +1,41 @@
+#ifndef HEXWALLET_LOCAL_SHA256_H
+#define HEXWALLET_LOCAL_SHA256_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+constexpr size_t kLocalSha256DigestSize = 32;
+
+void local_sha256(const uint8_t *data, size_t data_size,
+                  uint8_t digest[kLocalSha256DigestSize]);
+
+// State of one PBKDF2-HMAC-SHA256 output block. The key pads are kept as
+// midstates, so each iteration compresses two fixed pre-padded blocks, and
+// the iterations can be run in bounded slices. The midstates are equivalent
+// to the password; local_pbkdf2_sha256_finish() and _clear() wipe them.
+struct LocalPbkdf2Sha256 {
+  uint32_t inner[8];
+  uint32_t outer[8];
+  uint32_t block[8];
+  uint32_t accumulated[8];
+  uint32_t remaining;
+};
+
+// Prepares output block block_index (1 for the first 32 bytes) and runs the
+// first iteration.
+bool local_pbkdf2_sha256_begin(LocalPbkdf2Sha256 *state, const uint8_t *password,
+                               size_t password_size, const uint8_t *salt, size_t salt_size,
+                               uint32_t iterations, uint32_t block_index);
+// Runs at most max_iterations further iterations. Returns true once all of
+// them have run.
+bool local_pbkdf2_sha256_step(LocalPbkdf2Sha256 *state, uint32_t max_iterations);
+// Writes the finished block and wipes the state. Fails if iterations remain.
+bool local_pbkdf2_sha256_finish(LocalPbkdf2Sha256 *state,
+                                uint8_t out[kLocalSha256DigestSize]);
+void local_pbkdf2_sha256_clear(LocalPbkdf2Sha256 *state);
+
+bool local_pbkdf2_hmac_sha256(const uint8_t *password, size_t password_size,
+                              const uint8_t *salt, size_t salt_size, uint32_t iterations,
+                              uint8_t *out, size_t out_size);
+
+#endif
@@ -0,0 +1,267 @@
+#include "local_sha512.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr size_t kBlockSize = 128;
+constexpr size_t kStateWords = 8;
+constexpr size_t kBlockWords = 16;
+constexpr size_t kRounds = 80;
+constexpr uint64_t kPaddingBit = UINT64_C(0x8000000000000000);
+// Bit length of a pad block followed by one 64-byte digest.
+constexpr uint64_t kPaddedDigestBits = (kBlockSize + kLocalSha512DigestSize) * 8;
+
+constexpr uint64_t kInitialState[kStateWords] = {
+    UINT64_C(0x6a09e667f3bcc908), UINT64_C(0xbb67ae8584caa73b), UINT64_C(0x3c6ef372fe94f82b),
+    UINT64_C(0xa54ff53a5f1d36f1), UINT64_C(0x510e527fade682d1), UINT64_C(0x9b05688c2b3e6c1f),
+    UINT64_C(0x1f83d9abfb41bd6b), UINT64_C(0x5be0cd19137e2179),
+};
+constexpr uint64_t kRoundConstants[kRounds] = {
+    UINT64_C(0x428a2f98d728ae22), UINT64_C(0x7137449123ef65cd), UINT64_C(0xb5c0fbcfec4d3b2f),
+    UINT64_C(0xe9b5dba58189dbbc), UINT64_C(0x3956c25bf348b538), UINT64_C(0x59f111f1b605d019),
+    UINT64_C(0x923f82a4af194f9b), UINT64_C(0xab1c5ed5da6d8118), UINT64_C(0xd807aa98a3030242),
+    UINT64_C(0x12835b0145706fbe), UINT64_C(0x243185be4ee4b28c), UINT64_C(0x550c7dc3d5ffb4e2),
+    UINT64_C(0x72be5d74f27b896f), UINT64_C(0x80deb1fe3b1696b1), UINT64_C(0x9bdc06a725c71235),
+    UINT64_C(0xc19bf174cf692694), UINT64_C(0xe49b69c19ef14ad2), UINT64_C(0xefbe4786384f25e3),
+    UINT64_C(0x0fc19dc68b8cd5b5), UINT64_C(0x240ca1cc77ac9c65), UINT64_C(0x2de92c6f592b0275),
+    UINT64_C(0x4a7484aa6ea6e483), UINT64_C(0x5cb0a9dcbd41fbd4), UINT64_C(0x76f988da831153b5),
+    UINT64_C(0x983e5152ee66dfab), UINT64_C(0xa831c66d2db43210), UINT64_C(0xb00327c898fb213f),
+    UINT64_C(0xbf597fc7beef0ee4), UINT64_C(0xc6e00bf33da88fc2), UINT64_C(0xd5a79147930aa725),
+    UINT64_C(0x06ca6351e003826f), UINT64_C(0x142929670a0e6e70), UINT64_C(0x27b70a8546d22ffc),
+    UINT64_C(0x2e1b21385c26c926), UINT64_C(0x4d2c6dfc5ac42aed), UINT64_C(0x53380d139d95b3df),
+    UINT64_C(0x650a73548baf63de), UINT64_C(0x766a0abb3c77b2a8), UINT64_C(0x81c2c92e47edaee6),
+    UINT64_C(0x92722c851482353b), UINT64_C(0xa2bfe8a14cf10364), UINT64_C(0xa81a664bbc423001),
+    UINT64_C(0xc24b8b70d0f89791), UINT64_C(0xc76c51a30654be30), UINT64_C(0xd192e819d6ef5218),
+    UINT64_C(0xd69906245565a910), UINT64_C(0xf40e35855771202a), UINT64_C(0x106aa07032bbd1b8),
+    UINT64_C(0x19a4c116b8d2d0c8), UINT64_C(0x1e376c085141ab53), UINT64_C(0x2748774cdf8eeb99),
+    UINT64_C(0x34b0bcb5e19b48a8), UINT64_C(0x391c0cb3c5c95a63), UINT64_C(0x4ed8aa4ae3418acb),
+    UINT64_C(0x5b9cca4f7763e373), UINT64_C(0x682e6ff3d6b2b8a3), UINT64_C(0x748f82ee5defb2fc),
+    UINT64_C(0x78a5636f43172f60), UINT64_C(0x84c87814a1f0ab72), UINT64_C(0x8cc702081a6439ec),
+    UINT64_C(0x90befffa23631e28), UINT64_C(0xa4506cebde82bde9), UINT64_C(0xbef9a3f7b2c67915),
+    UINT64_C(0xc67178f2e372532b), UINT64_C(0xca273eceea26619c), UINT64_C(0xd186b8c721c0c207),
+    UINT64_C(0xeada7dd6cde0eb1e), UINT64_C(0xf57d4f7fee6ed178), UINT64_C(0x06f067aa72176fba),
+    UINT64_C(0x0a637dc5a2c898a6), UINT64_C(0x113f9804bef90dae), UINT64_C(0x1b710b35131c471b),
+    UINT64_C(0x28db77f523047d84), UINT64_C(0x32caab7b40c72493), UINT64_C(0x3c9ebe0a15c9bebc),
+    UINT64_C(0x431d67c49c100d4c), UINT64_C(0x4cc5d4becb3e42b6), UINT64_C(0x597f299cfc657e2a),
+    UINT64_C(0x5fcb6fab3ad6faec), UINT64_C(0x6c44198c4a475817),
+};
+
+struct Context {
+  uint64_t state[kStateWords];
+  uint8_t buffer[kBlockSize];
+  size_t used;
+  uint64_t total;
+};
+
+void wipe(void *data, size_t size) {
+  volatile uint8_t *bytes = static_cast<volatile uint8_t *>(data);
+  while (size-- != 0) *bytes++ = 0;
+}
+
+inline uint64_t rotate_right(uint64_t value, unsigned count) {
+  return (value >> count) | (value << (64U - count));
+}
+
+uint64_t load_be64(const uint8_t *data) {
+  uint64_t value = 0;
+  for (uint8_t index = 0; index < 8; ++index) value = (value << 8) | data[index];
+  return value;
+}
+
+void store_be64(uint8_t *out, uint64_t value) {
+  for (uint8_t index = 0; index < 8; ++index) {
+    out[index] = static_cast<uint8_t>(value >> (56U - index * 8U));
+  }
+}
+
+// One round with the working variables passed in rotated order, so eight
+// calls advance the state without moving values between registers.
+inline void round_step(uint64_t a, uint64_t b, uint64_t c, uint64_t &d, uint64_t e,
+                       uint64_t f, uint64_t g, uint64_t &h, uint64_t constant, uint64_t word) {
+  const uint64_t t1 = h + (rotate_right(e, 14) ^ rotate_right(e, 18) ^ rotate_right(e, 41)) +
+                      ((e & f) ^ (~e & g)) + constant + word;
+  const uint64_t t2 = (rotate_right(a, 28) ^ rotate_right(a, 34) ^ rotate_right(a, 39)) +
+                      ((a & b) ^ (a & c) ^ (b & c));
+  d += t1;
+  h = t1 + t2;
+}
+
+inline uint64_t schedule(uint64_t words[kBlockWords], size_t round) {
+  const uint64_t w15 = words[(round - 15) & 15];
+  const uint64_t w2 = words[(round - 2) & 15];
+  words[round & 15] += (rotate_right(w2, 19) ^ rotate_right(w2, 61) ^ (w2 >> 6)) +
+                       words[(round - 7) & 15] +
+                       (rotate_right(w15, 1) ^ rotate_right(w15, 8) ^ (w15 >> 7));
+  return words[round & 15];
+}
+
+void compress_words(uint64_t state[kStateWords], const uint64_t block[kBlockWords]) {
+  uint64_t words[kBlockWords];
+  memcpy(words, block, sizeof(words));
+  uint64_t a = state[0], b = state[1], c = state[2], d = state[3];
+  uint64_t e = state[4], f = state[5], g = state[6], h = state[7];
+  for (size_t round = 0; round < 16; round += 8) {
+    round_step(a, b, c, d, e, f, g, h, kRoundConstants[round], words[round]);
+    round_step(h, a, b, c, d, e, f, g, kRoundConstants[round + 1], words[round + 1]);
+    round_step(g, h, a, b, c, d, e, f, kRoundConstants[round + 2], words[round + 2]);
+    round_step(f, g, h, a, b, c, d, e, kRoundConstants[round + 3], words[round + 3]);
+    round_step(e, f, g, h, a, b, c, d, kRoundConstants[round + 4], words[round + 4]);
+    round_step(d, e, f, g, h, a, b, c, kRoundConstants[round + 5], words[round + 5]);
+    round_step(c, d, e, f, g, h, a, b, kRoundConstants[round + 6], words[round + 6]);
+    round_step(b, c, d, e, f, g, h, a, kRoundConstants[round + 7], words[round + 7]);
+  }
+  for (size_t round = 16; round < kRounds; round += 8) {
+    round_step(a, b, c, d, e, f, g, h, kRoundConstants[round], schedule(words, round));
+    round_step(h, a, b, c, d, e, f, g, kRoundConstants[round + 1], schedule(words, round + 1));
+    round_step(g, h, a, b, c, d, e, f, kRoundConstants[round + 2], schedule(words, round + 2));
+    round_step(f, g, h, a, b, c, d, e, kRoundConstants[round + 3], schedule(words, round + 3));
+    round_step(e, f, g, h, a, b, c, d, kRoundConstants[round + 4], schedule(words, round + 4));
+    round_step(d, e, f, g, h, a, b, c, kRoundConstants[round + 5], schedule(words, round + 5));
+    round_step(c, d, e, f, g, h, a, b, kRoundConstants[round + 6], schedule(words, round + 6));
+    round_step(b, c, d, e, f, g, h, a, kRoundConstants[round + 7], schedule(words, round + 7));
+  }
+  state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+  state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+  wipe(words, sizeof(words));
+}
+
+void compress_bytes(uint64_t state[kStateWords], const uint8_t block[kBlockSize]) {
+  uint64_t words[kBlockWords];
+  for (size_t index = 0; index < kBlockWords; ++index) words[index] = load_be64(block + index * 8);
+  compress_words(state, words);
+  wipe(words, sizeof(words));
+}
+
+void context_init(Context *context) {
+  memcpy(context->state, kInitialState, sizeof(context->state));
+  context->used = 0;
+  context->total = 0;
+}
+
+void context_update(Context *context, const uint8_t *data, size_t size) {
+  context->total += size;
+  while (size != 0) {
+    if (context->used == 0 && size >= kBlockSize) {
+      compress_bytes(context->state, data);
+      data += kBlockSize;
+      size -= kBlockSize;
+      continue;
+    }
+    size_t take = kBlockSize - context->used;
+    if (take > size) take = size;
+    memcpy(context->buffer + context->used, data, take);
+    context->used += take;
+    data += take;
+    size -= take;
+    if (context->used == kBlockSize) {
+      compress_bytes(context->state, context->buffer);
+      context->used = 0;
+    }
+  }
+}
+
+// Message lengths here stay far below 2^61 bytes, so the high half of the
+// 128-bit length field is always zero.
+void context_final(Context *context, uint64_t out[kStateWords]) {
+  const uint64_t bits = context->total * 8U;
+  context->buffer[context->used++] = 0x80;
+  if (context->used > kBlockSize - 16) {
+    memset(context->buffer + context->used, 0, kBlockSize - context->used);
+    compress_bytes(context->state, context->buffer);
+    context->used = 0;
+  }
+  memset(context->buffer + context->used, 0, kBlockSize - 8 - context->used);
+  store_be64(context->buffer + kBlockSize - 8, bits);
+  compress_bytes(context->state, context->buffer);
+  memcpy(out, context->state, sizeof(context->state));
+  wipe(context, sizeof(*context));
+}
+
+}  // namespace
+
+void local_sha512(const uint8_t *data, size_t data_size,
+                  uint8_t digest[kLocalSha512DigestSize]) {
+  if (digest == nullptr || (data == nullptr && data_size != 0)) {
+    return;
+  }
+  Context context;
+  uint64_t state[kStateWords];
+  context_init(&context);
+  context_update(&context, data, data_size);
+  context_final(&context, state);
+  for (size_t index = 0; index < kStateWords; ++index) store_be64(digest + index * 8, state[index]);
+  wipe(state, sizeof(state));
+}
+
+bool local_pbkdf2_hmac_sha512(const uint8_t *password, size_t password_size,
+                              const uint8_t *salt, size_t salt_size, uint32_t iterations,
+                              uint8_t *out, size_t out_size) {
+  if ((password == nullptr && password_size != 0) || (salt == nullptr && salt_size != 0) ||
+      out == nullptr || iterations == 0 || out_size == 0 ||
+      out_size / kLocalSha512DigestSize >= UINT32_MAX) {
+    return false;
+  }
+  uint8_t key_block[kBlockSize] = {};
+  if (password_size > kBlockSize) {
+    local_sha512(password, password_size, key_block);
+  } else if (password_size != 0) {
+    memcpy(key_block, password, password_size);
+  }
+  Context inner;
+  Context outer;
+  context_init(&inner);
+  context_init(&outer);
+  for (size_t index = 0; index < kBlockSize; ++index) key_block[index] ^= 0x36;
+  context_update(&inner, key_block, kBlockSize);
+  for (size_t index = 0; index < kBlockSize; ++index) key_block[index] ^= 0x36 ^ 0x5c;
+  context_update(&outer, key_block, kBlockSize);
+  wipe(key_block, sizeof(key_block));
+
+  // Later iterations hash U_(j-1) as a single pre-padded block: the digest
+  // words, the padding bit and the total length of pad block plus digest.
+  uint64_t block[kBlockWords] = {};
+  block[kStateWords] = kPaddingBit;
+  block[kBlockWords - 1] = kPaddedDigestBits;
+  uint64_t accumulated[kStateWords];
+  uint64_t state[kStateWords];
+  uint8_t digest[kLocalSha512DigestSize];
+  uint32_t block_index = 0;
+  while (out_size != 0) {
+    ++block_index;
+    const uint8_t counter[4] = {
+        static_cast<uint8_t>(block_index >> 24), static_cast<uint8_t>(block_index >> 16),
+        static_cast<uint8_t>(block_index >> 8), static_cast<uint8_t>(block_index),
+    };
+    Context context = inner;
+    context_update(&context, salt, salt_size);
+    context_update(&context, counter, sizeof(counter));
+    context_final(&context, state);
+    for (size_t index = 0; index < kStateWords; ++index) store_be64(digest + index * 8, state[index]);
+    context = outer;
+    context_update(&context, digest, sizeof(digest));
+    context_final(&context, state);
+    memcpy(accumulated, state, sizeof(accumulated));
+    for (uint32_t iteration = 1; iteration < iterations; ++iteration) {
+      memcpy(block, state, sizeof(state));
+      memcpy(state, inner.state, sizeof(state));
+      compress_words(state, block);
+      memcpy(block, state, sizeof(state));
+      memcpy(state, outer.state, sizeof(state));
+      compress_words(state, block);
+      for (size_t index = 0; index < kStateWords; ++index) accumulated[index] ^= state[index];
+    }
+    for (size_t index = 0; index < kStateWords; ++index) store_be64(digest + index * 8, accumulated[index]);
+    const size_t take = out_size < sizeof(digest) ? out_size : sizeof(digest);
+    memcpy(out, digest, take);
+    out += take;
+    out_size -= take;
+  }
+  wipe(&inner, sizeof(inner));
+  wipe(&outer, sizeof(outer));
+  wipe(block, sizeof(block));
+  wipe(accumulated, sizeof(accumulated));
+  wipe(state, sizeof(state));
+  wipe(digest, sizeof(digest));
+  return true;
+}
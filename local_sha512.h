@@ -0,0 +1,18 @@
+#ifndef HEXWALLET_LOCAL_SHA512_H
+#define HEXWALLET_LOCAL_SHA512_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+constexpr size_t kLocalSha512DigestSize = 64;
+
+void local_sha512(const uint8_t *data, size_t data_size,
+                  uint8_t digest[kLocalSha512DigestSize]);
+
+// PBKDF2-HMAC-SHA512. The key pads are hashed once into midstates and every
+// iteration then costs two compressions of a fixed, pre-padded block.
+bool local_pbkdf2_hmac_sha512(const uint8_t *password, size_t password_size,
+                              const uint8_t *salt, size_t salt_size, uint32_t iterations,
+                              uint8_t *out, size_t out_size);
+
+#endif
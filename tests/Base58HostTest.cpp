@@ -0,0 +1,116 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../base58.h"
+#include "../CryptoPrimitives.h"
+#include "../local_sha256.h"
+
+// base58.cpp only needs these two primitives; the firmware gets them from
+// CryptoPrimitives.cpp on mbedTLS.
+namespace hexwallet {
+
+bool crypto_double_sha256(const uint8_t *data, size_t size, uint8_t out[kSha256Size]) {
+  uint8_t first[kSha256Size];
+  local_sha256(data, size, first);
+  local_sha256(first, sizeof(first), out);
+  return true;
+}
+
+bool crypto_constant_time_equal(const uint8_t *left, const uint8_t *right, size_t size) {
+  uint8_t difference = 0;
+  for (size_t index = 0; index < size; ++index) difference |= left[index] ^ right[index];
+  return difference == 0;
+}
+
+}  // namespace hexwallet
+
+namespace {
+
+constexpr char kAlphabet[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+// The byte-at-a-time conversion the limb encoder replaced.
+size_t reference_encode(const uint8_t *bytes, size_t size, char *out) {
+  size_t zeroes = 0;
+  while (zeroes < size && bytes[zeroes] == 0) ++zeroes;
+  uint8_t work[128] = {};
+  const size_t work_size = (size - zeroes) * 138 / 100 + 1;
+  size_t high = work_size - 1;
+  for (size_t i = zeroes; i < size; ++i) {
+    int carry = bytes[i];
+    size_t j = work_size - 1;
+    for (; j > high || carry != 0; --j) {
+      carry += 256 * work[j];
+      work[j] = static_cast<uint8_t>(carry % 58);
+      carry /= 58;
+      if (j == 0) break;
+    }
+    high = j;
+  }
+  size_t first = 0;
+  while (first < work_size && work[first] == 0) ++first;
+  memset(out, '1', zeroes);
+  size_t written = zeroes;
+  while (first < work_size) out[written++] = kAlphabet[work[first++]];
+  out[written] = '\0';
+  return written + 1;
+}
+
+uint32_t next_random(uint32_t *state) {
+  *state = *state * 1664525U + 1013904223U;
+  return *state >> 8;
+}
+
+}  // namespace
+
+int main() {
+  // BIP32 test vector 1 master xpub.
+  static const char kXpub[] =
+      "xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8";
+  uint8_t decoded[82];
+  size_t decoded_size = sizeof(decoded);
+  char encoded[128];
+  size_t encoded_size = sizeof(encoded);
+  bool passed = b58check_dec(decoded, &decoded_size, kXpub) && decoded_size == 78 &&
+                decoded[0] == 0x04 && decoded[1] == 0x88 && decoded[2] == 0xb2 && decoded[3] == 0x1e;
+  uint8_t checked[82];
+  uint8_t checksum[hexwallet::kSha256Size];
+  memcpy(checked, decoded, 78);
+  hexwallet::crypto_double_sha256(decoded, 78, checksum);
+  memcpy(checked + 78, checksum, 4);
+  passed = passed && b58enc(encoded, &encoded_size, checked, sizeof(checked)) &&
+           encoded_size == sizeof(kXpub) && strcmp(encoded, kXpub) == 0;
+  checked[81] ^= 1;
+  encoded_size = sizeof(encoded);
+  passed = passed && b58enc(encoded, &encoded_size, checked, sizeof(checked)) &&
+           !b58check_dec(decoded, &decoded_size, encoded) &&
+           !b58check_dec(decoded, &decoded_size, "1111O") &&
+           !b58check_dec(decoded, &decoded_size, "");
+  encoded_size = 10;
+  passed = passed && !b58enc(encoded, &encoded_size, checked, sizeof(checked)) &&
+           encoded_size == sizeof(kXpub);
+
+  // Randomized sizes and leading-zero runs against the reference conversion,
+  // with a checksum appended so every encoding also round-trips the decoder.
+  uint32_t state = 0x58u;
+  for (size_t round = 0; passed && round < 20000; ++round) {
+    uint8_t payload[82] = {};
+    const size_t size = 4 + next_random(&state) % 79;
+    const size_t leading = next_random(&state) % 4 == 0 ? next_random(&state) % (size - 3) : 0;
+    for (size_t index = leading; index < size - 4; ++index) {
+      payload[index] = static_cast<uint8_t>(next_random(&state));
+    }
+    hexwallet::crypto_double_sha256(payload, size - 4, checksum);
+    memcpy(payload + size - 4, checksum, 4);
+    char expected[128];
+    const size_t expected_size = reference_encode(payload, size, expected);
+    encoded_size = sizeof(encoded);
+    decoded_size = sizeof(decoded);
+    passed = b58enc(encoded, &encoded_size, payload, size) && encoded_size == expected_size &&
+             strcmp(encoded, expected) == 0 &&
+             b58check_dec(decoded, &decoded_size, encoded) && decoded_size == size - 4 &&
+             memcmp(decoded, payload, size - 4) == 0;
+  }
+  if (!passed) printf("base58 host test failed\n");
+  return passed ? 0 : 1;
+}
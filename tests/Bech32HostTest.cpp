@@ -0,0 +1,138 @@
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../local_bech32.h"
+#include "../local_segwit.h"
+
+namespace {
+
+struct AddressVector {
+  const char *address;
+  const char *script_hex;
+};
+
+// BIP173 and BIP350 valid segwit addresses with their output scripts.
+constexpr AddressVector kValidAddresses[] = {
+    {"BC1QW508D6QEJXTDG4Y5R3ZARVARY0C5XW7KV8F3T4", "0014751e76e8199196d454941c45d1b3a323f1433bd6"},
+    {"tb1qrp33g0q5c5txsp9arysrx4k6zdkfs4nce4xj0gdcccefvpysxf3q0sl5k7",
+     "00201863143c14c5166804bd19203356da136c985678cd4d27a1b8c6329604903262"},
+    {"bc1pw508d6qejxtdg4y5r3zarvary0c5xw7kw508d6qejxtdg4y5r3zarvary0c5xw7kt5nd6y",
+     "5128751e76e8199196d454941c45d1b3a323f1433bd6751e76e8199196d454941c45d1b3a323f1433bd6"},
+    {"BC1SW50QGDZ25J", "6002751e"},
+    {"bc1zw508d6qejxtdg4y5r3zarvaryvaxxpcs", "5210751e76e8199196d454941c45d1b3a323"},
+    {"tb1qqqqqp399et2xygdj5xreqhjjvcmzhxw4aywxecjdzew6hylgvsesrxh6hy",
+     "0020000000c4a5cad46221b2a187905e5266362b99d5e91c6ce24d165dab93e86433"},
+    {"tb1pqqqqp399et2xygdj5xreqhjjvcmzhxw4aywxecjdzew6hylgvsesf3hn0c",
+     "5120000000c4a5cad46221b2a187905e5266362b99d5e91c6ce24d165dab93e86433"},
+    {"bc1p0xlxvlhemja6c4dqv22uapctqupfhlxm9h8z3k2e72q4k9hcz7vqzk5jj0",
+     "512079be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"},
+};
+
+// BIP173 and BIP350 invalid addresses, tried against both "bc" and "tb".
+constexpr const char *kInvalidAddresses[] = {
+    "tc1p0xlxvlhemja6c4dqv22uapctqupfhlxm9h8z3k2e72q4k9hcz7vq5zuyut",
+    "bc1p0xlxvlhemja6c4dqv22uapctqupfhlxm9h8z3k2e72q4k9hcz7vqh2y7hd",
+    "tb1z0xlxvlhemja6c4dqv22uapctqupfhlxm9h8z3k2e72q4k9hcz7vqglt7rf",
+    "BC1S0XLXVLHEMJA6C4DQV22UAPCTQUPFHLXM9H8Z3K2E72Q4K9HCZ7VQ54WELL",
+    "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kemeawh",
+    "bc1rw5uspcuh",
+    "bc10w508d6qejxtdg4y5r3zarvary0c5xw7kw508d6qejxtdg4y5r3zarvary0c5xw7kw5rljs90",
+    "BC1QR508D6QEJXTDG4Y5R3ZARVARYV98GJ9P",
+    "tb1qrp33g0q5c5txsp9arysrx4k6zdkfs4nce4xj0gdcccefvpysxf3q0sL5k7",
+    "bc1zw508d6qejxtdg4y5r3zarvaryvqyzf3du",
+    "bc1gmk9yu",
+};
+
+bool equal_hex(const uint8_t *bytes, size_t size, const char *hex) {
+  static constexpr char kHex[] = "0123456789abcdef";
+  if (strlen(hex) != size * 2) return false;
+  for (size_t index = 0; index < size; ++index) {
+    if (hex[index * 2] != kHex[bytes[index] >> 4] || hex[index * 2 + 1] != kHex[bytes[index] & 0x0f]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool check_valid(const AddressVector &vector) {
+  const char hrp[3] = {static_cast<char>(tolower(vector.address[0])),
+                       static_cast<char>(tolower(vector.address[1])), '\0'};
+  uint8_t script[2 + segwit_address::kMaximumProgramSize];
+  size_t program_size = segwit_address::kMaximumProgramSize;
+  const int witver = segwit_address::decode(hrp, vector.address, script + 2, &program_size);
+  if (witver < 0) return false;
+  script[0] = static_cast<uint8_t>(witver == 0 ? 0 : 0x50 + witver);
+  script[1] = static_cast<uint8_t>(program_size);
+  if (!equal_hex(script, program_size + 2, vector.script_hex)) return false;
+  char encoded[bech32::kMaximumTextLength + 1];
+  const size_t length = segwit_address::encode(encoded, sizeof(encoded), hrp, witver,
+                                               script + 2, program_size);
+  if (length != strlen(vector.address)) return false;
+  for (size_t index = 0; index < length; ++index) {
+    if (encoded[index] != tolower(vector.address[index])) return false;
+  }
+  // One byte short of the terminator must fail without writing past it.
+  return segwit_address::encode(encoded, length, hrp, witver, script + 2, program_size) == 0;
+}
+
+}  // namespace
+
+int main() {
+  bool passed = true;
+  // BIP173 bech32 and BIP350 bech32m checksum vectors.
+  constexpr const char *kBech32[] = {"A12UEL5L", "a12uel5l", "?1ezyfcl",
+                                     "abcdef1qpzry9x8gf2tvdw0s3jn54khce6mua7lmqqqxw"};
+  constexpr const char *kBech32m[] = {"A1LQFN3A", "a1lqfn3a", "?1v759aa",
+                                      "abcdef1l7aum6echk45nj3s0wdvt2fg8x9yrzpqzd3ryx"};
+  char hrp[bech32::kMaximumTextLength];
+  uint8_t values[bech32::kMaximumTextLength];
+  for (const char *text : kBech32) {
+    size_t count = sizeof(values);
+    passed = passed && bech32::decode(text, hrp, sizeof(hrp), values, &count) ==
+                           bech32::Encoding::BECH32;
+  }
+  for (const char *text : kBech32m) {
+    size_t count = sizeof(values);
+    passed = passed && bech32::decode(text, hrp, sizeof(hrp), values, &count) ==
+                           bech32::Encoding::BECH32M;
+  }
+  size_t count = sizeof(values);
+  char encoded[bech32::kMaximumTextLength + 1];
+  passed = passed &&
+           bech32::decode("abcdef1qpzry9x8gf2tvdw0s3jn54khce6mua7lmqqqxw", hrp, sizeof(hrp),
+                          values, &count) == bech32::Encoding::BECH32 &&
+           strcmp(hrp, "abcdef") == 0 && count == 32 &&
+           bech32::encode(encoded, sizeof(encoded), hrp, values, count, bech32::Encoding::BECH32) == 45 &&
+           strcmp(encoded, "abcdef1qpzry9x8gf2tvdw0s3jn54khce6mua7lmqqqxw") == 0;
+  count = 31;
+  passed = passed && bech32::decode("abcdef1qpzry9x8gf2tvdw0s3jn54khce6mua7lmqqqxw", hrp,
+                                    sizeof(hrp), values, &count) == bech32::Encoding::INVALID;
+
+  for (const AddressVector &vector : kValidAddresses) {
+    passed = passed && check_valid(vector);
+  }
+  for (const char *address : kInvalidAddresses) {
+    uint8_t program[segwit_address::kMaximumProgramSize];
+    size_t program_size = sizeof(program);
+    passed = passed && segwit_address::decode("bc", address, program, &program_size) < 0;
+    program_size = sizeof(program);
+    passed = passed && segwit_address::decode("tb", address, program, &program_size) < 0;
+  }
+  // A 40-byte program leaves room for an 18-character hrp within the BIP173
+  // 90-character limit; the encoder must not produce anything longer, and it
+  // must reject an hrp a decoder would not give back.
+  uint8_t long_program[segwit_address::kMaximumProgramSize] = {};
+  char address[bech32::kMaximumTextLength + 8];
+  passed = passed &&
+           segwit_address::encode(address, sizeof(address), "abcdefghijklmnopqr", 1, long_program,
+                                  sizeof(long_program)) == bech32::kMaximumTextLength &&
+           segwit_address::encode(address, sizeof(address), "abcdefghijklmnopqrs", 1, long_program,
+                                  sizeof(long_program)) == 0 &&
+           segwit_address::encode(address, sizeof(address), "BC", 0, long_program, 20) == 0 &&
+           segwit_address::encode(address, sizeof(address), "b c", 0, long_program, 20) == 0 &&
+           segwit_address::encode(address, sizeof(address), "", 0, long_program, 20) == 0;
+  if (!passed) printf("bech32 host test failed\n");
+  return passed ? 0 : 1;
+}
@@ -33,13 +33,22 @@ int main() {
   uint8_t one_shot[32];
   for (size_t index = 0; index < sizeof(long_input); ++index) long_input[index] = static_cast<uint8_t>(index);
   keccak_init(&context);
+  passed = passed && keccak_update(&context, long_input, 136) && keccak_final(&context, digest) &&
+      equal_hex(digest, 32, "7ce759f1ab7f9ce437719970c26b0a66ff11fe3e38e17df89cf5d29c7d7f807e");
+  keccak_init(&context);
   passed = passed && keccak_update(&context, long_input, sizeof(long_input)) &&
-      keccak_final(&context, one_shot);
+      keccak_final(&context, one_shot) &&
+      equal_hex(one_shot, 32, "a679e749a6af300c36e7ff2255d220864eab27b382f9cfdc5aa4d13563ba36ff");
   keccak_init(&context);
   passed = passed && keccak_update(&context, long_input, 17) &&
       keccak_update(&context, long_input + 17, 119) &&
       keccak_update(&context, long_input + 136, sizeof(long_input) - 136) &&
       keccak_final(&context, digest) && memcmp(one_shot, digest, sizeof(digest)) == 0;
+  // A buffered byte, then full blocks read from an unaligned address.
+  keccak_init(&context);
+  passed = passed && keccak_update(&context, long_input, 1) &&
+      keccak_update(&context, long_input + 1, sizeof(long_input) - 1) &&
+      keccak_final(&context, digest) && memcmp(one_shot, digest, sizeof(digest)) == 0;
   local_ripemd160(nullptr, 0, digest);
   passed = passed && equal_hex(digest, 20, "9c1185a5c5e9fc54612808977ee8f548b2258d31");
   static const uint8_t kQuickBrown[] = "The quick brown fox jumps over the lazy dog";
@@ -0,0 +1,47 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../local_descriptor.h"
+
+namespace {
+
+struct ChecksumVector {
+  const char *descriptor;
+  const char *checksum;
+};
+
+// BIP380 and Bitcoin Core documentation vectors, plus account descriptors in
+// the shape `wallet xpub` emits, with both hardened markers.
+constexpr ChecksumVector kVectors[] = {
+    {"raw(deadbeef)", "89f8spxm"},
+    {"pkh(02c6047f9441ed7d6d3045406e95c07cd85c778e4b8cef3ca7abac09b95c709ee5)", "8fhd9pwu"},
+    {"wpkh([73c5da0a/84h/0h/0h]xpub6CatWdiZiodmUeTDp8LT5or8nmbKNcuyvz7WyksVFkKB4RHwCD3XyuvPEbvqAQY3"
+     "rAPshWcMLoP2fMFMKHPJ4ZeZXYVUhLv1VMrjPC7PW6V/0/*)",
+     "afwvtk2s"},
+    {"sh(wpkh([d34db33f/49'/0'/0']xpub6CUGRUonZSQ4TWtTMmzXdrXDtypWKiKrhko4egpiMZbpiaQL2jkwSB1icqYh"
+     "2cfDfVxdx4df189oLKnC5fSwqPfgyP3hooxujYzAu3fDVmz/1/*))",
+     "f5293kud"},
+};
+
+}  // namespace
+
+int main() {
+  bool passed = true;
+  char checksum[kLocalDescriptorChecksumSize + 1];
+  for (const ChecksumVector &vector : kVectors) {
+    passed = passed && local_descriptor_checksum(vector.descriptor, checksum) &&
+             strcmp(checksum, vector.checksum) == 0;
+  }
+  // Characters outside the input set, including non-ASCII bytes, are rejected.
+  passed = passed && !local_descriptor_checksum("raw(deadbeef)\n", checksum) &&
+           !local_descriptor_checksum("raw(\xc3\xa9)", checksum);
+
+  char buffer[24] = "raw(deadbeef)";
+  passed = passed && local_descriptor_append_checksum(buffer, sizeof(buffer)) &&
+           strcmp(buffer, "raw(deadbeef)#89f8spxm") == 0;
+  char small[22] = "raw(deadbeef)";
+  passed = passed && !local_descriptor_append_checksum(small, sizeof(small)) &&
+           strcmp(small, "raw(deadbeef)") == 0;
+  if (!passed) printf("descriptor host test failed\n");
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,437 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../local_ed25519.h"
+#include "../local_sha512.h"
+
+namespace {
+
+// The always-add-and-double ladder the table engine replaced, on a plain
+// radix-2^51 field so it shares no arithmetic with the code under test.
+struct Reference {
+  uint64_t v[5];
+};
+
+struct ReferencePoint {
+  Reference x;
+  Reference y;
+  Reference z;
+  Reference t;
+};
+
+constexpr uint64_t kMask51 = (uint64_t{1} << 51) - 1;
+
+Reference reference_carry(unsigned __int128 wide[5]) {
+  Reference out;
+  for (int pass = 0; pass < 2; ++pass) {
+    for (size_t index = 0; index < 5; ++index) {
+      const unsigned __int128 carry = wide[index] >> 51;
+      wide[index] &= kMask51;
+      if (index == 4) {
+        wide[0] += carry * 19;
+      } else {
+        wide[index + 1] += carry;
+      }
+    }
+  }
+  for (size_t index = 0; index < 5; ++index) out.v[index] = static_cast<uint64_t>(wide[index]);
+  return out;
+}
+
+Reference reference_small(uint64_t value) {
+  Reference out = {{value, 0, 0, 0, 0}};
+  return out;
+}
+
+Reference reference_add(const Reference &left, const Reference &right) {
+  unsigned __int128 wide[5];
+  for (size_t index = 0; index < 5; ++index) wide[index] = left.v[index] + right.v[index];
+  return reference_carry(wide);
+}
+
+// left + 2p - right, so limbs never go negative.
+Reference reference_sub(const Reference &left, const Reference &right) {
+  unsigned __int128 wide[5];
+  for (size_t index = 0; index < 5; ++index) {
+    const uint64_t twice_p = index == 0 ? 2 * (kMask51 - 18) : 2 * kMask51;
+    wide[index] = left.v[index] + twice_p - right.v[index];
+  }
+  return reference_carry(wide);
+}
+
+Reference reference_mul(const Reference &left, const Reference &right) {
+  unsigned __int128 wide[5] = {};
+  for (size_t i = 0; i < 5; ++i) {
+    for (size_t j = 0; j < 5; ++j) {
+      const unsigned __int128 product = static_cast<unsigned __int128>(left.v[i]) * right.v[j];
+      if (i + j < 5) {
+        wide[i + j] += product;
+      } else {
+        wide[i + j - 5] += product * 19;
+      }
+    }
+  }
+  return reference_carry(wide);
+}
+
+Reference reference_invert(const Reference &value) {
+  // p - 2 = 2^255 - 21: every bit from 254 down is set except bits 2 and 4.
+  Reference out = reference_small(1);
+  for (int bit = 254; bit >= 0; --bit) {
+    out = reference_mul(out, out);
+    if (bit != 2 && bit != 4) out = reference_mul(out, value);
+  }
+  return out;
+}
+
+Reference reference_from_bytes(const uint8_t bytes[32]) {
+  Reference out = {};
+  for (size_t bit = 0; bit < 255; ++bit) {
+    if (((bytes[bit / 8] >> (bit % 8)) & 1) != 0) out.v[bit / 51] |= uint64_t{1} << (bit % 51);
+  }
+  return out;
+}
+
+void reference_to_bytes(uint8_t out[32], const Reference &value) {
+  unsigned __int128 wide[5];
+  for (size_t index = 0; index < 5; ++index) wide[index] = value.v[index];
+  Reference carried = reference_carry(wide);
+  uint64_t quotient = (carried.v[0] + 19) >> 51;
+  for (size_t index = 1; index < 5; ++index) quotient = (carried.v[index] + quotient) >> 51;
+  carried.v[0] += 19 * quotient;
+  for (size_t index = 0; index < 4; ++index) {
+    carried.v[index + 1] += carried.v[index] >> 51;
+    carried.v[index] &= kMask51;
+  }
+  carried.v[4] &= kMask51;
+  memset(out, 0, 32);
+  for (size_t bit = 0; bit < 255; ++bit) {
+    if (((carried.v[bit / 51] >> (bit % 51)) & 1) != 0) out[bit / 8] |= 1 << (bit % 8);
+  }
+}
+
+const Reference &reference_d() {
+  // d = -121665 / 121666.
+  static const Reference kD = reference_mul(reference_sub(reference_small(0), reference_small(121665)),
+                                            reference_invert(reference_small(121666)));
+  return kD;
+}
+
+ReferencePoint reference_add_points(const ReferencePoint &left, const ReferencePoint &right) {
+  const Reference a = reference_mul(reference_sub(left.y, left.x), reference_sub(right.y, right.x));
+  const Reference b = reference_mul(reference_add(left.y, left.x), reference_add(right.y, right.x));
+  const Reference tt = reference_mul(reference_mul(left.t, right.t), reference_d());
+  const Reference c = reference_add(tt, tt);
+  const Reference zz = reference_mul(left.z, right.z);
+  const Reference d = reference_add(zz, zz);
+  const Reference e = reference_sub(b, a);
+  const Reference f = reference_sub(d, c);
+  const Reference g = reference_add(d, c);
+  const Reference h = reference_add(b, a);
+  return {reference_mul(e, f), reference_mul(g, h), reference_mul(f, g), reference_mul(e, h)};
+}
+
+void reference_public_key(const uint8_t scalar[32], uint8_t out[32]) {
+  static const uint8_t kBaseX[32] = {
+      0x1a,0xd5,0x25,0x8f,0x60,0x2d,0x56,0xc9,0xb2,0xa7,0x25,0x95,0x60,0xc7,0x2c,0x69,
+      0x5c,0xdc,0xd6,0xfd,0x31,0xe2,0xa4,0xc0,0xfe,0x53,0x6e,0xcd,0xd3,0x36,0x69,0x21,
+  };
+  static const uint8_t kBaseY[32] = {
+      0x58,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+      0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+  };
+  ReferencePoint result = {reference_small(0), reference_small(1), reference_small(1),
+                           reference_small(0)};
+  ReferencePoint addend = {reference_from_bytes(kBaseX), reference_from_bytes(kBaseY),
+                           reference_small(1), {}};
+  addend.t = reference_mul(addend.x, addend.y);
+  for (size_t bit = 0; bit < 255; ++bit) {
+    if (((scalar[bit / 8] >> (bit % 8)) & 1) != 0) result = reference_add_points(result, addend);
+    addend = reference_add_points(addend, addend);
+  }
+  const Reference inverse = reference_invert(result.z);
+  uint8_t x[32];
+  reference_to_bytes(out, reference_mul(result.y, inverse));
+  reference_to_bytes(x, reference_mul(result.x, inverse));
+  out[31] |= static_cast<uint8_t>((x[0] & 1) << 7);
+}
+
+// input mod l by binary long division, one bit at a time.
+void reference_reduce(const uint8_t input[32], const uint8_t order[32], uint8_t out[32]) {
+  uint8_t remainder[33] = {};
+  for (int bit = 255; bit >= 0; --bit) {
+    unsigned carry = (input[bit / 8] >> (bit % 8)) & 1U;
+    for (size_t index = 0; index < 33; ++index) {
+      const unsigned shifted = (remainder[index] << 1) | carry;
+      remainder[index] = static_cast<uint8_t>(shifted);
+      carry = shifted >> 8;
+    }
+    uint8_t difference[33];
+    unsigned borrow = 0;
+    for (size_t index = 0; index < 33; ++index) {
+      const unsigned value = remainder[index] - (index < 32 ? order[index] : 0U) - borrow;
+      difference[index] = static_cast<uint8_t>(value);
+      borrow = (value >> 8) & 1U;
+    }
+    if (borrow == 0) memcpy(remainder, difference, sizeof(remainder));
+  }
+  memcpy(out, remainder, 32);
+}
+
+bool reduces_like_reference(const uint8_t input[32], const uint8_t order[32]) {
+  uint8_t expected[32];
+  uint8_t actual[32];
+  reference_reduce(input, order, expected);
+  local_ed25519_scalar_reduce(input, actual);
+  return memcmp(actual, expected, 32) == 0;
+}
+
+// (left + right) mod l for reduced inputs, whose sum stays below 2^256.
+void reference_add_mod(const uint8_t left[32], const uint8_t right[32], const uint8_t order[32],
+                       uint8_t out[32]) {
+  uint8_t sum[32];
+  unsigned carry = 0;
+  for (size_t index = 0; index < 32; ++index) {
+    const unsigned value = left[index] + right[index] + carry;
+    sum[index] = static_cast<uint8_t>(value);
+    carry = value >> 8;
+  }
+  reference_reduce(sum, order, out);
+}
+
+// (left * right) mod l by double-and-add over the bits of left.
+void reference_mul_mod(const uint8_t left[32], const uint8_t right[32], const uint8_t order[32],
+                       uint8_t out[32]) {
+  uint8_t addend[32];
+  reference_reduce(right, order, addend);
+  memset(out, 0, 32);
+  for (int bit = 255; bit >= 0; --bit) {
+    reference_add_mod(out, out, order, out);
+    if (((left[bit / 8] >> (bit % 8)) & 1) != 0) reference_add_mod(out, addend, order, out);
+  }
+}
+
+bool parse_hex(const char *text, uint8_t out[32]) {
+  for (size_t index = 0; index < 32; ++index) {
+    unsigned value;
+    if (sscanf(text + 2 * index, "%2x", &value) != 1) return false;
+    out[index] = static_cast<uint8_t>(value);
+  }
+  return true;
+}
+
+bool matches_reference(const uint8_t scalar[32]) {
+  uint8_t expected[32];
+  uint8_t actual[32];
+  reference_public_key(scalar, expected);
+  return local_ed25519_public_key(scalar, actual) && memcmp(actual, expected, 32) == 0;
+}
+
+uint32_t next_random(uint32_t *state) {
+  *state = *state * 1664525U + 1013904223U;
+  return *state >> 8;
+}
+
+}  // namespace
+
+int main() {
+  // RFC 8032 section 7.1 tests 1 to 3: the clamped SHA-512 of the secret key
+  // times B is the public key.
+  static const char *const kRfc8032[][2] = {
+      {"9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60",
+       "d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a"},
+      {"4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb",
+       "3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c"},
+      {"c5aa8df43f9f837bedb7442f31dcb7b166d38535076f094b85ce3a2e0b4458f7",
+       "fc51cd8e6218a1a38da47ed00230f0580816ed13ba3303ac5deb911548908025"},
+  };
+  bool passed = true;
+  for (const auto &vector : kRfc8032) {
+    uint8_t secret[32];
+    uint8_t expected[32];
+    uint8_t digest[kLocalSha512DigestSize];
+    uint8_t public_key[32];
+    passed = passed && parse_hex(vector[0], secret) && parse_hex(vector[1], expected);
+    local_sha512(secret, sizeof(secret), digest);
+    digest[0] &= 248;
+    digest[31] = static_cast<uint8_t>((digest[31] & 127) | 64);
+    passed = passed && local_ed25519_public_key(digest, public_key) &&
+             memcmp(public_key, expected, sizeof(expected)) == 0;
+  }
+
+  // Zero, one, l - 1, the largest accepted scalar, and runs of digit 8 that
+  // carry through every window.
+  uint8_t scalar[32] = {};
+  uint8_t point[32];
+  passed = passed && local_ed25519_public_key(scalar, point) && point[0] == 1 &&
+           matches_reference(scalar);
+  scalar[0] = 1;
+  passed = passed && matches_reference(scalar);
+  static const uint8_t kOrderMinusOne[32] = {
+      0xec,0xd3,0xf5,0x5c,0x1a,0x63,0x12,0x58,0xd6,0x9c,0xf7,0xa2,0xde,0xf9,0xde,0x14,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x10,
+  };
+  passed = passed && matches_reference(kOrderMinusOne) &&
+           local_ed25519_scalar_is_valid(kOrderMinusOne) && local_ed25519_scalar_is_valid(scalar);
+  memset(scalar, 0xff, sizeof(scalar));
+  scalar[31] = 0x7f;
+  passed = passed && matches_reference(scalar) && !local_ed25519_scalar_is_valid(scalar);
+  memset(scalar, 0x88, sizeof(scalar));
+  scalar[31] = 0x08;
+  passed = passed && matches_reference(scalar);
+  scalar[31] = 0x80;
+  passed = passed && !local_ed25519_public_key(scalar, point);
+  uint8_t order[32];
+  memcpy(order, kOrderMinusOne, sizeof(order));
+  order[0] = 0xed;
+  memset(scalar, 0, sizeof(scalar));
+  passed = passed && !local_ed25519_scalar_is_valid(order) && !local_ed25519_scalar_is_valid(scalar);
+
+  // Reduction mod l: l itself, its neighbours, 2^256 - 1 and the multiples
+  // of l nearest the top, where both folds carry.
+  passed = passed && reduces_like_reference(order, order) &&
+           reduces_like_reference(kOrderMinusOne, order);
+  uint8_t reduced[32];
+  local_ed25519_scalar_reduce(order, reduced);
+  passed = passed && memcmp(reduced, scalar, sizeof(reduced)) == 0;
+  for (uint8_t multiple = 1; multiple <= 15; ++multiple) {
+    uint8_t value[32];
+    unsigned carry = 0;
+    for (size_t index = 0; index < 32; ++index) {
+      const unsigned product = order[index] * multiple + carry;
+      value[index] = static_cast<uint8_t>(product);
+      carry = product >> 8;
+    }
+    passed = passed && reduces_like_reference(value, order);
+    value[0] = static_cast<uint8_t>(value[0] - 1);
+    passed = passed && reduces_like_reference(value, order);
+  }
+  memset(scalar, 0xff, sizeof(scalar));
+  passed = passed && reduces_like_reference(scalar, order);
+
+  uint32_t state = 0x25519u;
+  for (size_t round = 0; passed && round < 256; ++round) {
+    for (uint8_t &byte : scalar) byte = static_cast<uint8_t>(next_random(&state));
+    passed = reduces_like_reference(scalar, order);
+    scalar[31] &= 0x7f;
+    passed = passed && matches_reference(scalar);
+  }
+  // Products mod l, from the largest inputs down to random ones.
+  uint8_t product[32];
+  uint8_t expected_product[32];
+  memset(scalar, 0xff, sizeof(scalar));
+  local_ed25519_scalar_mul(scalar, scalar, product);
+  reference_mul_mod(scalar, scalar, order, expected_product);
+  passed = passed && memcmp(product, expected_product, sizeof(product)) == 0;
+  local_ed25519_scalar_mul(kOrderMinusOne, kOrderMinusOne, product);
+  reference_mul_mod(kOrderMinusOne, kOrderMinusOne, order, expected_product);
+  passed = passed && memcmp(product, expected_product, sizeof(product)) == 0 && product[0] == 1;
+  for (size_t round = 0; passed && round < 256; ++round) {
+    uint8_t other[32];
+    for (uint8_t &byte : scalar) byte = static_cast<uint8_t>(next_random(&state));
+    for (uint8_t &byte : other) byte = static_cast<uint8_t>(next_random(&state));
+    local_ed25519_scalar_mul(scalar, other, product);
+    reference_mul_mod(scalar, other, order, expected_product);
+    passed = memcmp(product, expected_product, sizeof(product)) == 0;
+  }
+
+  // Tweaked and scaled batches around P = b * B must match (b + t) * B and
+  // k * (b + t) * B from the reference ladder.
+  uint8_t spend[32];
+  uint8_t scale[32];
+  uint8_t spend_public[32];
+  uint8_t tweaks[kLocalEd25519MaxBatch * 32];
+  uint8_t tweaked[kLocalEd25519MaxBatch * 32];
+  uint8_t scaled[kLocalEd25519MaxBatch * 32];
+  LocalEd25519TweakBase base;
+  for (size_t round = 0; passed && round < 4; ++round) {
+    for (uint8_t &byte : scalar) byte = static_cast<uint8_t>(next_random(&state));
+    local_ed25519_scalar_reduce(scalar, spend);
+    for (uint8_t &byte : scalar) byte = static_cast<uint8_t>(next_random(&state));
+    local_ed25519_scalar_reduce(scalar, scale);
+    for (size_t index = 0; index < kLocalEd25519MaxBatch; ++index) {
+      for (uint8_t &byte : scalar) byte = static_cast<uint8_t>(next_random(&state));
+      local_ed25519_scalar_reduce(scalar, tweaks + index * 32);
+    }
+    const size_t count = round == 0 ? 1 : kLocalEd25519MaxBatch - round;
+    passed = local_ed25519_public_key(spend, spend_public) &&
+             local_ed25519_tweak_base_init(&base, spend_public, scale) &&
+             local_ed25519_tweak_add_scale_batch(base, tweaks, count, tweaked, scaled);
+    for (size_t index = 0; passed && index < count; ++index) {
+      uint8_t sum[32];
+      uint8_t expected[32];
+      reference_add_mod(spend, tweaks + index * 32, order, sum);
+      reference_public_key(sum, expected);
+      passed = memcmp(tweaked + index * 32, expected, 32) == 0;
+      reference_mul_mod(scale, sum, order, sum);
+      reference_public_key(sum, expected);
+      passed = passed && memcmp(scaled + index * 32, expected, 32) == 0;
+    }
+  }
+  // y = 2 has no x on the curve, y = p is not canonical and y = 1 with the
+  // sign bit set would be a negative zero.
+  uint8_t invalid[32] = {2};
+  passed = passed && !local_ed25519_tweak_base_init(&base, invalid, scale);
+  memset(invalid, 0xff, sizeof(invalid));
+  invalid[0] = 0xed;
+  invalid[31] = 0x7f;
+  passed = passed && !local_ed25519_tweak_base_init(&base, invalid, scale);
+  memset(invalid, 0, sizeof(invalid));
+  invalid[0] = 1;
+  invalid[31] = 0x80;
+  passed = passed && !local_ed25519_tweak_base_init(&base, invalid, scale);
+  invalid[31] = 0;
+  passed = passed && local_ed25519_tweak_base_init(&base, invalid, scale) &&
+           !local_ed25519_tweak_base_init(&base, spend_public, order) &&
+           !local_ed25519_tweak_add_scale_batch(base, tweaks, kLocalEd25519MaxBatch + 1, tweaked,
+                                                scaled);
+  // Without out_scaled only the tweaked keys are written.
+  uint8_t tweaked_only[kLocalEd25519MaxBatch * 32];
+  passed = passed && local_ed25519_tweak_base_init(&base, spend_public, scale) &&
+           local_ed25519_tweak_add_scale_batch(base, tweaks, 3, tweaked, scaled) &&
+           local_ed25519_tweak_add_scale_batch(base, tweaks, 3, tweaked_only, nullptr) &&
+           memcmp(tweaked_only, tweaked, 3 * 32) == 0;
+  tweaks[31] |= 0x80;
+  passed = passed && !local_ed25519_tweak_add_scale_batch(base, tweaks, 1, tweaked, scaled);
+
+  // Derivations 8 * a * (r * B) must match (8 * a * r) * B. Entry 2 is a
+  // point of order 8, which the cofactor sends to the identity, and entry 5
+  // does not decode.
+  static const char kOrderEight[] = "26e8958fc2b227b045c3f489f2ef98f0d5dfac05d3c63339b13802886d53fc05";
+  static const uint8_t kEight[32] = {8};
+  uint8_t points[kLocalEd25519MaxBatch * 32];
+  uint8_t randoms[kLocalEd25519MaxBatch * 32];
+  uint8_t derivations[kLocalEd25519MaxBatch * 32];
+  bool valid[kLocalEd25519MaxBatch];
+  for (size_t round = 0; passed && round < 3; ++round) {
+    for (uint8_t &byte : scalar) byte = static_cast<uint8_t>(next_random(&state));
+    local_ed25519_scalar_reduce(scalar, scale);
+    for (size_t index = 0; index < kLocalEd25519MaxBatch; ++index) {
+      for (uint8_t &byte : scalar) byte = static_cast<uint8_t>(next_random(&state));
+      local_ed25519_scalar_reduce(scalar, randoms + index * 32);
+      reference_public_key(randoms + index * 32, points + index * 32);
+    }
+    passed = parse_hex(kOrderEight, points + 2 * 32);
+    memcpy(points + 5 * 32, invalid, 32);
+    points[5 * 32] = 2;
+    const size_t count = kLocalEd25519MaxBatch - round;
+    passed = passed && local_ed25519_derivation_batch(scale, points, count, derivations, valid);
+    for (size_t index = 0; passed && index < count; ++index) {
+      uint8_t expected[32] = {};
+      if (index == 2) {
+        expected[0] = 1;
+      } else if (index != 5) {
+        reference_mul_mod(scale, randoms + index * 32, order, scalar);
+        reference_mul_mod(kEight, scalar, order, scalar);
+        reference_public_key(scalar, expected);
+      }
+      passed = valid[index] == (index != 5) && memcmp(derivations + index * 32, expected, 32) == 0;
+    }
+  }
+  passed = passed && !local_ed25519_derivation_batch(order, points, 1, derivations, valid) &&
+           !local_ed25519_derivation_batch(scale, points, kLocalEd25519MaxBatch + 1, derivations,
+                                           valid);
+  if (!passed) printf("ed25519 host test failed\n");
+  return passed ? 0 : 1;
+}
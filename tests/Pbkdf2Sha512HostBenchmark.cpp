@@ -0,0 +1,101 @@
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <mbedtls/pkcs5.h>
+
+#include "../local_sha512.h"
+
+namespace {
+
+bool equal_hex(const uint8_t *actual, size_t size, const char *expected) {
+  static constexpr char kHex[] = "0123456789abcdef";
+  for (size_t index = 0; index < size; ++index) {
+    if (kHex[actual[index] >> 4] != expected[index * 2] ||
+        kHex[actual[index] & 0x0f] != expected[index * 2 + 1]) return false;
+  }
+  return expected[size * 2] == '\0';
+}
+
+// The call bip39_seed_from_english() made before the midstate version.
+bool mbedtls_pbkdf2(const uint8_t *password, size_t password_size, const uint8_t *salt,
+                    size_t salt_size, uint32_t iterations, uint8_t *out, size_t out_size) {
+  return mbedtls_pkcs5_pbkdf2_hmac_ext(MBEDTLS_MD_SHA512, password, password_size, salt,
+                                       salt_size, iterations, static_cast<uint32_t>(out_size),
+                                       out) == 0;
+}
+
+template <typename Function>
+double microseconds_per_call(Function function, size_t rounds) {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t round = 0; round < rounds; ++round) function();
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::micro>(elapsed).count() / static_cast<double>(rounds);
+}
+
+}  // namespace
+
+int main() {
+  static const char kMnemonic[] =
+      "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about";
+  static const char kSalt[] = "mnemonicTREZOR";
+  const uint8_t *mnemonic = reinterpret_cast<const uint8_t *>(kMnemonic);
+  const uint8_t *salt = reinterpret_cast<const uint8_t *>(kSalt);
+  uint8_t seed[kLocalSha512DigestSize];
+  uint8_t reference[kLocalSha512DigestSize];
+  uint8_t digest[kLocalSha512DigestSize];
+  local_sha512(reinterpret_cast<const uint8_t *>("abc"), 3, digest);
+  bool passed = equal_hex(digest, sizeof(digest),
+      "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+      "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f");
+  passed = passed && local_pbkdf2_hmac_sha512(mnemonic, sizeof(kMnemonic) - 1, salt,
+                                              sizeof(kSalt) - 1, 2048, seed, sizeof(seed)) &&
+      equal_hex(seed, sizeof(seed),
+          "c55257c360c07c72029aebc1b53c05ed0362ada38ead3e3e9efa3708e5349553"
+          "1f09a6987599d18264c1e1c92f2cf141630c7a3c4ab7c81b2f001698e7463b04");
+  passed = passed && mbedtls_pbkdf2(mnemonic, sizeof(kMnemonic) - 1, salt, sizeof(kSalt) - 1,
+                                    2048, reference, sizeof(reference)) &&
+      memcmp(seed, reference, sizeof(seed)) == 0;
+  // Output spanning two blocks, and a password longer than the block size.
+  uint8_t long_password[200];
+  uint8_t wide[80];
+  uint8_t wide_reference[sizeof(wide)];
+  for (size_t index = 0; index < sizeof(long_password); ++index) {
+    long_password[index] = static_cast<uint8_t>(index);
+  }
+  passed = passed && local_pbkdf2_hmac_sha512(reinterpret_cast<const uint8_t *>("password"), 8,
+                                              reinterpret_cast<const uint8_t *>("salt"), 4, 2,
+                                              wide, sizeof(wide)) &&
+      equal_hex(wide, sizeof(wide),
+          "e1d9c16aa681708a45f5c7c4e215ceb66e011a2e9f0040713f18aefdb866d53c"
+          "f76cab2868a39b9f7840edce4fef5a82be67335c77a6068e04112754f27ccf4e"
+          "473e311ad827b68945f4e2dddb204c78") &&
+      local_pbkdf2_hmac_sha512(long_password, sizeof(long_password), salt, sizeof(kSalt) - 1, 3,
+                               wide, sizeof(wide)) &&
+      equal_hex(wide, sizeof(wide),
+          "05a372ba0d9a13d51448184b6f131ff4267fec60e3d244ef53c59d944bb06101"
+          "89f450290df05f5d74e8ceca0693b9c0364f1223774a49c3170842d9d4012ac5"
+          "0db01811381d525492bb66e8f048b429") &&
+      mbedtls_pbkdf2(long_password, sizeof(long_password), salt, sizeof(kSalt) - 1, 3,
+                     wide_reference, sizeof(wide_reference)) &&
+      memcmp(wide, wide_reference, sizeof(wide)) == 0 &&
+      !local_pbkdf2_hmac_sha512(mnemonic, 1, salt, 1, 0, wide, sizeof(wide));
+  if (!passed) {
+    printf("pbkdf2-sha512 host test failed\n");
+    return 1;
+  }
+
+  constexpr size_t kRounds = 20;
+  const double midstate = microseconds_per_call([&] {
+    local_pbkdf2_hmac_sha512(mnemonic, sizeof(kMnemonic) - 1, salt, sizeof(kSalt) - 1, 2048,
+                             seed, sizeof(seed));
+  }, kRounds);
+  const double mbedtls = microseconds_per_call([&] {
+    mbedtls_pbkdf2(mnemonic, sizeof(kMnemonic) - 1, salt, sizeof(kSalt) - 1, 2048, reference,
+                   sizeof(reference));
+  }, kRounds);
+  printf("bip39 seed, 2048 iterations: midstate %.0f us, mbedtls %.0f us (%.2fx)\n",
+         midstate, mbedtls, mbedtls / midstate);
+  return 0;
+}
@@ -0,0 +1,151 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../local_secp256k1.h"
+
+namespace {
+
+bool equal_hex(const uint8_t *actual, size_t size, const char *expected) {
+  static constexpr char kHex[] = "0123456789abcdef";
+  for (size_t index = 0; index < size; ++index) {
+    if (kHex[actual[index] >> 4] != expected[index * 2] ||
+        kHex[actual[index] & 0x0f] != expected[index * 2 + 1]) return false;
+  }
+  return expected[size * 2] == '\0';
+}
+
+// Deterministic filler so the consistency checks cover many limb patterns.
+void fill_scalar(uint32_t *state, uint8_t out[kLocalSecp256k1ScalarSize]) {
+  for (size_t index = 0; index < kLocalSecp256k1ScalarSize; ++index) {
+    *state = *state * 1664525U + 1013904223U;
+    out[index] = static_cast<uint8_t>(*state >> 24);
+  }
+}
+
+}  // namespace
+
+int main() {
+  static const uint8_t kOne[32] = {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+  };
+  static const uint8_t kThree[32] = {
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
+  };
+  static const uint8_t kOrderMinusOne[32] = {
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,
+      0xba,0xae,0xdc,0xe6,0xaf,0x48,0xa0,0x3b,0xbf,0xd2,0x5e,0x8c,0xd0,0x36,0x41,0x40,
+  };
+  static const uint8_t kOrder[32] = {
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,
+      0xba,0xae,0xdc,0xe6,0xaf,0x48,0xa0,0x3b,0xbf,0xd2,0x5e,0x8c,0xd0,0x36,0x41,0x41,
+  };
+  static const uint8_t kTopBit[32] = {
+      0x80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  };
+  static const uint8_t kZero[32] = {};
+  uint8_t compressed[kLocalSecp256k1CompressedSize];
+  uint8_t uncompressed[kLocalSecp256k1UncompressedSize];
+  bool passed =
+      local_secp256k1_public_key(kOne, true, compressed) &&
+      equal_hex(compressed, sizeof(compressed),
+                "0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798") &&
+      local_secp256k1_public_key(kThree, true, compressed) &&
+      equal_hex(compressed, sizeof(compressed),
+                "02f9308a019258c31049344f85f89d5229b531c845836f99b08601f113bce036f9") &&
+      local_secp256k1_public_key(kOrderMinusOne, true, compressed) &&
+      equal_hex(compressed, sizeof(compressed),
+                "0379be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798") &&
+      local_secp256k1_public_key(kTopBit, false, uncompressed) &&
+      equal_hex(uncompressed, sizeof(uncompressed),
+                "04b23790a42be63e1b251ad6c94fdef07271ec0aada31db6c3e8bd32043f8be384"
+                "fc6b694919d55edbe8d50f88aa81f94517f004f4149ecb58d10a473deb19880e") &&
+      local_secp256k1_public_key_is_valid(uncompressed, sizeof(uncompressed)) &&
+      !local_secp256k1_public_key(kZero, true, compressed) &&
+      !local_secp256k1_public_key(kOrder, true, compressed) &&
+      !local_secp256k1_scalar_is_valid(kOrder);
+
+  // RFC 6979 HMAC-SHA256 nonce for this key and digest; r and s are the
+  // firmware's run_secp256k1_self_test vector.
+  static const uint8_t kPrivateKey[32] = {
+      0x61,0x9c,0x33,0x50,0x25,0xc7,0xf4,0x01,0x2e,0x55,0x6c,0x2a,0x58,0xb2,0x50,0x6e,
+      0x30,0xb8,0x51,0x1b,0x53,0xad,0xe9,0x5e,0xa3,0x16,0xfd,0x8c,0x32,0x86,0xfe,0xb9,
+  };
+  static const uint8_t kDigest[32] = {
+      0xc3,0x7a,0xf3,0x11,0x16,0xd1,0xb2,0x7c,0xaf,0x68,0xaa,0xe9,0xe3,0xac,0x82,0xf1,
+      0x47,0x79,0x29,0x01,0x4d,0x5b,0x91,0x76,0x57,0xd0,0xeb,0x49,0x47,0x8c,0xb6,0x70,
+  };
+  static const uint8_t kNonce[32] = {
+      0xcb,0xd4,0x9f,0xeb,0x99,0x1f,0x95,0x88,0x4c,0xea,0x7f,0xd8,0x94,0x35,0x45,0x20,
+      0x73,0x9d,0xdb,0xc2,0x63,0x5c,0xdb,0x0b,0x1f,0xa1,0x87,0x6f,0x17,0x1e,0x16,0x8d,
+  };
+  uint8_t r[32];
+  uint8_t s[32];
+  uint8_t recovery_id = 0xff;
+  uint8_t verified_id = 0xff;
+  passed = passed && local_secp256k1_sign(kPrivateKey, kDigest, kNonce, r, s, &recovery_id) &&
+      equal_hex(r, sizeof(r), "3609e17b84f6a7d30c80bfa610b5b4542f32a8a0d5447a12fb1366d7f01cc44a") &&
+      equal_hex(s, sizeof(s), "573a954c4518331561406f90300e8f3358f51928d43c212a8caed02de67eebee") &&
+      recovery_id == 0 && local_secp256k1_public_key(kPrivateKey, true, compressed) &&
+      equal_hex(compressed, sizeof(compressed),
+                "025476c2e83188368da1ff3e292e7acafcdb3566bb0ad253f62fc70f07aeee6357") &&
+      local_secp256k1_verify(compressed, sizeof(compressed), kDigest, r, s, &verified_id) &&
+      verified_id == recovery_id && !local_secp256k1_sign(kPrivateKey, kDigest, kZero, r, s, &recovery_id);
+  uint8_t tampered[32];
+  memcpy(tampered, kDigest, sizeof(tampered));
+  tampered[31] ^= 1;
+  passed = passed && !local_secp256k1_verify(compressed, sizeof(compressed), tampered, r, s, nullptr);
+
+  // (a + t) * G must equal a * G + t * G, and signatures must verify under the
+  // signer's key, across scalars with and without the top bit set.
+  uint32_t state = 0x5eed;
+  for (size_t round = 0; passed && round < 32; ++round) {
+    uint8_t a[32];
+    uint8_t t[32];
+    uint8_t sum[32];
+    uint8_t tweaked[kLocalSecp256k1CompressedSize];
+    uint8_t direct[kLocalSecp256k1CompressedSize];
+    fill_scalar(&state, a);
+    fill_scalar(&state, t);
+    if (!local_secp256k1_scalar_is_valid(a) || !local_secp256k1_scalar_is_valid(t)) continue;
+    passed = local_secp256k1_public_key(a, true, compressed) &&
+             local_secp256k1_public_key_tweak_add(compressed, t, tweaked) &&
+             local_secp256k1_scalar_add(a, t, sum) &&
+             local_secp256k1_public_key(sum, true, direct) &&
+             memcmp(tweaked, direct, sizeof(direct)) == 0 &&
+             local_secp256k1_sign(a, t, sum, r, s, &recovery_id) &&
+             (s[0] & 0x80) == 0 &&
+             local_secp256k1_verify(compressed, sizeof(compressed), t, r, s, &verified_id) &&
+             verified_id == recovery_id;
+  }
+  // A batch must match the single steps key for key, in both encodings.
+  uint8_t tweaks[kLocalSecp256k1MaxBatch * 32];
+  uint8_t batch[kLocalSecp256k1MaxBatch * kLocalSecp256k1UncompressedSize];
+  uint8_t single[kLocalSecp256k1CompressedSize];
+  uint8_t parent_key[32];
+  fill_scalar(&state, parent_key);
+  passed = passed && local_secp256k1_public_key(parent_key, true, compressed);
+  for (size_t count = 1; passed && count <= kLocalSecp256k1MaxBatch; count += 5) {
+    for (size_t index = 0; index < count; ++index) fill_scalar(&state, tweaks + index * 32);
+    passed = local_secp256k1_public_key_tweak_add_batch(compressed, tweaks, count, true, batch);
+    for (size_t index = 0; passed && index < count; ++index) {
+      passed = local_secp256k1_public_key_tweak_add(compressed, tweaks + index * 32, single) &&
+               memcmp(batch + index * kLocalSecp256k1CompressedSize, single, sizeof(single)) == 0;
+    }
+    passed = passed &&
+             local_secp256k1_public_key_tweak_add_batch(compressed, tweaks, count, false, batch) &&
+             (batch[(count - 1) * kLocalSecp256k1UncompressedSize + 64] & 1) == (single[0] & 1) &&
+             memcmp(batch + (count - 1) * kLocalSecp256k1UncompressedSize + 1, single + 1, 32) == 0;
+  }
+
+  // Tweaking a * G by n - a reaches the point at infinity and must fail.
+  uint8_t negated[32];
+  passed = passed && local_secp256k1_public_key(kOne, true, compressed) &&
+           !local_secp256k1_public_key_tweak_add(compressed, kOrderMinusOne, negated) &&
+           !local_secp256k1_scalar_add(kOne, kOrderMinusOne, negated);
+  memcpy(tweaks, kOne, 32);
+  memcpy(tweaks + 32, kOrderMinusOne, 32);
+  passed = passed && !local_secp256k1_public_key_tweak_add_batch(compressed, tweaks, 2, true, batch);
+  if (!passed) printf("secp256k1 host test failed\n");
+  return passed ? 0 : 1;
+}
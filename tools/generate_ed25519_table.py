@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""Generates local_ed25519_table.h, the fixed-base table for local_ed25519.
+
+Entry [window][digit] holds (digit + 1) * 256^window * B in precomputed form:
+y + x, y - x and 2 * d * x * y, each as ten radix-2^25.5 limbs.
+"""
+
+import sys
+
+P = 2**255 - 19
+D = -121665 * pow(121666, P - 2, P) % P
+BY = 4 * pow(5, P - 2, P) % P
+WINDOWS = 32
+DIGITS = 8
+LIMB_BITS = [26, 25] * 5
+
+
+def recover_x(y):
+    xx = (y * y - 1) * pow(D * y * y + 1, P - 2, P) % P
+    x = pow(xx, (P + 3) // 8, P)
+    if (x * x - xx) % P != 0:
+        x = x * pow(2, (P - 1) // 4, P) % P
+    return P - x if x & 1 else x
+
+
+def add(a, b):
+    x1, y1 = a
+    x2, y2 = b
+    t = D * x1 * x2 * y1 * y2 % P
+    x = (x1 * y2 + x2 * y1) * pow(1 + t, P - 2, P) % P
+    y = (y1 * y2 + x1 * x2) * pow(1 - t, P - 2, P) % P
+    return x, y
+
+
+def limbs(value):
+    out = []
+    for bits in LIMB_BITS:
+        out.append(value & ((1 << bits) - 1))
+        value >>= bits
+    return ", ".join("%d" % limb for limb in out)
+
+
+def main():
+    lines = [
+        "// Generated by tools/generate_ed25519_table.py. Do not edit.",
+        "#ifndef HEXWALLET_LOCAL_ED25519_TABLE_H",
+        "#define HEXWALLET_LOCAL_ED25519_TABLE_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "constexpr int32_t kLocalEd25519BaseTable[%d][%d][3][10] = {" % (WINDOWS, DIGITS),
+    ]
+    base = (recover_x(BY), BY)
+    for window in range(WINDOWS):
+        lines.append("    {")
+        point = base
+        for _ in range(DIGITS):
+            x, y = point
+            lines.append("        {{%s},\n         {%s},\n         {%s}}," % (
+                limbs((y + x) % P), limbs((y - x) % P), limbs(2 * D * x * y % P)))
+            point = add(point, base)
+        lines.append("    },")
+        for _ in range(8):
+            base = add(base, base)
+    lines += ["};", "", "#endif", ""]
+    sys.stdout.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()